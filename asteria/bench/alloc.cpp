@@ -0,0 +1,76 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/genius_collector.hpp"
+#include "../src/runtime/variable.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Bench_Suite suite("alloc");
+
+    // Allocate and free variables one by one. The same block is reused every time.
+    suite.run("churn_1m",
+      [&] {
+        for(long k = 0;  k < 1000000;  ++k)
+          ::rocket::make_refcnt<Variable>()->initialize(V_integer(k), false);
+      });
+
+    // Allocate a large number of variables, then free all of them. Slabs are allocated and
+    // returned as a whole.
+    suite.run("batch_100k",
+      [&] {
+        cow_vector<rcptr<Variable>> vars;
+        vars.reserve(100000);
+        for(long k = 0;  k < 100000;  ++k)
+          vars.emplace_back(::rocket::make_refcnt<Variable>());
+      });
+
+    // Enumerate variables that have been allocated together.
+    {
+      cow_vector<rcptr<Variable>> vars;
+      for(long k = 0;  k < 100000;  ++k) {
+        auto var = ::rocket::make_refcnt<Variable>();
+        var->initialize(V_integer(k), false);
+        vars.emplace_back(::std::move(var));
+      }
+      suite.run("scan_100k",
+        [&] {
+          int64_t sum = 0;
+          for(const auto& var : vars)
+            sum += var->get_value().as_integer();
+          ROCKET_ASSERT(sum == INT64_C(4999950000));
+        });
+    }
+
+    // Run scripts that create a lot of short-lived variables.
+    Global_Context global;
+    Simple_Script code;
+    code.reload_string(::rocket::sref(
+      R"__(
+        var sum = 0;
+        for(var i = 0;  i < 200000;  ++i) {
+          var a = i;
+          var b = a + 1;
+          sum += b;
+        }
+        return sum;
+      )__"), ::rocket::sref("locals"));
+    suite.run("script_locals_200k", [&] { code.execute(global);  });
+
+    code.reload_string(::rocket::sref(
+      R"__(
+        var fs = [];
+        for(var i = 0;  i < 50000;  ++i) {
+          var x = i;
+          fs[$] = func() { return x;  };
+        }
+        fs = null;
+        std.system.gc_collect();
+      )__"), ::rocket::sref("closures"));
+    suite.run("script_closures_50k", [&] { code.execute(global);  });
+  }
@@ -0,0 +1,24 @@
+#!/bin/bash -e
+
+# This script builds Asteria twice, with and without threaded dispatch of AVMC
+# queues, then runs the dispatch benchmark with both builds.
+# Arguments are passed to the benchmark, which may name additional scripts.
+
+srcdir=$(readlink -f "$(dirname "$0")/../..")
+tmpdir=$(mktemp -d)
+trap 'rm -rf "${tmpdir}"' EXIT
+
+export CXXFLAGS=${CXXFLAGS:-"-O2 -g0"}
+
+for conf in enable disable; do
+  mkdir -p "${tmpdir}/${conf}"
+  (cd "${tmpdir}/${conf}" &&
+    "${srcdir}/configure" --${conf}-computed-goto --disable-static >/dev/null &&
+    make -j$(nproc) >/dev/null &&
+    make -j$(nproc) asteria/bench/dispatch.bench >/dev/null)
+done
+
+for conf in enable disable; do
+  echo "== computed goto: ${conf}d"
+  "${tmpdir}/${conf}/asteria/bench/dispatch.bench" "$@"
+done
@@ -0,0 +1,105 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+
+using namespace asteria;
+
+namespace {
+
+// These scripts resemble the interpreter tests, but run long enough to be timed.
+// Additional scripts may be specified on the command line.
+constexpr char s_corpus[][2][1024] =
+  {
+    { "loop", R"__(
+        var n = 0;
+        for(var i = 0;  i < 1000000;  ++i)
+          if(i % 3 == 0)
+            n += i;
+        return n;
+      )__" },
+
+    { "call", R"__(
+        func add(x, y) { return x + y;  }
+        var n = 0;
+        for(var i = 0;  i < 200000;  ++i)
+          n = add(n, i);
+        return n;
+      )__" },
+
+    { "ptc", R"__(
+        func count(n, r) { return (n == 0) ? r : count(n - 1, r + 1);  }
+        var n = 0;
+        for(var i = 0;  i < 10;  ++i)
+          n += count(10000, 0);
+        return n;
+      )__" },
+
+    { "recursion", R"__(
+        func fib(n) { return (n < 2) ? n : fib(n - 1) + fib(n - 2);  }
+        return fib(22);
+      )__" },
+
+    { "closure", R"__(
+        func make(k) { return func(x) = x * k;  }
+        var f = make(3);
+        var n = 0;
+        for(var i = 0;  i < 200000;  ++i)
+          n += f(i) & 0xFFFF;
+        return n;
+      )__" },
+
+    { "array", R"__(
+        var a = [ ];
+        for(var i = 0;  i < 20000;  ++i)
+          a[$] = i;
+        var n = 0;
+        for(each k, v : a)
+          n += v - k;
+        return n;
+      )__" },
+
+    { "object", R"__(
+        var o = { x: 1, y: 2, z: 3 };
+        var n = 0;
+        for(var i = 0;  i < 200000;  ++i) {
+          o.x += o.y;
+          n += o.z;
+        }
+        return n;
+      )__" },
+
+    { "exception", R"__(
+        var n = 0;
+        for(var i = 0;  i < 20000;  ++i)
+          try
+            throw i;
+          catch(e)
+            n += e;
+        return n;
+      )__" },
+  };
+
+}  // namespace
+
+int main(int argc, char** argv)
+  {
+    Bench_Suite suite("dispatch");
+    Global_Context global;
+
+    // Run embedded scripts.
+    for(const auto& pair : s_corpus) {
+      Simple_Script code;
+      code.reload_string(::rocket::sref(pair[1]), ::rocket::sref(pair[0]));
+      suite.run(pair[0], [&] { code.execute(global);  });
+    }
+
+    // Run scripts from files.
+    for(int k = 1;  k < argc;  ++k) {
+      Simple_Script code;
+      code.reload_file(argv[k]);
+      suite.run(argv[k], [&] { code.execute(global);  });
+    }
+  }
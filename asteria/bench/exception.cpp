@@ -0,0 +1,46 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Bench_Suite suite("exception");
+    Global_Context global;
+
+    // Throw exceptions through nested function calls and catch them at the outermost level.
+    // The function is not tail-recursive, so each call adds backtrace frames. The number of
+    // throws is chosen so that about the same number of calls is made for each depth.
+    Simple_Script code;
+    code.reload_string(::rocket::sref(
+      R"__(
+        func recurse(n) {
+          if(n == 0)
+            throw "boom";
+          return 1 + recurse(n - 1);
+        }
+        var depth = __varg(0);
+        var n = 0;
+        for(var i = 0;  i < 10000 / depth;  ++i)
+          try
+            recurse(depth);
+          catch(e)
+            n += 1;
+        return n;
+      )__"), ::rocket::sref("exception"));
+
+    for(long depth : { 10, 100, 1000 }) {
+      char name[32];
+      ::sprintf(name, "throw_depth_%ld", depth);
+      suite.run(name,
+        [&] {
+          cow_vector<Value> args;
+          args.emplace_back(V_integer(depth));
+          code.execute(global, ::std::move(args));
+        });
+    }
+  }
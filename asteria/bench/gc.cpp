@@ -0,0 +1,180 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/genius_collector.hpp"
+#include "../src/runtime/collector.hpp"
+#include "../src/runtime/gc_workers.hpp"
+#include "../src/runtime/variable.hpp"
+#include "../src/runtime/variable_callback.hpp"
+
+using namespace asteria;
+
+namespace {
+
+// Each node of a graph is an opaque value that references other variables.
+struct Graph_Node
+final
+  : Abstract_Opaque
+  {
+    cow_vector<rcptr<Variable>> edges;
+
+    tinyfmt&
+    describe(tinyfmt& fmt)
+    const override
+      { return fmt << "graph node";  }
+
+    Variable_Callback&
+    enumerate_variables(Variable_Callback& callback)
+    const override
+      {
+        for(const auto& var : this->edges)
+          if(callback.process(var))
+            var->enumerate_variables(callback);
+        return callback;
+      }
+
+    Abstract_Opaque*
+    clone_opt(rcptr<Abstract_Opaque>& output)
+    const override
+      {
+        auto qnew = ::rocket::make_unique<Graph_Node>(*this);
+        output.reset(qnew.get());
+        return qnew.release();
+      }
+  };
+
+// Creates a graph of `nvars` variables, all of which are tracked by `coll`. The graph is a
+// binary tree whose nodes also reference their parents, so all variables are reachable from
+// the root, and every edge is part of a cycle.
+rcptr<Variable>
+do_create_graph(Collector& coll, size_t nvars)
+  {
+    cow_vector<rcptr<Variable>> vars;
+    vars.reserve(nvars);
+    for(size_t k = 0;  k < nvars;  ++k) {
+      auto var = ::rocket::make_refcnt<Variable>();
+      coll.track_variable(var);
+      vars.emplace_back(::std::move(var));
+    }
+
+    for(size_t k = 0;  k < nvars;  ++k) {
+      auto node = ::rocket::make_refcnt<Graph_Node>();
+      for(size_t c = k * 2 + 1;  c < ::rocket::min(k * 2 + 3, nvars);  ++c)
+        node->edges.emplace_back(vars[c]);
+      if(k != 0)
+        node->edges.emplace_back(vars[(k - 1) / 2]);
+      vars.mut(k)->initialize(cow_opaque(::std::move(node)), false);
+    }
+    return vars[0];
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("gc");
+
+    // Mark a large number of live variables. Nothing is collected, so this measures the cost of
+    // a single pass of `Collector::collect_single_opt()` over tracked variables.
+    {
+      Collector coll(nullptr, nullptr, UINT32_MAX);
+      cow_vector<rcptr<Variable>> vars;
+      for(long k = 0;  k < 100000;  ++k) {
+        auto var = ::rocket::make_refcnt<Variable>();
+        var->initialize(V_integer(k), false);
+        coll.track_variable(var);
+        vars.emplace_back(::std::move(var));
+      }
+      suite.run("mark_live_100k", [&] { coll.collect_single_opt();  });
+
+      // Do the same in incremental steps. The first case measures a single pause, and the
+      // second one measures the whole collection.
+      suite.run("step_1000_live_100k",
+        [&] {
+          size_t work = 1000;
+          coll.collect_step_opt(work);
+        });
+      suite.run("steps_live_100k",
+        [&] {
+          coll.cancel_collection();
+          for(;;) {
+            size_t work = 1000;
+            if(coll.collect_step_opt(work) != &coll)
+              break;
+          }
+        });
+    }
+
+    // Mark a graph of one million live variables. This measures the cost of traversing tracked
+    // variables and their children, rather than that of individual ones.
+    {
+      Collector coll(nullptr, nullptr, UINT32_MAX);
+      auto root = do_create_graph(coll, 1000000);
+      suite.run("mark_graph_1m", [&] { coll.collect_single_opt();  });
+
+      // Do it again with multiple threads, which shows how parallel collection scales.
+      static constexpr struct { const char* name; size_t nthreads; } s_threads[] =
+        {
+          { "mark_graph_1m_threads_2", 2 },
+          { "mark_graph_1m_threads_4", 4 },
+          { "mark_graph_1m_threads_8", 8 },
+        };
+      GC_Workers workers;
+      coll.set_workers(&workers);
+      for(const auto& r : s_threads) {
+        workers.set_parallelism(r.nthreads);
+        suite.run(r.name, [&] { coll.collect_single_opt();  });
+      }
+      coll.set_workers(nullptr);
+      coll.wipe_out_variables();
+    }
+
+    // Create a graph of one million variables, then collect it after the last external reference
+    // has been dropped. The first case measures the cost of creating the graph alone.
+    suite.run("create_graph_1m",
+      [&] {
+        Collector coll(nullptr, nullptr, UINT32_MAX);
+        do_create_graph(coll, 1000000);
+        coll.wipe_out_variables();
+      });
+    suite.run("collect_graph_1m",
+      [&] {
+        Collector coll(nullptr, nullptr, UINT32_MAX);
+        do_create_graph(coll, 1000000);
+        coll.collect_single_opt();
+        ROCKET_ASSERT(coll.count_tracked_variables() == 0);
+      });
+
+    // Create live variables in the oldest generation, which triggers collections as its threshold
+    // is exceeded.
+    suite.run("track_oldest_10k",
+      [&] {
+        Genius_Collector gcoll;
+        cow_vector<rcptr<Variable>> vars;
+        for(long k = 0;  k < 10000;  ++k) {
+          auto var = gcoll.create_variable(gc_generation_oldest);
+          var->initialize(V_integer(k), false);
+          vars.emplace_back(::std::move(var));
+        }
+      });
+
+    // Create closures that reference themselves, then collect them.
+    {
+      Global_Context global;
+      Simple_Script code;
+      code.reload_string(::rocket::sref(
+        R"__(
+          var g;
+          for(var i = 0;  i < 20000;  ++i) {
+            var f;
+            f = func() { return f;  };
+            g = f;
+          }
+          std.system.gc_collect();
+        )__"), ::rocket::sref("cycles"));
+      suite.run("collect_cycles_20k", [&] { code.execute(global);  });
+    }
+  }
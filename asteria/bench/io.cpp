@@ -0,0 +1,88 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include <fcntl.h>  // ::open()
+#include <clocale>  // ::setlocale()
+#include <unistd.h>  // ::dup2()
+
+using namespace asteria;
+
+namespace {
+
+void
+do_pipe_through(Simple_Script& code, Global_Context& global, int ifd, int ofd)
+  {
+    // Redirect standard input and output. Running the script reopens them, so it
+    // always reads from the beginning of the input file.
+    int saved_out = ::dup(STDOUT_FILENO);
+    ::fflush(stdout);
+    if((::dup2(ifd, STDIN_FILENO) < 0) || (::dup2(ofd, STDOUT_FILENO) < 0))
+      ASTERIA_TERMINATE("Could not redirect standard streams");
+
+    code.execute(global);
+
+    // Restore standard output, where results are written.
+    ::fflush(stdout);
+    ::dup2(saved_out, STDOUT_FILENO);
+    ::close(saved_out);
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("io");
+
+    // Select the same locale as the interpreter.
+    ::setlocale(LC_ALL, "C.UTF-8");
+
+    // Generate log lines, a few of which contain non-ASCII characters. The size of input
+    // is 64 MiB by default, and may be overridden with `ASTERIA_BENCH_PIPE_MB`, such as
+    // 1024 for 1 GiB.
+    long nmbytes = 64;
+    if(const char* str = ::getenv("ASTERIA_BENCH_PIPE_MB"))
+      nmbytes = ::std::max(::std::strtol(str, nullptr, 10), 1L);
+
+    ::rocket::unique_posix_file fin(::tmpfile(), ::fclose);
+    if(!fin)
+      ASTERIA_TERMINATE("Could not create input file");
+    char line[256];
+    for(long k = 0;  ::ftell(fin) < nmbytes * 1048576;  ++k) {
+      ::std::sprintf(line, "2020-10-18T12:%02ld:%02ld.%03ldZ [%s] worker-%ld: request %ld %s\n",
+                     k / 60000 % 60, k / 1000 % 60, k % 1000, (k % 7 == 0) ? "WARN" : "INFO",
+                     k % 16, k, (k % 64 == 63) ? "caf\xC3\xA9 \xE2\x98\x95 served" : "completed in 12 ms");
+      ::fputs(line, fin);
+    }
+    ::fflush(fin);
+
+    int ofd = ::open("/dev/null", O_WRONLY);
+    if(ofd < 0)
+      ASTERIA_TERMINATE("Could not open '/dev/null'");
+
+    Global_Context global;
+
+    // Copy text line by line, like a log filter does.
+    Simple_Script lines;
+    lines.reload_string(::rocket::sref(
+      R"__(
+        var line;
+        while((line = std.io.getln()) != null)
+          std.io.putln(line);
+      )__"), ::rocket::sref("lines"));
+    suite.run("pipe_getln_putln", [&] { do_pipe_through(lines, global, ::fileno(fin), ofd);  });
+
+    // Copy bytes in large blocks. This is the upper bound of throughput.
+    Simple_Script bytes;
+    bytes.reload_string(::rocket::sref(
+      R"__(
+        var data;
+        while((data = std.io.read(65536)) != null)
+          std.io.write(data);
+      )__"), ::rocket::sref("bytes"));
+    suite.run("pipe_read_write", [&] { do_pipe_through(bytes, global, ::fileno(fin), ofd);  });
+
+    ::close(ofd);
+  }
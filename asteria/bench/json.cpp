@@ -0,0 +1,61 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/library/json.hpp"
+#include "../src/compiler/token_stream.hpp"
+#include "../src/value.hpp"
+
+using namespace asteria;
+
+namespace {
+
+cow_string
+do_make_document(long nrecords)
+  {
+    // Build a document that resembles a log bundle: an array of small objects with strings,
+    // numbers, nested arrays and the occasional escape sequence.
+    ::rocket::tinyfmt_str fmt;
+    fmt << "[\n";
+    for(long k = 0;  k < nrecords;  ++k)
+      fmt << "  { \"id\": " << k << ", \"time\": " << (static_cast<double>(k) * 1.375) << ", \"level\": \"info\", "
+          << "\"message\": \"request #" << k << " served from cache in \\u00B5s\\t(ok)\", "
+          << "\"tags\": [ \"http\", \"cache\", " << (k % 17) << " ], \"error\": null },\n";
+    fmt << "  { }\n]\n";
+    return fmt.extract_string();
+  }
+
+}  // namespace
+
+int main(int argc, char** argv)
+  {
+    Bench_Suite suite("json");
+
+    long nrecords = 20000;
+    if(argc > 1)
+      nrecords = ::std::max(::std::strtol(argv[1], nullptr, 10), 1L);
+
+    auto text = do_make_document(nrecords);
+
+    // This is how `std.json.parse()` used to start: tokenizing the whole document with the lexer
+    // of Asteria. Building a value from these tokens took additional time.
+    suite.run("tokenize",
+      [&] {
+        Compiler_Options opts;
+        opts.escapable_single_quotes = true;
+        opts.keywords_as_identifiers = true;
+        opts.integers_as_reals = true;
+
+        ::rocket::tinybuf_str cbuf;
+        cbuf.set_string(text, tinybuf::open_read);
+        Token_Stream tstrm(opts);
+        tstrm.reload(cbuf, ::rocket::sref("<JSON text>"));
+      });
+
+    // This is the dedicated parser.
+    Value value;
+    suite.run("parse", [&] { value = std_json_parse(text);  });
+
+    suite.run("format", [&] { std_json_format(value, nullopt);  });
+    suite.run("format5_indent", [&] { std_json_format5(value, V_integer(2));  });
+  }
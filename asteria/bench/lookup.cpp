@@ -0,0 +1,78 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/llds/reference_dictionary.hpp"
+#include "../src/runtime/reference.hpp"
+#include "../src/value.hpp"
+
+using namespace asteria;
+
+namespace {
+
+cow_vector<phsh_string>
+do_make_names(long count)
+  {
+    // Generate names that look like identifiers and object keys.
+    cow_vector<phsh_string> names;
+    ::rocket::tinyfmt_str fmt;
+    for(long k = 0;  k < count;  ++k) {
+      fmt.clear_string();
+      fmt << "name_" << k;
+      names.emplace_back(fmt.get_string());
+    }
+    return names;
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("lookup");
+    auto names = do_make_names(10000);
+    volatile size_t nfound;
+
+    // Look up every key of an object, as member accesses do.
+    V_object object;
+    for(const auto& name : names)
+      object.try_emplace(name, V_integer(1));
+
+    suite.run("cow_hashmap_find_10k",
+      [&] {
+        size_t n = 0;
+        for(long r = 0;  r < 100;  ++r)
+          for(const auto& name : names)
+            n += object.find(name) != object.end();
+        nfound = n;
+      });
+
+    // Look up every name of a context, as identifier lookups do.
+    Reference_Dictionary dict;
+    for(const auto& name : names) {
+      Reference_root::S_constant xref = { V_integer(1) };
+      dict.open(name) = ::std::move(xref);
+    }
+
+    suite.run("reference_dictionary_get_10k",
+      [&] {
+        size_t n = 0;
+        for(long r = 0;  r < 100;  ++r)
+          for(const auto& name : names)
+            n += dict.get_opt(name) != nullptr;
+        nfound = n;
+      });
+
+    // Look up names that don't exist.
+    auto misses = do_make_names(20000);
+    misses.erase(misses.begin(), misses.begin() + 10000);
+
+    suite.run("reference_dictionary_miss_10k",
+      [&] {
+        size_t n = 0;
+        for(long r = 0;  r < 100;  ++r)
+          for(const auto& name : misses)
+            n += dict.get_opt(name) != nullptr;
+        nfound = n;
+      });
+    static_cast<void>(nfound);
+  }
@@ -0,0 +1,130 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/library/json.hpp"
+#include "../src/value.hpp"
+#include "../rocket/ascii_numget.hpp"
+#include <random>
+
+using namespace asteria;
+
+namespace {
+
+template<typename FuncT>
+cow_string
+do_make_corpus(size_t count, FuncT&& func)
+  {
+    // Numbers are separated by commas, like elements of a JSON array.
+    ::std::mt19937_64 prng(42);
+    cow_string text;
+    char temp[64];
+    for(size_t k = 0;  k < count;  ++k) {
+      func(temp, prng);
+      text.append(temp).push_back(',');
+    }
+    return text;
+  }
+
+cow_string
+do_make_prices(size_t count)
+  {
+    // Generate prices, which have two decimal places, such as `1234.56`.
+    return do_make_corpus(count,
+      [](char* temp, ::std::mt19937_64& prng) {
+        ::std::sprintf(temp, "%d.%02d", static_cast<int>(prng() % 100000),
+                                        static_cast<int>(prng() % 100));
+      });
+  }
+
+cow_string
+do_make_coordinates(size_t count)
+  {
+    // Generate latitudes and longitudes, which have seven decimal places, such as
+    // `-122.4194155`.
+    return do_make_corpus(count,
+      [](char* temp, ::std::mt19937_64& prng) {
+        int64_t micro = static_cast<int64_t>(prng() % 3600000001) - 1800000000;
+        ::std::sprintf(temp, "%.7f", static_cast<double>(micro) / 1.0e7);
+      });
+  }
+
+cow_string
+do_make_timestamps(size_t count)
+  {
+    // Generate UNIX timestamps in seconds, with milliseconds, such as `1603024512.345`.
+    return do_make_corpus(count,
+      [](char* temp, ::std::mt19937_64& prng) {
+        int64_t milli = 1500000000000 + static_cast<int64_t>(prng() % 300000000000);
+        ::std::sprintf(temp, "%lld.%03d", static_cast<long long>(milli / 1000),
+                                          static_cast<int>(milli % 1000));
+      });
+  }
+
+cow_string
+do_make_random(size_t count)
+  {
+    // Generate finite values with all bit patterns, which usually require 17 digits.
+    return do_make_corpus(count,
+      [](char* temp, ::std::mt19937_64& prng) {
+        double value;
+        do {
+          uint64_t bits = prng();
+          ::std::memcpy(&value, &bits, sizeof(value));
+        }
+        while(!::std::isfinite(value));
+        ::std::sprintf(temp, "%.17g", value);
+      });
+  }
+
+void
+do_get_all(const cow_string& text)
+  {
+    ::rocket::ascii_numget numg;
+    double sum = 0;
+    const char* bp = text.data();
+    const char* ep = bp + text.size();
+    while(bp != ep) {
+      double value;
+      numg.parse_F(bp, ep);
+      numg.cast_F(value, -HUGE_VAL, HUGE_VAL);
+      sum += value;
+      bp++;  // comma
+    }
+
+    // Prevent the loop from being optimized away.
+    if(sum == 12345)
+      ::std::abort();
+  }
+
+cow_string
+do_make_json(const cow_string& text)
+  {
+    cow_string json = ::rocket::sref("[");
+    json.append(text);
+    json.mut_back() = ']';
+    return json;
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("numget");
+
+    auto prices = do_make_prices(1000000);
+    auto coords = do_make_coordinates(1000000);
+    auto stamps = do_make_timestamps(1000000);
+    auto random = do_make_random(1000000);
+
+    suite.run("get_prices_1m", [&] { do_get_all(prices);  });
+    suite.run("get_coordinates_1m", [&] { do_get_all(coords);  });
+    suite.run("get_timestamps_1m", [&] { do_get_all(stamps);  });
+    suite.run("get_random_1m", [&] { do_get_all(random);  });
+
+    // This is what `std.json.parse()` does with an array of numbers.
+    auto json_prices = do_make_json(do_make_prices(100000));
+    auto json_coords = do_make_json(do_make_coordinates(100000));
+    suite.run("json_parse_prices_100k", [&] { std_json_parse(json_prices);  });
+    suite.run("json_parse_coordinates_100k", [&] { std_json_parse(json_coords);  });
+  }
@@ -0,0 +1,92 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/library/json.hpp"
+#include "../src/value.hpp"
+#include "../rocket/ascii_numput.hpp"
+#include <random>
+
+using namespace asteria;
+
+namespace {
+
+cow_vector<double>
+do_make_random_reals(size_t count)
+  {
+    // Generate finite values with all bit patterns, which usually require 17 digits.
+    ::std::mt19937_64 prng(42);
+    cow_vector<double> reals;
+    while(reals.size() < count) {
+      uint64_t bits = prng();
+      double value;
+      ::std::memcpy(&value, &bits, sizeof(value));
+      if(::std::isfinite(value))
+        reals.emplace_back(value);
+    }
+    return reals;
+  }
+
+cow_vector<double>
+do_make_short_reals(size_t count)
+  {
+    // Generate values such as prices and measurements, which have few digits.
+    cow_vector<double> reals;
+    for(size_t k = 0;  k < count;  ++k)
+      reals.emplace_back(static_cast<double>(k % 100000) / 100 + static_cast<double>(k / 100000));
+    return reals;
+  }
+
+template<typename FuncT>
+void
+do_put_all(const cow_vector<double>& reals, FuncT&& func)
+  {
+    ::rocket::ascii_numput nump;
+    size_t nchars = 0;
+    for(double value : reals)
+      nchars += func(nump, value).size();
+
+    // Prevent the loop from being optimized away.
+    if(nchars == 0)
+      ::std::abort();
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("numput");
+
+    auto random = do_make_random_reals(1000000);
+    auto simple = do_make_short_reals(1000000);
+
+    suite.run("put_DF_random_1m",
+      [&] {
+        do_put_all(random,
+          [](::rocket::ascii_numput& nump, double value) -> auto& { return nump.put_DF(value);  });
+      });
+    suite.run("put_DE_random_1m",
+      [&] {
+        do_put_all(random,
+          [](::rocket::ascii_numput& nump, double value) -> auto& { return nump.put_DE(value);  });
+      });
+    suite.run("put_DF_short_1m",
+      [&] {
+        do_put_all(simple,
+          [](::rocket::ascii_numput& nump, double value) -> auto& { return nump.put_DF(value);  });
+      });
+    suite.run("put_DF_single_1m",
+      [&] {
+        do_put_all(simple,
+          [](::rocket::ascii_numput& nump, double value) -> auto& {
+            return nump.put_DF(static_cast<double>(static_cast<float>(value)), true);
+          });
+      });
+
+    // This is what `std.json.format()` does with an array of numbers.
+    V_array array;
+    for(size_t k = 0;  k < 100000;  ++k)
+      array.emplace_back(V_real(random[k]));
+    Value value = ::std::move(array);
+    suite.run("json_format_random_100k", [&] { std_json_format(value, nullopt);  });
+  }
@@ -0,0 +1,79 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/llds/regex_automaton.hpp"
+#include <regex>
+
+using namespace asteria;
+
+namespace {
+
+size_t
+do_count_automaton(const char* pattern, const cow_string& text)
+  {
+    Regex_Automaton dfa;
+    if(!dfa.compile(pattern, ::std::strlen(pattern)))
+      ASTERIA_TERMINATE("Pattern `$1` is not supported", pattern);
+
+    // Count non-overlapping matches, like `std::regex_iterator`.
+    size_t count = 0;
+    Regex_Automaton::Submatch subs[8];
+    const char* sp = text.data();
+    const char* ep = sp + text.size();
+    bool prev_avail = false;
+    while(dfa.search(subs, 8, sp, ep, prev_avail)) {
+      count++;
+      sp = subs[0].second + (subs[0].first == subs[0].second);
+      prev_avail = true;
+      if(sp > ep)
+        break;
+    }
+    return count;
+  }
+
+size_t
+do_count_std(const char* pattern, const cow_string& text)
+  {
+    ::std::regex regex(pattern);
+    ::std::cregex_iterator qbegin(text.data(), text.data() + text.size(), regex);
+    return static_cast<size_t>(::std::distance(qbegin, ::std::cregex_iterator()));
+  }
+
+void
+do_compare(Bench_Suite& suite, const char* name, const char* pattern, const cow_string& text)
+  {
+    // Both engines shall agree, then they are measured separately.
+    size_t count = do_count_automaton(pattern, text);
+    if(count != do_count_std(pattern, text))
+      ASTERIA_TERMINATE("Results of `$1` do not agree", name);
+
+    suite.run((cow_string(name) + "_automaton").c_str(), [&] { do_count_automaton(pattern, text);  });
+    suite.run((cow_string(name) + "_std").c_str(), [&] { do_count_std(pattern, text);  });
+  }
+
+}  // namespace
+
+int main()
+  {
+    Bench_Suite suite("regex");
+
+    // Generate 4 MiB of log lines.
+    cow_string text;
+    for(long k = 0;  text.size() < 4194304;  ++k)
+      text += (k % 64 == 63) ? "2020-05-17 12:34:56 GET /index.html HTTP/1.1 200\n"
+                             : "the quick brown fox jumps over the lazy dog\n";
+
+    // Throughput. The first one begins with a literal string which is looked up with
+    // SIMD instructions. The others are run by DFAs, with submatches.
+    do_compare(suite, "literal_4m", "HTTP/\\d\\.\\d", text);
+    do_compare(suite, "class_4m", "\\d{2}:\\d{2}", text);
+    do_compare(suite, "groups_4m", "(\\d{4})-(\\d{2})-(\\d{2}) (\\w+)", text);
+    do_compare(suite, "words_4m", "\\b(fox|dog)\\b", text);
+
+    // Worst cases. Backtracking takes exponential time on the first one. The second one
+    // is quadratic, and deep recursion may overflow the stack of `std::regex` if the
+    // subject is made longer.
+    do_compare(suite, "nested_26", "(a|aa)*b", cow_string(26, 'a'));
+    do_compare(suite, "unmatched_5k", "[ab]*c", cow_string(5000, 'a'));
+  }
@@ -0,0 +1,74 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/library/string.hpp"
+#include "../src/library/checksum.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/regex_cache.hpp"
+#include "../src/value.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Bench_Suite suite("string");
+
+    // Generate 4 MiB of text with a few non-ASCII characters.
+    V_string text;
+    for(long k = 0;  text.size() < 4194304;  ++k)
+      text += (k % 64 == 63) ? "caf\xC3\xA9 au lait, s'il vous pla\xC3\xAEt\n" : "the quick brown fox jumps over the lazy dog\n";
+
+    // Kernels of `std.string`. Results are discarded.
+    suite.run("find", [&] { std_string_find(text, 0, nullopt, ::rocket::sref("lazy cat"));  });
+
+    // These are quadratic at the moment, so only a slice is used.
+    auto slice = text.substr(0, 65536);
+    suite.run("find_and_replace_64k",
+      [&] { std_string_find_and_replace(slice, 0, nullopt, ::rocket::sref("fox"), ::rocket::sref("cat"));  });
+    suite.run("url_encode_64k", [&] { std_string_url_encode(slice, nullopt);  });
+    suite.run("to_upper", [&] { std_string_to_upper(text);  });
+    suite.run("translate", [&] { std_string_translate(text, ::rocket::sref("aeiou"), ::rocket::sref("AEIOU"));  });
+    suite.run("explode", [&] { std_string_explode(text, ::rocket::sref("\n"), nullopt);  });
+    suite.run("hex_encode", [&] { std_string_hex_encode(text, nullopt, nullopt);  });
+    suite.run("base64_encode", [&] { std_string_base64_encode(text);  });
+    suite.run("utf8_validate", [&] { std_string_utf8_validate(text);  });
+
+    // Checksums.
+    suite.run("crc32", [&] { std_checksum_crc32(text);  });
+    suite.run("fnv1a32", [&] { std_checksum_fnv1a32(text);  });
+    suite.run("md5", [&] { std_checksum_md5(text);  });
+    suite.run("sha1", [&] { std_checksum_sha1(text);  });
+    suite.run("sha256", [&] { std_checksum_sha256(text);  });
+
+    // Build a 10 MB string piece by piece in a script, like a template engine does.
+    Global_Context global;
+    Simple_Script code;
+    code.reload_string(::rocket::sref(
+      R"__(
+        var piece = "the quick brown fox jumps over the lazy dog\n" * 2;
+        var str = "";
+        while(countof str < 10000000)
+          str += piece;
+        return countof str;
+      )__"), ::rocket::sref("append"));
+    suite.run("script_append_10m", [&] { code.execute(global);  });
+
+    // Match log lines against the same few patterns, with and without the cache of
+    // compiled patterns.
+    code.reload_string(::rocket::sref(
+      R"__(
+        var n = 0;
+        for(var i = 0;  i < 10000;  ++i) {
+          if(std.string.regex_match("2020-05-17 12:34:56", '(\d{4})-(\d{2})-(\d{2}) (\d{2}):(\d{2}):(\d{2})'))
+            ++n;
+          if(std.string.regex_find("GET /index.html HTTP/1.1", 'HTTP/\d\.\d'))
+            ++n;
+        }
+        return n;
+      )__"), ::rocket::sref("regex"));
+    suite.run("script_regex_10k", [&] { code.execute(global);  });
+    global.regex_cache()->set_max_size(0);
+    suite.run("script_regex_10k_uncached", [&] { code.execute(global);  });
+  }
@@ -0,0 +1,134 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_BENCH_UTILITIES_HPP_
+#define ASTERIA_BENCH_UTILITIES_HPP_
+
+#include "../src/fwd.hpp"
+#include "../src/utilities.hpp"
+#include "../rocket/unique_posix_file.hpp"
+#include <chrono>
+
+namespace asteria {
+
+// Each benchmark program creates a suite and runs cases in it. Results are written in the JSON Lines
+// format, one object per case, so they can be collected and compared across builds.
+// The number of warmup runs and repetitions may be overridden with `ASTERIA_BENCH_WARMUP` and
+// `ASTERIA_BENCH_REPS` respectively. If `ASTERIA_BENCH_OUTPUT` is set, results are appended to the
+// file that it designates; otherwise they are written to standard output. Be advised that running
+// scripts reopens standard output, which truncates it if it has been redirected to a file.
+class Bench_Suite
+  {
+  private:
+    const char* m_name;
+    long m_warmup = 1;
+    long m_nreps = 10;
+    ::rocket::unique_posix_file m_file = { nullptr, nullptr };
+    cow_vector<double> m_samples;
+
+  public:
+    explicit
+    Bench_Suite(const char* name)
+      : m_name(name)
+      {
+        if(const char* str = ::getenv("ASTERIA_BENCH_WARMUP"))
+          this->m_warmup = ::std::max(::std::strtol(str, nullptr, 10), 0L);
+
+        if(const char* str = ::getenv("ASTERIA_BENCH_REPS"))
+          this->m_nreps = ::std::max(::std::strtol(str, nullptr, 10), 1L);
+
+        if(const char* str = ::getenv("ASTERIA_BENCH_OUTPUT"))
+          if(!this->m_file.reset(::fopen(str, "a"), ::fclose))
+            ASTERIA_TERMINATE("Could not open benchmark output file '$1'", str);
+      }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Bench_Suite)
+      { }
+
+  private:
+    ::FILE*
+    do_output()
+    const noexcept
+      { return this->m_file ? this->m_file.get() : stdout;  }
+
+    void
+    do_print_string(const char* str)
+    const
+      {
+        ::fputc('\"', this->do_output());
+        for(auto p = str;  *p;  ++p)
+          if((*p == '\"') || (*p == '\\'))
+            ::fprintf(this->do_output(), "\\%c", *p);
+          else if(static_cast<unsigned char>(*p) < 0x20)
+            ::fprintf(this->do_output(), "\\u%.4X", static_cast<unsigned char>(*p));
+          else
+            ::fputc(*p, this->do_output());
+        ::fputc('\"', this->do_output());
+      }
+
+    double
+    do_percentile(double pct)
+    const noexcept
+      {
+        // Use the nearest-rank method. Samples shall have been sorted.
+        auto rank = static_cast<size_t>(::std::ceil(pct / 100 * static_cast<double>(this->m_samples.size())));
+        return this->m_samples[::rocket::clamp(rank, size_t(1), this->m_samples.size()) - 1];
+      }
+
+  public:
+    long
+    warmup()
+    const noexcept
+      { return this->m_warmup;  }
+
+    long
+    repetitions()
+    const noexcept
+      { return this->m_nreps;  }
+
+    template<typename FuncT>
+    Bench_Suite&
+    run(const char* name, FuncT&& func)
+      {
+        for(long k = 0;  k < this->m_warmup;  ++k)
+          func();
+
+        // Take samples in milliseconds.
+        this->m_samples.clear();
+        for(long k = 0;  k < this->m_nreps;  ++k) {
+          auto t0 = ::std::chrono::steady_clock::now();
+          func();
+          auto t1 = ::std::chrono::steady_clock::now();
+          this->m_samples.emplace_back(::std::chrono::duration<double, ::std::milli>(t1 - t0).count());
+        }
+        ::std::sort(this->m_samples.mut_begin(), this->m_samples.mut_end());
+
+        double sum = 0;
+        for(double t : this->m_samples)
+          sum += t;
+        double mean = sum / static_cast<double>(this->m_samples.size());
+        double var = 0;
+        for(double t : this->m_samples)
+          var += (t - mean) * (t - mean);
+        double stddev = ::std::sqrt(var / static_cast<double>(this->m_samples.size()));
+
+        ::FILE* fp = this->do_output();
+        ::fprintf(fp, "{\"suite\":");
+        this->do_print_string(this->m_name);
+        ::fprintf(fp, ",\"case\":");
+        this->do_print_string(name);
+        ::fprintf(fp, ",\"unit\":\"ms\",\"warmup\":%ld,\"repetitions\":%ld,"
+                      "\"min\":%.6f,\"mean\":%.6f,\"stddev\":%.6f,"
+                      "\"p50\":%.6f,\"p90\":%.6f,\"p99\":%.6f,\"max\":%.6f}\n",
+                      this->m_warmup, this->m_nreps,
+                      this->m_samples.front(), mean, stddev,
+                      this->do_percentile(50), this->do_percentile(90), this->do_percentile(99),
+                      this->m_samples.back());
+        ::fflush(fp);
+        return *this;
+      }
+  };
+
+}  // namespace asteria
+
+#endif
@@ -5,6 +5,8 @@
 #include "assert.hpp"
 #include "throw.hpp"
 #include <cmath>
+#include <cfloat>
+#include <cstring>
 
 namespace rocket {
 namespace {
@@ -98,10 +100,56 @@ constexpr int8_t s_digits[] =
      -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
   };
 
+bool
+do_load_digits8(uint64_t& value, const char* rp)
+  {
+    // Load eight characters as a little-endian word.
+    uint64_t word;
+    ::std::memcpy(&word, rp, sizeof(word));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    word = __builtin_bswap64(word);
+#endif
+    // Check whether all of them are decimal digits. The high-order nibble of each
+    // byte must be 3, and adding 6 to the low-order nibble must not carry.
+    if(((word & 0xF0F0F0F0F0F0F0F0) | (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+          != 0x3333333333333333)
+      return false;
+    // Combine adjacent digits, then adjacent pairs, then adjacent quadruples.
+    // The first digit is the most significant one.
+    word -= 0x3030303030303030;
+    word = word * 10 + (word >> 8);
+    word = ((word & 0x000000FF000000FF) * (100 + (UINT64_C(1000000) << 32))
+            + ((word >> 16) & 0x000000FF000000FF) * (1 + (UINT64_C(10000) << 32))) >> 32;
+    value = word;
+    return true;
+  }
+
 size_t
 do_collect_U(mantissa& m, const char*& rp, const char* eptr, uint8_t base, uint64_t limit)
   {
     size_t nread = 0;
+    // A digit can be appended to `value` if the result does not exceed `limit`.
+    // These are calculated beforehand, as divisions are expensive. Divisions by
+    // constants are much cheaper.
+    uint64_t vmax = limit >> 1;
+    uint8_t dmax = static_cast<uint8_t>(limit & 1);
+    if(base == 16) {
+      vmax = limit >> 4;
+      dmax = static_cast<uint8_t>(limit & 15);
+    }
+    // Decimal digits are consumed in groups of eight, as long as they cannot overflow.
+    if(base == 10) {
+      vmax = limit / 10;
+      dmax = static_cast<uint8_t>(limit % 10);
+      uint64_t vmax8 = (limit - 99'999'999) / 100'000'000;
+      uint64_t dval8;
+      while((eptr - rp >= 8) && (m.value <= vmax8) && do_load_digits8(dval8, rp)) {
+        m.value = m.value * 100'000'000 + dval8;
+        nread += 8;
+        rp += 8;
+      }
+    }
+    // Consume remaining digits one by one.
     for(;;) {
       // Get a digit.
       if(rp == eptr) {
@@ -117,7 +165,7 @@ do_collect_U(mantissa& m, const char*& rp, const char* eptr, uint8_t base, uint6
       if((dval == 0) && (m.value == 0)) {
         continue;
       }
-      if(m.value <= (limit - dval) / base) {
+      if((m.value < vmax) || ((m.value == vmax) && (dval <= dmax))) {
         // Append this digit to `value`.
         m.value *= base;
         m.value += dval;
@@ -133,38 +181,60 @@ do_collect_U(mantissa& m, const char*& rp, const char* eptr, uint8_t base, uint6
 
 #if 0
 /* This program is used to generate the multiplier table for decimal
- * numbers. Each multiplier for the mantissa is split into two parts.
- * The base of exponents is 2.
+ * numbers. Each multiplier is the power of five, normalized to 128 bits,
+ * whose MSB is always set. Positive powers are truncated. Negative powers
+ * are rounded upwards if they fit in 128 bits, and truncated otherwise.
+ * The base of exponents is implied by the exponent itself.
  *
  * Compile with:
- *   gcc -std=c99 -W{all,extra,{sign-,}conversion} table.c -lquadmath
+ *   gcc -std=c99 -W{all,extra} table.c -lgmp
 **/
 
-#include <quadmath.h>
+#include <gmp.h>
 #include <stdio.h>
 
 void
 do_print_one(int e)
   {
-    __float128 value, frac;
+    mpz_t value, temp, quot;
     int bexp;
-    long long mant;
-
-    // Calculate the multiplier.
-    value = powq(10, e);
-    // Break it down into the fraction and exponent.
-    frac = frexpq(value, &bexp);
-    // Truncate the fraction to 63 bits. Do not round it.
-    frac = ldexpq(frac, 63);
-    mant = (long long)frac;
-    bexp = bexp + 1;
+    unsigned long long hi, lo;
+
+    mpz_inits(value, temp, quot, NULL);
+    if(e >= 0) {
+      // Calculate the multiplier.
+      mpz_ui_pow_ui(value, 5, (unsigned long)e);
+      // Truncate it to 128 bits. Do not round it.
+      bexp = (int)mpz_sizeinbase(value, 2) - 128;
+      if(bexp >= 0)
+        mpz_tdiv_q_2exp(value, value, (unsigned long)bexp);
+      else
+        mpz_mul_2exp(value, value, (unsigned long)-bexp);
+    }
+    else {
+      // Calculate the reciprocal of the multiplier. If it is not exact in 128 bits,
+      // calculate twice as many bits, so the final result is always truncated.
+      mpz_ui_pow_ui(temp, 5, (unsigned long)-e);
+      bexp = (int)mpz_sizeinbase(temp, 2) + 127;
+      if(e < -27)
+        bexp += (int)mpz_sizeinbase(temp, 2) + 1;
+      mpz_setbit(quot, (unsigned long)bexp);
+      mpz_tdiv_q(value, quot, temp);
+      // Round it upwards, then truncate it to 128 bits.
+      mpz_add_ui(value, value, 1);
+      while(mpz_sizeinbase(value, 2) > 128)
+        mpz_tdiv_q_2exp(value, value, 1);
+    }
     // Print the mantissa in fixed-point format.
-    printf("\t{ 0x%.16llX, ", mant);
-    // Print the exponent in binary.
-    printf("%+5d },", bexp);
+    mpz_tdiv_q_2exp(temp, value, 64);
+    hi = mpz_get_ui(temp);
+    mpz_tdiv_r_2exp(temp, value, 64);
+    lo = mpz_get_ui(temp);
+    printf("\t{ 0x%.16llX, 0x%.16llX },", hi, lo);
 
     // Print some comments.
     printf("  // 1.0e%+.3d\n", e);
+    mpz_clears(value, temp, quot, NULL);
   }
 
 int
@@ -172,7 +242,7 @@ main(void)
   {
     int e;
 
-    for(e = -343; e <= +308; ++e)
+    for(e = -342; e <= +308; ++e)
       do_print_one(e);
 
     return 0;
@@ -182,675 +252,974 @@ main(void)
 // These are generated data. Do not edit by hand!
 struct decmult_F
   {
-    uint64_t mant;
-    int bexp;
+    uint64_t hi;
+    uint64_t lo;
   }
 constexpr s_decmult_F[] =
   {
-    { 0x5F94EE55D417EF57, -1138 },  // 1.0e-343
-    { 0x777A29EB491DEB2D, -1135 },  // 1.0e-342
-    { 0x4AAC5A330DB2B2FC, -1131 },  // 1.0e-341
-    { 0x5D5770BFD11F5FBB, -1128 },  // 1.0e-340
-    { 0x74AD4CEFC56737A9, -1125 },  // 1.0e-339
-    { 0x48EC5015DB6082CA, -1121 },  // 1.0e-338
-    { 0x5B27641B5238A37C, -1118 },  // 1.0e-337
-    { 0x71F13D2226C6CC5B, -1115 },  // 1.0e-336
-    { 0x4736C635583C3FB9, -1111 },  // 1.0e-335
-    { 0x590477C2AE4B4FA7, -1108 },  // 1.0e-334
-    { 0x6F4595B359DE2391, -1105 },  // 1.0e-333
-    { 0x458B7D90182AD63B, -1101 },  // 1.0e-332
-    { 0x56EE5CF41E358BC9, -1098 },  // 1.0e-331
-    { 0x6CA9F43125C2EEBC, -1095 },  // 1.0e-330
-    { 0x43EA389EB799D535, -1091 },  // 1.0e-329
-    { 0x54E4C6C665804A83, -1088 },  // 1.0e-328
-    { 0x6A1DF877FEE05D24, -1085 },  // 1.0e-327
-    { 0x4252BB4AFF4C3A36, -1081 },  // 1.0e-326
-    { 0x52E76A1DBF1F48C4, -1078 },  // 1.0e-325
-    { 0x67A144A52EE71AF5, -1075 },  // 1.0e-324
-    { 0x40C4CAE73D5070D9, -1071 },  // 1.0e-323
-    { 0x50F5FDA10CA48D0F, -1068 },  // 1.0e-322
-    { 0x65337D094FCDB053, -1065 },  // 1.0e-321
-    { 0x7E805C4BA3C11C68, -1062 },  // 1.0e-320
-    { 0x4F1039AF4658B1C1, -1058 },  // 1.0e-319
-    { 0x62D4481B17EEDE31, -1055 },  // 1.0e-318
-    { 0x7B895A21DDEA95BD, -1052 },  // 1.0e-317
-    { 0x4D35D8552AB29D96, -1048 },  // 1.0e-316
-    { 0x60834E6A755F44FC, -1045 },  // 1.0e-315
-    { 0x78A4220512B7163B, -1042 },  // 1.0e-314
-    { 0x4B6695432BB26DE5, -1038 },  // 1.0e-313
-    { 0x5E403A93F69F095E, -1035 },  // 1.0e-312
-    { 0x75D04938F446CBB5, -1032 },  // 1.0e-311
-    { 0x49A22DC398AC3F51, -1028 },  // 1.0e-310
-    { 0x5C0AB9347ED74F26, -1025 },  // 1.0e-309
-    { 0x730D67819E8D22EF, -1022 },  // 1.0e-308
-    { 0x47E860B1031835D5, -1018 },  // 1.0e-307
-    { 0x59E278DD43DE434B, -1015 },  // 1.0e-306
-    { 0x705B171494D5D41E, -1012 },  // 1.0e-305
-    { 0x4638EE6CDD05A492, -1008 },  // 1.0e-304
-    { 0x57C72A0814470DB7, -1005 },  // 1.0e-303
-    { 0x6DB8F48A1958D125, -1002 },  // 1.0e-302
-    { 0x449398D64FD782B7,  -998 },  // 1.0e-301
-    { 0x55B87F0BE3CD6365,  -995 },  // 1.0e-300
-    { 0x6B269ECEDCC0BC3E,  -992 },  // 1.0e-299
-    { 0x42F8234149F875A7,  -988 },  // 1.0e-298
-    { 0x53B62C119C769310,  -985 },  // 1.0e-297
-    { 0x68A3B716039437D5,  -982 },  // 1.0e-296
-    { 0x4166526DC23CA2E5,  -978 },  // 1.0e-295
-    { 0x51BFE70932CBCB9E,  -975 },  // 1.0e-294
-    { 0x662FE0CB7F7EBE86,  -972 },  // 1.0e-293
-    { 0x7FBBD8FE5F5E6E27,  -969 },  // 1.0e-292
-    { 0x4FD5679EFB9B04D8,  -965 },  // 1.0e-291
-    { 0x63CAC186BA81C60E,  -962 },  // 1.0e-290
-    { 0x7CBD71E869223792,  -959 },  // 1.0e-289
-    { 0x4DF6673141B562BB,  -955 },  // 1.0e-288
-    { 0x617400FD9222BB6A,  -952 },  // 1.0e-287
-    { 0x79D1013CF6AB6A45,  -949 },  // 1.0e-286
-    { 0x4C22A0C61A2B226B,  -945 },  // 1.0e-285
-    { 0x5F2B48F7A0B5EB06,  -942 },  // 1.0e-284
-    { 0x76F61B3588E365C7,  -939 },  // 1.0e-283
-    { 0x4A59D101758E1F9C,  -935 },  // 1.0e-282
-    { 0x5CF04541D2F1A783,  -932 },  // 1.0e-281
-    { 0x742C569247AE1164,  -929 },  // 1.0e-280
-    { 0x489BB61B6CCCCADF,  -925 },  // 1.0e-279
-    { 0x5AC2A3A247FFFD96,  -922 },  // 1.0e-278
-    { 0x71734C8AD9FFFCFC,  -919 },  // 1.0e-277
-    { 0x46E80FD6C83FFE1D,  -915 },  // 1.0e-276
-    { 0x58A213CC7A4FFDA5,  -912 },  // 1.0e-275
-    { 0x6ECA98BF98E3FD0E,  -909 },  // 1.0e-274
-    { 0x453E9F77BF8E7E29,  -905 },  // 1.0e-273
-    { 0x568E4755AF721DB3,  -902 },  // 1.0e-272
-    { 0x6C31D92B1B4EA520,  -899 },  // 1.0e-271
-    { 0x439F27BAF1112734,  -895 },  // 1.0e-270
-    { 0x5486F1A9AD557101,  -892 },  // 1.0e-269
-    { 0x69A8AE1418AACD41,  -889 },  // 1.0e-268
-    { 0x42096CCC8F6AC048,  -885 },  // 1.0e-267
-    { 0x528BC7FFB345705B,  -882 },  // 1.0e-266
-    { 0x672EB9FFA016CC71,  -879 },  // 1.0e-265
-    { 0x407D343FC40E3FC7,  -875 },  // 1.0e-264
-    { 0x509C814FB511CFB9,  -872 },  // 1.0e-263
-    { 0x64C3A1A3A25643A7,  -869 },  // 1.0e-262
-    { 0x7DF48A0C8AEBD491,  -866 },  // 1.0e-261
-    { 0x4EB8D647D6D364DA,  -862 },  // 1.0e-260
-    { 0x62670BD9CC883E11,  -859 },  // 1.0e-259
-    { 0x7B00CED03FAA4D95,  -856 },  // 1.0e-258
-    { 0x4CE0814227CA707D,  -852 },  // 1.0e-257
-    { 0x6018A192B1BD0C9C,  -849 },  // 1.0e-256
-    { 0x781EC9F75E2C4FC4,  -846 },  // 1.0e-255
-    { 0x4B133E3A9ADBB1DA,  -842 },  // 1.0e-254
-    { 0x5DD80DC941929E51,  -839 },  // 1.0e-253
-    { 0x754E113B91F745E5,  -836 },  // 1.0e-252
-    { 0x4950CAC53B3A8BAF,  -832 },  // 1.0e-251
-    { 0x5BA4FD768A092E9B,  -829 },  // 1.0e-250
-    { 0x728E3CD42C8B7A42,  -826 },  // 1.0e-249
-    { 0x4798E6049BD72C69,  -822 },  // 1.0e-248
-    { 0x597F1F85C2CCF783,  -819 },  // 1.0e-247
-    { 0x6FDEE76733803564,  -816 },  // 1.0e-246
-    { 0x45EB50A08030215E,  -812 },  // 1.0e-245
-    { 0x576624C8A03C29B6,  -809 },  // 1.0e-244
-    { 0x6D3FADFAC84B3424,  -806 },  // 1.0e-243
-    { 0x4447CCBCBD2F0096,  -802 },  // 1.0e-242
-    { 0x5559BFEBEC7AC0BC,  -799 },  // 1.0e-241
-    { 0x6AB02FE6E79970EB,  -796 },  // 1.0e-240
-    { 0x42AE1DF050BFE693,  -792 },  // 1.0e-239
-    { 0x5359A56C64EFE037,  -789 },  // 1.0e-238
-    { 0x68300EC77E2BD845,  -786 },  // 1.0e-237
-    { 0x411E093CAEDB672B,  -782 },  // 1.0e-236
-    { 0x51658B8BDA9240F6,  -779 },  // 1.0e-235
-    { 0x65BEEE6ED136D134,  -776 },  // 1.0e-234
-    { 0x7F2EAA0A85848581,  -773 },  // 1.0e-233
-    { 0x4F7D2A469372D370,  -769 },  // 1.0e-232
-    { 0x635C74D8384F884D,  -766 },  // 1.0e-231
-    { 0x7C33920E46636A60,  -763 },  // 1.0e-230
-    { 0x4DA03B48EBFE227C,  -759 },  // 1.0e-229
-    { 0x61084A1B26FDAB1B,  -756 },  // 1.0e-228
-    { 0x794A5CA1F0BD15E2,  -753 },  // 1.0e-227
-    { 0x4BCE79E536762DAD,  -749 },  // 1.0e-226
-    { 0x5EC2185E8413B918,  -746 },  // 1.0e-225
-    { 0x76729E762518A75E,  -743 },  // 1.0e-224
-    { 0x4A07A309D72F689B,  -739 },  // 1.0e-223
-    { 0x5C898BCC4CFB42C2,  -736 },  // 1.0e-222
-    { 0x73ABEEBF603A1372,  -733 },  // 1.0e-221
-    { 0x484B75379C244C27,  -729 },  // 1.0e-220
-    { 0x5A5E5285832D5F31,  -726 },  // 1.0e-219
-    { 0x70F5E726E3F8B6FD,  -723 },  // 1.0e-218
-    { 0x4699B0784E7B725E,  -719 },  // 1.0e-217
-    { 0x58401C96621A4EF6,  -716 },  // 1.0e-216
-    { 0x6E5023BBFAA0E2B3,  -713 },  // 1.0e-215
-    { 0x44F216557CA48DB0,  -709 },  // 1.0e-214
-    { 0x562E9BEADBCDB11C,  -706 },  // 1.0e-213
-    { 0x6BBA42E592C11D63,  -703 },  // 1.0e-212
-    { 0x435469CF7BB8B25E,  -699 },  // 1.0e-211
-    { 0x542984435AA6DEF5,  -696 },  // 1.0e-210
-    { 0x6933E554315096B3,  -693 },  // 1.0e-209
-    { 0x41C06F549ED25E30,  -689 },  // 1.0e-208
-    { 0x52308B29C686F5BC,  -686 },  // 1.0e-207
-    { 0x66BCADF43828B32B,  -683 },  // 1.0e-206
-    { 0x4035ECB8A3196FFB,  -679 },  // 1.0e-205
-    { 0x504367E6CBDFCBF9,  -676 },  // 1.0e-204
-    { 0x645441E07ED7BEF8,  -673 },  // 1.0e-203
-    { 0x7D6952589E8DAEB6,  -670 },  // 1.0e-202
-    { 0x4E61D37763188D31,  -666 },  // 1.0e-201
-    { 0x61FA48553BDEB07E,  -663 },  // 1.0e-200
-    { 0x7A78DA6A8AD65C9D,  -660 },  // 1.0e-199
-    { 0x4C8B888296C5F9E2,  -656 },  // 1.0e-198
-    { 0x5FAE6AA33C77785B,  -653 },  // 1.0e-197
-    { 0x779A054C0B955672,  -650 },  // 1.0e-196
-    { 0x4AC0434F873D5607,  -646 },  // 1.0e-195
-    { 0x5D705423690CAB89,  -643 },  // 1.0e-194
-    { 0x74CC692C434FD66B,  -640 },  // 1.0e-193
-    { 0x48FFC1BBAA11E603,  -636 },  // 1.0e-192
-    { 0x5B3FB22A94965F84,  -633 },  // 1.0e-191
-    { 0x720F9EB539BBF765,  -630 },  // 1.0e-190
-    { 0x4749C33144157A9F,  -626 },  // 1.0e-189
-    { 0x591C33FD951AD946,  -623 },  // 1.0e-188
-    { 0x6F6340FCFA618F98,  -620 },  // 1.0e-187
-    { 0x459E089E1C7CF9BF,  -616 },  // 1.0e-186
-    { 0x57058AC5A39C382F,  -613 },  // 1.0e-185
-    { 0x6CC6ED770C83463B,  -610 },  // 1.0e-184
-    { 0x43FC546A67D20BE4,  -606 },  // 1.0e-183
-    { 0x54FB698501C68EDE,  -603 },  // 1.0e-182
-    { 0x6A3A43E642383295,  -600 },  // 1.0e-181
-    { 0x42646A6FE9631F9D,  -596 },  // 1.0e-180
-    { 0x52FD850BE3BBE784,  -593 },  // 1.0e-179
-    { 0x67BCE64EDCAAE166,  -590 },  // 1.0e-178
-    { 0x40D60FF149EACCDF,  -586 },  // 1.0e-177
-    { 0x510B93ED9C658017,  -583 },  // 1.0e-176
-    { 0x654E78E9037EE01D,  -580 },  // 1.0e-175
-    { 0x7EA21723445E9825,  -577 },  // 1.0e-174
-    { 0x4F254E760ABB1F17,  -573 },  // 1.0e-173
-    { 0x62EEA2138D69E6DD,  -570 },  // 1.0e-172
-    { 0x7BAA4A9870C46094,  -567 },  // 1.0e-171
-    { 0x4D4A6E9F467ABC5C,  -563 },  // 1.0e-170
-    { 0x609D0A4718196B73,  -560 },  // 1.0e-169
-    { 0x78C44CD8DE1FC650,  -557 },  // 1.0e-168
-    { 0x4B7AB0078AD3DBF2,  -553 },  // 1.0e-167
-    { 0x5E595C096D88D2EF,  -550 },  // 1.0e-166
-    { 0x75EFB30BC8EB07AB,  -547 },  // 1.0e-165
-    { 0x49B5CFE75D92E4CA,  -543 },  // 1.0e-164
-    { 0x5C2343E134F79DFD,  -540 },  // 1.0e-163
-    { 0x732C14D98235857D,  -537 },  // 1.0e-162
-    { 0x47FB8D07F161736E,  -533 },  // 1.0e-161
-    { 0x59FA7049EDB9D049,  -530 },  // 1.0e-160
-    { 0x70790C5C6928445C,  -527 },  // 1.0e-159
-    { 0x464BA7B9C1B92AB9,  -523 },  // 1.0e-158
-    { 0x57DE91A832277567,  -520 },  // 1.0e-157
-    { 0x6DD636123EB152C1,  -517 },  // 1.0e-156
-    { 0x44A5E1CB672ED3B9,  -513 },  // 1.0e-155
-    { 0x55CF5A3E40FA88A7,  -510 },  // 1.0e-154
-    { 0x6B4330CDD1392AD1,  -507 },  // 1.0e-153
-    { 0x4309FE80A2C3BAC2,  -503 },  // 1.0e-152
-    { 0x53CC7E20CB74A973,  -500 },  // 1.0e-151
-    { 0x68BF9DA8FE51D3D0,  -497 },  // 1.0e-150
-    { 0x4177C2899EF32462,  -493 },  // 1.0e-149
-    { 0x51D5B32C06AFED7A,  -490 },  // 1.0e-148
-    { 0x664B1FF7085BE8D9,  -487 },  // 1.0e-147
-    { 0x7FDDE7F4CA72E30F,  -484 },  // 1.0e-146
-    { 0x4FEAB0F8FE87CDE9,  -480 },  // 1.0e-145
-    { 0x63E55D373E29C164,  -477 },  // 1.0e-144
-    { 0x7CDEB4850DB431BD,  -474 },  // 1.0e-143
-    { 0x4E0B30D328909F16,  -470 },  // 1.0e-142
-    { 0x618DFD07F2B4C6DC,  -467 },  // 1.0e-141
-    { 0x79F17C49EF61F893,  -464 },  // 1.0e-140
-    { 0x4C36EDAE359D3B5B,  -460 },  // 1.0e-139
-    { 0x5F44A919C3048A32,  -457 },  // 1.0e-138
-    { 0x7715D36033C5ACBF,  -454 },  // 1.0e-137
-    { 0x4A6DA41C205B8BF7,  -450 },  // 1.0e-136
-    { 0x5D090D2328726EF5,  -447 },  // 1.0e-135
-    { 0x744B506BF28F0AB3,  -444 },  // 1.0e-134
-    { 0x48AF1243779966B0,  -440 },  // 1.0e-133
-    { 0x5ADAD6D4557FC05C,  -437 },  // 1.0e-132
-    { 0x71918C896ADFB073,  -434 },  // 1.0e-131
-    { 0x46FAF7D5E2CBCE47,  -430 },  // 1.0e-130
-    { 0x58B9B5CB5B7EC1D9,  -427 },  // 1.0e-129
-    { 0x6EE8233E325E7250,  -424 },  // 1.0e-128
-    { 0x45511606DF7B0772,  -420 },  // 1.0e-127
-    { 0x56A55B889759C94E,  -417 },  // 1.0e-126
-    { 0x6C4EB26ABD303BA2,  -414 },  // 1.0e-125
-    { 0x43B12F82B63E2545,  -410 },  // 1.0e-124
-    { 0x549D7B6363CDAE96,  -407 },  // 1.0e-123
-    { 0x69C4DA3C3CC11A3C,  -404 },  // 1.0e-122
-    { 0x421B0865A5F8B065,  -400 },  // 1.0e-121
-    { 0x52A1CA7F0F76DC7F,  -397 },  // 1.0e-120
-    { 0x674A3D1ED354939F,  -394 },  // 1.0e-119
-    { 0x408E66334414DC43,  -390 },  // 1.0e-118
-    { 0x50B1FFC0151A1354,  -387 },  // 1.0e-117
-    { 0x64DE7FB01A609829,  -384 },  // 1.0e-116
-    { 0x7E161F9C20F8BE33,  -381 },  // 1.0e-115
-    { 0x4ECDD3C1949B76E0,  -377 },  // 1.0e-114
-    { 0x628148B1F9C25498,  -374 },  // 1.0e-113
-    { 0x7B219ADE7832E9BE,  -371 },  // 1.0e-112
-    { 0x4CF500CB0B1FD217,  -367 },  // 1.0e-111
-    { 0x603240FDCDE7C69C,  -364 },  // 1.0e-110
-    { 0x783ED13D4161B844,  -361 },  // 1.0e-109
-    { 0x4B2742C648DD132A,  -357 },  // 1.0e-108
-    { 0x5DF11377DB1457F5,  -354 },  // 1.0e-107
-    { 0x756D5855D1D96DF2,  -351 },  // 1.0e-106
-    { 0x49645735A327E4B7,  -347 },  // 1.0e-105
-    { 0x5BBD6D030BF1DDE5,  -344 },  // 1.0e-104
-    { 0x72ACC843CEEE555E,  -341 },  // 1.0e-103
-    { 0x47ABFD2A6154F55B,  -337 },  // 1.0e-102
-    { 0x5996FC74F9AA32B2,  -334 },  // 1.0e-101
-    { 0x6FFCBB923814BF5E,  -331 },  // 1.0e-100
-    { 0x45FDF53B630CF79B,  -327 },  // 1.0e-099
-    { 0x577D728A3BD03581,  -324 },  // 1.0e-098
-    { 0x6D5CCF2CCAC442E2,  -321 },  // 1.0e-097
-    { 0x445A017BFEBAA9CD,  -317 },  // 1.0e-096
-    { 0x557081DAFE695440,  -314 },  // 1.0e-095
-    { 0x6ACCA251BE03A951,  -311 },  // 1.0e-094
-    { 0x42BFE57316C249D2,  -307 },  // 1.0e-093
-    { 0x536FDECFDC72DC47,  -304 },  // 1.0e-092
-    { 0x684BD683D38F9359,  -301 },  // 1.0e-091
-    { 0x412F66126439BC17,  -297 },  // 1.0e-090
-    { 0x517B3F96FD482B1D,  -294 },  // 1.0e-089
-    { 0x65DA0F7CBC9A35E5,  -291 },  // 1.0e-088
-    { 0x7F50935BEBC0C35E,  -288 },  // 1.0e-087
-    { 0x4F925C1973587A1B,  -284 },  // 1.0e-086
-    { 0x6376F31FD02E98A1,  -281 },  // 1.0e-085
-    { 0x7C54AFE7C43A3ECA,  -278 },  // 1.0e-084
-    { 0x4DB4EDF0DAA4673E,  -274 },  // 1.0e-083
-    { 0x6122296D114D810D,  -271 },  // 1.0e-082
-    { 0x796AB3C855A0E151,  -268 },  // 1.0e-081
-    { 0x4BE2B05D35848CD2,  -264 },  // 1.0e-080
-    { 0x5EDB5C7482E5B007,  -261 },  // 1.0e-079
-    { 0x76923391A39F1C09,  -258 },  // 1.0e-078
-    { 0x4A1B603B06437185,  -254 },  // 1.0e-077
-    { 0x5CA23849C7D44DE7,  -251 },  // 1.0e-076
-    { 0x73CAC65C39C96161,  -248 },  // 1.0e-075
-    { 0x485EBBF9A41DDCDC,  -244 },  // 1.0e-074
-    { 0x5A766AF80D255414,  -241 },  // 1.0e-073
-    { 0x711405B6106EA919,  -238 },  // 1.0e-072
-    { 0x46AC8391CA4529AF,  -234 },  // 1.0e-071
-    { 0x5857A4763CD6741B,  -231 },  // 1.0e-070
-    { 0x6E6D8D93CC0C1122,  -228 },  // 1.0e-069
-    { 0x4504787C5F878AB5,  -224 },  // 1.0e-068
-    { 0x5645969B77696D62,  -221 },  // 1.0e-067
-    { 0x6BD6FC425543C8BB,  -218 },  // 1.0e-066
-    { 0x43665DA9754A5D75,  -214 },  // 1.0e-065
-    { 0x543FF513D29CF4D2,  -211 },  // 1.0e-064
-    { 0x694FF258C7443207,  -208 },  // 1.0e-063
-    { 0x41D1F7777C8A9F44,  -204 },  // 1.0e-062
-    { 0x524675555BAD4715,  -201 },  // 1.0e-061
-    { 0x66D812AAB29898DB,  -198 },  // 1.0e-060
-    { 0x40470BAAAF9F5F88,  -194 },  // 1.0e-059
-    { 0x5058CE955B87376B,  -191 },  // 1.0e-058
-    { 0x646F023AB2690545,  -188 },  // 1.0e-057
-    { 0x7D8AC2C95F034697,  -185 },  // 1.0e-056
-    { 0x4E76B9BDDB620C1E,  -181 },  // 1.0e-055
-    { 0x6214682D523A8F26,  -178 },  // 1.0e-054
-    { 0x7A998238A6C932EF,  -175 },  // 1.0e-053
-    { 0x4C9FF163683DBFD5,  -171 },  // 1.0e-052
-    { 0x5FC7EDBC424D2FCB,  -168 },  // 1.0e-051
-    { 0x77B9E92B52E07BBE,  -165 },  // 1.0e-050
-    { 0x4AD431BB13CC4D56,  -161 },  // 1.0e-049
-    { 0x5D893E29D8BF60AC,  -158 },  // 1.0e-048
-    { 0x74EB8DB44EEF38D7,  -155 },  // 1.0e-047
-    { 0x49133890B1558386,  -151 },  // 1.0e-046
-    { 0x5B5806B4DDAAE468,  -148 },  // 1.0e-045
-    { 0x722E086215159D82,  -145 },  // 1.0e-044
-    { 0x475CC53D4D2D8271,  -141 },  // 1.0e-043
-    { 0x5933F68CA078E30E,  -138 },  // 1.0e-042
-    { 0x6F80F42FC8971BD1,  -135 },  // 1.0e-041
-    { 0x45B0989DDD5E7163,  -131 },  // 1.0e-040
-    { 0x571CBEC554B60DBB,  -128 },  // 1.0e-039
-    { 0x6CE3EE76A9E3912A,  -125 },  // 1.0e-038
-    { 0x440E750A2A2E3ABA,  -121 },  // 1.0e-037
-    { 0x5512124CB4B9C969,  -118 },  // 1.0e-036
-    { 0x6A5696DFE1E83BC3,  -115 },  // 1.0e-035
-    { 0x42761E4BED31255A,  -111 },  // 1.0e-034
-    { 0x5313A5DEE87D6EB0,  -108 },  // 1.0e-033
-    { 0x67D88F56A29CCA5D,  -105 },  // 1.0e-032
-    { 0x40E7599625A1FE7A,  -101 },  // 1.0e-031
-    { 0x51212FFBAF0A7E18,   -98 },  // 1.0e-030
-    { 0x65697BFA9ACD1D9F,   -95 },  // 1.0e-029
-    { 0x7EC3DAF941806506,   -92 },  // 1.0e-028
-    { 0x4F3A68DBC8F03F24,   -88 },  // 1.0e-027
-    { 0x63090312BB2C4EED,   -85 },  // 1.0e-026
-    { 0x7BCB43D769F762A8,   -82 },  // 1.0e-025
-    { 0x4D5F0A66A23A9DA9,   -78 },  // 1.0e-024
-    { 0x60B6CD004AC94513,   -75 },  // 1.0e-023
-    { 0x78E480405D7B9658,   -72 },  // 1.0e-022
-    { 0x4B8ED0283A6D3DF7,   -68 },  // 1.0e-021
-    { 0x5E72843249088D75,   -65 },  // 1.0e-020
-    { 0x760F253EDB4AB0D2,   -62 },  // 1.0e-019
-    { 0x49C97747490EAE83,   -58 },  // 1.0e-018
-    { 0x5C3BD5191B525A24,   -55 },  // 1.0e-017
-    { 0x734ACA5F6226F0AD,   -52 },  // 1.0e-016
-    { 0x480EBE7B9D58566C,   -48 },  // 1.0e-015
-    { 0x5A126E1A84AE6C07,   -45 },  // 1.0e-014
-    { 0x709709A125DA0709,   -42 },  // 1.0e-013
-    { 0x465E6604B7A84465,   -38 },  // 1.0e-012
-    { 0x57F5FF85E592557F,   -35 },  // 1.0e-011
-    { 0x6DF37F675EF6EADF,   -32 },  // 1.0e-010
-    { 0x44B82FA09B5A52CB,   -28 },  // 1.0e-009
-    { 0x55E63B88C230E77E,   -25 },  // 1.0e-008
-    { 0x6B5FCA6AF2BD215E,   -22 },  // 1.0e-007
-    { 0x431BDE82D7B634DA,   -18 },  // 1.0e-006
-    { 0x53E2D6238DA3C211,   -15 },  // 1.0e-005
-    { 0x68DB8BAC710CB295,   -12 },  // 1.0e-004
-    { 0x4189374BC6A7EF9D,    -8 },  // 1.0e-003
-    { 0x51EB851EB851EB85,    -5 },  // 1.0e-002
-    { 0x6666666666666666,    -2 },  // 1.0e-001
-    { 0x4000000000000000,    +2 },  // 1.0e+000
-    { 0x5000000000000000,    +5 },  // 1.0e+001
-    { 0x6400000000000000,    +8 },  // 1.0e+002
-    { 0x7D00000000000000,   +11 },  // 1.0e+003
-    { 0x4E20000000000000,   +15 },  // 1.0e+004
-    { 0x61A8000000000000,   +18 },  // 1.0e+005
-    { 0x7A12000000000000,   +21 },  // 1.0e+006
-    { 0x4C4B400000000000,   +25 },  // 1.0e+007
-    { 0x5F5E100000000000,   +28 },  // 1.0e+008
-    { 0x7735940000000000,   +31 },  // 1.0e+009
-    { 0x4A817C8000000000,   +35 },  // 1.0e+010
-    { 0x5D21DBA000000000,   +38 },  // 1.0e+011
-    { 0x746A528800000000,   +41 },  // 1.0e+012
-    { 0x48C2739500000000,   +45 },  // 1.0e+013
-    { 0x5AF3107A40000000,   +48 },  // 1.0e+014
-    { 0x71AFD498D0000000,   +51 },  // 1.0e+015
-    { 0x470DE4DF82000000,   +55 },  // 1.0e+016
-    { 0x58D15E1762800000,   +58 },  // 1.0e+017
-    { 0x6F05B59D3B200000,   +61 },  // 1.0e+018
-    { 0x4563918244F40000,   +65 },  // 1.0e+019
-    { 0x56BC75E2D6310000,   +68 },  // 1.0e+020
-    { 0x6C6B935B8BBD4000,   +71 },  // 1.0e+021
-    { 0x43C33C1937564800,   +75 },  // 1.0e+022
-    { 0x54B40B1F852BDA00,   +78 },  // 1.0e+023
-    { 0x69E10DE76676D080,   +81 },  // 1.0e+024
-    { 0x422CA8B0A00A4250,   +85 },  // 1.0e+025
-    { 0x52B7D2DCC80CD2E4,   +88 },  // 1.0e+026
-    { 0x6765C793FA10079D,   +91 },  // 1.0e+027
-    { 0x409F9CBC7C4A04C2,   +95 },  // 1.0e+028
-    { 0x50C783EB9B5C85F2,   +98 },  // 1.0e+029
-    { 0x64F964E68233A76F,  +101 },  // 1.0e+030
-    { 0x7E37BE2022C0914B,  +104 },  // 1.0e+031
-    { 0x4EE2D6D415B85ACE,  +108 },  // 1.0e+032
-    { 0x629B8C891B267182,  +111 },  // 1.0e+033
-    { 0x7B426FAB61F00DE3,  +114 },  // 1.0e+034
-    { 0x4D0985CB1D3608AE,  +118 },  // 1.0e+035
-    { 0x604BE73DE4838AD9,  +121 },  // 1.0e+036
-    { 0x785EE10D5DA46D90,  +124 },  // 1.0e+037
-    { 0x4B3B4CA85A86C47A,  +128 },  // 1.0e+038
-    { 0x5E0A1FD271287598,  +131 },  // 1.0e+039
-    { 0x758CA7C70D7292FE,  +134 },  // 1.0e+040
-    { 0x4977E8DC68679BDF,  +138 },  // 1.0e+041
-    { 0x5BD5E313828182D6,  +141 },  // 1.0e+042
-    { 0x72CB5BD86321E38C,  +144 },  // 1.0e+043
-    { 0x47BF19673DF52E37,  +148 },  // 1.0e+044
-    { 0x59AEDFC10D7279C5,  +151 },  // 1.0e+045
-    { 0x701A97B150CF1837,  +154 },  // 1.0e+046
-    { 0x46109ECED2816F22,  +158 },  // 1.0e+047
-    { 0x5794C6828721CAEB,  +161 },  // 1.0e+048
-    { 0x6D79F82328EA3DA6,  +164 },  // 1.0e+049
-    { 0x446C3B15F9926687,  +168 },  // 1.0e+050
-    { 0x558749DB77F70029,  +171 },  // 1.0e+051
-    { 0x6AE91C5255F4C034,  +174 },  // 1.0e+052
-    { 0x42D1B1B375B8F820,  +178 },  // 1.0e+053
-    { 0x53861E2053273628,  +181 },  // 1.0e+054
-    { 0x6867A5A867F103B2,  +184 },  // 1.0e+055
-    { 0x4140C78940F6A24F,  +188 },  // 1.0e+056
-    { 0x5190F96B91344AE3,  +191 },  // 1.0e+057
-    { 0x65F537C675815D9C,  +194 },  // 1.0e+058
-    { 0x7F7285B812E1B504,  +197 },  // 1.0e+059
-    { 0x4FA793930BCD1122,  +201 },  // 1.0e+060
-    { 0x63917877CEC0556B,  +204 },  // 1.0e+061
-    { 0x7C75D695C2706AC5,  +207 },  // 1.0e+062
-    { 0x4DC9A61D998642BB,  +211 },  // 1.0e+063
-    { 0x613C0FA4FFE7D36A,  +214 },  // 1.0e+064
-    { 0x798B138E3FE1C845,  +217 },  // 1.0e+065
-    { 0x4BF6EC38E7ED1D2B,  +221 },  // 1.0e+066
-    { 0x5EF4A74721E86476,  +224 },  // 1.0e+067
-    { 0x76B1D118EA627D93,  +227 },  // 1.0e+068
-    { 0x4A2F22AF927D8E7C,  +231 },  // 1.0e+069
-    { 0x5CBAEB5B771CF21B,  +234 },  // 1.0e+070
-    { 0x73E9A63254E42EA2,  +237 },  // 1.0e+071
-    { 0x487207DF750E9D25,  +241 },  // 1.0e+072
-    { 0x5A8E89D75252446E,  +244 },  // 1.0e+073
-    { 0x71322C4D26E6D58A,  +247 },  // 1.0e+074
-    { 0x46BF5BB038504576,  +251 },  // 1.0e+075
-    { 0x586F329C466456D4,  +254 },  // 1.0e+076
-    { 0x6E8AFF4357FD6C89,  +257 },  // 1.0e+077
-    { 0x4516DF8A16FE63D5,  +261 },  // 1.0e+078
-    { 0x565C976C9CBDFCCB,  +264 },  // 1.0e+079
-    { 0x6BF3BD47C3ED7BFD,  +267 },  // 1.0e+080
-    { 0x4378564CDA746D7E,  +271 },  // 1.0e+081
-    { 0x54566BE0111188DE,  +274 },  // 1.0e+082
-    { 0x696C06D81555EB15,  +277 },  // 1.0e+083
-    { 0x41E384470D55B2ED,  +281 },  // 1.0e+084
-    { 0x525C6558D0AB1FA9,  +284 },  // 1.0e+085
-    { 0x66F37EAF04D5E793,  +287 },  // 1.0e+086
-    { 0x40582F2D6305B0BC,  +291 },  // 1.0e+087
-    { 0x506E3AF8BBC71CEB,  +294 },  // 1.0e+088
-    { 0x6489C9B6EAB8E426,  +297 },  // 1.0e+089
-    { 0x7DAC3C24A5671D2F,  +300 },  // 1.0e+090
-    { 0x4E8BA596E760723D,  +304 },  // 1.0e+091
-    { 0x622E8EFCA1388ECD,  +307 },  // 1.0e+092
-    { 0x7ABA32BBC986B280,  +310 },  // 1.0e+093
-    { 0x4CB45FB55DF42F90,  +314 },  // 1.0e+094
-    { 0x5FE177A2B5713B74,  +317 },  // 1.0e+095
-    { 0x77D9D58B62CD8A51,  +320 },  // 1.0e+096
-    { 0x4AE825771DC07672,  +324 },  // 1.0e+097
-    { 0x5DA22ED4E530940F,  +327 },  // 1.0e+098
-    { 0x750ABA8A1E7CB913,  +330 },  // 1.0e+099
-    { 0x4926B496530DF3AC,  +334 },  // 1.0e+100
-    { 0x5B7061BBE7D17097,  +337 },  // 1.0e+101
-    { 0x724C7A2AE1C5CCBD,  +340 },  // 1.0e+102
-    { 0x476FCC5ACD1B9FF6,  +344 },  // 1.0e+103
-    { 0x594BBF71806287F3,  +347 },  // 1.0e+104
-    { 0x6F9EAF4DE07B29F0,  +350 },  // 1.0e+105
-    { 0x45C32D90AC4CFA36,  +354 },  // 1.0e+106
-    { 0x5733F8F4D76038C3,  +357 },  // 1.0e+107
-    { 0x6D00F7320D3846F4,  +360 },  // 1.0e+108
-    { 0x44209A7F48432C59,  +364 },  // 1.0e+109
-    { 0x5528C11F1A53F76F,  +367 },  // 1.0e+110
-    { 0x6A72F166E0E8F54B,  +370 },  // 1.0e+111
-    { 0x4287D6E04C91994F,  +374 },  // 1.0e+112
-    { 0x5329CC985FB5FFA2,  +377 },  // 1.0e+113
-    { 0x67F43FBE77A37F8B,  +380 },  // 1.0e+114
-    { 0x40F8A7D70AC62FB7,  +384 },  // 1.0e+115
-    { 0x5136D1CCCD77BBA4,  +387 },  // 1.0e+116
-    { 0x6584864000D5AA8E,  +390 },  // 1.0e+117
-    { 0x7EE5A7D0010B1531,  +393 },  // 1.0e+118
-    { 0x4F4F88E200A6ED3F,  +397 },  // 1.0e+119
-    { 0x63236B1A80D0A88E,  +400 },  // 1.0e+120
-    { 0x7BEC45E12104D2B2,  +403 },  // 1.0e+121
-    { 0x4D73ABACB4A303AF,  +407 },  // 1.0e+122
-    { 0x60D09697E1CBC49B,  +410 },  // 1.0e+123
-    { 0x7904BC3DDA3EB5C2,  +413 },  // 1.0e+124
-    { 0x4BA2F5A6A8673199,  +417 },  // 1.0e+125
-    { 0x5E8BB3105280FDFF,  +420 },  // 1.0e+126
-    { 0x762E9FD467213D7F,  +423 },  // 1.0e+127
-    { 0x49DD23E4C074C66F,  +427 },  // 1.0e+128
-    { 0x5C546CDDF091F80B,  +430 },  // 1.0e+129
-    { 0x736988156CB6760E,  +433 },  // 1.0e+130
-    { 0x4821F50D63F209C9,  +437 },  // 1.0e+131
-    { 0x5A2A7250BCEE8C3B,  +440 },  // 1.0e+132
-    { 0x70B50EE4EC2A2F4A,  +443 },  // 1.0e+133
-    { 0x4671294F139A5D8E,  +447 },  // 1.0e+134
-    { 0x580D73A2D880F4F2,  +450 },  // 1.0e+135
-    { 0x6E10D08B8EA1322E,  +453 },  // 1.0e+136
-    { 0x44CA82573924BF5D,  +457 },  // 1.0e+137
-    { 0x55FD22ED076DEF34,  +460 },  // 1.0e+138
-    { 0x6B7C6BA849496B01,  +463 },  // 1.0e+139
-    { 0x432DC3492DCDE2E1,  +467 },  // 1.0e+140
-    { 0x53F9341B79415B99,  +470 },  // 1.0e+141
-    { 0x68F781225791B27F,  +473 },  // 1.0e+142
-    { 0x419AB0B576BB0F8F,  +477 },  // 1.0e+143
-    { 0x52015CE2D469D373,  +480 },  // 1.0e+144
-    { 0x6681B41B89844850,  +483 },  // 1.0e+145
-    { 0x4011109135F2AD32,  +487 },  // 1.0e+146
-    { 0x501554B5836F587E,  +490 },  // 1.0e+147
-    { 0x641AA9E2E44B2E9E,  +493 },  // 1.0e+148
-    { 0x7D21545B9D5DFA46,  +496 },  // 1.0e+149
-    { 0x4E34D4B9425ABC6B,  +500 },  // 1.0e+150
-    { 0x61C209E792F16B86,  +503 },  // 1.0e+151
-    { 0x7A328C6177ADC668,  +506 },  // 1.0e+152
-    { 0x4C5F97BCEACC9C01,  +510 },  // 1.0e+153
-    { 0x5F777DAC257FC301,  +513 },  // 1.0e+154
-    { 0x77555D172EDFB3C2,  +516 },  // 1.0e+155
-    { 0x4A955A2E7D4BD059,  +520 },  // 1.0e+156
-    { 0x5D3AB0BA1C9EC46F,  +523 },  // 1.0e+157
-    { 0x74895CE8A3C6758B,  +526 },  // 1.0e+158
-    { 0x48D5DA11665C0977,  +530 },  // 1.0e+159
-    { 0x5B0B5095BFF30BD5,  +533 },  // 1.0e+160
-    { 0x71CE24BB2FEFCECA,  +536 },  // 1.0e+161
-    { 0x4720D6F4FDF5E13E,  +540 },  // 1.0e+162
-    { 0x58E90CB23D73598E,  +543 },  // 1.0e+163
-    { 0x6F234FDECCD02FF1,  +546 },  // 1.0e+164
-    { 0x457611EB40021DF7,  +550 },  // 1.0e+165
-    { 0x56D396661002A574,  +553 },  // 1.0e+166
-    { 0x6C887BFF94034ED2,  +556 },  // 1.0e+167
-    { 0x43D54D7FBC821143,  +560 },  // 1.0e+168
-    { 0x54CAA0DFABA29594,  +563 },  // 1.0e+169
-    { 0x69FD4917968B3AF9,  +566 },  // 1.0e+170
-    { 0x423E4DAEBE1704DB,  +570 },  // 1.0e+171
-    { 0x52CDE11A6D9CC612,  +573 },  // 1.0e+172
-    { 0x678159610903F797,  +576 },  // 1.0e+173
-    { 0x40B0D7DCA5A27ABE,  +580 },  // 1.0e+174
-    { 0x50DD0DD3CF0B196E,  +583 },  // 1.0e+175
-    { 0x65145148C2CDDFC9,  +586 },  // 1.0e+176
-    { 0x7E59659AF38157BC,  +589 },  // 1.0e+177
-    { 0x4EF7DF80D830D6D5,  +593 },  // 1.0e+178
-    { 0x62B5D7610E3D0C8B,  +596 },  // 1.0e+179
-    { 0x7B634D3951CC4FAD,  +599 },  // 1.0e+180
-    { 0x4D1E1043D31FB1CC,  +603 },  // 1.0e+181
-    { 0x60659454C7E79E3F,  +606 },  // 1.0e+182
-    { 0x787EF969F9E185CF,  +609 },  // 1.0e+183
-    { 0x4B4F5BE23C2CF3A1,  +613 },  // 1.0e+184
-    { 0x5E2332DACB38308A,  +616 },  // 1.0e+185
-    { 0x75ABFF917E063CAC,  +619 },  // 1.0e+186
-    { 0x498B7FBAEEC3E5EC,  +623 },  // 1.0e+187
-    { 0x5BEE5FA9AA74DF67,  +626 },  // 1.0e+188
-    { 0x72E9F79415121740,  +629 },  // 1.0e+189
-    { 0x47D23ABC8D2B4E88,  +633 },  // 1.0e+190
-    { 0x59C6C96BB076222A,  +636 },  // 1.0e+191
-    { 0x70387BC69C93AAB5,  +639 },  // 1.0e+192
-    { 0x46234D5C21DC4AB1,  +643 },  // 1.0e+193
-    { 0x57AC20B32A535D5D,  +646 },  // 1.0e+194
-    { 0x6D9728DFF4E834B5,  +649 },  // 1.0e+195
-    { 0x447E798BF91120F1,  +653 },  // 1.0e+196
-    { 0x559E17EEF755692D,  +656 },  // 1.0e+197
-    { 0x6B059DEAB52AC378,  +659 },  // 1.0e+198
-    { 0x42E382B2B13ABA2B,  +663 },  // 1.0e+199
-    { 0x539C635F5D8968B6,  +666 },  // 1.0e+200
-    { 0x68837C3734EBC2E3,  +669 },  // 1.0e+201
-    { 0x41522DA2811359CE,  +673 },  // 1.0e+202
-    { 0x51A6B90B21583042,  +676 },  // 1.0e+203
-    { 0x6610674DE9AE3C52,  +679 },  // 1.0e+204
-    { 0x7F9481216419CB67,  +682 },  // 1.0e+205
-    { 0x4FBCD0B4DE901F20,  +686 },  // 1.0e+206
-    { 0x63AC04E2163426E8,  +689 },  // 1.0e+207
-    { 0x7C97061A9BC130A2,  +692 },  // 1.0e+208
-    { 0x4DDE63D0A158BE65,  +696 },  // 1.0e+209
-    { 0x6155FCC4C9AEEDFF,  +699 },  // 1.0e+210
-    { 0x79AB7BF5FC1AA97F,  +702 },  // 1.0e+211
-    { 0x4C0B2D79BD90A9EF,  +706 },  // 1.0e+212
-    { 0x5F0DF8D82CF4D46B,  +709 },  // 1.0e+213
-    { 0x76D1770E38320986,  +712 },  // 1.0e+214
-    { 0x4A42EA68E31F45F3,  +716 },  // 1.0e+215
-    { 0x5CD3A5031BE71770,  +719 },  // 1.0e+216
-    { 0x74088E43E2E0DD4C,  +722 },  // 1.0e+217
-    { 0x488558EA6DCC8A50,  +726 },  // 1.0e+218
-    { 0x5AA6AF25093FACE4,  +729 },  // 1.0e+219
-    { 0x71505AEE4B8F981D,  +732 },  // 1.0e+220
-    { 0x46D238D4EF39BF12,  +736 },  // 1.0e+221
-    { 0x5886C70A2B082ED6,  +739 },  // 1.0e+222
-    { 0x6EA878CCB5CA3A8C,  +742 },  // 1.0e+223
-    { 0x45294B7FF19E6497,  +746 },  // 1.0e+224
-    { 0x56739E5FEE05FDBD,  +749 },  // 1.0e+225
-    { 0x6C1085F7E9877D2D,  +752 },  // 1.0e+226
-    { 0x438A53BAF1F4AE3C,  +756 },  // 1.0e+227
-    { 0x546CE8A9AE71D9CB,  +759 },  // 1.0e+228
-    { 0x698822D41A0E503E,  +762 },  // 1.0e+229
-    { 0x41F515C49048F226,  +766 },  // 1.0e+230
-    { 0x52725B35B45B2EB0,  +769 },  // 1.0e+231
-    { 0x670EF2032171FA5C,  +772 },  // 1.0e+232
-    { 0x40695741F4E73C79,  +776 },  // 1.0e+233
-    { 0x5083AD1272210B98,  +779 },  // 1.0e+234
-    { 0x64A498570EA94E7E,  +782 },  // 1.0e+235
-    { 0x7DCDBE6CD253A21E,  +785 },  // 1.0e+236
-    { 0x4EA0970403744552,  +789 },  // 1.0e+237
-    { 0x6248BCC5045156A7,  +792 },  // 1.0e+238
-    { 0x7ADAEBF64565AC51,  +795 },  // 1.0e+239
-    { 0x4CC8D379EB5F8BB2,  +799 },  // 1.0e+240
-    { 0x5FFB085866376E9F,  +802 },  // 1.0e+241
-    { 0x77F9CA6E7FC54A47,  +805 },  // 1.0e+242
-    { 0x4AFC1E850FDB4E6C,  +809 },  // 1.0e+243
-    { 0x5DBB262653D22207,  +812 },  // 1.0e+244
-    { 0x7529EFAFE8C6AA89,  +815 },  // 1.0e+245
-    { 0x493A35CDF17C2A96,  +819 },  // 1.0e+246
-    { 0x5B88C3416DDB353B,  +822 },  // 1.0e+247
-    { 0x726AF411C952028A,  +825 },  // 1.0e+248
-    { 0x4782D88B1DD34196,  +829 },  // 1.0e+249
-    { 0x59638EADE54811FC,  +832 },  // 1.0e+250
-    { 0x6FBC72595E9A167B,  +835 },  // 1.0e+251
-    { 0x45D5C777DB204E0D,  +839 },  // 1.0e+252
-    { 0x574B3955D1E86190,  +842 },  // 1.0e+253
-    { 0x6D1E07AB466279F4,  +845 },  // 1.0e+254
-    { 0x4432C4CB0BFD8C38,  +849 },  // 1.0e+255
-    { 0x553F75FDCEFCEF46,  +852 },  // 1.0e+256
-    { 0x6A8F537D42BC2B18,  +855 },  // 1.0e+257
-    { 0x4299942E49B59AEF,  +859 },  // 1.0e+258
-    { 0x533FF939DC2301AB,  +862 },  // 1.0e+259
-    { 0x680FF788532BC216,  +865 },  // 1.0e+260
-    { 0x4109FAB533FB594D,  +869 },  // 1.0e+261
-    { 0x514C796280FA2FA1,  +872 },  // 1.0e+262
-    { 0x659F97BB2138BB89,  +875 },  // 1.0e+263
-    { 0x7F077DA9E986EA6B,  +878 },  // 1.0e+264
-    { 0x4F64AE8A31F45283,  +882 },  // 1.0e+265
-    { 0x633DDA2CBE716724,  +885 },  // 1.0e+266
-    { 0x7C0D50B7EE0DC0ED,  +888 },  // 1.0e+267
-    { 0x4D885272F4C89894,  +892 },  // 1.0e+268
-    { 0x60EA670FB1FABEB9,  +895 },  // 1.0e+269
-    { 0x792500D39E796E67,  +898 },  // 1.0e+270
-    { 0x4BB72084430BE500,  +902 },  // 1.0e+271
-    { 0x5EA4E8A553CEDE41,  +905 },  // 1.0e+272
-    { 0x764E22CEA8C295D1,  +908 },  // 1.0e+273
-    { 0x49F0D5C129799DA2,  +912 },  // 1.0e+274
-    { 0x5C6D0B3173D8050B,  +915 },  // 1.0e+275
-    { 0x73884DFDD0CE064E,  +918 },  // 1.0e+276
-    { 0x483530BEA280C3F1,  +922 },  // 1.0e+277
-    { 0x5A427CEE4B20F4ED,  +925 },  // 1.0e+278
-    { 0x70D31C29DDE93228,  +928 },  // 1.0e+279
-    { 0x4683F19A2AB1BF59,  +932 },  // 1.0e+280
-    { 0x5824EE00B55E2F2F,  +935 },  // 1.0e+281
-    { 0x6E2E2980E2B5BAFB,  +938 },  // 1.0e+282
-    { 0x44DCD9F08DB194DD,  +942 },  // 1.0e+283
-    { 0x5614106CB11DFA14,  +945 },  // 1.0e+284
-    { 0x6B991487DD657899,  +948 },  // 1.0e+285
-    { 0x433FACD4EA5F6B60,  +952 },  // 1.0e+286
-    { 0x540F980A24F74638,  +955 },  // 1.0e+287
-    { 0x69137E0CAE3517C6,  +958 },  // 1.0e+288
-    { 0x41AC2EC7ECE12EDB,  +962 },  // 1.0e+289
-    { 0x52173A79E8197A92,  +965 },  // 1.0e+290
-    { 0x669D0918621FD937,  +968 },  // 1.0e+291
-    { 0x402225AF3D53E7C2,  +972 },  // 1.0e+292
-    { 0x502AAF1B0CA8E1B3,  +975 },  // 1.0e+293
-    { 0x64355AE1CFD31A20,  +978 },  // 1.0e+294
-    { 0x7D42B19A43C7E0A8,  +981 },  // 1.0e+295
-    { 0x4E49AF006A5CEC69,  +985 },  // 1.0e+296
-    { 0x61DC1AC084F42783,  +988 },  // 1.0e+297
-    { 0x7A532170A6313164,  +991 },  // 1.0e+298
-    { 0x4C73F4E667DEBEDE,  +995 },  // 1.0e+299
-    { 0x5F90F22001D66E96,  +998 },  // 1.0e+300
-    { 0x77752EA8024C0A3C, +1001 },  // 1.0e+301
-    { 0x4AA93D29016F8665, +1005 },  // 1.0e+302
-    { 0x5D538C7341CB67FE, +1008 },  // 1.0e+303
-    { 0x74A86F90123E41FE, +1011 },  // 1.0e+304
-    { 0x48E945BA0B66E93F, +1015 },  // 1.0e+305
-    { 0x5B2397288E40A38E, +1018 },  // 1.0e+306
-    { 0x71EC7CF2B1D0CC72, +1021 },  // 1.0e+307
-    { 0x4733CE17AF227FC7, +1025 },  // 1.0e+308
+    { 0xEEF453D6923BD65A, 0x113FAA2906A13B3F },  // 1.0e-342
+    { 0x9558B4661B6565F8, 0x4AC7CA59A424C507 },  // 1.0e-341
+    { 0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649 },  // 1.0e-340
+    { 0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC },  // 1.0e-339
+    { 0x91D8A02BB6C10594, 0x79071B9B8A4BE869 },  // 1.0e-338
+    { 0xB64EC836A47146F9, 0x9748E2826CDEE284 },  // 1.0e-337
+    { 0xE3E27A444D8D98B7, 0xFD1B1B2308169B25 },  // 1.0e-336
+    { 0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7 },  // 1.0e-335
+    { 0xB208EF855C969F4F, 0xBDBD2D335E51A935 },  // 1.0e-334
+    { 0xDE8B2B66B3BC4723, 0xAD2C788035E61382 },  // 1.0e-333
+    { 0x8B16FB203055AC76, 0x4C3BCB5021AFCC31 },  // 1.0e-332
+    { 0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D },  // 1.0e-331
+    { 0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D },  // 1.0e-330
+    { 0x87D4713D6F33AA6B, 0x8672648C40E5AD68 },  // 1.0e-329
+    { 0xA9C98D8CCB009506, 0x680EFDAF511F18C2 },  // 1.0e-328
+    { 0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2 },  // 1.0e-327
+    { 0x84A57695FE98746D, 0x014BB630F7604B57 },  // 1.0e-326
+    { 0xA5CED43B7E3E9188, 0x419EA3BD35385E2D },  // 1.0e-325
+    { 0xCF42894A5DCE35EA, 0x52064CAC828675B9 },  // 1.0e-324
+    { 0x818995CE7AA0E1B2, 0x7343EFEBD1940993 },  // 1.0e-323
+    { 0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8 },  // 1.0e-322
+    { 0xCA66FA129F9B60A6, 0xD41A26E077774EF6 },  // 1.0e-321
+    { 0xFD00B897478238D0, 0x8920B098955522B4 },  // 1.0e-320
+    { 0x9E20735E8CB16382, 0x55B46E5F5D5535B0 },  // 1.0e-319
+    { 0xC5A890362FDDBC62, 0xEB2189F734AA831D },  // 1.0e-318
+    { 0xF712B443BBD52B7B, 0xA5E9EC7501D523E4 },  // 1.0e-317
+    { 0x9A6BB0AA55653B2D, 0x47B233C92125366E },  // 1.0e-316
+    { 0xC1069CD4EABE89F8, 0x999EC0BB696E840A },  // 1.0e-315
+    { 0xF148440A256E2C76, 0xC00670EA43CA250D },  // 1.0e-314
+    { 0x96CD2A865764DBCA, 0x380406926A5E5728 },  // 1.0e-313
+    { 0xBC807527ED3E12BC, 0xC605083704F5ECF2 },  // 1.0e-312
+    { 0xEBA09271E88D976B, 0xF7864A44C633682E },  // 1.0e-311
+    { 0x93445B8731587EA3, 0x7AB3EE6AFBE0211D },  // 1.0e-310
+    { 0xB8157268FDAE9E4C, 0x5960EA05BAD82964 },  // 1.0e-309
+    { 0xE61ACF033D1A45DF, 0x6FB92487298E33BD },  // 1.0e-308
+    { 0x8FD0C16206306BAB, 0xA5D3B6D479F8E056 },  // 1.0e-307
+    { 0xB3C4F1BA87BC8696, 0x8F48A4899877186C },  // 1.0e-306
+    { 0xE0B62E2929ABA83C, 0x331ACDABFE94DE87 },  // 1.0e-305
+    { 0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14 },  // 1.0e-304
+    { 0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9 },  // 1.0e-303
+    { 0xDB71E91432B1A24A, 0xC9E82CD9F69D6150 },  // 1.0e-302
+    { 0x892731AC9FAF056E, 0xBE311C083A225CD2 },  // 1.0e-301
+    { 0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406 },  // 1.0e-300
+    { 0xD64D3D9DB981787D, 0x092CBBCCDAD5B108 },  // 1.0e-299
+    { 0x85F0468293F0EB4E, 0x25BBF56008C58EA5 },  // 1.0e-298
+    { 0xA76C582338ED2621, 0xAF2AF2B80AF6F24E },  // 1.0e-297
+    { 0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1 },  // 1.0e-296
+    { 0x82CCA4DB847945CA, 0x50D98D9FC890ED4D },  // 1.0e-295
+    { 0xA37FCE126597973C, 0xE50FF107BAB528A0 },  // 1.0e-294
+    { 0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8 },  // 1.0e-293
+    { 0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A },  // 1.0e-292
+    { 0x9FAACF3DF73609B1, 0x77B191618C54E9AC },  // 1.0e-291
+    { 0xC795830D75038C1D, 0xD59DF5B9EF6A2417 },  // 1.0e-290
+    { 0xF97AE3D0D2446F25, 0x4B0573286B44AD1D },  // 1.0e-289
+    { 0x9BECCE62836AC577, 0x4EE367F9430AEC32 },  // 1.0e-288
+    { 0xC2E801FB244576D5, 0x229C41F793CDA73F },  // 1.0e-287
+    { 0xF3A20279ED56D48A, 0x6B43527578C1110F },  // 1.0e-286
+    { 0x9845418C345644D6, 0x830A13896B78AAA9 },  // 1.0e-285
+    { 0xBE5691EF416BD60C, 0x23CC986BC656D553 },  // 1.0e-284
+    { 0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8 },  // 1.0e-283
+    { 0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9 },  // 1.0e-282
+    { 0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53 },  // 1.0e-281
+    { 0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68 },  // 1.0e-280
+    { 0x91376C36D99995BE, 0x23100809B9C21FA1 },  // 1.0e-279
+    { 0xB58547448FFFFB2D, 0xABD40A0C2832A78A },  // 1.0e-278
+    { 0xE2E69915B3FFF9F9, 0x16C90C8F323F516C },  // 1.0e-277
+    { 0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3 },  // 1.0e-276
+    { 0xB1442798F49FFB4A, 0x99CD11CFDF41779C },  // 1.0e-275
+    { 0xDD95317F31C7FA1D, 0x40405643D711D583 },  // 1.0e-274
+    { 0x8A7D3EEF7F1CFC52, 0x482835EA666B2572 },  // 1.0e-273
+    { 0xAD1C8EAB5EE43B66, 0xDA3243650005EECF },  // 1.0e-272
+    { 0xD863B256369D4A40, 0x90BED43E40076A82 },  // 1.0e-271
+    { 0x873E4F75E2224E68, 0x5A7744A6E804A291 },  // 1.0e-270
+    { 0xA90DE3535AAAE202, 0x711515D0A205CB36 },  // 1.0e-269
+    { 0xD3515C2831559A83, 0x0D5A5B44CA873E03 },  // 1.0e-268
+    { 0x8412D9991ED58091, 0xE858790AFE9486C2 },  // 1.0e-267
+    { 0xA5178FFF668AE0B6, 0x626E974DBE39A872 },  // 1.0e-266
+    { 0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F },  // 1.0e-265
+    { 0x80FA687F881C7F8E, 0x7CE66634BC9D0B99 },  // 1.0e-264
+    { 0xA139029F6A239F72, 0x1C1FFFC1EBC44E80 },  // 1.0e-263
+    { 0xC987434744AC874E, 0xA327FFB266B56220 },  // 1.0e-262
+    { 0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8 },  // 1.0e-261
+    { 0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9 },  // 1.0e-260
+    { 0xC4CE17B399107C22, 0xCB550FB4384D21D3 },  // 1.0e-259
+    { 0xF6019DA07F549B2B, 0x7E2A53A146606A48 },  // 1.0e-258
+    { 0x99C102844F94E0FB, 0x2EDA7444CBFC426D },  // 1.0e-257
+    { 0xC0314325637A1939, 0xFA911155FEFB5308 },  // 1.0e-256
+    { 0xF03D93EEBC589F88, 0x793555AB7EBA27CA },  // 1.0e-255
+    { 0x96267C7535B763B5, 0x4BC1558B2F3458DE },  // 1.0e-254
+    { 0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16 },  // 1.0e-253
+    { 0xEA9C227723EE8BCB, 0x465E15A979C1CADC },  // 1.0e-252
+    { 0x92A1958A7675175F, 0x0BFACD89EC191EC9 },  // 1.0e-251
+    { 0xB749FAED14125D36, 0xCEF980EC671F667B },  // 1.0e-250
+    { 0xE51C79A85916F484, 0x82B7E12780E7401A },  // 1.0e-249
+    { 0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810 },  // 1.0e-248
+    { 0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15 },  // 1.0e-247
+    { 0xDFBDCECE67006AC9, 0x67A791E093E1D49A },  // 1.0e-246
+    { 0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0 },  // 1.0e-245
+    { 0xAECC49914078536D, 0x58FAE9F773886E18 },  // 1.0e-244
+    { 0xDA7F5BF590966848, 0xAF39A475506A899E },  // 1.0e-243
+    { 0x888F99797A5E012D, 0x6D8406C952429603 },  // 1.0e-242
+    { 0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83 },  // 1.0e-241
+    { 0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64 },  // 1.0e-240
+    { 0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F },  // 1.0e-239
+    { 0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E },  // 1.0e-238
+    { 0xD0601D8EFC57B08B, 0xF13B94DAF124DA26 },  // 1.0e-237
+    { 0x823C12795DB6CE57, 0x76C53D08D6B70858 },  // 1.0e-236
+    { 0xA2CB1717B52481ED, 0x54768C4B0C64CA6E },  // 1.0e-235
+    { 0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09 },  // 1.0e-234
+    { 0xFE5D54150B090B02, 0xD3F93B35435D7C4C },  // 1.0e-233
+    { 0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF },  // 1.0e-232
+    { 0xC6B8E9B0709F109A, 0x359AB6419CA1091B },  // 1.0e-231
+    { 0xF867241C8CC6D4C0, 0xC30163D203C94B62 },  // 1.0e-230
+    { 0x9B407691D7FC44F8, 0x79E0DE63425DCF1D },  // 1.0e-229
+    { 0xC21094364DFB5636, 0x985915FC12F542E4 },  // 1.0e-228
+    { 0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D },  // 1.0e-227
+    { 0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42 },  // 1.0e-226
+    { 0xBD8430BD08277231, 0x50C6FF782A838353 },  // 1.0e-225
+    { 0xECE53CEC4A314EBD, 0xA4F8BF5635246428 },  // 1.0e-224
+    { 0x940F4613AE5ED136, 0x871B7795E136BE99 },  // 1.0e-223
+    { 0xB913179899F68584, 0x28E2557B59846E3F },  // 1.0e-222
+    { 0xE757DD7EC07426E5, 0x331AEADA2FE589CF },  // 1.0e-221
+    { 0x9096EA6F3848984F, 0x3FF0D2C85DEF7621 },  // 1.0e-220
+    { 0xB4BCA50B065ABE63, 0x0FED077A756B53A9 },  // 1.0e-219
+    { 0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894 },  // 1.0e-218
+    { 0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C },  // 1.0e-217
+    { 0xB080392CC4349DEC, 0xBD8D794D96AACFB3 },  // 1.0e-216
+    { 0xDCA04777F541C567, 0xECF0D7A0FC5583A0 },  // 1.0e-215
+    { 0x89E42CAAF9491B60, 0xF41686C49DB57244 },  // 1.0e-214
+    { 0xAC5D37D5B79B6239, 0x311C2875C522CED5 },  // 1.0e-213
+    { 0xD77485CB25823AC7, 0x7D633293366B828B },  // 1.0e-212
+    { 0x86A8D39EF77164BC, 0xAE5DFF9C02033197 },  // 1.0e-211
+    { 0xA8530886B54DBDEB, 0xD9F57F830283FDFC },  // 1.0e-210
+    { 0xD267CAA862A12D66, 0xD072DF63C324FD7B },  // 1.0e-209
+    { 0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D },  // 1.0e-208
+    { 0xA46116538D0DEB78, 0x52D9BE85F074E608 },  // 1.0e-207
+    { 0xCD795BE870516656, 0x67902E276C921F8B },  // 1.0e-206
+    { 0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6 },  // 1.0e-205
+    { 0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4 },  // 1.0e-204
+    { 0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD },  // 1.0e-203
+    { 0xFAD2A4B13D1B5D6C, 0x796B805720085F81 },  // 1.0e-202
+    { 0x9CC3A6EEC6311A63, 0xCBE3303674053BB0 },  // 1.0e-201
+    { 0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C },  // 1.0e-200
+    { 0xF4F1B4D515ACB93B, 0xEE92FB5515482D44 },  // 1.0e-199
+    { 0x991711052D8BF3C5, 0x751BDD152D4D1C4A },  // 1.0e-198
+    { 0xBF5CD54678EEF0B6, 0xD262D45A78A0635D },  // 1.0e-197
+    { 0xEF340A98172AACE4, 0x86FB897116C87C34 },  // 1.0e-196
+    { 0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0 },  // 1.0e-195
+    { 0xBAE0A846D2195712, 0x8974836059CCA109 },  // 1.0e-194
+    { 0xE998D258869FACD7, 0x2BD1A438703FC94B },  // 1.0e-193
+    { 0x91FF83775423CC06, 0x7B6306A34627DDCF },  // 1.0e-192
+    { 0xB67F6455292CBF08, 0x1A3BC84C17B1D542 },  // 1.0e-191
+    { 0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93 },  // 1.0e-190
+    { 0x8E938662882AF53E, 0x547EB47B7282EE9C },  // 1.0e-189
+    { 0xB23867FB2A35B28D, 0xE99E619A4F23AA43 },  // 1.0e-188
+    { 0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4 },  // 1.0e-187
+    { 0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04 },  // 1.0e-186
+    { 0xAE0B158B4738705E, 0x9624AB50B148D445 },  // 1.0e-185
+    { 0xD98DDAEE19068C76, 0x3BADD624DD9B0957 },  // 1.0e-184
+    { 0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6 },  // 1.0e-183
+    { 0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C },  // 1.0e-182
+    { 0xD47487CC8470652B, 0x7647C3200069671F },  // 1.0e-181
+    { 0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073 },  // 1.0e-180
+    { 0xA5FB0A17C777CF09, 0xF468107100525890 },  // 1.0e-179
+    { 0xCF79CC9DB955C2CC, 0x7182148D4066EEB4 },  // 1.0e-178
+    { 0x81AC1FE293D599BF, 0xC6F14CD848405530 },  // 1.0e-177
+    { 0xA21727DB38CB002F, 0xB8ADA00E5A506A7C },  // 1.0e-176
+    { 0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C },  // 1.0e-175
+    { 0xFD442E4688BD304A, 0x908F4A166D1DA663 },  // 1.0e-174
+    { 0x9E4A9CEC15763E2E, 0x9A598E4E043287FE },  // 1.0e-173
+    { 0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD },  // 1.0e-172
+    { 0xF7549530E188C128, 0xD12BEE59E68EF47C },  // 1.0e-171
+    { 0x9A94DD3E8CF578B9, 0x82BB74F8301958CE },  // 1.0e-170
+    { 0xC13A148E3032D6E7, 0xE36A52363C1FAF01 },  // 1.0e-169
+    { 0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1 },  // 1.0e-168
+    { 0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9 },  // 1.0e-167
+    { 0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7 },  // 1.0e-166
+    { 0xEBDF661791D60F56, 0x111B495B3464AD21 },  // 1.0e-165
+    { 0x936B9FCEBB25C995, 0xCAB10DD900BEEC34 },  // 1.0e-164
+    { 0xB84687C269EF3BFB, 0x3D5D514F40EEA742 },  // 1.0e-163
+    { 0xE65829B3046B0AFA, 0x0CB4A5A3112A5112 },  // 1.0e-162
+    { 0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB },  // 1.0e-161
+    { 0xB3F4E093DB73A093, 0x59ED216765690F56 },  // 1.0e-160
+    { 0xE0F218B8D25088B8, 0x306869C13EC3532C },  // 1.0e-159
+    { 0x8C974F7383725573, 0x1E414218C73A13FB },  // 1.0e-158
+    { 0xAFBD2350644EEACF, 0xE5D1929EF90898FA },  // 1.0e-157
+    { 0xDBAC6C247D62A583, 0xDF45F746B74ABF39 },  // 1.0e-156
+    { 0x894BC396CE5DA772, 0x6B8BBA8C328EB783 },  // 1.0e-155
+    { 0xAB9EB47C81F5114F, 0x066EA92F3F326564 },  // 1.0e-154
+    { 0xD686619BA27255A2, 0xC80A537B0EFEFEBD },  // 1.0e-153
+    { 0x8613FD0145877585, 0xBD06742CE95F5F36 },  // 1.0e-152
+    { 0xA798FC4196E952E7, 0x2C48113823B73704 },  // 1.0e-151
+    { 0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5 },  // 1.0e-150
+    { 0x82EF85133DE648C4, 0x9A984D73DBE722FB },  // 1.0e-149
+    { 0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA },  // 1.0e-148
+    { 0xCC963FEE10B7D1B3, 0x318DF905079926A8 },  // 1.0e-147
+    { 0xFFBBCFE994E5C61F, 0xFDF17746497F7052 },  // 1.0e-146
+    { 0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633 },  // 1.0e-145
+    { 0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0 },  // 1.0e-144
+    { 0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0 },  // 1.0e-143
+    { 0x9C1661A651213E2D, 0x06BEA10CA65C084E },  // 1.0e-142
+    { 0xC31BFA0FE5698DB8, 0x486E494FCFF30A62 },  // 1.0e-141
+    { 0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA },  // 1.0e-140
+    { 0x986DDB5C6B3A76B7, 0xF89629465A75E01C },  // 1.0e-139
+    { 0xBE89523386091465, 0xF6BBB397F1135823 },  // 1.0e-138
+    { 0xEE2BA6C0678B597F, 0x746AA07DED582E2C },  // 1.0e-137
+    { 0x94DB483840B717EF, 0xA8C2A44EB4571CDC },  // 1.0e-136
+    { 0xBA121A4650E4DDEB, 0x92F34D62616CE413 },  // 1.0e-135
+    { 0xE896A0D7E51E1566, 0x77B020BAF9C81D17 },  // 1.0e-134
+    { 0x915E2486EF32CD60, 0x0ACE1474DC1D122E },  // 1.0e-133
+    { 0xB5B5ADA8AAFF80B8, 0x0D819992132456BA },  // 1.0e-132
+    { 0xE3231912D5BF60E6, 0x10E1FFF697ED6C69 },  // 1.0e-131
+    { 0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1 },  // 1.0e-130
+    { 0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2 },  // 1.0e-129
+    { 0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE },  // 1.0e-128
+    { 0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B },  // 1.0e-127
+    { 0xAD4AB7112EB3929D, 0x86C16C98D2C953C6 },  // 1.0e-126
+    { 0xD89D64D57A607744, 0xE871C7BF077BA8B7 },  // 1.0e-125
+    { 0x87625F056C7C4A8B, 0x11471CD764AD4972 },  // 1.0e-124
+    { 0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF },  // 1.0e-123
+    { 0xD389B47879823479, 0x4AFF1D108D4EC2C3 },  // 1.0e-122
+    { 0x843610CB4BF160CB, 0xCEDF722A585139BA },  // 1.0e-121
+    { 0xA54394FE1EEDB8FE, 0xC2974EB4EE658828 },  // 1.0e-120
+    { 0xCE947A3DA6A9273E, 0x733D226229FEEA32 },  // 1.0e-119
+    { 0x811CCC668829B887, 0x0806357D5A3F525F },  // 1.0e-118
+    { 0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7 },  // 1.0e-117
+    { 0xC9BCFF6034C13052, 0xFC89B393DD02F0B5 },  // 1.0e-116
+    { 0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2 },  // 1.0e-115
+    { 0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D },  // 1.0e-114
+    { 0xC5029163F384A931, 0x0A9E795E65D4DF11 },  // 1.0e-113
+    { 0xF64335BCF065D37D, 0x4D4617B5FF4A16D5 },  // 1.0e-112
+    { 0x99EA0196163FA42E, 0x504BCED1BF8E4E45 },  // 1.0e-111
+    { 0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6 },  // 1.0e-110
+    { 0xF07DA27A82C37088, 0x5D767327BB4E5A4C },  // 1.0e-109
+    { 0x964E858C91BA2655, 0x3A6A07F8D510F86F },  // 1.0e-108
+    { 0xBBE226EFB628AFEA, 0x890489F70A55368B },  // 1.0e-107
+    { 0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E },  // 1.0e-106
+    { 0x92C8AE6B464FC96F, 0x3B0B8BC90012929D },  // 1.0e-105
+    { 0xB77ADA0617E3BBCB, 0x09CE6EBB40173744 },  // 1.0e-104
+    { 0xE55990879DDCAABD, 0xCC420A6A101D0515 },  // 1.0e-103
+    { 0x8F57FA54C2A9EAB6, 0x9FA946824A12232D },  // 1.0e-102
+    { 0xB32DF8E9F3546564, 0x47939822DC96ABF9 },  // 1.0e-101
+    { 0xDFF9772470297EBD, 0x59787E2B93BC56F7 },  // 1.0e-100
+    { 0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A },  // 1.0e-099
+    { 0xAEFAE51477A06B03, 0xEDE622920B6B23F1 },  // 1.0e-098
+    { 0xDAB99E59958885C4, 0xE95FAB368E45ECED },  // 1.0e-097
+    { 0x88B402F7FD75539B, 0x11DBCB0218EBB414 },  // 1.0e-096
+    { 0xAAE103B5FCD2A881, 0xD652BDC29F26A119 },  // 1.0e-095
+    { 0xD59944A37C0752A2, 0x4BE76D3346F0495F },  // 1.0e-094
+    { 0x857FCAE62D8493A5, 0x6F70A4400C562DDB },  // 1.0e-093
+    { 0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952 },  // 1.0e-092
+    { 0xD097AD07A71F26B2, 0x7E2000A41346A7A7 },  // 1.0e-091
+    { 0x825ECC24C873782F, 0x8ED400668C0C28C8 },  // 1.0e-090
+    { 0xA2F67F2DFA90563B, 0x728900802F0F32FA },  // 1.0e-089
+    { 0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9 },  // 1.0e-088
+    { 0xFEA126B7D78186BC, 0xE2F610C84987BFA8 },  // 1.0e-087
+    { 0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9 },  // 1.0e-086
+    { 0xC6EDE63FA05D3143, 0x91503D1C79720DBB },  // 1.0e-085
+    { 0xF8A95FCF88747D94, 0x75A44C6397CE912A },  // 1.0e-084
+    { 0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA },  // 1.0e-083
+    { 0xC24452DA229B021B, 0xFBE85BADCE996168 },  // 1.0e-082
+    { 0xF2D56790AB41C2A2, 0xFAE27299423FB9C3 },  // 1.0e-081
+    { 0x97C560BA6B0919A5, 0xDCCD879FC967D41A },  // 1.0e-080
+    { 0xBDB6B8E905CB600F, 0x5400E987BBC1C920 },  // 1.0e-079
+    { 0xED246723473E3813, 0x290123E9AAB23B68 },  // 1.0e-078
+    { 0x9436C0760C86E30B, 0xF9A0B6720AAF6521 },  // 1.0e-077
+    { 0xB94470938FA89BCE, 0xF808E40E8D5B3E69 },  // 1.0e-076
+    { 0xE7958CB87392C2C2, 0xB60B1D1230B20E04 },  // 1.0e-075
+    { 0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2 },  // 1.0e-074
+    { 0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3 },  // 1.0e-073
+    { 0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0 },  // 1.0e-072
+    { 0x8D590723948A535F, 0x579C487E5A38AD0E },  // 1.0e-071
+    { 0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851 },  // 1.0e-070
+    { 0xDCDB1B2798182244, 0xF8E431456CF88E65 },  // 1.0e-069
+    { 0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF },  // 1.0e-068
+    { 0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F },  // 1.0e-067
+    { 0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F },  // 1.0e-066
+    { 0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9 },  // 1.0e-065
+    { 0xA87FEA27A539E9A5, 0x3F2398D747B36224 },  // 1.0e-064
+    { 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD },  // 1.0e-063
+    { 0x83A3EEEEF9153E89, 0x1953CF68300424AC },  // 1.0e-062
+    { 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7 },  // 1.0e-061
+    { 0xCDB02555653131B6, 0x3792F412CB06794D },  // 1.0e-060
+    { 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0 },  // 1.0e-059
+    { 0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4 },  // 1.0e-058
+    { 0xC8DE047564D20A8B, 0xF245825A5A445275 },  // 1.0e-057
+    { 0xFB158592BE068D2E, 0xEED6E2F0F0D56712 },  // 1.0e-056
+    { 0x9CED737BB6C4183D, 0x55464DD69685606B },  // 1.0e-055
+    { 0xC428D05AA4751E4C, 0xAA97E14C3C26B886 },  // 1.0e-054
+    { 0xF53304714D9265DF, 0xD53DD99F4B3066A8 },  // 1.0e-053
+    { 0x993FE2C6D07B7FAB, 0xE546A8038EFE4029 },  // 1.0e-052
+    { 0xBF8FDB78849A5F96, 0xDE98520472BDD033 },  // 1.0e-051
+    { 0xEF73D256A5C0F77C, 0x963E66858F6D4440 },  // 1.0e-050
+    { 0x95A8637627989AAD, 0xDDE7001379A44AA8 },  // 1.0e-049
+    { 0xBB127C53B17EC159, 0x5560C018580D5D52 },  // 1.0e-048
+    { 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6 },  // 1.0e-047
+    { 0x9226712162AB070D, 0xCAB3961304CA70E8 },  // 1.0e-046
+    { 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22 },  // 1.0e-045
+    { 0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A },  // 1.0e-044
+    { 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242 },  // 1.0e-043
+    { 0xB267ED1940F1C61C, 0x55F038B237591ED3 },  // 1.0e-042
+    { 0xDF01E85F912E37A3, 0x6B6C46DEC52F6688 },  // 1.0e-041
+    { 0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015 },  // 1.0e-040
+    { 0xAE397D8AA96C1B77, 0xABEC975E0A0D081A },  // 1.0e-039
+    { 0xD9C7DCED53C72255, 0x96E7BD358C904A21 },  // 1.0e-038
+    { 0x881CEA14545C7575, 0x7E50D64177DA2E54 },  // 1.0e-037
+    { 0xAA242499697392D2, 0xDDE50BD1D5D0B9E9 },  // 1.0e-036
+    { 0xD4AD2DBFC3D07787, 0x955E4EC64B44E864 },  // 1.0e-035
+    { 0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E },  // 1.0e-034
+    { 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E },  // 1.0e-033
+    { 0xCFB11EAD453994BA, 0x67DE18EDA5814AF2 },  // 1.0e-032
+    { 0x81CEB32C4B43FCF4, 0x80EACF948770CED7 },  // 1.0e-031
+    { 0xA2425FF75E14FC31, 0xA1258379A94D028D },  // 1.0e-030
+    { 0xCAD2F7F5359A3B3E, 0x096EE45813A04330 },  // 1.0e-029
+    { 0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC },  // 1.0e-028
+    { 0x9E74D1B791E07E48, 0x775EA264CF55347E },  // 1.0e-027
+    { 0xC612062576589DDA, 0x95364AFE032A819E },  // 1.0e-026
+    { 0xF79687AED3EEC551, 0x3A83DDBD83F52205 },  // 1.0e-025
+    { 0x9ABE14CD44753B52, 0xC4926A9672793543 },  // 1.0e-024
+    { 0xC16D9A0095928A27, 0x75B7053C0F178294 },  // 1.0e-023
+    { 0xF1C90080BAF72CB1, 0x5324C68B12DD6339 },  // 1.0e-022
+    { 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04 },  // 1.0e-021
+    { 0xBCE5086492111AEA, 0x88F4BB1CA6BCF585 },  // 1.0e-020
+    { 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6 },  // 1.0e-019
+    { 0x9392EE8E921D5D07, 0x3AFF322E62439FD0 },  // 1.0e-018
+    { 0xB877AA3236A4B449, 0x09BEFEB9FAD487C3 },  // 1.0e-017
+    { 0xE69594BEC44DE15B, 0x4C2EBE687989A9B4 },  // 1.0e-016
+    { 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11 },  // 1.0e-015
+    { 0xB424DC35095CD80F, 0x538484C19EF38C95 },  // 1.0e-014
+    { 0xE12E13424BB40E13, 0x2865A5F206B06FBA },  // 1.0e-013
+    { 0x8CBCCC096F5088CB, 0xF93F87B7442E45D4 },  // 1.0e-012
+    { 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749 },  // 1.0e-011
+    { 0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C },  // 1.0e-010
+    { 0x89705F4136B4A597, 0x31680A88F8953031 },  // 1.0e-009
+    { 0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E },  // 1.0e-008
+    { 0xD6BF94D5E57A42BC, 0x3D32907604691B4D },  // 1.0e-007
+    { 0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110 },  // 1.0e-006
+    { 0xA7C5AC471B478423, 0x0FCF80DC33721D54 },  // 1.0e-005
+    { 0xD1B71758E219652B, 0xD3C36113404EA4A9 },  // 1.0e-004
+    { 0x83126E978D4FDF3B, 0x645A1CAC083126EA },  // 1.0e-003
+    { 0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4 },  // 1.0e-002
+    { 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD },  // 1.0e-001
+    { 0x8000000000000000, 0x0000000000000000 },  // 1.0e+000
+    { 0xA000000000000000, 0x0000000000000000 },  // 1.0e+001
+    { 0xC800000000000000, 0x0000000000000000 },  // 1.0e+002
+    { 0xFA00000000000000, 0x0000000000000000 },  // 1.0e+003
+    { 0x9C40000000000000, 0x0000000000000000 },  // 1.0e+004
+    { 0xC350000000000000, 0x0000000000000000 },  // 1.0e+005
+    { 0xF424000000000000, 0x0000000000000000 },  // 1.0e+006
+    { 0x9896800000000000, 0x0000000000000000 },  // 1.0e+007
+    { 0xBEBC200000000000, 0x0000000000000000 },  // 1.0e+008
+    { 0xEE6B280000000000, 0x0000000000000000 },  // 1.0e+009
+    { 0x9502F90000000000, 0x0000000000000000 },  // 1.0e+010
+    { 0xBA43B74000000000, 0x0000000000000000 },  // 1.0e+011
+    { 0xE8D4A51000000000, 0x0000000000000000 },  // 1.0e+012
+    { 0x9184E72A00000000, 0x0000000000000000 },  // 1.0e+013
+    { 0xB5E620F480000000, 0x0000000000000000 },  // 1.0e+014
+    { 0xE35FA931A0000000, 0x0000000000000000 },  // 1.0e+015
+    { 0x8E1BC9BF04000000, 0x0000000000000000 },  // 1.0e+016
+    { 0xB1A2BC2EC5000000, 0x0000000000000000 },  // 1.0e+017
+    { 0xDE0B6B3A76400000, 0x0000000000000000 },  // 1.0e+018
+    { 0x8AC7230489E80000, 0x0000000000000000 },  // 1.0e+019
+    { 0xAD78EBC5AC620000, 0x0000000000000000 },  // 1.0e+020
+    { 0xD8D726B7177A8000, 0x0000000000000000 },  // 1.0e+021
+    { 0x878678326EAC9000, 0x0000000000000000 },  // 1.0e+022
+    { 0xA968163F0A57B400, 0x0000000000000000 },  // 1.0e+023
+    { 0xD3C21BCECCEDA100, 0x0000000000000000 },  // 1.0e+024
+    { 0x84595161401484A0, 0x0000000000000000 },  // 1.0e+025
+    { 0xA56FA5B99019A5C8, 0x0000000000000000 },  // 1.0e+026
+    { 0xCECB8F27F4200F3A, 0x0000000000000000 },  // 1.0e+027
+    { 0x813F3978F8940984, 0x4000000000000000 },  // 1.0e+028
+    { 0xA18F07D736B90BE5, 0x5000000000000000 },  // 1.0e+029
+    { 0xC9F2C9CD04674EDE, 0xA400000000000000 },  // 1.0e+030
+    { 0xFC6F7C4045812296, 0x4D00000000000000 },  // 1.0e+031
+    { 0x9DC5ADA82B70B59D, 0xF020000000000000 },  // 1.0e+032
+    { 0xC5371912364CE305, 0x6C28000000000000 },  // 1.0e+033
+    { 0xF684DF56C3E01BC6, 0xC732000000000000 },  // 1.0e+034
+    { 0x9A130B963A6C115C, 0x3C7F400000000000 },  // 1.0e+035
+    { 0xC097CE7BC90715B3, 0x4B9F100000000000 },  // 1.0e+036
+    { 0xF0BDC21ABB48DB20, 0x1E86D40000000000 },  // 1.0e+037
+    { 0x96769950B50D88F4, 0x1314448000000000 },  // 1.0e+038
+    { 0xBC143FA4E250EB31, 0x17D955A000000000 },  // 1.0e+039
+    { 0xEB194F8E1AE525FD, 0x5DCFAB0800000000 },  // 1.0e+040
+    { 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000 },  // 1.0e+041
+    { 0xB7ABC627050305AD, 0xF14A3D9E40000000 },  // 1.0e+042
+    { 0xE596B7B0C643C719, 0x6D9CCD05D0000000 },  // 1.0e+043
+    { 0x8F7E32CE7BEA5C6F, 0xE4820023A2000000 },  // 1.0e+044
+    { 0xB35DBF821AE4F38B, 0xDDA2802C8A800000 },  // 1.0e+045
+    { 0xE0352F62A19E306E, 0xD50B2037AD200000 },  // 1.0e+046
+    { 0x8C213D9DA502DE45, 0x4526F422CC340000 },  // 1.0e+047
+    { 0xAF298D050E4395D6, 0x9670B12B7F410000 },  // 1.0e+048
+    { 0xDAF3F04651D47B4C, 0x3C0CDD765F114000 },  // 1.0e+049
+    { 0x88D8762BF324CD0F, 0xA5880A69FB6AC800 },  // 1.0e+050
+    { 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00 },  // 1.0e+051
+    { 0xD5D238A4ABE98068, 0x72A4904598D6D880 },  // 1.0e+052
+    { 0x85A36366EB71F041, 0x47A6DA2B7F864750 },  // 1.0e+053
+    { 0xA70C3C40A64E6C51, 0x999090B65F67D924 },  // 1.0e+054
+    { 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D },  // 1.0e+055
+    { 0x82818F1281ED449F, 0xBFF8F10E7A8921A4 },  // 1.0e+056
+    { 0xA321F2D7226895C7, 0xAFF72D52192B6A0D },  // 1.0e+057
+    { 0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490 },  // 1.0e+058
+    { 0xFEE50B7025C36A08, 0x02F236D04753D5B4 },  // 1.0e+059
+    { 0x9F4F2726179A2245, 0x01D762422C946590 },  // 1.0e+060
+    { 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5 },  // 1.0e+061
+    { 0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2 },  // 1.0e+062
+    { 0x9B934C3B330C8577, 0x63CC55F49F88EB2F },  // 1.0e+063
+    { 0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB },  // 1.0e+064
+    { 0xF316271C7FC3908A, 0x8BEF464E3945EF7A },  // 1.0e+065
+    { 0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC },  // 1.0e+066
+    { 0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317 },  // 1.0e+067
+    { 0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD },  // 1.0e+068
+    { 0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A },  // 1.0e+069
+    { 0xB975D6B6EE39E436, 0xB3E2FD538E122B44 },  // 1.0e+070
+    { 0xE7D34C64A9C85D44, 0x60DBBCA87196B616 },  // 1.0e+071
+    { 0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD },  // 1.0e+072
+    { 0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41 },  // 1.0e+073
+    { 0xE264589A4DCDAB14, 0xC696963C7EED2DD1 },  // 1.0e+074
+    { 0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2 },  // 1.0e+075
+    { 0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB },  // 1.0e+076
+    { 0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE },  // 1.0e+077
+    { 0x8A2DBF142DFCC7AB, 0x6E3569326C784337 },  // 1.0e+078
+    { 0xACB92ED9397BF996, 0x49C2C37F07965404 },  // 1.0e+079
+    { 0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906 },  // 1.0e+080
+    { 0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3 },  // 1.0e+081
+    { 0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C },  // 1.0e+082
+    { 0xD2D80DB02AABD62B, 0xF50A3FA490C30190 },  // 1.0e+083
+    { 0x83C7088E1AAB65DB, 0x792667C6DA79E0FA },  // 1.0e+084
+    { 0xA4B8CAB1A1563F52, 0x577001B891185938 },  // 1.0e+085
+    { 0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86 },  // 1.0e+086
+    { 0x80B05E5AC60B6178, 0x544F8158315B05B4 },  // 1.0e+087
+    { 0xA0DC75F1778E39D6, 0x696361AE3DB1C721 },  // 1.0e+088
+    { 0xC913936DD571C84C, 0x03BC3A19CD1E38E9 },  // 1.0e+089
+    { 0xFB5878494ACE3A5F, 0x04AB48A04065C723 },  // 1.0e+090
+    { 0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76 },  // 1.0e+091
+    { 0xC45D1DF942711D9A, 0x3BA5D0BD324F8394 },  // 1.0e+092
+    { 0xF5746577930D6500, 0xCA8F44EC7EE36479 },  // 1.0e+093
+    { 0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB },  // 1.0e+094
+    { 0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E },  // 1.0e+095
+    { 0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E },  // 1.0e+096
+    { 0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12 },  // 1.0e+097
+    { 0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97 },  // 1.0e+098
+    { 0xEA1575143CF97226, 0xF52D09D71A3293BD },  // 1.0e+099
+    { 0x924D692CA61BE758, 0x593C2626705F9C56 },  // 1.0e+100
+    { 0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C },  // 1.0e+101
+    { 0xE498F455C38B997A, 0x0B6DFB9C0F956447 },  // 1.0e+102
+    { 0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC },  // 1.0e+103
+    { 0xB2977EE300C50FE7, 0x58EDEC91EC2CB657 },  // 1.0e+104
+    { 0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED },  // 1.0e+105
+    { 0x8B865B215899F46C, 0xBD79E0D20082EE74 },  // 1.0e+106
+    { 0xAE67F1E9AEC07187, 0xECD8590680A3AA11 },  // 1.0e+107
+    { 0xDA01EE641A708DE9, 0xE80E6F4820CC9495 },  // 1.0e+108
+    { 0x884134FE908658B2, 0x3109058D147FDCDD },  // 1.0e+109
+    { 0xAA51823E34A7EEDE, 0xBD4B46F0599FD415 },  // 1.0e+110
+    { 0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A },  // 1.0e+111
+    { 0x850FADC09923329E, 0x03E2CF6BC604DDB0 },  // 1.0e+112
+    { 0xA6539930BF6BFF45, 0x84DB8346B786151C },  // 1.0e+113
+    { 0xCFE87F7CEF46FF16, 0xE612641865679A63 },  // 1.0e+114
+    { 0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E },  // 1.0e+115
+    { 0xA26DA3999AEF7749, 0xE3BE5E330F38F09D },  // 1.0e+116
+    { 0xCB090C8001AB551C, 0x5CADF5BFD3072CC5 },  // 1.0e+117
+    { 0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6 },  // 1.0e+118
+    { 0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA },  // 1.0e+119
+    { 0xC646D63501A1511D, 0xB281E1FD541501B8 },  // 1.0e+120
+    { 0xF7D88BC24209A565, 0x1F225A7CA91A4226 },  // 1.0e+121
+    { 0x9AE757596946075F, 0x3375788DE9B06958 },  // 1.0e+122
+    { 0xC1A12D2FC3978937, 0x0052D6B1641C83AE },  // 1.0e+123
+    { 0xF209787BB47D6B84, 0xC0678C5DBD23A49A },  // 1.0e+124
+    { 0x9745EB4D50CE6332, 0xF840B7BA963646E0 },  // 1.0e+125
+    { 0xBD176620A501FBFF, 0xB650E5A93BC3D898 },  // 1.0e+126
+    { 0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE },  // 1.0e+127
+    { 0x93BA47C980E98CDF, 0xC66F336C36B10137 },  // 1.0e+128
+    { 0xB8A8D9BBE123F017, 0xB80B0047445D4184 },  // 1.0e+129
+    { 0xE6D3102AD96CEC1D, 0xA60DC059157491E5 },  // 1.0e+130
+    { 0x9043EA1AC7E41392, 0x87C89837AD68DB2F },  // 1.0e+131
+    { 0xB454E4A179DD1877, 0x29BABE4598C311FB },  // 1.0e+132
+    { 0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A },  // 1.0e+133
+    { 0x8CE2529E2734BB1D, 0x1899E4A65F58660C },  // 1.0e+134
+    { 0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F },  // 1.0e+135
+    { 0xDC21A1171D42645D, 0x76707543F4FA1F73 },  // 1.0e+136
+    { 0x899504AE72497EBA, 0x6A06494A791C53A8 },  // 1.0e+137
+    { 0xABFA45DA0EDBDE69, 0x0487DB9D17636892 },  // 1.0e+138
+    { 0xD6F8D7509292D603, 0x45A9D2845D3C42B6 },  // 1.0e+139
+    { 0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2 },  // 1.0e+140
+    { 0xA7F26836F282B732, 0x8E6CAC7768D7141E },  // 1.0e+141
+    { 0xD1EF0244AF2364FF, 0x3207D795430CD926 },  // 1.0e+142
+    { 0x8335616AED761F1F, 0x7F44E6BD49E807B8 },  // 1.0e+143
+    { 0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6 },  // 1.0e+144
+    { 0xCD036837130890A1, 0x36DBA887C37A8C0F },  // 1.0e+145
+    { 0x802221226BE55A64, 0xC2494954DA2C9789 },  // 1.0e+146
+    { 0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C },  // 1.0e+147
+    { 0xC83553C5C8965D3D, 0x6F92829494E5ACC7 },  // 1.0e+148
+    { 0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9 },  // 1.0e+149
+    { 0x9C69A97284B578D7, 0xFF2A760414536EFB },  // 1.0e+150
+    { 0xC38413CF25E2D70D, 0xFEF5138519684ABA },  // 1.0e+151
+    { 0xF46518C2EF5B8CD1, 0x7EB258665FC25D69 },  // 1.0e+152
+    { 0x98BF2F79D5993802, 0xEF2F773FFBD97A61 },  // 1.0e+153
+    { 0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA },  // 1.0e+154
+    { 0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38 },  // 1.0e+155
+    { 0x952AB45CFA97A0B2, 0xDD945A747BF26183 },  // 1.0e+156
+    { 0xBA756174393D88DF, 0x94F971119AEEF9E4 },  // 1.0e+157
+    { 0xE912B9D1478CEB17, 0x7A37CD5601AAB85D },  // 1.0e+158
+    { 0x91ABB422CCB812EE, 0xAC62E055C10AB33A },  // 1.0e+159
+    { 0xB616A12B7FE617AA, 0x577B986B314D6009 },  // 1.0e+160
+    { 0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B },  // 1.0e+161
+    { 0x8E41ADE9FBEBC27D, 0x14588F13BE847307 },  // 1.0e+162
+    { 0xB1D219647AE6B31C, 0x596EB2D8AE258FC8 },  // 1.0e+163
+    { 0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB },  // 1.0e+164
+    { 0x8AEC23D680043BEE, 0x25DE7BB9480D5854 },  // 1.0e+165
+    { 0xADA72CCC20054AE9, 0xAF561AA79A10AE6A },  // 1.0e+166
+    { 0xD910F7FF28069DA4, 0x1B2BA1518094DA04 },  // 1.0e+167
+    { 0x87AA9AFF79042286, 0x90FB44D2F05D0842 },  // 1.0e+168
+    { 0xA99541BF57452B28, 0x353A1607AC744A53 },  // 1.0e+169
+    { 0xD3FA922F2D1675F2, 0x42889B8997915CE8 },  // 1.0e+170
+    { 0x847C9B5D7C2E09B7, 0x69956135FEBADA11 },  // 1.0e+171
+    { 0xA59BC234DB398C25, 0x43FAB9837E699095 },  // 1.0e+172
+    { 0xCF02B2C21207EF2E, 0x94F967E45E03F4BB },  // 1.0e+173
+    { 0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5 },  // 1.0e+174
+    { 0xA1BA1BA79E1632DC, 0x6462D92A69731732 },  // 1.0e+175
+    { 0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE },  // 1.0e+176
+    { 0xFCB2CB35E702AF78, 0x5CDA735244C3D43E },  // 1.0e+177
+    { 0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7 },  // 1.0e+178
+    { 0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0 },  // 1.0e+179
+    { 0xF6C69A72A3989F5B, 0x8AAD549E57273D45 },  // 1.0e+180
+    { 0x9A3C2087A63F6399, 0x36AC54E2F678864B },  // 1.0e+181
+    { 0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD },  // 1.0e+182
+    { 0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5 },  // 1.0e+183
+    { 0x969EB7C47859E743, 0x9F644AE5A4B1B325 },  // 1.0e+184
+    { 0xBC4665B596706114, 0x873D5D9F0DDE1FEE },  // 1.0e+185
+    { 0xEB57FF22FC0C7959, 0xA90CB506D155A7EA },  // 1.0e+186
+    { 0x9316FF75DD87CBD8, 0x09A7F12442D588F2 },  // 1.0e+187
+    { 0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F },  // 1.0e+188
+    { 0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA },  // 1.0e+189
+    { 0x8FA475791A569D10, 0xF96E017D694487BC },  // 1.0e+190
+    { 0xB38D92D760EC4455, 0x37C981DCC395A9AC },  // 1.0e+191
+    { 0xE070F78D3927556A, 0x85BBE253F47B1417 },  // 1.0e+192
+    { 0x8C469AB843B89562, 0x93956D7478CCEC8E },  // 1.0e+193
+    { 0xAF58416654A6BABB, 0x387AC8D1970027B2 },  // 1.0e+194
+    { 0xDB2E51BFE9D0696A, 0x06997B05FCC0319E },  // 1.0e+195
+    { 0x88FCF317F22241E2, 0x441FECE3BDF81F03 },  // 1.0e+196
+    { 0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3 },  // 1.0e+197
+    { 0xD60B3BD56A5586F1, 0x8A71E223D8D3B074 },  // 1.0e+198
+    { 0x85C7056562757456, 0xF6872D5667844E49 },  // 1.0e+199
+    { 0xA738C6BEBB12D16C, 0xB428F8AC016561DB },  // 1.0e+200
+    { 0xD106F86E69D785C7, 0xE13336D701BEBA52 },  // 1.0e+201
+    { 0x82A45B450226B39C, 0xECC0024661173473 },  // 1.0e+202
+    { 0xA34D721642B06084, 0x27F002D7F95D0190 },  // 1.0e+203
+    { 0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4 },  // 1.0e+204
+    { 0xFF290242C83396CE, 0x7E67047175A15271 },  // 1.0e+205
+    { 0x9F79A169BD203E41, 0x0F0062C6E984D386 },  // 1.0e+206
+    { 0xC75809C42C684DD1, 0x52C07B78A3E60868 },  // 1.0e+207
+    { 0xF92E0C3537826145, 0xA7709A56CCDF8A82 },  // 1.0e+208
+    { 0x9BBCC7A142B17CCB, 0x88A66076400BB691 },  // 1.0e+209
+    { 0xC2ABF989935DDBFE, 0x6ACFF893D00EA435 },  // 1.0e+210
+    { 0xF356F7EBF83552FE, 0x0583F6B8C4124D43 },  // 1.0e+211
+    { 0x98165AF37B2153DE, 0xC3727A337A8B704A },  // 1.0e+212
+    { 0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C },  // 1.0e+213
+    { 0xEDA2EE1C7064130C, 0x1162DEF06F79DF73 },  // 1.0e+214
+    { 0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8 },  // 1.0e+215
+    { 0xB9A74A0637CE2EE1, 0x6D953E2BD7173692 },  // 1.0e+216
+    { 0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437 },  // 1.0e+217
+    { 0x910AB1D4DB9914A0, 0x1D9C9892400A22A2 },  // 1.0e+218
+    { 0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B },  // 1.0e+219
+    { 0xE2A0B5DC971F303A, 0x2E44AE64840FD61D },  // 1.0e+220
+    { 0x8DA471A9DE737E24, 0x5CEAECFED289E5D2 },  // 1.0e+221
+    { 0xB10D8E1456105DAD, 0x7425A83E872C5F47 },  // 1.0e+222
+    { 0xDD50F1996B947518, 0xD12F124E28F77719 },  // 1.0e+223
+    { 0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F },  // 1.0e+224
+    { 0xACE73CBFDC0BFB7B, 0x636CC64D1001550B },  // 1.0e+225
+    { 0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E },  // 1.0e+226
+    { 0x8714A775E3E95C78, 0x65ACFAEC34810A71 },  // 1.0e+227
+    { 0xA8D9D1535CE3B396, 0x7F1839A741A14D0D },  // 1.0e+228
+    { 0xD31045A8341CA07C, 0x1EDE48111209A050 },  // 1.0e+229
+    { 0x83EA2B892091E44D, 0x934AED0AAB460432 },  // 1.0e+230
+    { 0xA4E4B66B68B65D60, 0xF81DA84D5617853F },  // 1.0e+231
+    { 0xCE1DE40642E3F4B9, 0x36251260AB9D668E },  // 1.0e+232
+    { 0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019 },  // 1.0e+233
+    { 0xA1075A24E4421730, 0xB24CF65B8612F81F },  // 1.0e+234
+    { 0xC94930AE1D529CFC, 0xDEE033F26797B627 },  // 1.0e+235
+    { 0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1 },  // 1.0e+236
+    { 0x9D412E0806E88AA5, 0x8E1F289560EE864E },  // 1.0e+237
+    { 0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2 },  // 1.0e+238
+    { 0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB },  // 1.0e+239
+    { 0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29 },  // 1.0e+240
+    { 0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3 },  // 1.0e+241
+    { 0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0 },  // 1.0e+242
+    { 0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E },  // 1.0e+243
+    { 0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1 },  // 1.0e+244
+    { 0xEA53DF5FD18D5513, 0x84C86189216DC5ED },  // 1.0e+245
+    { 0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4 },  // 1.0e+246
+    { 0xB7118682DBB66A77, 0x3FBC8C33221DC2A1 },  // 1.0e+247
+    { 0xE4D5E82392A40515, 0x0FABAF3FEAA5334A },  // 1.0e+248
+    { 0x8F05B1163BA6832D, 0x29CB4D87F2A7400E },  // 1.0e+249
+    { 0xB2C71D5BCA9023F8, 0x743E20E9EF511012 },  // 1.0e+250
+    { 0xDF78E4B2BD342CF6, 0x914DA9246B255416 },  // 1.0e+251
+    { 0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E },  // 1.0e+252
+    { 0xAE9672ABA3D0C320, 0xA184AC2473B529B1 },  // 1.0e+253
+    { 0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E },  // 1.0e+254
+    { 0x8865899617FB1871, 0x7E2FA67C7A658892 },  // 1.0e+255
+    { 0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7 },  // 1.0e+256
+    { 0xD51EA6FA85785631, 0x552A74227F3EA565 },  // 1.0e+257
+    { 0x8533285C936B35DE, 0xD53A88958F87275F },  // 1.0e+258
+    { 0xA67FF273B8460356, 0x8A892ABAF368F137 },  // 1.0e+259
+    { 0xD01FEF10A657842C, 0x2D2B7569B0432D85 },  // 1.0e+260
+    { 0x8213F56A67F6B29B, 0x9C3B29620E29FC73 },  // 1.0e+261
+    { 0xA298F2C501F45F42, 0x8349F3BA91B47B8F },  // 1.0e+262
+    { 0xCB3F2F7642717713, 0x241C70A936219A73 },  // 1.0e+263
+    { 0xFE0EFB53D30DD4D7, 0xED238CD383AA0110 },  // 1.0e+264
+    { 0x9EC95D1463E8A506, 0xF4363804324A40AA },  // 1.0e+265
+    { 0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5 },  // 1.0e+266
+    { 0xF81AA16FDC1B81DA, 0xDD94B7868E94050A },  // 1.0e+267
+    { 0x9B10A4E5E9913128, 0xCA7CF2B4191C8326 },  // 1.0e+268
+    { 0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0 },  // 1.0e+269
+    { 0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC },  // 1.0e+270
+    { 0x976E41088617CA01, 0xD5BE0503E085D813 },  // 1.0e+271
+    { 0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18 },  // 1.0e+272
+    { 0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E },  // 1.0e+273
+    { 0x93E1AB8252F33B45, 0xCABB90E5C942B503 },  // 1.0e+274
+    { 0xB8DA1662E7B00A17, 0x3D6A751F3B936243 },  // 1.0e+275
+    { 0xE7109BFBA19C0C9D, 0x0CC512670A783AD4 },  // 1.0e+276
+    { 0x906A617D450187E2, 0x27FB2B80668B24C5 },  // 1.0e+277
+    { 0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6 },  // 1.0e+278
+    { 0xE1A63853BBD26451, 0x5E7873F8A0396973 },  // 1.0e+279
+    { 0x8D07E33455637EB2, 0xDB0B487B6423E1E8 },  // 1.0e+280
+    { 0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62 },  // 1.0e+281
+    { 0xDC5C5301C56B75F7, 0x7641A140CC7810FB },  // 1.0e+282
+    { 0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D },  // 1.0e+283
+    { 0xAC2820D9623BF429, 0x546345FA9FBDCD44 },  // 1.0e+284
+    { 0xD732290FBACAF133, 0xA97C177947AD4095 },  // 1.0e+285
+    { 0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D },  // 1.0e+286
+    { 0xA81F301449EE8C70, 0x5C68F256BFFF5A74 },  // 1.0e+287
+    { 0xD226FC195C6A2F8C, 0x73832EEC6FFF3111 },  // 1.0e+288
+    { 0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB },  // 1.0e+289
+    { 0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55 },  // 1.0e+290
+    { 0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB },  // 1.0e+291
+    { 0x80444B5E7AA7CF85, 0x7980D163CF5B81B3 },  // 1.0e+292
+    { 0xA0555E361951C366, 0xD7E105BCC332621F },  // 1.0e+293
+    { 0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7 },  // 1.0e+294
+    { 0xFA856334878FC150, 0xB14F98F6F0FEB951 },  // 1.0e+295
+    { 0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3 },  // 1.0e+296
+    { 0xC3B8358109E84F07, 0x0A862F80EC4700C8 },  // 1.0e+297
+    { 0xF4A642E14C6262C8, 0xCD27BB612758C0FA },  // 1.0e+298
+    { 0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C },  // 1.0e+299
+    { 0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3 },  // 1.0e+300
+    { 0xEEEA5D5004981478, 0x1858CCFCE06CAC74 },  // 1.0e+301
+    { 0x95527A5202DF0CCB, 0x0F37801E0C43EBC8 },  // 1.0e+302
+    { 0xBAA718E68396CFFD, 0xD30560258F54E6BA },  // 1.0e+303
+    { 0xE950DF20247C83FD, 0x47C6B82EF32A2069 },  // 1.0e+304
+    { 0x91D28B7416CDD27E, 0x4CDC331D57FA5441 },  // 1.0e+305
+    { 0xB6472E511C81471D, 0xE0133FE4ADF8E952 },  // 1.0e+306
+    { 0xE3D8F9E563A198E5, 0x58180FDDD97723A6 },  // 1.0e+307
+    { 0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648 },  // 1.0e+308
+  };
+static_assert(noadl::countof(s_decmult_F) == 651);
+
+constexpr double s_decpow_D[] =
+  {
+    1.0e+00, 1.0e+01, 1.0e+02, 1.0e+03, 1.0e+04, 1.0e+05, 1.0e+06, 1.0e+07,
+    1.0e+08, 1.0e+09, 1.0e+10, 1.0e+11, 1.0e+12, 1.0e+13, 1.0e+14, 1.0e+15,
+    1.0e+16, 1.0e+17, 1.0e+18, 1.0e+19, 1.0e+20, 1.0e+21, 1.0e+22,
+  };
+
+constexpr float s_decpow_S[] =
+  {
+    1.0e+00f, 1.0e+01f, 1.0e+02f, 1.0e+03f, 1.0e+04f, 1.0e+05f, 1.0e+06f, 1.0e+07f,
+    1.0e+08f, 1.0e+09f, 1.0e+10f,
   };
-static_assert(noadl::countof(s_decmult_F) == 652);
 
 double
-do_xldexp_I(uint64_t ireg, int bexp, bool single)
+do_xbits_F(uint64_t mant, int32_t bexp, bool single)
+  {
+    // Compose a floating-point number from its biased exponent and its fraction. If the
+    // fraction has its hidden bit set, it is carried into the exponent field.
+    if(ROCKET_UNEXPECT(single)) {
+      uint32_t bits = (static_cast<uint32_t>(bexp) << 23) + static_cast<uint32_t>(mant);
+      float value;
+      ::std::memcpy(&value, &bits, sizeof(value));
+      return static_cast<double>(value);
+    }
+    else {
+      uint64_t bits = (static_cast<uint64_t>(bexp) << 52) + mant;
+      double value;
+      ::std::memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  }
+
+double
+do_xldexp_I(uint64_t ireg, bool more, int32_t bexp, bool single)
   {
-    ROCKET_ASSERT(ireg <= INT64_MAX);
-    // Round it correctly.
-    if(ROCKET_UNEXPECT(single))
-      return (double)::std::ldexp((float)(int64_t)ireg, bexp);
+    ROCKET_ASSERT(ireg != 0);
+    // Get the number of significant bits and the range of exponents.
+    int32_t mbits = single ? 23 : 52;
+    int32_t emin = single ? -126 : -1022;
+    int32_t emax = single ? +127 : +1023;
+    // Adjust `ireg` such that its MSB is non-zero. The value is `1.ireg * 2^bexp` now.
+    int32_t lzcnt = __builtin_clzll(ireg);
+    ireg <<= lzcnt;
+    bexp += 63 - lzcnt;
+    if(bexp > emax)
+      return HUGE_VAL;
+    // Get the number of bits to shift out, which is larger for subnormal numbers.
+    int32_t shift = 63 - mbits + ::std::max(emin - bexp, 0);
+    if(shift > 64)
+      return 0;
+    // Round the mantissa to nearest, ties to even. The dropped bits are kept in the
+    // high-order part of `rem`, and `more` denotes whether any non-zero bits follow.
+    uint64_t mant = 0;
+    uint64_t rem = ireg;
+    if(shift < 64) {
+      mant = ireg >> shift;
+      rem = ireg << (64 - shift);
+    }
+    constexpr uint64_t half = UINT64_C(1) << 63;
+    if((rem > half) || ((rem == half) && (more || (mant & 1))))
+      mant += 1;
+    // Compose the result. Note the hidden bit is added into the exponent field.
+    if(bexp < emin)
+      return do_xbits_F(mant, 0, single);
+    if(mant >> (mbits + 1)) {
+      mant >>= 1;
+      bexp += 1;
+      if(bexp > emax)
+        return HUGE_VAL;
+    }
+    return do_xbits_F(mant, bexp - emin, single);
+  }
+
+double
+do_xmul_F(uint64_t ireg, int32_t expo, bool single)
+  {
+    ROCKET_ASSERT(ireg != 0);
+    // This is the Eisel-Lemire algorithm. It is exact for all 64-bit values of
+    // `ireg`, but is not applicable if `ireg` is inexact itself.
+    // Get the number of significant bits and the range of exponents.
+    int32_t mbits = single ? 23 : 52;
+    int32_t emin = single ? -127 : -1023;
+    int32_t einf = single ? 0xFF : 0x7FF;
+    // Powers of ten that are too large or too small always overflow or underflow.
+    if(expo < (single ? -65 : -342))
+      return 0;
+    if(expo > (single ? +38 : +308))
+      return HUGE_VAL;
+    // Adjust `ireg` such that its MSB is non-zero.
+    const auto& mult = s_decmult_F[expo + 342];
+    int32_t lzcnt = __builtin_clzll(ireg);
+    ireg <<= lzcnt;
+    // Multiply the mantissa by the 128-bit multiplier. The lower half of the
+    // multiplier is only necessary if the result might be close to a halfway point.
+    __extension__ using uint128 = unsigned __int128;
+    uint128 xhi = static_cast<uint128>(ireg) * mult.hi;
+    uint64_t phi = static_cast<uint64_t>(xhi >> 64);
+    uint64_t plo = static_cast<uint64_t>(xhi);
+    uint64_t mask = UINT64_MAX >> (mbits + 3);
+    if((phi & mask) == mask) {
+      uint128 xlo = static_cast<uint128>(ireg) * mult.lo;
+      uint64_t carry = static_cast<uint64_t>(xlo >> 64);
+      plo += carry;
+      phi += plo < carry;
+    }
+    // Take the `mbits + 3` most significant bits of the product. The binary exponent
+    // is `floor(expo * log2(10))`, which is calculated with fixed-point arithmetic.
+    int32_t upper = static_cast<int32_t>(phi >> 63);
+    int32_t shift = upper + 64 - mbits - 3;
+    uint64_t mant = phi >> shift;
+    int32_t bexp = ((expo * 217706) >> 16) + 63 + upper - lzcnt - emin;
+    if(bexp <= 0) {
+      // The result is subnormal, where halfway cases are not possible.
+      if(1 - bexp >= 64)
+        return 0;
+      mant >>= 1 - bexp;
+      mant += mant & 1;
+      mant >>= 1;
+      bexp = (mant >> mbits) ? 1 : 0;
+      return do_xbits_F(mant & ~(UINT64_C(1) << mbits), bexp, single);
+    }
+    // If the product is exact and the result is exactly halfway between two values,
+    // round it to even. This is only possible with small powers of ten.
+    if((plo <= 1) && (expo >= (single ? -17 : -4)) && (expo <= (single ? +10 : +23))
+                  && ((mant & 3) == 1) && ((mant << shift) == phi))
+      mant &= ~UINT64_C(1);
+    // Round the mantissa to nearest.
+    mant += mant & 1;
+    mant >>= 1;
+    if(mant >> (mbits + 1)) {
+      mant >>= 1;
+      bexp += 1;
+    }
+    if(bexp >= einf)
+      return HUGE_VAL;
+    return do_xbits_F(mant & ~(UINT64_C(1) << mbits), bexp, single);
+  }
+
+struct bigint
+  {
+    uint32_t size;  // number of limbs in use
+    uint32_t limbs[100];  // little-endian
+  };
+
+void
+do_bigint_mul_add(bigint& x, uint32_t mult, uint32_t add)
+  {
+    uint64_t carry = add;
+    for(uint32_t i = 0;  i != x.size;  ++i) {
+      carry += static_cast<uint64_t>(x.limbs[i]) * mult;
+      x.limbs[i] = static_cast<uint32_t>(carry);
+      carry >>= 32;
+    }
+    if(carry != 0) {
+      ROCKET_ASSERT(x.size < noadl::countof(x.limbs));
+      x.limbs[x.size++] = static_cast<uint32_t>(carry);
+    }
+  }
+
+void
+do_bigint_mul_pow5(bigint& x, uint32_t count)
+  {
+    // 5^13 is the largest power of five that fits in a `uint32_t`.
+    uint32_t rem = count;
+    while(rem >= 13) {
+      do_bigint_mul_add(x, 1220703125, 0);
+      rem -= 13;
+    }
+    uint32_t mult = 1;
+    while(rem-- != 0)
+      mult *= 5;
+    do_bigint_mul_add(x, mult, 0);
+  }
+
+void
+do_bigint_shl(bigint& x, uint32_t count)
+  {
+    if(x.size == 0)
+      return;
+    uint32_t nlimbs = count / 32;
+    uint32_t nbits = count % 32;
+    ROCKET_ASSERT(x.size + nlimbs < noadl::countof(x.limbs));
+    // Shift bits, then limbs.
+    x.limbs[x.size] = 0;
+    if(nbits != 0)
+      for(uint32_t i = x.size;  i != 0;  --i)
+        x.limbs[i] = x.limbs[i] << nbits | x.limbs[i-1] >> (32 - nbits);
+    x.limbs[0] <<= nbits;
+    x.size += (x.limbs[x.size] != 0);
+    ::std::memmove(x.limbs + nlimbs, x.limbs, x.size * sizeof(uint32_t));
+    ::std::memset(x.limbs, 0, nlimbs * sizeof(uint32_t));
+    x.size += nlimbs;
+  }
+
+uint32_t
+do_bigint_bits(const bigint& x)
+  {
+    if(x.size == 0)
+      return 0;
+    return x.size * 32 - static_cast<uint32_t>(__builtin_clz(x.limbs[x.size-1]));
+  }
+
+int
+do_bigint_compare(const bigint& x, const bigint& y)
+  {
+    if(x.size != y.size)
+      return (x.size < y.size) ? -1 : +1;
+    for(uint32_t i = x.size;  i != 0;  --i)
+      if(x.limbs[i-1] != y.limbs[i-1])
+        return (x.limbs[i-1] < y.limbs[i-1]) ? -1 : +1;
+    return 0;
+  }
+
+void
+do_bigint_sub(bigint& x, const bigint& y)
+  {
+    ROCKET_ASSERT(do_bigint_compare(x, y) >= 0);
+    uint64_t borrow = 0;
+    for(uint32_t i = 0;  i != x.size;  ++i) {
+      uint64_t sub = borrow + ((i < y.size) ? y.limbs[i] : 0);
+      borrow = x.limbs[i] < sub;
+      x.limbs[i] = static_cast<uint32_t>(x.limbs[i] - sub);
+    }
+    while((x.size != 0) && (x.limbs[x.size-1] == 0))
+      x.size--;
+  }
+
+ROCKET_NOINLINE
+void
+do_xdecimal_exact(uint64_t& ireg, bool& more, int32_t& bexp, const char* rp, const char* eptr,
+                  int64_t expo)
+  {
+    // Convert a string of decimal digits, which may contain a radix point, times
+    // `10^expo`, to `ireg * 2^bexp`. `ireg` will have its MSB set. `more` is set
+    // if some non-zero bits have been truncated. Only the first 780 significant
+    // figures are taken into account. This is sufficient, as a halfway point of
+    // two adjacent values has at most 767 significant figures. If non-zero digits
+    // follow them, a trailing `1` is appended, so the result is never exact.
+    bigint num = { };
+    uint32_t ndigits = 0;
+    uint32_t chunk = 0;
+    uint32_t cmult = 1;
+    bool rtrunc = false;
+    for(const char* dp = rp;  dp != eptr;  ++dp) {
+      if(*dp == '.')
+        continue;
+      uint32_t dval = static_cast<uint32_t>(*dp - '0');
+      if(ndigits == 780) {
+        // Drop this digit.
+        expo += 1;
+        rtrunc |= dval != 0;
+        continue;
+      }
+      if((dval == 0) && (ndigits == 0))
+        continue;
+      // Accumulate up to nine digits before multiplying the big integer.
+      chunk = chunk * 10 + dval;
+      cmult *= 10;
+      ndigits += 1;
+      if(cmult == 1000000000) {
+        do_bigint_mul_add(num, cmult, chunk);
+        chunk = 0;
+        cmult = 1;
+      }
+    }
+    if(rtrunc) {
+      chunk = chunk * 10 + 1;
+      cmult *= 10;
+      expo -= 1;
+    }
+    do_bigint_mul_add(num, cmult, chunk);
+    ROCKET_ASSERT(num.size != 0);
+
+    // The value is `num / den * 2^expo` now.
+    bigint den = { 1, { 1 } };
+    if(expo >= 0)
+      do_bigint_mul_pow5(num, static_cast<uint32_t>(expo));
     else
-      return ::std::ldexp((double)(int64_t)ireg, bexp);
+      do_bigint_mul_pow5(den, static_cast<uint32_t>(-expo));
+
+    // Align them, such that `den <= num < den * 2`.
+    int64_t xexp = expo;
+    uint32_t nbits = do_bigint_bits(num);
+    uint32_t dbits = do_bigint_bits(den);
+    if(nbits > dbits) {
+      do_bigint_shl(den, nbits - dbits);
+      xexp += nbits - dbits;
+    }
+    else {
+      do_bigint_shl(num, dbits - nbits);
+      xexp -= dbits - nbits;
+    }
+    if(do_bigint_compare(num, den) < 0) {
+      do_bigint_shl(num, 1);
+      xexp -= 1;
+    }
+
+    // Perform long division. Each iteration yields a bit of the quotient.
+    ireg = 0;
+    for(uint32_t i = 0;  i != 64;  ++i) {
+      ireg <<= 1;
+      if(do_bigint_compare(num, den) >= 0) {
+        do_bigint_sub(num, den);
+        ireg |= 1;
+      }
+      do_bigint_shl(num, 1);
+    }
+    more = num.size != 0;
+    bexp = static_cast<int32_t>(xexp - 63);
   }
 
 }  // namespace
@@ -1033,9 +1402,14 @@ ascii_numget& ascii_numget::parse_F(const char*& bptr, const char* eptr, uint8_t
     else {
       // Check for the base prefix, which is optional.
       uint8_t base = do_get_base(rp, eptr, ibase);
-      // Get the mantissa.
+      // Get the mantissa. At most 19 decimal digits are kept, so adding one to it
+      // never overflows.
+      uint64_t limit = UINT64_MAX;
+      if(base == 10)
+        limit = UINT64_C(9'999'999'999'999'999'999);
+      const char* mptr = rp;
       mantissa m = { };
-      if(do_collect_U(m, rp, eptr, base, UINT64_MAX) == 0) {
+      if(do_collect_U(m, rp, eptr, base, limit) == 0) {
         return *this;
       }
       // Check for the radix point, which is optional.
@@ -1045,10 +1419,11 @@ ascii_numget& ascii_numget::parse_F(const char*& bptr, const char* eptr, uint8_t
         // Skip the radix point.
         rp += 1;
         // Get the fractional part, which is required.
-        nfrac = do_collect_U(m, rp, eptr, base, UINT64_MAX);
+        nfrac = do_collect_U(m, rp, eptr, base, limit);
         if(nfrac == 0)
           return *this;
       }
+      const char* mend = rp;
       // Initialize the exponent.
       int64_t expo = static_cast<int64_t>(m.novfl) - static_cast<int64_t>(nfrac);
       bool erdx = true;
@@ -1107,8 +1482,26 @@ ascii_numget& ascii_numget::parse_F(const char*& bptr, const char* eptr, uint8_t
         // Set an infinity if the exponent is too large.
         this->m_vcls = 2;  // infinity
       }
+      else if((base == 10) && (m.xvadd != 0) &&
+              ((do_xmul_F(m.value, static_cast<int32_t>(expo), false)
+                  != do_xmul_F(m.value + 1, static_cast<int32_t>(expo), false)) ||
+               (do_xmul_F(m.value, static_cast<int32_t>(expo), true)
+                  != do_xmul_F(m.value + 1, static_cast<int32_t>(expo), true)))) {
+        // Some significant figures have been truncated, and they affect how the
+        // value is rounded. This is rare, but the value has to be converted exactly
+        // from all digits. The result is stored as a binary number.
+        int32_t bexp;
+        bool more;
+        do_xdecimal_exact(this->m_mant, more, bexp, mptr, mend,
+                          expo - static_cast<int64_t>(m.novfl));
+        this->m_erdx = false;
+        this->m_madd = more;
+        this->m_base = base;
+        this->m_expo = bexp;
+      }
       else {
-        // Set the value.
+        // Set the value. If some significant figures have been truncated, they
+        // do not affect rounding of floating-point numbers.
         this->m_erdx = erdx;
         this->m_madd = m.xvadd != 0;
         this->m_base = base;
@@ -1390,50 +1783,40 @@ noexcept
         double freg;
         switch(base) {
           case 2: {
-            // Convert the mantissa to a floating-point number. The result is exact.
-            if(ireg >> 62) {
-              // Drop two bits from the right.
-              ireg = (ireg >> 2) | (((ireg >> 1) | ireg) & 1) | this->m_madd;
-              freg = do_xldexp_I(ireg, this->m_expo + 2, single);
-            }
-            else {
-              // Shift overflowed digits into the right.
-              ireg = (ireg << 1) | this->m_madd;
-              freg = do_xldexp_I(ireg, this->m_expo - 1, single);
-            }
+            // Convert the mantissa to a floating-point number. The result is rounded
+            // correctly, as the bits that have been shifted out are taken into account.
+            freg = do_xldexp_I(ireg, this->m_madd, this->m_expo, single);
             break;
           }
 
           case 10: {
-            // Get the multiplier.
-            uint32_t mpos = static_cast<uint32_t>(this->m_expo + 343);
-            if(mpos >= INT32_MAX) {
-              freg = 0;
+#if FLT_EVAL_METHOD == 0
+            // If both the mantissa and the multiplier can be represented exactly,
+            // the result is rounded correctly by a single multiplication or division.
+            if(!this->m_madd && (ireg <= (UINT64_C(1) << (single ? 24 : 53)))
+                             && (this->m_expo >= (single ? -10 : -22))
+                             && (this->m_expo <= (single ? +10 : +22))) {
+              if(ROCKET_UNEXPECT(single)) {
+                float ftemp = static_cast<float>(ireg);
+                if(this->m_expo < 0)
+                  ftemp /= s_decpow_S[-this->m_expo];
+                else
+                  ftemp *= s_decpow_S[this->m_expo];
+                freg = static_cast<double>(ftemp);
+              }
+              else {
+                freg = static_cast<double>(ireg);
+                if(this->m_expo < 0)
+                  freg /= s_decpow_D[-this->m_expo];
+                else
+                  freg *= s_decpow_D[this->m_expo];
+              }
               break;
             }
-            if(mpos >= noadl::countof(s_decmult_F)) {
-              freg = HUGE_VAL;
-              break;
-            }
-            const auto& mult = s_decmult_F[mpos];
-            // Adjust `ireg` such that its MSB is non-zero.
-            // TODO: Modern CPUs have intrinsics for LZCNT.
-            int32_t lzcnt = 0;
-            for(int i = 32; i != 0; i /= 2) {
-              if(ireg >> (64 - i))
-                continue;
-              ireg <<= i;
-              lzcnt += i;
-            }
-            // Multiply two 64-bit values and get the high-order half.
-            // TODO: Modern CPUs have intrinsics for this.
-            uint64_t xhi = ireg >> 32;
-            uint64_t xlo = ireg << 32 >> 32;
-            uint64_t yhi = mult.mant >> 32;
-            uint64_t ylo = mult.mant << 32 >> 32;
-            ireg = xhi * yhi + (((xlo * yhi >> 30) + (xhi * ylo >> 30) + (xlo * ylo >> 62)) >> 2);
-            // Convert the mantissa to a floating-point number.
-            freg = do_xldexp_I(ireg | 1, mult.bexp - lzcnt, single);
+#endif
+            // Multiply the mantissa by a power of ten. If some significant figures
+            // have been truncated, `parse_F()` has ensured that they do not matter.
+            freg = do_xmul_F(ireg, this->m_expo, single);
             break;
           }
 
@@ -146,57 +146,59 @@ do_xput_I_exp(char*& ep, const int& exp)
 
 #if 0
 /* This program is used to generate the multiplier table for decimal
- * numbers. Each multiplier for the mantissa is split into two parts.
- * The base of exponents is 2.
+ * numbers. Each multiplier is a power of ten, scaled by a power of two so
+ * it has 128 significant bits, truncated, then incremented by one. It is
+ * split into the higher and lower halves.
  *
  * Compile with:
- *   gcc -std=c99 -W{all,extra,{sign-,}conversion} table.c -lquadmath
+ *   gcc -std=c99 -W{all,extra,{sign-,}conversion} table.c -lgmp
 **/
 
-#include <quadmath.h>
+#include <gmp.h>
 #include <stdio.h>
 
 void
 do_print_one(int e)
   {
-    __float128 value, frac;
+    mpz_t num, den, g;
     int bexp;
-    long long mant;
 
-    // Calculate the boundary.
-    value = powq(10, e);
-    if(e == -324) {
-      // Truncate the underflowed value.
-      printf("\t{ %23s, ", "0");
+    // Calculate `10^e` as a fraction.
+    mpz_init_set_ui(num, 1);
+    mpz_init_set_ui(den, 1);
+    if(e >= 0)
+      mpz_ui_pow_ui(num, 10, (unsigned long)e);
+    else
+      mpz_ui_pow_ui(den, 10, (unsigned long)-e);
+
+    // Get the binary exponent, such that `2^bexp <= 10^e < 2^(bexp+1)`.
+    bexp = (int)mpz_sizeinbase(num, 2) - (int)mpz_sizeinbase(den, 2);
+    mpz_init(g);
+    if(bexp >= 0) {
+      mpz_mul_2exp(g, den, (unsigned long)bexp);
+      if(mpz_cmp(num, g) < 0)
+        bexp--;
     }
     else {
-      // Break it down into the fraction and exponent.
-      frac = frexpq(value, &bexp);
-      // Truncate the fraction to 53 bits. Do not round it.
-      frac = ldexpq(frac, 53);
-      mant = (long long)frac;
-      bexp = bexp - 1;
-      // Print the higher part in fixed-point format.
-      printf("\t{ 0x1.%.13llXp%+.4d, ",
-             mant & 0xFFFFFFFFFFFFF, bexp);
+      mpz_mul_2exp(g, num, (unsigned long)-bexp);
+      if(mpz_cmp(g, den) < 0)
+        bexp--;
     }
 
-    // Calculate the reciprocal of the boundary.
-    // We only need 17 decimal digits.
-    value = 1.0e17 / value;
-    // Break it down into the fraction and exponent.
-    frac = frexpq(value, &bexp);
-    // The fraction is in 63-bit mantissa format.
-    frac = ldexpq(frac, 63);
-    mant = (long long)frac;
-    bexp = bexp + 1;
-    // Print the mantissa in fixed-point format.
-    printf(" 0x%.16llX, ", mant);
-    // Print the exponent in binary.
-    printf("%+5d },", bexp);
-
-    // Print some comments.
-    printf("  // 1.0e%+.3d\n", e);
+    // Scale it so there are 128 significant bits, truncate it, then add one.
+    if(127 - bexp >= 0)
+      mpz_mul_2exp(num, num, (unsigned long)(127 - bexp));
+    else
+      mpz_mul_2exp(den, den, (unsigned long)(bexp - 127));
+    mpz_fdiv_q(g, num, den);
+    mpz_add_ui(g, g, 1);
+
+    // Print the higher and lower halves.
+    mpz_fdiv_q_2exp(num, g, 64);
+    mpz_fdiv_r_2exp(den, g, 64);
+    gmp_printf("    { 0x%.16ZX, 0x%.16ZX },  // 1.0e%+.3d\n", num, den, e);
+
+    mpz_clears(num, den, g, NULL);
   }
 
 int
@@ -204,7 +206,7 @@ main(void)
   {
     int e;
 
-    for(e = -324; e <= +308; ++e)
+    for(e = -292; e <= +324; ++e)
       do_print_one(e);
 
     return 0;
@@ -214,709 +216,752 @@ main(void)
 // These are generated data. Do not edit by hand!
 struct decmult_F
   {
-    double bound;
-    uint64_t mant;
-    int bexp;
+    uint64_t hi;
+    uint64_t lo;
   }
 constexpr s_decmult_F[] =
   {
-    {                       0,  0x6DB4616541769502, +1134 },  // 1.0e-324
-    { 0x1.03132B9CF541Cp-1073,  0x57C3811DCDF87735, +1131 },  // 1.0e-323
-    { 0x1.43D7F68432923p-1070,  0x463600E4A4C6C5C4, +1128 },  // 1.0e-322
-    { 0x1.94CDF4253F36Cp-1067,  0x705667D43AD7A2D3, +1124 },  // 1.0e-321
-    { 0x1.FA01712E8F047p-1064,  0x59DEB97695794F0F, +1121 },  // 1.0e-320
-    { 0x1.3C40E6BD1962Cp-1060,  0x47E5612BAAC77273, +1118 },  // 1.0e-319
-    { 0x1.8B51206C5FBB7p-1057,  0x73089B79113F1D84, +1114 },  // 1.0e-318
-    { 0x1.EE25688777AA5p-1054,  0x5C06E2C740FF4AD0, +1111 },  // 1.0e-317
-    { 0x1.34D76154AACA7p-1050,  0x499F1BD29A65D573, +1108 },  // 1.0e-316
-    { 0x1.820D39A9D57D1p-1047,  0x75CB5FB75D6FBBEC, +1104 },  // 1.0e-315
-    { 0x1.E29088144ADC5p-1044,  0x5E3C4C92B1262FF0, +1101 },  // 1.0e-314
-    { 0x1.2D9A550CAEC9Bp-1040,  0x4B6370755A84F326, +1098 },  // 1.0e-313
-    { 0x1.7900EA4FDA7C2p-1037,  0x789F1A555DA1850A, +1094 },  // 1.0e-312
-    { 0x1.D74124E3D11B2p-1034,  0x607F48444AE79DA2, +1091 },  // 1.0e-311
-    { 0x1.2688B70E62B0Fp-1030,  0x4D32A036A252E481, +1088 },  // 1.0e-310
-    { 0x1.702AE4D1FB5D3p-1027,  0x7B84338A9D516D9C, +1084 },  // 1.0e-309
-    { 0x1.CC359E067A348p-1024,  0x62D0293BB10DF149, +1081 },  // 1.0e-308
-    { 0x1.1FA182C40C60Dp-1020,  0x4F0CEDC95A718DD4, +1078 },  // 1.0e-307
-    { 0x1.6789E3750F790p-1017,  0x7E7B160EF71C1621, +1074 },  // 1.0e-306
-    { 0x1.C16C5C5253575p-1014,  0x652F44D8C5B011B4, +1071 },  // 1.0e-305
-    { 0x1.18E3B9B374169p-1010,  0x50F29D7A37C00E29, +1068 },  // 1.0e-304
-    { 0x1.5F1CA820511C3p-1007,  0x40C21794F96671BA, +1065 },  // 1.0e-303
-    { 0x1.B6E3D22865634p-1004,  0x679CF287F570B5F7, +1061 },  // 1.0e-302
-    { 0x1.124E63593F5E0p-1000,  0x52E3F5399126F7F9, +1058 },  // 1.0e-301
-    { 0x1.56E1FC2F8F358p-0997,  0x424FF76140EBF994, +1055 },  // 1.0e-300
-    { 0x1.AC9A7B3B7302Fp-0994,  0x6A198BCECE465C20, +1051 },  // 1.0e-299
-    { 0x1.0BE08D0527E1Dp-0990,  0x54E13CA571D1E34D, +1048 },  // 1.0e-298
-    { 0x1.4ED8B04671DA4p-0987,  0x43E763B78E4182A4, +1045 },  // 1.0e-297
-    { 0x1.A28EDC580E50Dp-0984,  0x6CA56C58E39C043A, +1041 },  // 1.0e-296
-    { 0x1.059949B708F28p-0980,  0x56EABD13E9499CFB, +1038 },  // 1.0e-295
-    { 0x1.46FF9C24CB2F2p-0977,  0x458897432107B0C8, +1035 },  // 1.0e-294
-    { 0x1.98BF832DFDFAFp-0974,  0x6F40F20501A5E7A7, +1031 },  // 1.0e-293
-    { 0x1.FEEF63F97D79Bp-0971,  0x5900C19D9AEB1FB9, +1028 },  // 1.0e-292
-    { 0x1.3F559E7BEE6C1p-0967,  0x4733CE17AF227FC7, +1025 },  // 1.0e-291
-    { 0x1.8F2B061AEA071p-0964,  0x71EC7CF2B1D0CC72, +1021 },  // 1.0e-290
-    { 0x1.F2F5C7A1A488Dp-0961,  0x5B2397288E40A38E, +1018 },  // 1.0e-289
-    { 0x1.37D99CC506D58p-0957,  0x48E945BA0B66E93F, +1015 },  // 1.0e-288
-    { 0x1.85D003F6488AEp-0954,  0x74A86F90123E41FE, +1011 },  // 1.0e-287
-    { 0x1.E74404F3DAADAp-0951,  0x5D538C7341CB67FE, +1008 },  // 1.0e-286
-    { 0x1.308A831868AC8p-0947,  0x4AA93D29016F8665, +1005 },  // 1.0e-285
-    { 0x1.7CAD23DE82D7Ap-0944,  0x77752EA8024C0A3C, +1001 },  // 1.0e-284
-    { 0x1.DBD86CD6238D9p-0941,  0x5F90F22001D66E96,  +998 },  // 1.0e-283
-    { 0x1.29674405D6387p-0937,  0x4C73F4E667DEBEDE,  +995 },  // 1.0e-282
-    { 0x1.73C115074BC69p-0934,  0x7A532170A6313164,  +991 },  // 1.0e-281
-    { 0x1.D0B15A491EB84p-0931,  0x61DC1AC084F42783,  +988 },  // 1.0e-280
-    { 0x1.226ED86DB3332p-0927,  0x4E49AF006A5CEC69,  +985 },  // 1.0e-279
-    { 0x1.6B0A8E891FFFFp-0924,  0x7D42B19A43C7E0A8,  +981 },  // 1.0e-278
-    { 0x1.C5CD322B67FFFp-0921,  0x64355AE1CFD31A20,  +978 },  // 1.0e-277
-    { 0x1.1BA03F5B20FFFp-0917,  0x502AAF1B0CA8E1B3,  +975 },  // 1.0e-276
-    { 0x1.62884F31E93FFp-0914,  0x402225AF3D53E7C2,  +972 },  // 1.0e-275
-    { 0x1.BB2A62FE638FFp-0911,  0x669D0918621FD937,  +968 },  // 1.0e-274
-    { 0x1.14FA7DDEFE39Fp-0907,  0x52173A79E8197A92,  +965 },  // 1.0e-273
-    { 0x1.5A391D56BDC87p-0904,  0x41AC2EC7ECE12EDB,  +962 },  // 1.0e-272
-    { 0x1.B0C764AC6D3A9p-0901,  0x69137E0CAE3517C6,  +958 },  // 1.0e-271
-    { 0x1.0E7C9EEBC4449p-0897,  0x540F980A24F74638,  +955 },  // 1.0e-270
-    { 0x1.521BC6A6B555Cp-0894,  0x433FACD4EA5F6B60,  +952 },  // 1.0e-269
-    { 0x1.A6A2B85062AB3p-0891,  0x6B991487DD657899,  +948 },  // 1.0e-268
-    { 0x1.0825B3323DAB0p-0887,  0x5614106CB11DFA14,  +945 },  // 1.0e-267
-    { 0x1.4A2F1FFECD15Cp-0884,  0x44DCD9F08DB194DD,  +942 },  // 1.0e-266
-    { 0x1.9CBAE7FE805B3p-0881,  0x6E2E2980E2B5BAFB,  +938 },  // 1.0e-265
-    { 0x1.01F4D0FF1038Fp-0877,  0x5824EE00B55E2F2F,  +935 },  // 1.0e-264
-    { 0x1.4272053ED4473p-0874,  0x4683F19A2AB1BF59,  +932 },  // 1.0e-263
-    { 0x1.930E868E89590p-0871,  0x70D31C29DDE93228,  +928 },  // 1.0e-262
-    { 0x1.F7D228322BAF5p-0868,  0x5A427CEE4B20F4ED,  +925 },  // 1.0e-261
-    { 0x1.3AE3591F5B4D9p-0864,  0x483530BEA280C3F1,  +922 },  // 1.0e-260
-    { 0x1.899C2F673220Fp-0861,  0x73884DFDD0CE064E,  +918 },  // 1.0e-259
-    { 0x1.EC033B40FEA93p-0858,  0x5C6D0B3173D8050B,  +915 },  // 1.0e-258
-    { 0x1.338205089F29Cp-0854,  0x49F0D5C129799DA2,  +912 },  // 1.0e-257
-    { 0x1.8062864AC6F43p-0851,  0x764E22CEA8C295D1,  +908 },  // 1.0e-256
-    { 0x1.E07B27DD78B13p-0848,  0x5EA4E8A553CEDE41,  +905 },  // 1.0e-255
-    { 0x1.2C4CF8EA6B6ECp-0844,  0x4BB72084430BE500,  +902 },  // 1.0e-254
-    { 0x1.77603725064A7p-0841,  0x792500D39E796E67,  +898 },  // 1.0e-253
-    { 0x1.D53844EE47DD1p-0838,  0x60EA670FB1FABEB9,  +895 },  // 1.0e-252
-    { 0x1.25432B14ECEA2p-0834,  0x4D885272F4C89894,  +892 },  // 1.0e-251
-    { 0x1.6E93F5DA2824Bp-0831,  0x7C0D50B7EE0DC0ED,  +888 },  // 1.0e-250
-    { 0x1.CA38F350B22DEp-0828,  0x633DDA2CBE716724,  +885 },  // 1.0e-249
-    { 0x1.1E6398126F5CBp-0824,  0x4F64AE8A31F45283,  +882 },  // 1.0e-248
-    { 0x1.65FC7E170B33Dp-0821,  0x7F077DA9E986EA6B,  +878 },  // 1.0e-247
-    { 0x1.BF7B9D9CCE00Dp-0818,  0x659F97BB2138BB89,  +875 },  // 1.0e-246
-    { 0x1.17AD428200C08p-0814,  0x514C796280FA2FA1,  +872 },  // 1.0e-245
-    { 0x1.5D98932280F0Ap-0811,  0x4109FAB533FB594D,  +869 },  // 1.0e-244
-    { 0x1.B4FEB7EB212CDp-0808,  0x680FF788532BC216,  +865 },  // 1.0e-243
-    { 0x1.111F32F2F4BC0p-0804,  0x533FF939DC2301AB,  +862 },  // 1.0e-242
-    { 0x1.5566FFAFB1EB0p-0801,  0x4299942E49B59AEF,  +859 },  // 1.0e-241
-    { 0x1.AAC0BF9B9E65Cp-0798,  0x6A8F537D42BC2B18,  +855 },  // 1.0e-240
-    { 0x1.0AB877C142FF9p-0794,  0x553F75FDCEFCEF46,  +852 },  // 1.0e-239
-    { 0x1.4D6695B193BF8p-0791,  0x4432C4CB0BFD8C38,  +849 },  // 1.0e-238
-    { 0x1.A0C03B1DF8AF6p-0788,  0x6D1E07AB466279F4,  +845 },  // 1.0e-237
-    { 0x1.047824F2BB6D9p-0784,  0x574B3955D1E86190,  +842 },  // 1.0e-236
-    { 0x1.45962E2F6A490p-0781,  0x45D5C777DB204E0D,  +839 },  // 1.0e-235
-    { 0x1.96FBB9BB44DB4p-0778,  0x6FBC72595E9A167B,  +835 },  // 1.0e-234
-    { 0x1.FCBAA82A16121p-0775,  0x59638EADE54811FC,  +832 },  // 1.0e-233
-    { 0x1.3DF4A91A4DCB4p-0771,  0x4782D88B1DD34196,  +829 },  // 1.0e-232
-    { 0x1.8D71D360E13E2p-0768,  0x726AF411C952028A,  +825 },  // 1.0e-231
-    { 0x1.F0CE4839198DAp-0765,  0x5B88C3416DDB353B,  +822 },  // 1.0e-230
-    { 0x1.3680ED23AFF88p-0761,  0x493A35CDF17C2A96,  +819 },  // 1.0e-229
-    { 0x1.8421286C9BF6Ap-0758,  0x7529EFAFE8C6AA89,  +815 },  // 1.0e-228
-    { 0x1.E5297287C2F45p-0755,  0x5DBB262653D22207,  +812 },  // 1.0e-227
-    { 0x1.2F39E794D9D8Bp-0751,  0x4AFC1E850FDB4E6C,  +809 },  // 1.0e-226
-    { 0x1.7B08617A104EEp-0748,  0x77F9CA6E7FC54A47,  +805 },  // 1.0e-225
-    { 0x1.D9CA79D894629p-0745,  0x5FFB085866376E9F,  +802 },  // 1.0e-224
-    { 0x1.281E8C275CBDAp-0741,  0x4CC8D379EB5F8BB2,  +799 },  // 1.0e-223
-    { 0x1.72262F3133ED0p-0738,  0x7ADAEBF64565AC51,  +795 },  // 1.0e-222
-    { 0x1.CEAFBAFD80E84p-0735,  0x6248BCC5045156A7,  +792 },  // 1.0e-221
-    { 0x1.212DD4DE70913p-0731,  0x4EA0970403744552,  +789 },  // 1.0e-220
-    { 0x1.69794A160CB57p-0728,  0x7DCDBE6CD253A21E,  +785 },  // 1.0e-219
-    { 0x1.C3D79C9B8FE2Dp-0725,  0x64A498570EA94E7E,  +782 },  // 1.0e-218
-    { 0x1.1A66C1E139EDCp-0721,  0x5083AD1272210B98,  +779 },  // 1.0e-217
-    { 0x1.6100725988693p-0718,  0x40695741F4E73C79,  +776 },  // 1.0e-216
-    { 0x1.B9408EEFEA838p-0715,  0x670EF2032171FA5C,  +772 },  // 1.0e-215
-    { 0x1.13C85955F2923p-0711,  0x52725B35B45B2EB0,  +769 },  // 1.0e-214
-    { 0x1.58BA6FAB6F36Cp-0708,  0x41F515C49048F226,  +766 },  // 1.0e-213
-    { 0x1.AEE90B964B047p-0705,  0x698822D41A0E503E,  +762 },  // 1.0e-212
-    { 0x1.0D51A73DEEE2Cp-0701,  0x546CE8A9AE71D9CB,  +759 },  // 1.0e-211
-    { 0x1.50A6110D6A9B7p-0698,  0x438A53BAF1F4AE3C,  +756 },  // 1.0e-210
-    { 0x1.A4CF9550C5425p-0695,  0x6C1085F7E9877D2D,  +752 },  // 1.0e-209
-    { 0x1.0701BD527B497p-0691,  0x56739E5FEE05FDBD,  +749 },  // 1.0e-208
-    { 0x1.48C22CA71A1BDp-0688,  0x45294B7FF19E6497,  +746 },  // 1.0e-207
-    { 0x1.9AF2B7D0E0A2Cp-0685,  0x6EA878CCB5CA3A8C,  +742 },  // 1.0e-206
-    { 0x1.00D7B2E28C65Bp-0681,  0x5886C70A2B082ED6,  +739 },  // 1.0e-205
-    { 0x1.410D9F9B2F7F2p-0678,  0x46D238D4EF39BF12,  +736 },  // 1.0e-204
-    { 0x1.91510781FB5EFp-0675,  0x71505AEE4B8F981D,  +732 },  // 1.0e-203
-    { 0x1.F5A549627A36Bp-0672,  0x5AA6AF25093FACE4,  +729 },  // 1.0e-202
-    { 0x1.39874DDD8C623p-0668,  0x488558EA6DCC8A50,  +726 },  // 1.0e-201
-    { 0x1.87E92154EF7ACp-0665,  0x74088E43E2E0DD4C,  +722 },  // 1.0e-200
-    { 0x1.E9E369AA2B597p-0662,  0x5CD3A5031BE71770,  +719 },  // 1.0e-199
-    { 0x1.322E220A5B17Ep-0658,  0x4A42EA68E31F45F3,  +716 },  // 1.0e-198
-    { 0x1.7EB9AA8CF1DDEp-0655,  0x76D1770E38320986,  +712 },  // 1.0e-197
-    { 0x1.DE6815302E555p-0652,  0x5F0DF8D82CF4D46B,  +709 },  // 1.0e-196
-    { 0x1.2B010D3E1CF55p-0648,  0x4C0B2D79BD90A9EF,  +706 },  // 1.0e-195
-    { 0x1.75C1508DA432Ap-0645,  0x79AB7BF5FC1AA97F,  +702 },  // 1.0e-194
-    { 0x1.D331A4B10D3F5p-0642,  0x6155FCC4C9AEEDFF,  +699 },  // 1.0e-193
-    { 0x1.23FF06EEA8479p-0638,  0x4DDE63D0A158BE65,  +696 },  // 1.0e-192
-    { 0x1.6CFEC8AA52597p-0635,  0x7C97061A9BC130A2,  +692 },  // 1.0e-191
-    { 0x1.C83E7AD4E6EFDp-0632,  0x63AC04E2163426E8,  +689 },  // 1.0e-190
-    { 0x1.1D270CC51055Ep-0628,  0x4FBCD0B4DE901F20,  +686 },  // 1.0e-189
-    { 0x1.6470CFF6546B6p-0625,  0x7F9481216419CB67,  +682 },  // 1.0e-188
-    { 0x1.BD8D03F3E9863p-0622,  0x6610674DE9AE3C52,  +679 },  // 1.0e-187
-    { 0x1.1678227871F3Ep-0618,  0x51A6B90B21583042,  +676 },  // 1.0e-186
-    { 0x1.5C162B168E70Ep-0615,  0x41522DA2811359CE,  +673 },  // 1.0e-185
-    { 0x1.B31BB5DC320D1p-0612,  0x68837C3734EBC2E3,  +669 },  // 1.0e-184
-    { 0x1.0FF151A99F482p-0608,  0x539C635F5D8968B6,  +666 },  // 1.0e-183
-    { 0x1.53EDA614071A3p-0605,  0x42E382B2B13ABA2B,  +663 },  // 1.0e-182
-    { 0x1.A8E90F9908E0Cp-0602,  0x6B059DEAB52AC378,  +659 },  // 1.0e-181
-    { 0x1.0991A9BFA58C7p-0598,  0x559E17EEF755692D,  +656 },  // 1.0e-180
-    { 0x1.4BF6142F8EEF9p-0595,  0x447E798BF91120F1,  +653 },  // 1.0e-179
-    { 0x1.9EF3993B72AB8p-0592,  0x6D9728DFF4E834B5,  +649 },  // 1.0e-178
-    { 0x1.03583FC527AB3p-0588,  0x57AC20B32A535D5D,  +646 },  // 1.0e-177
-    { 0x1.442E4FB671960p-0585,  0x46234D5C21DC4AB1,  +643 },  // 1.0e-176
-    { 0x1.9539E3A40DFB8p-0582,  0x70387BC69C93AAB5,  +639 },  // 1.0e-175
-    { 0x1.FA885C8D117A6p-0579,  0x59C6C96BB076222A,  +636 },  // 1.0e-174
-    { 0x1.3C9539D82AEC7p-0575,  0x47D23ABC8D2B4E88,  +633 },  // 1.0e-173
-    { 0x1.8BBA884E35A79p-0572,  0x72E9F79415121740,  +629 },  // 1.0e-172
-    { 0x1.EEA92A61C3118p-0569,  0x5BEE5FA9AA74DF67,  +626 },  // 1.0e-171
-    { 0x1.3529BA7D19EAFp-0565,  0x498B7FBAEEC3E5EC,  +623 },  // 1.0e-170
-    { 0x1.8274291C6065Ap-0562,  0x75ABFF917E063CAC,  +619 },  // 1.0e-169
-    { 0x1.E3113363787F1p-0559,  0x5E2332DACB38308A,  +616 },  // 1.0e-168
-    { 0x1.2DEAC01E2B4F6p-0555,  0x4B4F5BE23C2CF3A1,  +613 },  // 1.0e-167
-    { 0x1.79657025B6234p-0552,  0x787EF969F9E185CF,  +609 },  // 1.0e-166
-    { 0x1.D7BECC2F23AC1p-0549,  0x60659454C7E79E3F,  +606 },  // 1.0e-165
-    { 0x1.26D73F9D764B9p-0545,  0x4D1E1043D31FB1CC,  +603 },  // 1.0e-164
-    { 0x1.708D0F84D3DE7p-0542,  0x7B634D3951CC4FAD,  +599 },  // 1.0e-163
-    { 0x1.CCB0536608D61p-0539,  0x62B5D7610E3D0C8B,  +596 },  // 1.0e-162
-    { 0x1.1FEE341FC585Cp-0535,  0x4EF7DF80D830D6D5,  +593 },  // 1.0e-161
-    { 0x1.67E9C127B6E74p-0532,  0x7E59659AF38157BC,  +589 },  // 1.0e-160
-    { 0x1.C1E43171A4A11p-0529,  0x65145148C2CDDFC9,  +586 },  // 1.0e-159
-    { 0x1.192E9EE706E4Ap-0525,  0x50DD0DD3CF0B196E,  +583 },  // 1.0e-158
-    { 0x1.5F7A46A0C89DDp-0522,  0x40B0D7DCA5A27ABE,  +580 },  // 1.0e-157
-    { 0x1.B758D848FAC54p-0519,  0x678159610903F797,  +576 },  // 1.0e-156
-    { 0x1.1297872D9CBB4p-0515,  0x52CDE11A6D9CC612,  +573 },  // 1.0e-155
-    { 0x1.573D68F903EA2p-0512,  0x423E4DAEBE1704DB,  +570 },  // 1.0e-154
-    { 0x1.AD0CC33744E4Ap-0509,  0x69FD4917968B3AF9,  +566 },  // 1.0e-153
-    { 0x1.0C27FA028B0EEp-0505,  0x54CAA0DFABA29594,  +563 },  // 1.0e-152
-    { 0x1.4F31F8832DD2Ap-0502,  0x43D54D7FBC821143,  +560 },  // 1.0e-151
-    { 0x1.A2FE76A3F9474p-0499,  0x6C887BFF94034ED2,  +556 },  // 1.0e-150
-    { 0x1.05DF0A267BCC9p-0495,  0x56D396661002A574,  +553 },  // 1.0e-149
-    { 0x1.4756CCB01ABFBp-0492,  0x457611EB40021DF7,  +550 },  // 1.0e-148
-    { 0x1.992C7FDC216FAp-0489,  0x6F234FDECCD02FF1,  +546 },  // 1.0e-147
-    { 0x1.FF779FD329CB8p-0486,  0x58E90CB23D73598E,  +543 },  // 1.0e-146
-    { 0x1.3FAAC3E3FA1F3p-0482,  0x4720D6F4FDF5E13E,  +540 },  // 1.0e-145
-    { 0x1.8F9574DCF8A70p-0479,  0x71CE24BB2FEFCECA,  +536 },  // 1.0e-144
-    { 0x1.F37AD21436D0Cp-0476,  0x5B0B5095BFF30BD5,  +533 },  // 1.0e-143
-    { 0x1.382CC34CA2427p-0472,  0x48D5DA11665C0977,  +530 },  // 1.0e-142
-    { 0x1.8637F41FCAD31p-0469,  0x74895CE8A3C6758B,  +526 },  // 1.0e-141
-    { 0x1.E7C5F127BD87Ep-0466,  0x5D3AB0BA1C9EC46F,  +523 },  // 1.0e-140
-    { 0x1.30DBB6B8D674Ep-0462,  0x4A955A2E7D4BD059,  +520 },  // 1.0e-139
-    { 0x1.7D12A4670C122p-0459,  0x77555D172EDFB3C2,  +516 },  // 1.0e-138
-    { 0x1.DC574D80CF16Bp-0456,  0x5F777DAC257FC301,  +513 },  // 1.0e-137
-    { 0x1.29B69070816E2p-0452,  0x4C5F97BCEACC9C01,  +510 },  // 1.0e-136
-    { 0x1.7424348CA1C9Bp-0449,  0x7A328C6177ADC668,  +506 },  // 1.0e-135
-    { 0x1.D12D41AFCA3C2p-0446,  0x61C209E792F16B86,  +503 },  // 1.0e-134
-    { 0x1.22BC490DDE659p-0442,  0x4E34D4B9425ABC6B,  +500 },  // 1.0e-133
-    { 0x1.6B6B5B5155FF0p-0439,  0x7D21545B9D5DFA46,  +496 },  // 1.0e-132
-    { 0x1.C6463225AB7ECp-0436,  0x641AA9E2E44B2E9E,  +493 },  // 1.0e-131
-    { 0x1.1BEBDF578B2F3p-0432,  0x501554B5836F587E,  +490 },  // 1.0e-130
-    { 0x1.62E6D72D6DFB0p-0429,  0x4011109135F2AD32,  +487 },  // 1.0e-129
-    { 0x1.BBA08CF8C979Cp-0426,  0x6681B41B89844850,  +483 },  // 1.0e-128
-    { 0x1.1544581B7DEC1p-0422,  0x52015CE2D469D373,  +480 },  // 1.0e-127
-    { 0x1.5A956E225D672p-0419,  0x419AB0B576BB0F8F,  +477 },  // 1.0e-126
-    { 0x1.B13AC9AAF4C0Ep-0416,  0x68F781225791B27F,  +473 },  // 1.0e-125
-    { 0x1.0EC4BE0AD8F89p-0412,  0x53F9341B79415B99,  +470 },  // 1.0e-124
-    { 0x1.5275ED8D8F36Bp-0409,  0x432DC3492DCDE2E1,  +467 },  // 1.0e-123
-    { 0x1.A71368F0F3046p-0406,  0x6B7C6BA849496B01,  +463 },  // 1.0e-122
-    { 0x1.086C219697E2Cp-0402,  0x55FD22ED076DEF34,  +460 },  // 1.0e-121
-    { 0x1.4A8729FC3DDB7p-0399,  0x44CA82573924BF5D,  +457 },  // 1.0e-120
-    { 0x1.9D28F47B4D524p-0396,  0x6E10D08B8EA1322E,  +453 },  // 1.0e-119
-    { 0x1.023998CD10537p-0392,  0x580D73A2D880F4F2,  +450 },  // 1.0e-118
-    { 0x1.42C7FF0054684p-0389,  0x4671294F139A5D8E,  +447 },  // 1.0e-117
-    { 0x1.9379FEC069826p-0386,  0x70B50EE4EC2A2F4A,  +443 },  // 1.0e-116
-    { 0x1.F8587E7083E2Fp-0383,  0x5A2A7250BCEE8C3B,  +440 },  // 1.0e-115
-    { 0x1.3B374F06526DDp-0379,  0x4821F50D63F209C9,  +437 },  // 1.0e-114
-    { 0x1.8A0522C7E7095p-0376,  0x736988156CB6760E,  +433 },  // 1.0e-113
-    { 0x1.EC866B79E0CBAp-0373,  0x5C546CDDF091F80B,  +430 },  // 1.0e-112
-    { 0x1.33D4032C2C7F4p-0369,  0x49DD23E4C074C66F,  +427 },  // 1.0e-111
-    { 0x1.80C903F7379F1p-0366,  0x762E9FD467213D7F,  +423 },  // 1.0e-110
-    { 0x1.E0FB44F50586Ep-0363,  0x5E8BB3105280FDFF,  +420 },  // 1.0e-109
-    { 0x1.2C9D0B1923744p-0359,  0x4BA2F5A6A8673199,  +417 },  // 1.0e-108
-    { 0x1.77C44DDF6C515p-0356,  0x7904BC3DDA3EB5C2,  +413 },  // 1.0e-107
-    { 0x1.D5B561574765Bp-0353,  0x60D09697E1CBC49B,  +410 },  // 1.0e-106
-    { 0x1.25915CD68C9F9p-0349,  0x4D73ABACB4A303AF,  +407 },  // 1.0e-105
-    { 0x1.6EF5B40C2FC77p-0346,  0x7BEC45E12104D2B2,  +403 },  // 1.0e-104
-    { 0x1.CAB3210F3BB95p-0343,  0x63236B1A80D0A88E,  +400 },  // 1.0e-103
-    { 0x1.1EAFF4A98553Dp-0339,  0x4F4F88E200A6ED3F,  +397 },  // 1.0e-102
-    { 0x1.665BF1D3E6A8Cp-0336,  0x7EE5A7D0010B1531,  +393 },  // 1.0e-101
-    { 0x1.BFF2EE48E052Fp-0333,  0x6584864000D5AA8E,  +390 },  // 1.0e-100
-    { 0x1.17F7D4ED8C33Dp-0329,  0x5136D1CCCD77BBA4,  +387 },  // 1.0e-099
-    { 0x1.5DF5CA28EF40Dp-0326,  0x40F8A7D70AC62FB7,  +384 },  // 1.0e-098
-    { 0x1.B5733CB32B110p-0323,  0x67F43FBE77A37F8B,  +380 },  // 1.0e-097
-    { 0x1.116805EFFAEAAp-0319,  0x5329CC985FB5FFA2,  +377 },  // 1.0e-096
-    { 0x1.55C2076BF9A55p-0316,  0x4287D6E04C91994F,  +374 },  // 1.0e-095
-    { 0x1.AB328946F80EAp-0313,  0x6A72F166E0E8F54B,  +370 },  // 1.0e-094
-    { 0x1.0AFF95CC5B092p-0309,  0x5528C11F1A53F76F,  +367 },  // 1.0e-093
-    { 0x1.4DBF7B3F71CB7p-0306,  0x44209A7F48432C59,  +364 },  // 1.0e-092
-    { 0x1.A12F5A0F4E3E4p-0303,  0x6D00F7320D3846F4,  +360 },  // 1.0e-091
-    { 0x1.04BD984990E6Fp-0299,  0x5733F8F4D76038C3,  +357 },  // 1.0e-090
-    { 0x1.45ECFE5BF520Ap-0296,  0x45C32D90AC4CFA36,  +354 },  // 1.0e-089
-    { 0x1.97683DF2F268Dp-0293,  0x6F9EAF4DE07B29F0,  +350 },  // 1.0e-088
-    { 0x1.FD424D6FAF030p-0290,  0x594BBF71806287F3,  +347 },  // 1.0e-087
-    { 0x1.3E497065CD61Ep-0286,  0x476FCC5ACD1B9FF6,  +344 },  // 1.0e-086
-    { 0x1.8DDBCC7F40BA6p-0283,  0x724C7A2AE1C5CCBD,  +340 },  // 1.0e-085
-    { 0x1.F152BF9F10E8Fp-0280,  0x5B7061BBE7D17097,  +337 },  // 1.0e-084
-    { 0x1.36D3B7C36A919p-0276,  0x4926B496530DF3AC,  +334 },  // 1.0e-083
-    { 0x1.8488A5B445360p-0273,  0x750ABA8A1E7CB913,  +330 },  // 1.0e-082
-    { 0x1.E5AACF2156838p-0270,  0x5DA22ED4E530940F,  +327 },  // 1.0e-081
-    { 0x1.2F8AC174D6123p-0266,  0x4AE825771DC07672,  +324 },  // 1.0e-080
-    { 0x1.7B6D71D20B96Cp-0263,  0x77D9D58B62CD8A51,  +320 },  // 1.0e-079
-    { 0x1.DA48CE468E7C7p-0260,  0x5FE177A2B5713B74,  +317 },  // 1.0e-078
-    { 0x1.286D80EC190DCp-0256,  0x4CB45FB55DF42F90,  +314 },  // 1.0e-077
-    { 0x1.7288E1271F513p-0253,  0x7ABA32BBC986B280,  +310 },  // 1.0e-076
-    { 0x1.CF2B1970E7258p-0250,  0x622E8EFCA1388ECD,  +307 },  // 1.0e-075
-    { 0x1.217AEFE690777p-0246,  0x4E8BA596E760723D,  +304 },  // 1.0e-074
-    { 0x1.69D9ABE034955p-0243,  0x7DAC3C24A5671D2F,  +300 },  // 1.0e-073
-    { 0x1.C45016D841BAAp-0240,  0x6489C9B6EAB8E426,  +297 },  // 1.0e-072
-    { 0x1.1AB20E472914Ap-0236,  0x506E3AF8BBC71CEB,  +294 },  // 1.0e-071
-    { 0x1.615E91D8F359Dp-0233,  0x40582F2D6305B0BC,  +291 },  // 1.0e-070
-    { 0x1.B9B6364F30304p-0230,  0x66F37EAF04D5E793,  +287 },  // 1.0e-069
-    { 0x1.1411E1F17E1E2p-0226,  0x525C6558D0AB1FA9,  +284 },  // 1.0e-068
-    { 0x1.59165A6DDDA5Bp-0223,  0x41E384470D55B2ED,  +281 },  // 1.0e-067
-    { 0x1.AF5BF109550F2p-0220,  0x696C06D81555EB15,  +277 },  // 1.0e-066
-    { 0x1.0D9976A5D5297p-0216,  0x54566BE0111188DE,  +274 },  // 1.0e-065
-    { 0x1.50FFD44F4A73Dp-0213,  0x4378564CDA746D7E,  +271 },  // 1.0e-064
-    { 0x1.A53FC9631D10Cp-0210,  0x6BF3BD47C3ED7BFD,  +267 },  // 1.0e-063
-    { 0x1.0747DDDDF22A7p-0206,  0x565C976C9CBDFCCB,  +264 },  // 1.0e-062
-    { 0x1.4919D5556EB51p-0203,  0x4516DF8A16FE63D5,  +261 },  // 1.0e-061
-    { 0x1.9B604AAACA626p-0200,  0x6E8AFF4357FD6C89,  +257 },  // 1.0e-060
-    { 0x1.011C2EAABE7D7p-0196,  0x586F329C466456D4,  +254 },  // 1.0e-059
-    { 0x1.41633A556E1CDp-0193,  0x46BF5BB038504576,  +251 },  // 1.0e-058
-    { 0x1.91BC08EAC9A41p-0190,  0x71322C4D26E6D58A,  +247 },  // 1.0e-057
-    { 0x1.F62B0B257C0D1p-0187,  0x5A8E89D75252446E,  +244 },  // 1.0e-056
-    { 0x1.39DAE6F76D883p-0183,  0x487207DF750E9D25,  +241 },  // 1.0e-055
-    { 0x1.8851A0B548EA3p-0180,  0x73E9A63254E42EA2,  +237 },  // 1.0e-054
-    { 0x1.EA6608E29B24Cp-0177,  0x5CBAEB5B771CF21B,  +234 },  // 1.0e-053
-    { 0x1.327FC58DA0F6Fp-0173,  0x4A2F22AF927D8E7C,  +231 },  // 1.0e-052
-    { 0x1.7F1FB6F10934Bp-0170,  0x76B1D118EA627D93,  +227 },  // 1.0e-051
-    { 0x1.DEE7A4AD4B81Ep-0167,  0x5EF4A74721E86476,  +224 },  // 1.0e-050
-    { 0x1.2B50C6EC4F313p-0163,  0x4BF6EC38E7ED1D2B,  +221 },  // 1.0e-049
-    { 0x1.7624F8A762FD8p-0160,  0x798B138E3FE1C845,  +217 },  // 1.0e-048
-    { 0x1.D3AE36D13BBCEp-0157,  0x613C0FA4FFE7D36A,  +214 },  // 1.0e-047
-    { 0x1.244CE242C5560p-0153,  0x4DC9A61D998642BB,  +211 },  // 1.0e-046
-    { 0x1.6D601AD376AB9p-0150,  0x7C75D695C2706AC5,  +207 },  // 1.0e-045
-    { 0x1.C8B8218854567p-0147,  0x63917877CEC0556B,  +204 },  // 1.0e-044
-    { 0x1.1D7314F534B60p-0143,  0x4FA793930BCD1122,  +201 },  // 1.0e-043
-    { 0x1.64CFDA3281E38p-0140,  0x7F7285B812E1B504,  +197 },  // 1.0e-042
-    { 0x1.BE03D0BF225C6p-0137,  0x65F537C675815D9C,  +194 },  // 1.0e-041
-    { 0x1.16C262777579Cp-0133,  0x5190F96B91344AE3,  +191 },  // 1.0e-040
-    { 0x1.5C72FB1552D83p-0130,  0x4140C78940F6A24F,  +188 },  // 1.0e-039
-    { 0x1.B38FB9DAA78E4p-0127,  0x6867A5A867F103B2,  +184 },  // 1.0e-038
-    { 0x1.1039D428A8B8Ep-0123,  0x53861E2053273628,  +181 },  // 1.0e-037
-    { 0x1.54484932D2E72p-0120,  0x42D1B1B375B8F820,  +178 },  // 1.0e-036
-    { 0x1.A95A5B7F87A0Ep-0117,  0x6AE91C5255F4C034,  +174 },  // 1.0e-035
-    { 0x1.09D8792FB4C49p-0113,  0x558749DB77F70029,  +171 },  // 1.0e-034
-    { 0x1.4C4E977BA1F5Bp-0110,  0x446C3B15F9926687,  +168 },  // 1.0e-033
-    { 0x1.9F623D5A8A732p-0107,  0x6D79F82328EA3DA6,  +164 },  // 1.0e-032
-    { 0x1.039D66589687Fp-0103,  0x5794C6828721CAEB,  +161 },  // 1.0e-031
-    { 0x1.4484BFEEBC29Fp-0100,  0x46109ECED2816F22,  +158 },  // 1.0e-030
-    { 0x1.95A5EFEA6B347p-0097,  0x701A97B150CF1837,  +154 },  // 1.0e-029
-    { 0x1.FB0F6BE506019p-0094,  0x59AEDFC10D7279C5,  +151 },  // 1.0e-028
-    { 0x1.3CE9A36F23C0Fp-0090,  0x47BF19673DF52E37,  +148 },  // 1.0e-027
-    { 0x1.8C240C4AECB13p-0087,  0x72CB5BD86321E38C,  +144 },  // 1.0e-026
-    { 0x1.EF2D0F5DA7DD8p-0084,  0x5BD5E313828182D6,  +141 },  // 1.0e-025
-    { 0x1.357C299A88EA7p-0080,  0x4977E8DC68679BDF,  +138 },  // 1.0e-024
-    { 0x1.82DB34012B251p-0077,  0x758CA7C70D7292FE,  +134 },  // 1.0e-023
-    { 0x1.E392010175EE5p-0074,  0x5E0A1FD271287598,  +131 },  // 1.0e-022
-    { 0x1.2E3B40A0E9B4Fp-0070,  0x4B3B4CA85A86C47A,  +128 },  // 1.0e-021
-    { 0x1.79CA10C924223p-0067,  0x785EE10D5DA46D90,  +124 },  // 1.0e-020
-    { 0x1.D83C94FB6D2ACp-0064,  0x604BE73DE4838AD9,  +121 },  // 1.0e-019
-    { 0x1.2725DD1D243ABp-0060,  0x4D0985CB1D3608AE,  +118 },  // 1.0e-018
-    { 0x1.70EF54646D496p-0057,  0x7B426FAB61F00DE3,  +114 },  // 1.0e-017
-    { 0x1.CD2B297D889BCp-0054,  0x629B8C891B267182,  +111 },  // 1.0e-016
-    { 0x1.203AF9EE75615p-0050,  0x4EE2D6D415B85ACE,  +108 },  // 1.0e-015
-    { 0x1.6849B86A12B9Bp-0047,  0x7E37BE2022C0914B,  +104 },  // 1.0e-014
-    { 0x1.C25C268497681p-0044,  0x64F964E68233A76F,  +101 },  // 1.0e-013
-    { 0x1.19799812DEA11p-0040,  0x50C783EB9B5C85F2,   +98 },  // 1.0e-012
-    { 0x1.5FD7FE1796495p-0037,  0x409F9CBC7C4A04C2,   +95 },  // 1.0e-011
-    { 0x1.B7CDFD9D7BDBAp-0034,  0x6765C793FA10079D,   +91 },  // 1.0e-010
-    { 0x1.12E0BE826D694p-0030,  0x52B7D2DCC80CD2E4,   +88 },  // 1.0e-009
-    { 0x1.5798EE2308C39p-0027,  0x422CA8B0A00A4250,   +85 },  // 1.0e-008
-    { 0x1.AD7F29ABCAF48p-0024,  0x69E10DE76676D080,   +81 },  // 1.0e-007
-    { 0x1.0C6F7A0B5ED8Dp-0020,  0x54B40B1F852BDA00,   +78 },  // 1.0e-006
-    { 0x1.4F8B588E368F0p-0017,  0x43C33C1937564800,   +75 },  // 1.0e-005
-    { 0x1.A36E2EB1C432Cp-0014,  0x6C6B935B8BBD4000,   +71 },  // 1.0e-004
-    { 0x1.0624DD2F1A9FBp-0010,  0x56BC75E2D6310000,   +68 },  // 1.0e-003
-    { 0x1.47AE147AE147Ap-0007,  0x4563918244F40000,   +65 },  // 1.0e-002
-    { 0x1.9999999999999p-0004,  0x6F05B59D3B200000,   +61 },  // 1.0e-001
-    { 0x1.0000000000000p+0000,  0x58D15E1762800000,   +58 },  // 1.0e+000
-    { 0x1.4000000000000p+0003,  0x470DE4DF82000000,   +55 },  // 1.0e+001
-    { 0x1.9000000000000p+0006,  0x71AFD498D0000000,   +51 },  // 1.0e+002
-    { 0x1.F400000000000p+0009,  0x5AF3107A40000000,   +48 },  // 1.0e+003
-    { 0x1.3880000000000p+0013,  0x48C2739500000000,   +45 },  // 1.0e+004
-    { 0x1.86A0000000000p+0016,  0x746A528800000000,   +41 },  // 1.0e+005
-    { 0x1.E848000000000p+0019,  0x5D21DBA000000000,   +38 },  // 1.0e+006
-    { 0x1.312D000000000p+0023,  0x4A817C8000000000,   +35 },  // 1.0e+007
-    { 0x1.7D78400000000p+0026,  0x7735940000000000,   +31 },  // 1.0e+008
-    { 0x1.DCD6500000000p+0029,  0x5F5E100000000000,   +28 },  // 1.0e+009
-    { 0x1.2A05F20000000p+0033,  0x4C4B400000000000,   +25 },  // 1.0e+010
-    { 0x1.74876E8000000p+0036,  0x7A12000000000000,   +21 },  // 1.0e+011
-    { 0x1.D1A94A2000000p+0039,  0x61A8000000000000,   +18 },  // 1.0e+012
-    { 0x1.2309CE5400000p+0043,  0x4E20000000000000,   +15 },  // 1.0e+013
-    { 0x1.6BCC41E900000p+0046,  0x7D00000000000000,   +11 },  // 1.0e+014
-    { 0x1.C6BF526340000p+0049,  0x6400000000000000,    +8 },  // 1.0e+015
-    { 0x1.1C37937E08000p+0053,  0x5000000000000000,    +5 },  // 1.0e+016
-    { 0x1.6345785D8A000p+0056,  0x4000000000000000,    +2 },  // 1.0e+017
-    { 0x1.BC16D674EC800p+0059,  0x6666666666666666,    -2 },  // 1.0e+018
-    { 0x1.158E460913D00p+0063,  0x51EB851EB851EB85,    -5 },  // 1.0e+019
-    { 0x1.5AF1D78B58C40p+0066,  0x4189374BC6A7EF9D,    -8 },  // 1.0e+020
-    { 0x1.B1AE4D6E2EF50p+0069,  0x68DB8BAC710CB295,   -12 },  // 1.0e+021
-    { 0x1.0F0CF064DD592p+0073,  0x53E2D6238DA3C211,   -15 },  // 1.0e+022
-    { 0x1.52D02C7E14AF6p+0076,  0x431BDE82D7B634DA,   -18 },  // 1.0e+023
-    { 0x1.A784379D99DB4p+0079,  0x6B5FCA6AF2BD215E,   -22 },  // 1.0e+024
-    { 0x1.08B2A2C280290p+0083,  0x55E63B88C230E77E,   -25 },  // 1.0e+025
-    { 0x1.4ADF4B7320334p+0086,  0x44B82FA09B5A52CB,   -28 },  // 1.0e+026
-    { 0x1.9D971E4FE8401p+0089,  0x6DF37F675EF6EADF,   -32 },  // 1.0e+027
-    { 0x1.027E72F1F1281p+0093,  0x57F5FF85E592557F,   -35 },  // 1.0e+028
-    { 0x1.431E0FAE6D721p+0096,  0x465E6604B7A84465,   -38 },  // 1.0e+029
-    { 0x1.93E5939A08CE9p+0099,  0x709709A125DA0709,   -42 },  // 1.0e+030
-    { 0x1.F8DEF8808B024p+0102,  0x5A126E1A84AE6C07,   -45 },  // 1.0e+031
-    { 0x1.3B8B5B5056E16p+0106,  0x480EBE7B9D58566C,   -48 },  // 1.0e+032
-    { 0x1.8A6E32246C99Cp+0109,  0x734ACA5F6226F0AD,   -52 },  // 1.0e+033
-    { 0x1.ED09BEAD87C03p+0112,  0x5C3BD5191B525A24,   -55 },  // 1.0e+034
-    { 0x1.3426172C74D82p+0116,  0x49C97747490EAE83,   -58 },  // 1.0e+035
-    { 0x1.812F9CF7920E2p+0119,  0x760F253EDB4AB0D2,   -62 },  // 1.0e+036
-    { 0x1.E17B84357691Bp+0122,  0x5E72843249088D75,   -65 },  // 1.0e+037
-    { 0x1.2CED32A16A1B1p+0126,  0x4B8ED0283A6D3DF7,   -68 },  // 1.0e+038
-    { 0x1.78287F49C4A1Dp+0129,  0x78E480405D7B9658,   -72 },  // 1.0e+039
-    { 0x1.D6329F1C35CA4p+0132,  0x60B6CD004AC94513,   -75 },  // 1.0e+040
-    { 0x1.25DFA371A19E6p+0136,  0x4D5F0A66A23A9DA9,   -78 },  // 1.0e+041
-    { 0x1.6F578C4E0A060p+0139,  0x7BCB43D769F762A8,   -82 },  // 1.0e+042
-    { 0x1.CB2D6F618C878p+0142,  0x63090312BB2C4EED,   -85 },  // 1.0e+043
-    { 0x1.1EFC659CF7D4Bp+0146,  0x4F3A68DBC8F03F24,   -88 },  // 1.0e+044
-    { 0x1.66BB7F0435C9Ep+0149,  0x7EC3DAF941806506,   -92 },  // 1.0e+045
-    { 0x1.C06A5EC5433C6p+0152,  0x65697BFA9ACD1D9F,   -95 },  // 1.0e+046
-    { 0x1.18427B3B4A05Bp+0156,  0x51212FFBAF0A7E18,   -98 },  // 1.0e+047
-    { 0x1.5E531A0A1C872p+0159,  0x40E7599625A1FE7A,  -101 },  // 1.0e+048
-    { 0x1.B5E7E08CA3A8Fp+0162,  0x67D88F56A29CCA5D,  -105 },  // 1.0e+049
-    { 0x1.11B0EC57E6499p+0166,  0x5313A5DEE87D6EB0,  -108 },  // 1.0e+050
-    { 0x1.561D276DDFDC0p+0169,  0x42761E4BED31255A,  -111 },  // 1.0e+051
-    { 0x1.ABA4714957D30p+0172,  0x6A5696DFE1E83BC3,  -115 },  // 1.0e+052
-    { 0x1.0B46C6CDD6E3Ep+0176,  0x5512124CB4B9C969,  -118 },  // 1.0e+053
-    { 0x1.4E1878814C9CDp+0179,  0x440E750A2A2E3ABA,  -121 },  // 1.0e+054
-    { 0x1.A19E96A19FC40p+0182,  0x6CE3EE76A9E3912A,  -125 },  // 1.0e+055
-    { 0x1.05031E2503DA8p+0186,  0x571CBEC554B60DBB,  -128 },  // 1.0e+056
-    { 0x1.4643E5AE44D12p+0189,  0x45B0989DDD5E7163,  -131 },  // 1.0e+057
-    { 0x1.97D4DF19D6057p+0192,  0x6F80F42FC8971BD1,  -135 },  // 1.0e+058
-    { 0x1.FDCA16E04B86Dp+0195,  0x5933F68CA078E30E,  -138 },  // 1.0e+059
-    { 0x1.3E9E4E4C2F344p+0199,  0x475CC53D4D2D8271,  -141 },  // 1.0e+060
-    { 0x1.8E45E1DF3B015p+0202,  0x722E086215159D82,  -145 },  // 1.0e+061
-    { 0x1.F1D75A5709C1Ap+0205,  0x5B5806B4DDAAE468,  -148 },  // 1.0e+062
-    { 0x1.3726987666190p+0209,  0x49133890B1558386,  -151 },  // 1.0e+063
-    { 0x1.84F03E93FF9F4p+0212,  0x74EB8DB44EEF38D7,  -155 },  // 1.0e+064
-    { 0x1.E62C4E38FF872p+0215,  0x5D893E29D8BF60AC,  -158 },  // 1.0e+065
-    { 0x1.2FDBB0E39FB47p+0219,  0x4AD431BB13CC4D56,  -161 },  // 1.0e+066
-    { 0x1.7BD29D1C87A19p+0222,  0x77B9E92B52E07BBE,  -165 },  // 1.0e+067
-    { 0x1.DAC74463A989Fp+0225,  0x5FC7EDBC424D2FCB,  -168 },  // 1.0e+068
-    { 0x1.28BC8ABE49F63p+0229,  0x4C9FF163683DBFD5,  -171 },  // 1.0e+069
-    { 0x1.72EBAD6DDC73Cp+0232,  0x7A998238A6C932EF,  -175 },  // 1.0e+070
-    { 0x1.CFA698C95390Bp+0235,  0x6214682D523A8F26,  -178 },  // 1.0e+071
-    { 0x1.21C81F7DD43A7p+0239,  0x4E76B9BDDB620C1E,  -181 },  // 1.0e+072
-    { 0x1.6A3A275D49491p+0242,  0x7D8AC2C95F034697,  -185 },  // 1.0e+073
-    { 0x1.C4C8B1349B9B5p+0245,  0x646F023AB2690545,  -188 },  // 1.0e+074
-    { 0x1.1AFD6EC0E1411p+0249,  0x5058CE955B87376B,  -191 },  // 1.0e+075
-    { 0x1.61BCCA7119915p+0252,  0x40470BAAAF9F5F88,  -194 },  // 1.0e+076
-    { 0x1.BA2BFD0D5FF5Bp+0255,  0x66D812AAB29898DB,  -198 },  // 1.0e+077
-    { 0x1.145B7E285BF98p+0259,  0x524675555BAD4715,  -201 },  // 1.0e+078
-    { 0x1.59725DB272F7Fp+0262,  0x41D1F7777C8A9F44,  -204 },  // 1.0e+079
-    { 0x1.AFCEF51F0FB5Ep+0265,  0x694FF258C7443207,  -208 },  // 1.0e+080
-    { 0x1.0DE1593369D1Bp+0269,  0x543FF513D29CF4D2,  -211 },  // 1.0e+081
-    { 0x1.5159AF8044462p+0272,  0x43665DA9754A5D75,  -214 },  // 1.0e+082
-    { 0x1.A5B01B605557Ap+0275,  0x6BD6FC425543C8BB,  -218 },  // 1.0e+083
-    { 0x1.078E111C3556Cp+0279,  0x5645969B77696D62,  -221 },  // 1.0e+084
-    { 0x1.4971956342AC7p+0282,  0x4504787C5F878AB5,  -224 },  // 1.0e+085
-    { 0x1.9BCDFABC13579p+0285,  0x6E6D8D93CC0C1122,  -228 },  // 1.0e+086
-    { 0x1.0160BCB58C16Cp+0289,  0x5857A4763CD6741B,  -231 },  // 1.0e+087
-    { 0x1.41B8EBE2EF1C7p+0292,  0x46AC8391CA4529AF,  -234 },  // 1.0e+088
-    { 0x1.922726DBAAE39p+0295,  0x711405B6106EA919,  -238 },  // 1.0e+089
-    { 0x1.F6B0F092959C7p+0298,  0x5A766AF80D255414,  -241 },  // 1.0e+090
-    { 0x1.3A2E965B9D81Cp+0302,  0x485EBBF9A41DDCDC,  -244 },  // 1.0e+091
-    { 0x1.88BA3BF284E23p+0305,  0x73CAC65C39C96161,  -248 },  // 1.0e+092
-    { 0x1.EAE8CAEF261ACp+0308,  0x5CA23849C7D44DE7,  -251 },  // 1.0e+093
-    { 0x1.32D17ED577D0Bp+0312,  0x4A1B603B06437185,  -254 },  // 1.0e+094
-    { 0x1.7F85DE8AD5C4Ep+0315,  0x76923391A39F1C09,  -258 },  // 1.0e+095
-    { 0x1.DF67562D8B362p+0318,  0x5EDB5C7482E5B007,  -261 },  // 1.0e+096
-    { 0x1.2BA095DC7701Dp+0322,  0x4BE2B05D35848CD2,  -264 },  // 1.0e+097
-    { 0x1.7688BB5394C25p+0325,  0x796AB3C855A0E151,  -268 },  // 1.0e+098
-    { 0x1.D42AEA2879F2Ep+0328,  0x6122296D114D810D,  -271 },  // 1.0e+099
-    { 0x1.249AD2594C37Cp+0332,  0x4DB4EDF0DAA4673E,  -274 },  // 1.0e+100
-    { 0x1.6DC186EF9F45Cp+0335,  0x7C54AFE7C43A3ECA,  -278 },  // 1.0e+101
-    { 0x1.C931E8AB87173p+0338,  0x6376F31FD02E98A1,  -281 },  // 1.0e+102
-    { 0x1.1DBF316B346E7p+0342,  0x4F925C1973587A1B,  -284 },  // 1.0e+103
-    { 0x1.652EFDC6018A1p+0345,  0x7F50935BEBC0C35E,  -288 },  // 1.0e+104
-    { 0x1.BE7ABD3781ECAp+0348,  0x65DA0F7CBC9A35E5,  -291 },  // 1.0e+105
-    { 0x1.170CB642B133Ep+0352,  0x517B3F96FD482B1D,  -294 },  // 1.0e+106
-    { 0x1.5CCFE3D35D80Ep+0355,  0x412F66126439BC17,  -297 },  // 1.0e+107
-    { 0x1.B403DCC834E11p+0358,  0x684BD683D38F9359,  -301 },  // 1.0e+108
-    { 0x1.108269FD210CBp+0362,  0x536FDECFDC72DC47,  -304 },  // 1.0e+109
-    { 0x1.54A3047C694FDp+0365,  0x42BFE57316C249D2,  -307 },  // 1.0e+110
-    { 0x1.A9CBC59B83A3Dp+0368,  0x6ACCA251BE03A951,  -311 },  // 1.0e+111
-    { 0x1.0A1F5B8132466p+0372,  0x557081DAFE695440,  -314 },  // 1.0e+112
-    { 0x1.4CA732617ED7Fp+0375,  0x445A017BFEBAA9CD,  -317 },  // 1.0e+113
-    { 0x1.9FD0FEF9DE8DFp+0378,  0x6D5CCF2CCAC442E2,  -321 },  // 1.0e+114
-    { 0x1.03E29F5C2B18Bp+0382,  0x577D728A3BD03581,  -324 },  // 1.0e+115
-    { 0x1.44DB473335DEEp+0385,  0x45FDF53B630CF79B,  -327 },  // 1.0e+116
-    { 0x1.961219000356Ap+0388,  0x6FFCBB923814BF5E,  -331 },  // 1.0e+117
-    { 0x1.FB969F40042C5p+0391,  0x5996FC74F9AA32B2,  -334 },  // 1.0e+118
-    { 0x1.3D3E2388029BBp+0395,  0x47ABFD2A6154F55B,  -337 },  // 1.0e+119
-    { 0x1.8C8DAC6A0342Ap+0398,  0x72ACC843CEEE555E,  -341 },  // 1.0e+120
-    { 0x1.EFB1178484134p+0401,  0x5BBD6D030BF1DDE5,  -344 },  // 1.0e+121
-    { 0x1.35CEAEB2D28C0p+0405,  0x49645735A327E4B7,  -347 },  // 1.0e+122
-    { 0x1.83425A5F872F1p+0408,  0x756D5855D1D96DF2,  -351 },  // 1.0e+123
-    { 0x1.E412F0F768FADp+0411,  0x5DF11377DB1457F5,  -354 },  // 1.0e+124
-    { 0x1.2E8BD69AA19CCp+0415,  0x4B2742C648DD132A,  -357 },  // 1.0e+125
-    { 0x1.7A2ECC414A03Fp+0418,  0x783ED13D4161B844,  -361 },  // 1.0e+126
-    { 0x1.D8BA7F519C84Fp+0421,  0x603240FDCDE7C69C,  -364 },  // 1.0e+127
-    { 0x1.27748F9301D31p+0425,  0x4CF500CB0B1FD217,  -367 },  // 1.0e+128
-    { 0x1.7151B377C247Ep+0428,  0x7B219ADE7832E9BE,  -371 },  // 1.0e+129
-    { 0x1.CDA62055B2D9Dp+0431,  0x628148B1F9C25498,  -374 },  // 1.0e+130
-    { 0x1.2087D4358FC82p+0435,  0x4ECDD3C1949B76E0,  -377 },  // 1.0e+131
-    { 0x1.68A9C942F3BA3p+0438,  0x7E161F9C20F8BE33,  -381 },  // 1.0e+132
-    { 0x1.C2D43B93B0A8Bp+0441,  0x64DE7FB01A609829,  -384 },  // 1.0e+133
-    { 0x1.19C4A53C4E697p+0445,  0x50B1FFC0151A1354,  -387 },  // 1.0e+134
-    { 0x1.6035CE8B6203Dp+0448,  0x408E66334414DC43,  -390 },  // 1.0e+135
-    { 0x1.B843422E3A84Cp+0451,  0x674A3D1ED354939F,  -394 },  // 1.0e+136
-    { 0x1.132A095CE492Fp+0455,  0x52A1CA7F0F76DC7F,  -397 },  // 1.0e+137
-    { 0x1.57F48BB41DB7Bp+0458,  0x421B0865A5F8B065,  -400 },  // 1.0e+138
-    { 0x1.ADF1AEA12525Ap+0461,  0x69C4DA3C3CC11A3C,  -404 },  // 1.0e+139
-    { 0x1.0CB70D24B7378p+0465,  0x549D7B6363CDAE96,  -407 },  // 1.0e+140
-    { 0x1.4FE4D06DE5056p+0468,  0x43B12F82B63E2545,  -410 },  // 1.0e+141
-    { 0x1.A3DE04895E46Cp+0471,  0x6C4EB26ABD303BA2,  -414 },  // 1.0e+142
-    { 0x1.066AC2D5DAEC3p+0475,  0x56A55B889759C94E,  -417 },  // 1.0e+143
-    { 0x1.4805738B51A74p+0478,  0x45511606DF7B0772,  -420 },  // 1.0e+144
-    { 0x1.9A06D06E26112p+0481,  0x6EE8233E325E7250,  -424 },  // 1.0e+145
-    { 0x1.00444244D7CABp+0485,  0x58B9B5CB5B7EC1D9,  -427 },  // 1.0e+146
-    { 0x1.405552D60DBD6p+0488,  0x46FAF7D5E2CBCE47,  -430 },  // 1.0e+147
-    { 0x1.906AA78B912CBp+0491,  0x71918C896ADFB073,  -434 },  // 1.0e+148
-    { 0x1.F485516E7577Ep+0494,  0x5ADAD6D4557FC05C,  -437 },  // 1.0e+149
-    { 0x1.38D352E5096AFp+0498,  0x48AF1243779966B0,  -440 },  // 1.0e+150
-    { 0x1.8708279E4BC5Ap+0501,  0x744B506BF28F0AB3,  -444 },  // 1.0e+151
-    { 0x1.E8CA3185DEB71p+0504,  0x5D090D2328726EF5,  -447 },  // 1.0e+152
-    { 0x1.317E5EF3AB327p+0508,  0x4A6DA41C205B8BF7,  -450 },  // 1.0e+153
-    { 0x1.7DDDF6B095FF0p+0511,  0x7715D36033C5ACBF,  -454 },  // 1.0e+154
-    { 0x1.DD55745CBB7ECp+0514,  0x5F44A919C3048A32,  -457 },  // 1.0e+155
-    { 0x1.2A5568B9F52F4p+0518,  0x4C36EDAE359D3B5B,  -460 },  // 1.0e+156
-    { 0x1.74EAC2E8727B1p+0521,  0x79F17C49EF61F893,  -464 },  // 1.0e+157
-    { 0x1.D22573A28F19Dp+0524,  0x618DFD07F2B4C6DC,  -467 },  // 1.0e+158
-    { 0x1.2357684599702p+0528,  0x4E0B30D328909F16,  -470 },  // 1.0e+159
-    { 0x1.6C2D4256FFCC2p+0531,  0x7CDEB4850DB431BD,  -474 },  // 1.0e+160
-    { 0x1.C73892ECBFBF3p+0534,  0x63E55D373E29C164,  -477 },  // 1.0e+161
-    { 0x1.1C835BD3F7D78p+0538,  0x4FEAB0F8FE87CDE9,  -480 },  // 1.0e+162
-    { 0x1.63A432C8F5CD6p+0541,  0x7FDDE7F4CA72E30F,  -484 },  // 1.0e+163
-    { 0x1.BC8D3F7B3340Bp+0544,  0x664B1FF7085BE8D9,  -487 },  // 1.0e+164
-    { 0x1.15D847AD00087p+0548,  0x51D5B32C06AFED7A,  -490 },  // 1.0e+165
-    { 0x1.5B4E5998400A9p+0551,  0x4177C2899EF32462,  -493 },  // 1.0e+166
-    { 0x1.B221EFFE500D3p+0554,  0x68BF9DA8FE51D3D0,  -497 },  // 1.0e+167
-    { 0x1.0F5535FEF2084p+0558,  0x53CC7E20CB74A973,  -500 },  // 1.0e+168
-    { 0x1.532A837EAE8A5p+0561,  0x4309FE80A2C3BAC2,  -503 },  // 1.0e+169
-    { 0x1.A7F5245E5A2CEp+0564,  0x6B4330CDD1392AD1,  -507 },  // 1.0e+170
-    { 0x1.08F936BAF85C1p+0568,  0x55CF5A3E40FA88A7,  -510 },  // 1.0e+171
-    { 0x1.4B378469B6731p+0571,  0x44A5E1CB672ED3B9,  -513 },  // 1.0e+172
-    { 0x1.9E056584240FDp+0574,  0x6DD636123EB152C1,  -517 },  // 1.0e+173
-    { 0x1.02C35F729689Ep+0578,  0x57DE91A832277567,  -520 },  // 1.0e+174
-    { 0x1.4374374F3C2C6p+0581,  0x464BA7B9C1B92AB9,  -523 },  // 1.0e+175
-    { 0x1.945145230B377p+0584,  0x70790C5C6928445C,  -527 },  // 1.0e+176
-    { 0x1.F965966BCE055p+0587,  0x59FA7049EDB9D049,  -530 },  // 1.0e+177
-    { 0x1.3BDF7E0360C35p+0591,  0x47FB8D07F161736E,  -533 },  // 1.0e+178
-    { 0x1.8AD75D8438F43p+0594,  0x732C14D98235857D,  -537 },  // 1.0e+179
-    { 0x1.ED8D34E547313p+0597,  0x5C2343E134F79DFD,  -540 },  // 1.0e+180
-    { 0x1.3478410F4C7ECp+0601,  0x49B5CFE75D92E4CA,  -543 },  // 1.0e+181
-    { 0x1.819651531F9E7p+0604,  0x75EFB30BC8EB07AB,  -547 },  // 1.0e+182
-    { 0x1.E1FBE5A7E7861p+0607,  0x5E595C096D88D2EF,  -550 },  // 1.0e+183
-    { 0x1.2D3D6F88F0B3Cp+0611,  0x4B7AB0078AD3DBF2,  -553 },  // 1.0e+184
-    { 0x1.788CCB6B2CE0Cp+0614,  0x78C44CD8DE1FC650,  -557 },  // 1.0e+185
-    { 0x1.D6AFFE45F818Fp+0617,  0x609D0A4718196B73,  -560 },  // 1.0e+186
-    { 0x1.262DFEEBBB0F9p+0621,  0x4D4A6E9F467ABC5C,  -563 },  // 1.0e+187
-    { 0x1.6FB97EA6A9D37p+0624,  0x7BAA4A9870C46094,  -567 },  // 1.0e+188
-    { 0x1.CBA7DE5054485p+0627,  0x62EEA2138D69E6DD,  -570 },  // 1.0e+189
-    { 0x1.1F48EAF234AD3p+0631,  0x4F254E760ABB1F17,  -573 },  // 1.0e+190
-    { 0x1.671B25AEC1D88p+0634,  0x7EA21723445E9825,  -577 },  // 1.0e+191
-    { 0x1.C0E1EF1A724EAp+0637,  0x654E78E9037EE01D,  -580 },  // 1.0e+192
-    { 0x1.188D357087712p+0641,  0x510B93ED9C658017,  -583 },  // 1.0e+193
-    { 0x1.5EB082CCA94D7p+0644,  0x40D60FF149EACCDF,  -586 },  // 1.0e+194
-    { 0x1.B65CA37FD3A0Dp+0647,  0x67BCE64EDCAAE166,  -590 },  // 1.0e+195
-    { 0x1.11F9E62FE4448p+0651,  0x52FD850BE3BBE784,  -593 },  // 1.0e+196
-    { 0x1.56785FBBDD55Ap+0654,  0x42646A6FE9631F9D,  -596 },  // 1.0e+197
-    { 0x1.AC1677AAD4AB0p+0657,  0x6A3A43E642383295,  -600 },  // 1.0e+198
-    { 0x1.0B8E0ACAC4EAEp+0661,  0x54FB698501C68EDE,  -603 },  // 1.0e+199
-    { 0x1.4E718D7D7625Ap+0664,  0x43FC546A67D20BE4,  -606 },  // 1.0e+200
-    { 0x1.A20DF0DCD3AF0p+0667,  0x6CC6ED770C83463B,  -610 },  // 1.0e+201
-    { 0x1.0548B68A044D6p+0671,  0x57058AC5A39C382F,  -613 },  // 1.0e+202
-    { 0x1.469AE42C8560Cp+0674,  0x459E089E1C7CF9BF,  -616 },  // 1.0e+203
-    { 0x1.98419D37A6B8Fp+0677,  0x6F6340FCFA618F98,  -620 },  // 1.0e+204
-    { 0x1.FE52048590672p+0680,  0x591C33FD951AD946,  -623 },  // 1.0e+205
-    { 0x1.3EF342D37A407p+0684,  0x4749C33144157A9F,  -626 },  // 1.0e+206
-    { 0x1.8EB0138858D09p+0687,  0x720F9EB539BBF765,  -630 },  // 1.0e+207
-    { 0x1.F25C186A6F04Cp+0690,  0x5B3FB22A94965F84,  -633 },  // 1.0e+208
-    { 0x1.37798F428562Fp+0694,  0x48FFC1BBAA11E603,  -636 },  // 1.0e+209
-    { 0x1.8557F31326BBBp+0697,  0x74CC692C434FD66B,  -640 },  // 1.0e+210
-    { 0x1.E6ADEFD7F06AAp+0700,  0x5D705423690CAB89,  -643 },  // 1.0e+211
-    { 0x1.302CB5E6F642Ap+0704,  0x4AC0434F873D5607,  -646 },  // 1.0e+212
-    { 0x1.7C37E360B3D35p+0707,  0x779A054C0B955672,  -650 },  // 1.0e+213
-    { 0x1.DB45DC38E0C82p+0710,  0x5FAE6AA33C77785B,  -653 },  // 1.0e+214
-    { 0x1.290BA9A38C7D1p+0714,  0x4C8B888296C5F9E2,  -656 },  // 1.0e+215
-    { 0x1.734E940C6F9C5p+0717,  0x7A78DA6A8AD65C9D,  -660 },  // 1.0e+216
-    { 0x1.D022390F8B837p+0720,  0x61FA48553BDEB07E,  -663 },  // 1.0e+217
-    { 0x1.221563A9B7322p+0724,  0x4E61D37763188D31,  -666 },  // 1.0e+218
-    { 0x1.6A9ABC9424FEBp+0727,  0x7D6952589E8DAEB6,  -670 },  // 1.0e+219
-    { 0x1.C5416BB92E3E6p+0730,  0x645441E07ED7BEF8,  -673 },  // 1.0e+220
-    { 0x1.1B48E353BCE6Fp+0734,  0x504367E6CBDFCBF9,  -676 },  // 1.0e+221
-    { 0x1.621B1C28AC20Bp+0737,  0x4035ECB8A3196FFB,  -679 },  // 1.0e+222
-    { 0x1.BAA1E332D728Ep+0740,  0x66BCADF43828B32B,  -683 },  // 1.0e+223
-    { 0x1.14A52DFFC6799p+0744,  0x52308B29C686F5BC,  -686 },  // 1.0e+224
-    { 0x1.59CE797FB817Fp+0747,  0x41C06F549ED25E30,  -689 },  // 1.0e+225
-    { 0x1.B04217DFA61DFp+0750,  0x6933E554315096B3,  -693 },  // 1.0e+226
-    { 0x1.0E294EEBC7D2Bp+0754,  0x542984435AA6DEF5,  -696 },  // 1.0e+227
-    { 0x1.51B3A2A6B9C76p+0757,  0x435469CF7BB8B25E,  -699 },  // 1.0e+228
-    { 0x1.A6208B5068394p+0760,  0x6BBA42E592C11D63,  -703 },  // 1.0e+229
-    { 0x1.07D457124123Cp+0764,  0x562E9BEADBCDB11C,  -706 },  // 1.0e+230
-    { 0x1.49C96CD6D16CBp+0767,  0x44F216557CA48DB0,  -709 },  // 1.0e+231
-    { 0x1.9C3BC80C85C7Ep+0770,  0x6E5023BBFAA0E2B3,  -713 },  // 1.0e+232
-    { 0x1.01A55D07D39CFp+0774,  0x58401C96621A4EF6,  -716 },  // 1.0e+233
-    { 0x1.420EB449C8842p+0777,  0x4699B0784E7B725E,  -719 },  // 1.0e+234
-    { 0x1.9292615C3AA53p+0780,  0x70F5E726E3F8B6FD,  -723 },  // 1.0e+235
-    { 0x1.F736F9B3494E8p+0783,  0x5A5E5285832D5F31,  -726 },  // 1.0e+236
-    { 0x1.3A825C100DD11p+0787,  0x484B75379C244C27,  -729 },  // 1.0e+237
-    { 0x1.8922F31411455p+0790,  0x73ABEEBF603A1372,  -733 },  // 1.0e+238
-    { 0x1.EB6BAFD91596Bp+0793,  0x5C898BCC4CFB42C2,  -736 },  // 1.0e+239
-    { 0x1.33234DE7AD7E2p+0797,  0x4A07A309D72F689B,  -739 },  // 1.0e+240
-    { 0x1.7FEC216198DDBp+0800,  0x76729E762518A75E,  -743 },  // 1.0e+241
-    { 0x1.DFE729B9FF152p+0803,  0x5EC2185E8413B918,  -746 },  // 1.0e+242
-    { 0x1.2BF07A143F6D3p+0807,  0x4BCE79E536762DAD,  -749 },  // 1.0e+243
-    { 0x1.76EC98994F488p+0810,  0x794A5CA1F0BD15E2,  -753 },  // 1.0e+244
-    { 0x1.D4A7BEBFA31AAp+0813,  0x61084A1B26FDAB1B,  -756 },  // 1.0e+245
-    { 0x1.24E8D737C5F0Ap+0817,  0x4DA03B48EBFE227C,  -759 },  // 1.0e+246
-    { 0x1.6E230D05B76CDp+0820,  0x7C33920E46636A60,  -763 },  // 1.0e+247
-    { 0x1.C9ABD04725480p+0823,  0x635C74D8384F884D,  -766 },  // 1.0e+248
-    { 0x1.1E0B622C774D0p+0827,  0x4F7D2A469372D370,  -769 },  // 1.0e+249
-    { 0x1.658E3AB795204p+0830,  0x7F2EAA0A85848581,  -773 },  // 1.0e+250
-    { 0x1.BEF1C9657A685p+0833,  0x65BEEE6ED136D134,  -776 },  // 1.0e+251
-    { 0x1.17571DDF6C813p+0837,  0x51658B8BDA9240F6,  -779 },  // 1.0e+252
-    { 0x1.5D2CE55747A18p+0840,  0x411E093CAEDB672B,  -782 },  // 1.0e+253
-    { 0x1.B4781EAD1989Ep+0843,  0x68300EC77E2BD845,  -786 },  // 1.0e+254
-    { 0x1.10CB132C2FF63p+0847,  0x5359A56C64EFE037,  -789 },  // 1.0e+255
-    { 0x1.54FDD7F73BF3Bp+0850,  0x42AE1DF050BFE693,  -792 },  // 1.0e+256
-    { 0x1.AA3D4DF50AF0Ap+0853,  0x6AB02FE6E79970EB,  -796 },  // 1.0e+257
-    { 0x1.0A6650B926D66p+0857,  0x5559BFEBEC7AC0BC,  -799 },  // 1.0e+258
-    { 0x1.4CFFE4E7708C0p+0860,  0x4447CCBCBD2F0096,  -802 },  // 1.0e+259
-    { 0x1.A03FDE214CAF0p+0863,  0x6D3FADFAC84B3424,  -806 },  // 1.0e+260
-    { 0x1.0427EAD4CFED6p+0867,  0x576624C8A03C29B6,  -809 },  // 1.0e+261
-    { 0x1.4531E58A03E8Bp+0870,  0x45EB50A08030215E,  -812 },  // 1.0e+262
-    { 0x1.967E5EEC84E2Ep+0873,  0x6FDEE76733803564,  -816 },  // 1.0e+263
-    { 0x1.FC1DF6A7A61BAp+0876,  0x597F1F85C2CCF783,  -819 },  // 1.0e+264
-    { 0x1.3D92BA28C7D14p+0880,  0x4798E6049BD72C69,  -822 },  // 1.0e+265
-    { 0x1.8CF768B2F9C59p+0883,  0x728E3CD42C8B7A42,  -826 },  // 1.0e+266
-    { 0x1.F03542DFB8370p+0886,  0x5BA4FD768A092E9B,  -829 },  // 1.0e+267
-    { 0x1.362149CBD3226p+0890,  0x4950CAC53B3A8BAF,  -832 },  // 1.0e+268
-    { 0x1.83A99C3EC7EAFp+0893,  0x754E113B91F745E5,  -836 },  // 1.0e+269
-    { 0x1.E494034E79E5Bp+0896,  0x5DD80DC941929E51,  -839 },  // 1.0e+270
-    { 0x1.2EDC82110C2F9p+0900,  0x4B133E3A9ADBB1DA,  -842 },  // 1.0e+271
-    { 0x1.7A93A2954F3B7p+0903,  0x781EC9F75E2C4FC4,  -846 },  // 1.0e+272
-    { 0x1.D9388B3AA30A5p+0906,  0x6018A192B1BD0C9C,  -849 },  // 1.0e+273
-    { 0x1.27C35704A5E67p+0910,  0x4CE0814227CA707D,  -852 },  // 1.0e+274
-    { 0x1.71B42CC5CF601p+0913,  0x7B00CED03FAA4D95,  -856 },  // 1.0e+275
-    { 0x1.CE2137F743381p+0916,  0x62670BD9CC883E11,  -859 },  // 1.0e+276
-    { 0x1.20D4C2FA8A030p+0920,  0x4EB8D647D6D364DA,  -862 },  // 1.0e+277
-    { 0x1.6909F3B92C83Dp+0923,  0x7DF48A0C8AEBD491,  -866 },  // 1.0e+278
-    { 0x1.C34C70A777A4Cp+0926,  0x64C3A1A3A25643A7,  -869 },  // 1.0e+279
-    { 0x1.1A0FC668AAC6Fp+0930,  0x509C814FB511CFB9,  -872 },  // 1.0e+280
-    { 0x1.6093B802D578Bp+0933,  0x407D343FC40E3FC7,  -875 },  // 1.0e+281
-    { 0x1.B8B8A6038AD6Ep+0936,  0x672EB9FFA016CC71,  -879 },  // 1.0e+282
-    { 0x1.137367C236C65p+0940,  0x528BC7FFB345705B,  -882 },  // 1.0e+283
-    { 0x1.585041B2C477Ep+0943,  0x42096CCC8F6AC048,  -885 },  // 1.0e+284
-    { 0x1.AE64521F7595Ep+0946,  0x69A8AE1418AACD41,  -889 },  // 1.0e+285
-    { 0x1.0CFEB353A97DAp+0950,  0x5486F1A9AD557101,  -892 },  // 1.0e+286
-    { 0x1.503E602893DD1p+0953,  0x439F27BAF1112734,  -895 },  // 1.0e+287
-    { 0x1.A44DF832B8D45p+0956,  0x6C31D92B1B4EA520,  -899 },  // 1.0e+288
-    { 0x1.06B0BB1FB384Bp+0960,  0x568E4755AF721DB3,  -902 },  // 1.0e+289
-    { 0x1.485CE9E7A065Ep+0963,  0x453E9F77BF8E7E29,  -905 },  // 1.0e+290
-    { 0x1.9A742461887F6p+0966,  0x6ECA98BF98E3FD0E,  -909 },  // 1.0e+291
-    { 0x1.008896BCF54F9p+0970,  0x58A213CC7A4FFDA5,  -912 },  // 1.0e+292
-    { 0x1.40AABC6C32A38p+0973,  0x46E80FD6C83FFE1D,  -915 },  // 1.0e+293
-    { 0x1.90D56B873F4C6p+0976,  0x71734C8AD9FFFCFC,  -919 },  // 1.0e+294
-    { 0x1.F50AC6690F1F8p+0979,  0x5AC2A3A247FFFD96,  -922 },  // 1.0e+295
-    { 0x1.3926BC01A973Bp+0983,  0x489BB61B6CCCCADF,  -925 },  // 1.0e+296
-    { 0x1.87706B0213D09p+0986,  0x742C569247AE1164,  -929 },  // 1.0e+297
-    { 0x1.E94C85C298C4Cp+0989,  0x5CF04541D2F1A783,  -932 },  // 1.0e+298
-    { 0x1.31CFD3999F7AFp+0993,  0x4A59D101758E1F9C,  -935 },  // 1.0e+299
-    { 0x1.7E43C8800759Bp+0996,  0x76F61B3588E365C7,  -939 },  // 1.0e+300
-    { 0x1.DDD4BAA009302p+0999,  0x5F2B48F7A0B5EB06,  -942 },  // 1.0e+301
-    { 0x1.2AA4F4A405BE1p+1003,  0x4C22A0C61A2B226B,  -945 },  // 1.0e+302
-    { 0x1.754E31CD072D9p+1006,  0x79D1013CF6AB6A45,  -949 },  // 1.0e+303
-    { 0x1.D2A1BE4048F90p+1009,  0x617400FD9222BB6A,  -952 },  // 1.0e+304
-    { 0x1.23A516E82D9BAp+1013,  0x4DF6673141B562BB,  -955 },  // 1.0e+305
-    { 0x1.6C8E5CA239028p+1016,  0x7CBD71E869223792,  -959 },  // 1.0e+306
-    { 0x1.C7B1F3CAC7433p+1019,  0x63CAC186BA81C60E,  -962 },  // 1.0e+307
-    { 0x1.1CCF385EBC89Fp+1023,  0x4FD5679EFB9B04D8,  -965 },  // 1.0e+308
+    { 0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7B },  // 1.0e-292
+    { 0x9FAACF3DF73609B1, 0x77B191618C54E9AD },  // 1.0e-291
+    { 0xC795830D75038C1D, 0xD59DF5B9EF6A2418 },  // 1.0e-290
+    { 0xF97AE3D0D2446F25, 0x4B0573286B44AD1E },  // 1.0e-289
+    { 0x9BECCE62836AC577, 0x4EE367F9430AEC33 },  // 1.0e-288
+    { 0xC2E801FB244576D5, 0x229C41F793CDA740 },  // 1.0e-287
+    { 0xF3A20279ED56D48A, 0x6B43527578C11110 },  // 1.0e-286
+    { 0x9845418C345644D6, 0x830A13896B78AAAA },  // 1.0e-285
+    { 0xBE5691EF416BD60C, 0x23CC986BC656D554 },  // 1.0e-284
+    { 0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA9 },  // 1.0e-283
+    { 0x94B3A202EB1C3F39, 0x7BF7D71432F3D6AA },  // 1.0e-282
+    { 0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC54 },  // 1.0e-281
+    { 0xE858AD248F5C22C9, 0xD1B3400F8F9CFF69 },  // 1.0e-280
+    { 0x91376C36D99995BE, 0x23100809B9C21FA2 },  // 1.0e-279
+    { 0xB58547448FFFFB2D, 0xABD40A0C2832A78B },  // 1.0e-278
+    { 0xE2E69915B3FFF9F9, 0x16C90C8F323F516D },  // 1.0e-277
+    { 0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E4 },  // 1.0e-276
+    { 0xB1442798F49FFB4A, 0x99CD11CFDF41779D },  // 1.0e-275
+    { 0xDD95317F31C7FA1D, 0x40405643D711D584 },  // 1.0e-274
+    { 0x8A7D3EEF7F1CFC52, 0x482835EA666B2573 },  // 1.0e-273
+    { 0xAD1C8EAB5EE43B66, 0xDA3243650005EED0 },  // 1.0e-272
+    { 0xD863B256369D4A40, 0x90BED43E40076A83 },  // 1.0e-271
+    { 0x873E4F75E2224E68, 0x5A7744A6E804A292 },  // 1.0e-270
+    { 0xA90DE3535AAAE202, 0x711515D0A205CB37 },  // 1.0e-269
+    { 0xD3515C2831559A83, 0x0D5A5B44CA873E04 },  // 1.0e-268
+    { 0x8412D9991ED58091, 0xE858790AFE9486C3 },  // 1.0e-267
+    { 0xA5178FFF668AE0B6, 0x626E974DBE39A873 },  // 1.0e-266
+    { 0xCE5D73FF402D98E3, 0xFB0A3D212DC81290 },  // 1.0e-265
+    { 0x80FA687F881C7F8E, 0x7CE66634BC9D0B9A },  // 1.0e-264
+    { 0xA139029F6A239F72, 0x1C1FFFC1EBC44E81 },  // 1.0e-263
+    { 0xC987434744AC874E, 0xA327FFB266B56221 },  // 1.0e-262
+    { 0xFBE9141915D7A922, 0x4BF1FF9F0062BAA9 },  // 1.0e-261
+    { 0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4AA },  // 1.0e-260
+    { 0xC4CE17B399107C22, 0xCB550FB4384D21D4 },  // 1.0e-259
+    { 0xF6019DA07F549B2B, 0x7E2A53A146606A49 },  // 1.0e-258
+    { 0x99C102844F94E0FB, 0x2EDA7444CBFC426E },  // 1.0e-257
+    { 0xC0314325637A1939, 0xFA911155FEFB5309 },  // 1.0e-256
+    { 0xF03D93EEBC589F88, 0x793555AB7EBA27CB },  // 1.0e-255
+    { 0x96267C7535B763B5, 0x4BC1558B2F3458DF },  // 1.0e-254
+    { 0xBBB01B9283253CA2, 0x9EB1AAEDFB016F17 },  // 1.0e-253
+    { 0xEA9C227723EE8BCB, 0x465E15A979C1CADD },  // 1.0e-252
+    { 0x92A1958A7675175F, 0x0BFACD89EC191ECA },  // 1.0e-251
+    { 0xB749FAED14125D36, 0xCEF980EC671F667C },  // 1.0e-250
+    { 0xE51C79A85916F484, 0x82B7E12780E7401B },  // 1.0e-249
+    { 0x8F31CC0937AE58D2, 0xD1B2ECB8B0908811 },  // 1.0e-248
+    { 0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA16 },  // 1.0e-247
+    { 0xDFBDCECE67006AC9, 0x67A791E093E1D49B },  // 1.0e-246
+    { 0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E1 },  // 1.0e-245
+    { 0xAECC49914078536D, 0x58FAE9F773886E19 },  // 1.0e-244
+    { 0xDA7F5BF590966848, 0xAF39A475506A899F },  // 1.0e-243
+    { 0x888F99797A5E012D, 0x6D8406C952429604 },  // 1.0e-242
+    { 0xAAB37FD7D8F58178, 0xC8E5087BA6D33B84 },  // 1.0e-241
+    { 0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A65 },  // 1.0e-240
+    { 0x855C3BE0A17FCD26, 0x5CF2EEA09A550680 },  // 1.0e-239
+    { 0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481F },  // 1.0e-238
+    { 0xD0601D8EFC57B08B, 0xF13B94DAF124DA27 },  // 1.0e-237
+    { 0x823C12795DB6CE57, 0x76C53D08D6B70859 },  // 1.0e-236
+    { 0xA2CB1717B52481ED, 0x54768C4B0C64CA6F },  // 1.0e-235
+    { 0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD0A },  // 1.0e-234
+    { 0xFE5D54150B090B02, 0xD3F93B35435D7C4D },  // 1.0e-233
+    { 0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DB0 },  // 1.0e-232
+    { 0xC6B8E9B0709F109A, 0x359AB6419CA1091C },  // 1.0e-231
+    { 0xF867241C8CC6D4C0, 0xC30163D203C94B63 },  // 1.0e-230
+    { 0x9B407691D7FC44F8, 0x79E0DE63425DCF1E },  // 1.0e-229
+    { 0xC21094364DFB5636, 0x985915FC12F542E5 },  // 1.0e-228
+    { 0xF294B943E17A2BC4, 0x3E6F5B7B17B2939E },  // 1.0e-227
+    { 0x979CF3CA6CEC5B5A, 0xA705992CEECF9C43 },  // 1.0e-226
+    { 0xBD8430BD08277231, 0x50C6FF782A838354 },  // 1.0e-225
+    { 0xECE53CEC4A314EBD, 0xA4F8BF5635246429 },  // 1.0e-224
+    { 0x940F4613AE5ED136, 0x871B7795E136BE9A },  // 1.0e-223
+    { 0xB913179899F68584, 0x28E2557B59846E40 },  // 1.0e-222
+    { 0xE757DD7EC07426E5, 0x331AEADA2FE589D0 },  // 1.0e-221
+    { 0x9096EA6F3848984F, 0x3FF0D2C85DEF7622 },  // 1.0e-220
+    { 0xB4BCA50B065ABE63, 0x0FED077A756B53AA },  // 1.0e-219
+    { 0xE1EBCE4DC7F16DFB, 0xD3E8495912C62895 },  // 1.0e-218
+    { 0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95D },  // 1.0e-217
+    { 0xB080392CC4349DEC, 0xBD8D794D96AACFB4 },  // 1.0e-216
+    { 0xDCA04777F541C567, 0xECF0D7A0FC5583A1 },  // 1.0e-215
+    { 0x89E42CAAF9491B60, 0xF41686C49DB57245 },  // 1.0e-214
+    { 0xAC5D37D5B79B6239, 0x311C2875C522CED6 },  // 1.0e-213
+    { 0xD77485CB25823AC7, 0x7D633293366B828C },  // 1.0e-212
+    { 0x86A8D39EF77164BC, 0xAE5DFF9C02033198 },  // 1.0e-211
+    { 0xA8530886B54DBDEB, 0xD9F57F830283FDFD },  // 1.0e-210
+    { 0xD267CAA862A12D66, 0xD072DF63C324FD7C },  // 1.0e-209
+    { 0x8380DEA93DA4BC60, 0x4247CB9E59F71E6E },  // 1.0e-208
+    { 0xA46116538D0DEB78, 0x52D9BE85F074E609 },  // 1.0e-207
+    { 0xCD795BE870516656, 0x67902E276C921F8C },  // 1.0e-206
+    { 0x806BD9714632DFF6, 0x00BA1CD8A3DB53B7 },  // 1.0e-205
+    { 0xA086CFCD97BF97F3, 0x80E8A40ECCD228A5 },  // 1.0e-204
+    { 0xC8A883C0FDAF7DF0, 0x6122CD128006B2CE },  // 1.0e-203
+    { 0xFAD2A4B13D1B5D6C, 0x796B805720085F82 },  // 1.0e-202
+    { 0x9CC3A6EEC6311A63, 0xCBE3303674053BB1 },  // 1.0e-201
+    { 0xC3F490AA77BD60FC, 0xBEDBFC4411068A9D },  // 1.0e-200
+    { 0xF4F1B4D515ACB93B, 0xEE92FB5515482D45 },  // 1.0e-199
+    { 0x991711052D8BF3C5, 0x751BDD152D4D1C4B },  // 1.0e-198
+    { 0xBF5CD54678EEF0B6, 0xD262D45A78A0635E },  // 1.0e-197
+    { 0xEF340A98172AACE4, 0x86FB897116C87C35 },  // 1.0e-196
+    { 0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA1 },  // 1.0e-195
+    { 0xBAE0A846D2195712, 0x8974836059CCA10A },  // 1.0e-194
+    { 0xE998D258869FACD7, 0x2BD1A438703FC94C },  // 1.0e-193
+    { 0x91FF83775423CC06, 0x7B6306A34627DDD0 },  // 1.0e-192
+    { 0xB67F6455292CBF08, 0x1A3BC84C17B1D543 },  // 1.0e-191
+    { 0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A94 },  // 1.0e-190
+    { 0x8E938662882AF53E, 0x547EB47B7282EE9D },  // 1.0e-189
+    { 0xB23867FB2A35B28D, 0xE99E619A4F23AA44 },  // 1.0e-188
+    { 0xDEC681F9F4C31F31, 0x6405FA00E2EC94D5 },  // 1.0e-187
+    { 0x8B3C113C38F9F37E, 0xDE83BC408DD3DD05 },  // 1.0e-186
+    { 0xAE0B158B4738705E, 0x9624AB50B148D446 },  // 1.0e-185
+    { 0xD98DDAEE19068C76, 0x3BADD624DD9B0958 },  // 1.0e-184
+    { 0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D7 },  // 1.0e-183
+    { 0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4D },  // 1.0e-182
+    { 0xD47487CC8470652B, 0x7647C32000696720 },  // 1.0e-181
+    { 0x84C8D4DFD2C63F3B, 0x29ECD9F40041E074 },  // 1.0e-180
+    { 0xA5FB0A17C777CF09, 0xF468107100525891 },  // 1.0e-179
+    { 0xCF79CC9DB955C2CC, 0x7182148D4066EEB5 },  // 1.0e-178
+    { 0x81AC1FE293D599BF, 0xC6F14CD848405531 },  // 1.0e-177
+    { 0xA21727DB38CB002F, 0xB8ADA00E5A506A7D },  // 1.0e-176
+    { 0xCA9CF1D206FDC03B, 0xA6D90811F0E4851D },  // 1.0e-175
+    { 0xFD442E4688BD304A, 0x908F4A166D1DA664 },  // 1.0e-174
+    { 0x9E4A9CEC15763E2E, 0x9A598E4E043287FF },  // 1.0e-173
+    { 0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FE },  // 1.0e-172
+    { 0xF7549530E188C128, 0xD12BEE59E68EF47D },  // 1.0e-171
+    { 0x9A94DD3E8CF578B9, 0x82BB74F8301958CF },  // 1.0e-170
+    { 0xC13A148E3032D6E7, 0xE36A52363C1FAF02 },  // 1.0e-169
+    { 0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC2 },  // 1.0e-168
+    { 0x96F5600F15A7B7E5, 0x29AB103A5EF8C0BA },  // 1.0e-167
+    { 0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E8 },  // 1.0e-166
+    { 0xEBDF661791D60F56, 0x111B495B3464AD22 },  // 1.0e-165
+    { 0x936B9FCEBB25C995, 0xCAB10DD900BEEC35 },  // 1.0e-164
+    { 0xB84687C269EF3BFB, 0x3D5D514F40EEA743 },  // 1.0e-163
+    { 0xE65829B3046B0AFA, 0x0CB4A5A3112A5113 },  // 1.0e-162
+    { 0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AC },  // 1.0e-161
+    { 0xB3F4E093DB73A093, 0x59ED216765690F57 },  // 1.0e-160
+    { 0xE0F218B8D25088B8, 0x306869C13EC3532D },  // 1.0e-159
+    { 0x8C974F7383725573, 0x1E414218C73A13FC },  // 1.0e-158
+    { 0xAFBD2350644EEACF, 0xE5D1929EF90898FB },  // 1.0e-157
+    { 0xDBAC6C247D62A583, 0xDF45F746B74ABF3A },  // 1.0e-156
+    { 0x894BC396CE5DA772, 0x6B8BBA8C328EB784 },  // 1.0e-155
+    { 0xAB9EB47C81F5114F, 0x066EA92F3F326565 },  // 1.0e-154
+    { 0xD686619BA27255A2, 0xC80A537B0EFEFEBE },  // 1.0e-153
+    { 0x8613FD0145877585, 0xBD06742CE95F5F37 },  // 1.0e-152
+    { 0xA798FC4196E952E7, 0x2C48113823B73705 },  // 1.0e-151
+    { 0xD17F3B51FCA3A7A0, 0xF75A15862CA504C6 },  // 1.0e-150
+    { 0x82EF85133DE648C4, 0x9A984D73DBE722FC },  // 1.0e-149
+    { 0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBB },  // 1.0e-148
+    { 0xCC963FEE10B7D1B3, 0x318DF905079926A9 },  // 1.0e-147
+    { 0xFFBBCFE994E5C61F, 0xFDF17746497F7053 },  // 1.0e-146
+    { 0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA634 },  // 1.0e-145
+    { 0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC1 },  // 1.0e-144
+    { 0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B1 },  // 1.0e-143
+    { 0x9C1661A651213E2D, 0x06BEA10CA65C084F },  // 1.0e-142
+    { 0xC31BFA0FE5698DB8, 0x486E494FCFF30A63 },  // 1.0e-141
+    { 0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFB },  // 1.0e-140
+    { 0x986DDB5C6B3A76B7, 0xF89629465A75E01D },  // 1.0e-139
+    { 0xBE89523386091465, 0xF6BBB397F1135824 },  // 1.0e-138
+    { 0xEE2BA6C0678B597F, 0x746AA07DED582E2D },  // 1.0e-137
+    { 0x94DB483840B717EF, 0xA8C2A44EB4571CDD },  // 1.0e-136
+    { 0xBA121A4650E4DDEB, 0x92F34D62616CE414 },  // 1.0e-135
+    { 0xE896A0D7E51E1566, 0x77B020BAF9C81D18 },  // 1.0e-134
+    { 0x915E2486EF32CD60, 0x0ACE1474DC1D122F },  // 1.0e-133
+    { 0xB5B5ADA8AAFF80B8, 0x0D819992132456BB },  // 1.0e-132
+    { 0xE3231912D5BF60E6, 0x10E1FFF697ED6C6A },  // 1.0e-131
+    { 0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C2 },  // 1.0e-130
+    { 0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB3 },  // 1.0e-129
+    { 0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDF },  // 1.0e-128
+    { 0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96C },  // 1.0e-127
+    { 0xAD4AB7112EB3929D, 0x86C16C98D2C953C7 },  // 1.0e-126
+    { 0xD89D64D57A607744, 0xE871C7BF077BA8B8 },  // 1.0e-125
+    { 0x87625F056C7C4A8B, 0x11471CD764AD4973 },  // 1.0e-124
+    { 0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BD0 },  // 1.0e-123
+    { 0xD389B47879823479, 0x4AFF1D108D4EC2C4 },  // 1.0e-122
+    { 0x843610CB4BF160CB, 0xCEDF722A585139BB },  // 1.0e-121
+    { 0xA54394FE1EEDB8FE, 0xC2974EB4EE658829 },  // 1.0e-120
+    { 0xCE947A3DA6A9273E, 0x733D226229FEEA33 },  // 1.0e-119
+    { 0x811CCC668829B887, 0x0806357D5A3F5260 },  // 1.0e-118
+    { 0xA163FF802A3426A8, 0xCA07C2DCB0CF26F8 },  // 1.0e-117
+    { 0xC9BCFF6034C13052, 0xFC89B393DD02F0B6 },  // 1.0e-116
+    { 0xFC2C3F3841F17C67, 0xBBAC2078D443ACE3 },  // 1.0e-115
+    { 0x9D9BA7832936EDC0, 0xD54B944B84AA4C0E },  // 1.0e-114
+    { 0xC5029163F384A931, 0x0A9E795E65D4DF12 },  // 1.0e-113
+    { 0xF64335BCF065D37D, 0x4D4617B5FF4A16D6 },  // 1.0e-112
+    { 0x99EA0196163FA42E, 0x504BCED1BF8E4E46 },  // 1.0e-111
+    { 0xC06481FB9BCF8D39, 0xE45EC2862F71E1D7 },  // 1.0e-110
+    { 0xF07DA27A82C37088, 0x5D767327BB4E5A4D },  // 1.0e-109
+    { 0x964E858C91BA2655, 0x3A6A07F8D510F870 },  // 1.0e-108
+    { 0xBBE226EFB628AFEA, 0x890489F70A55368C },  // 1.0e-107
+    { 0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842F },  // 1.0e-106
+    { 0x92C8AE6B464FC96F, 0x3B0B8BC90012929E },  // 1.0e-105
+    { 0xB77ADA0617E3BBCB, 0x09CE6EBB40173745 },  // 1.0e-104
+    { 0xE55990879DDCAABD, 0xCC420A6A101D0516 },  // 1.0e-103
+    { 0x8F57FA54C2A9EAB6, 0x9FA946824A12232E },  // 1.0e-102
+    { 0xB32DF8E9F3546564, 0x47939822DC96ABFA },  // 1.0e-101
+    { 0xDFF9772470297EBD, 0x59787E2B93BC56F8 },  // 1.0e-100
+    { 0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65B },  // 1.0e-099
+    { 0xAEFAE51477A06B03, 0xEDE622920B6B23F2 },  // 1.0e-098
+    { 0xDAB99E59958885C4, 0xE95FAB368E45ECEE },  // 1.0e-097
+    { 0x88B402F7FD75539B, 0x11DBCB0218EBB415 },  // 1.0e-096
+    { 0xAAE103B5FCD2A881, 0xD652BDC29F26A11A },  // 1.0e-095
+    { 0xD59944A37C0752A2, 0x4BE76D3346F04960 },  // 1.0e-094
+    { 0x857FCAE62D8493A5, 0x6F70A4400C562DDC },  // 1.0e-093
+    { 0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB953 },  // 1.0e-092
+    { 0xD097AD07A71F26B2, 0x7E2000A41346A7A8 },  // 1.0e-091
+    { 0x825ECC24C873782F, 0x8ED400668C0C28C9 },  // 1.0e-090
+    { 0xA2F67F2DFA90563B, 0x728900802F0F32FB },  // 1.0e-089
+    { 0xCBB41EF979346BCA, 0x4F2B40A03AD2FFBA },  // 1.0e-088
+    { 0xFEA126B7D78186BC, 0xE2F610C84987BFA9 },  // 1.0e-087
+    { 0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7CA },  // 1.0e-086
+    { 0xC6EDE63FA05D3143, 0x91503D1C79720DBC },  // 1.0e-085
+    { 0xF8A95FCF88747D94, 0x75A44C6397CE912B },  // 1.0e-084
+    { 0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABB },  // 1.0e-083
+    { 0xC24452DA229B021B, 0xFBE85BADCE996169 },  // 1.0e-082
+    { 0xF2D56790AB41C2A2, 0xFAE27299423FB9C4 },  // 1.0e-081
+    { 0x97C560BA6B0919A5, 0xDCCD879FC967D41B },  // 1.0e-080
+    { 0xBDB6B8E905CB600F, 0x5400E987BBC1C921 },  // 1.0e-079
+    { 0xED246723473E3813, 0x290123E9AAB23B69 },  // 1.0e-078
+    { 0x9436C0760C86E30B, 0xF9A0B6720AAF6522 },  // 1.0e-077
+    { 0xB94470938FA89BCE, 0xF808E40E8D5B3E6A },  // 1.0e-076
+    { 0xE7958CB87392C2C2, 0xB60B1D1230B20E05 },  // 1.0e-075
+    { 0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C3 },  // 1.0e-074
+    { 0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF4 },  // 1.0e-073
+    { 0xE2280B6C20DD5232, 0x25C6DA63C38DE1B1 },  // 1.0e-072
+    { 0x8D590723948A535F, 0x579C487E5A38AD0F },  // 1.0e-071
+    { 0xB0AF48EC79ACE837, 0x2D835A9DF0C6D852 },  // 1.0e-070
+    { 0xDCDB1B2798182244, 0xF8E431456CF88E66 },  // 1.0e-069
+    { 0x8A08F0F8BF0F156B, 0x1B8E9ECB641B5900 },  // 1.0e-068
+    { 0xAC8B2D36EED2DAC5, 0xE272467E3D222F40 },  // 1.0e-067
+    { 0xD7ADF884AA879177, 0x5B0ED81DCC6ABB10 },  // 1.0e-066
+    { 0x86CCBB52EA94BAEA, 0x98E947129FC2B4EA },  // 1.0e-065
+    { 0xA87FEA27A539E9A5, 0x3F2398D747B36225 },  // 1.0e-064
+    { 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAE },  // 1.0e-063
+    { 0x83A3EEEEF9153E89, 0x1953CF68300424AD },  // 1.0e-062
+    { 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD8 },  // 1.0e-061
+    { 0xCDB02555653131B6, 0x3792F412CB06794E },  // 1.0e-060
+    { 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD1 },  // 1.0e-059
+    { 0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC5 },  // 1.0e-058
+    { 0xC8DE047564D20A8B, 0xF245825A5A445276 },  // 1.0e-057
+    { 0xFB158592BE068D2E, 0xEED6E2F0F0D56713 },  // 1.0e-056
+    { 0x9CED737BB6C4183D, 0x55464DD69685606C },  // 1.0e-055
+    { 0xC428D05AA4751E4C, 0xAA97E14C3C26B887 },  // 1.0e-054
+    { 0xF53304714D9265DF, 0xD53DD99F4B3066A9 },  // 1.0e-053
+    { 0x993FE2C6D07B7FAB, 0xE546A8038EFE402A },  // 1.0e-052
+    { 0xBF8FDB78849A5F96, 0xDE98520472BDD034 },  // 1.0e-051
+    { 0xEF73D256A5C0F77C, 0x963E66858F6D4441 },  // 1.0e-050
+    { 0x95A8637627989AAD, 0xDDE7001379A44AA9 },  // 1.0e-049
+    { 0xBB127C53B17EC159, 0x5560C018580D5D53 },  // 1.0e-048
+    { 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A7 },  // 1.0e-047
+    { 0x9226712162AB070D, 0xCAB3961304CA70E9 },  // 1.0e-046
+    { 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D23 },  // 1.0e-045
+    { 0xE45C10C42A2B3B05, 0x8CB89A7DB77C506B },  // 1.0e-044
+    { 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB243 },  // 1.0e-043
+    { 0xB267ED1940F1C61C, 0x55F038B237591ED4 },  // 1.0e-042
+    { 0xDF01E85F912E37A3, 0x6B6C46DEC52F6689 },  // 1.0e-041
+    { 0x8B61313BBABCE2C6, 0x2323AC4B3B3DA016 },  // 1.0e-040
+    { 0xAE397D8AA96C1B77, 0xABEC975E0A0D081B },  // 1.0e-039
+    { 0xD9C7DCED53C72255, 0x96E7BD358C904A22 },  // 1.0e-038
+    { 0x881CEA14545C7575, 0x7E50D64177DA2E55 },  // 1.0e-037
+    { 0xAA242499697392D2, 0xDDE50BD1D5D0B9EA },  // 1.0e-036
+    { 0xD4AD2DBFC3D07787, 0x955E4EC64B44E865 },  // 1.0e-035
+    { 0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113F },  // 1.0e-034
+    { 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58F },  // 1.0e-033
+    { 0xCFB11EAD453994BA, 0x67DE18EDA5814AF3 },  // 1.0e-032
+    { 0x81CEB32C4B43FCF4, 0x80EACF948770CED8 },  // 1.0e-031
+    { 0xA2425FF75E14FC31, 0xA1258379A94D028E },  // 1.0e-030
+    { 0xCAD2F7F5359A3B3E, 0x096EE45813A04331 },  // 1.0e-029
+    { 0xFD87B5F28300CA0D, 0x8BCA9D6E188853FD },  // 1.0e-028
+    { 0x9E74D1B791E07E48, 0x775EA264CF55347E },  // 1.0e-027
+    { 0xC612062576589DDA, 0x95364AFE032A819E },  // 1.0e-026
+    { 0xF79687AED3EEC551, 0x3A83DDBD83F52205 },  // 1.0e-025
+    { 0x9ABE14CD44753B52, 0xC4926A9672793543 },  // 1.0e-024
+    { 0xC16D9A0095928A27, 0x75B7053C0F178294 },  // 1.0e-023
+    { 0xF1C90080BAF72CB1, 0x5324C68B12DD6339 },  // 1.0e-022
+    { 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04 },  // 1.0e-021
+    { 0xBCE5086492111AEA, 0x88F4BB1CA6BCF585 },  // 1.0e-020
+    { 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6 },  // 1.0e-019
+    { 0x9392EE8E921D5D07, 0x3AFF322E62439FD0 },  // 1.0e-018
+    { 0xB877AA3236A4B449, 0x09BEFEB9FAD487C3 },  // 1.0e-017
+    { 0xE69594BEC44DE15B, 0x4C2EBE687989A9B4 },  // 1.0e-016
+    { 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11 },  // 1.0e-015
+    { 0xB424DC35095CD80F, 0x538484C19EF38C95 },  // 1.0e-014
+    { 0xE12E13424BB40E13, 0x2865A5F206B06FBA },  // 1.0e-013
+    { 0x8CBCCC096F5088CB, 0xF93F87B7442E45D4 },  // 1.0e-012
+    { 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749 },  // 1.0e-011
+    { 0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C },  // 1.0e-010
+    { 0x89705F4136B4A597, 0x31680A88F8953031 },  // 1.0e-009
+    { 0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E },  // 1.0e-008
+    { 0xD6BF94D5E57A42BC, 0x3D32907604691B4D },  // 1.0e-007
+    { 0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110 },  // 1.0e-006
+    { 0xA7C5AC471B478423, 0x0FCF80DC33721D54 },  // 1.0e-005
+    { 0xD1B71758E219652B, 0xD3C36113404EA4A9 },  // 1.0e-004
+    { 0x83126E978D4FDF3B, 0x645A1CAC083126EA },  // 1.0e-003
+    { 0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4 },  // 1.0e-002
+    { 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD },  // 1.0e-001
+    { 0x8000000000000000, 0x0000000000000001 },  // 1.0e+000
+    { 0xA000000000000000, 0x0000000000000001 },  // 1.0e+001
+    { 0xC800000000000000, 0x0000000000000001 },  // 1.0e+002
+    { 0xFA00000000000000, 0x0000000000000001 },  // 1.0e+003
+    { 0x9C40000000000000, 0x0000000000000001 },  // 1.0e+004
+    { 0xC350000000000000, 0x0000000000000001 },  // 1.0e+005
+    { 0xF424000000000000, 0x0000000000000001 },  // 1.0e+006
+    { 0x9896800000000000, 0x0000000000000001 },  // 1.0e+007
+    { 0xBEBC200000000000, 0x0000000000000001 },  // 1.0e+008
+    { 0xEE6B280000000000, 0x0000000000000001 },  // 1.0e+009
+    { 0x9502F90000000000, 0x0000000000000001 },  // 1.0e+010
+    { 0xBA43B74000000000, 0x0000000000000001 },  // 1.0e+011
+    { 0xE8D4A51000000000, 0x0000000000000001 },  // 1.0e+012
+    { 0x9184E72A00000000, 0x0000000000000001 },  // 1.0e+013
+    { 0xB5E620F480000000, 0x0000000000000001 },  // 1.0e+014
+    { 0xE35FA931A0000000, 0x0000000000000001 },  // 1.0e+015
+    { 0x8E1BC9BF04000000, 0x0000000000000001 },  // 1.0e+016
+    { 0xB1A2BC2EC5000000, 0x0000000000000001 },  // 1.0e+017
+    { 0xDE0B6B3A76400000, 0x0000000000000001 },  // 1.0e+018
+    { 0x8AC7230489E80000, 0x0000000000000001 },  // 1.0e+019
+    { 0xAD78EBC5AC620000, 0x0000000000000001 },  // 1.0e+020
+    { 0xD8D726B7177A8000, 0x0000000000000001 },  // 1.0e+021
+    { 0x878678326EAC9000, 0x0000000000000001 },  // 1.0e+022
+    { 0xA968163F0A57B400, 0x0000000000000001 },  // 1.0e+023
+    { 0xD3C21BCECCEDA100, 0x0000000000000001 },  // 1.0e+024
+    { 0x84595161401484A0, 0x0000000000000001 },  // 1.0e+025
+    { 0xA56FA5B99019A5C8, 0x0000000000000001 },  // 1.0e+026
+    { 0xCECB8F27F4200F3A, 0x0000000000000001 },  // 1.0e+027
+    { 0x813F3978F8940984, 0x4000000000000001 },  // 1.0e+028
+    { 0xA18F07D736B90BE5, 0x5000000000000001 },  // 1.0e+029
+    { 0xC9F2C9CD04674EDE, 0xA400000000000001 },  // 1.0e+030
+    { 0xFC6F7C4045812296, 0x4D00000000000001 },  // 1.0e+031
+    { 0x9DC5ADA82B70B59D, 0xF020000000000001 },  // 1.0e+032
+    { 0xC5371912364CE305, 0x6C28000000000001 },  // 1.0e+033
+    { 0xF684DF56C3E01BC6, 0xC732000000000001 },  // 1.0e+034
+    { 0x9A130B963A6C115C, 0x3C7F400000000001 },  // 1.0e+035
+    { 0xC097CE7BC90715B3, 0x4B9F100000000001 },  // 1.0e+036
+    { 0xF0BDC21ABB48DB20, 0x1E86D40000000001 },  // 1.0e+037
+    { 0x96769950B50D88F4, 0x1314448000000001 },  // 1.0e+038
+    { 0xBC143FA4E250EB31, 0x17D955A000000001 },  // 1.0e+039
+    { 0xEB194F8E1AE525FD, 0x5DCFAB0800000001 },  // 1.0e+040
+    { 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000001 },  // 1.0e+041
+    { 0xB7ABC627050305AD, 0xF14A3D9E40000001 },  // 1.0e+042
+    { 0xE596B7B0C643C719, 0x6D9CCD05D0000001 },  // 1.0e+043
+    { 0x8F7E32CE7BEA5C6F, 0xE4820023A2000001 },  // 1.0e+044
+    { 0xB35DBF821AE4F38B, 0xDDA2802C8A800001 },  // 1.0e+045
+    { 0xE0352F62A19E306E, 0xD50B2037AD200001 },  // 1.0e+046
+    { 0x8C213D9DA502DE45, 0x4526F422CC340001 },  // 1.0e+047
+    { 0xAF298D050E4395D6, 0x9670B12B7F410001 },  // 1.0e+048
+    { 0xDAF3F04651D47B4C, 0x3C0CDD765F114001 },  // 1.0e+049
+    { 0x88D8762BF324CD0F, 0xA5880A69FB6AC801 },  // 1.0e+050
+    { 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A01 },  // 1.0e+051
+    { 0xD5D238A4ABE98068, 0x72A4904598D6D881 },  // 1.0e+052
+    { 0x85A36366EB71F041, 0x47A6DA2B7F864751 },  // 1.0e+053
+    { 0xA70C3C40A64E6C51, 0x999090B65F67D925 },  // 1.0e+054
+    { 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6E },  // 1.0e+055
+    { 0x82818F1281ED449F, 0xBFF8F10E7A8921A5 },  // 1.0e+056
+    { 0xA321F2D7226895C7, 0xAFF72D52192B6A0E },  // 1.0e+057
+    { 0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764491 },  // 1.0e+058
+    { 0xFEE50B7025C36A08, 0x02F236D04753D5B5 },  // 1.0e+059
+    { 0x9F4F2726179A2245, 0x01D762422C946591 },  // 1.0e+060
+    { 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF6 },  // 1.0e+061
+    { 0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB3 },  // 1.0e+062
+    { 0x9B934C3B330C8577, 0x63CC55F49F88EB30 },  // 1.0e+063
+    { 0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FC },  // 1.0e+064
+    { 0xF316271C7FC3908A, 0x8BEF464E3945EF7B },  // 1.0e+065
+    { 0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AD },  // 1.0e+066
+    { 0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA318 },  // 1.0e+067
+    { 0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDE },  // 1.0e+068
+    { 0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6B },  // 1.0e+069
+    { 0xB975D6B6EE39E436, 0xB3E2FD538E122B45 },  // 1.0e+070
+    { 0xE7D34C64A9C85D44, 0x60DBBCA87196B617 },  // 1.0e+071
+    { 0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CE },  // 1.0e+072
+    { 0xB51D13AEA4A488DD, 0x6BABAB6398BDBE42 },  // 1.0e+073
+    { 0xE264589A4DCDAB14, 0xC696963C7EED2DD2 },  // 1.0e+074
+    { 0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA3 },  // 1.0e+075
+    { 0xB0DE65388CC8ADA8, 0x3B25A55F43294BCC },  // 1.0e+076
+    { 0xDD15FE86AFFAD912, 0x49EF0EB713F39EBF },  // 1.0e+077
+    { 0x8A2DBF142DFCC7AB, 0x6E3569326C784338 },  // 1.0e+078
+    { 0xACB92ED9397BF996, 0x49C2C37F07965405 },  // 1.0e+079
+    { 0xD7E77A8F87DAF7FB, 0xDC33745EC97BE907 },  // 1.0e+080
+    { 0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A4 },  // 1.0e+081
+    { 0xA8ACD7C0222311BC, 0xC40832EA0D68CE0D },  // 1.0e+082
+    { 0xD2D80DB02AABD62B, 0xF50A3FA490C30191 },  // 1.0e+083
+    { 0x83C7088E1AAB65DB, 0x792667C6DA79E0FB },  // 1.0e+084
+    { 0xA4B8CAB1A1563F52, 0x577001B891185939 },  // 1.0e+085
+    { 0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F87 },  // 1.0e+086
+    { 0x80B05E5AC60B6178, 0x544F8158315B05B5 },  // 1.0e+087
+    { 0xA0DC75F1778E39D6, 0x696361AE3DB1C722 },  // 1.0e+088
+    { 0xC913936DD571C84C, 0x03BC3A19CD1E38EA },  // 1.0e+089
+    { 0xFB5878494ACE3A5F, 0x04AB48A04065C724 },  // 1.0e+090
+    { 0x9D174B2DCEC0E47B, 0x62EB0D64283F9C77 },  // 1.0e+091
+    { 0xC45D1DF942711D9A, 0x3BA5D0BD324F8395 },  // 1.0e+092
+    { 0xF5746577930D6500, 0xCA8F44EC7EE3647A },  // 1.0e+093
+    { 0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECC },  // 1.0e+094
+    { 0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67F },  // 1.0e+095
+    { 0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101F },  // 1.0e+096
+    { 0x95D04AEE3B80ECE5, 0xBBA1F1D158724A13 },  // 1.0e+097
+    { 0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC98 },  // 1.0e+098
+    { 0xEA1575143CF97226, 0xF52D09D71A3293BE },  // 1.0e+099
+    { 0x924D692CA61BE758, 0x593C2626705F9C57 },  // 1.0e+100
+    { 0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836D },  // 1.0e+101
+    { 0xE498F455C38B997A, 0x0B6DFB9C0F956448 },  // 1.0e+102
+    { 0x8EDF98B59A373FEC, 0x4724BD4189BD5EAD },  // 1.0e+103
+    { 0xB2977EE300C50FE7, 0x58EDEC91EC2CB658 },  // 1.0e+104
+    { 0xDF3D5E9BC0F653E1, 0x2F2967B66737E3EE },  // 1.0e+105
+    { 0x8B865B215899F46C, 0xBD79E0D20082EE75 },  // 1.0e+106
+    { 0xAE67F1E9AEC07187, 0xECD8590680A3AA12 },  // 1.0e+107
+    { 0xDA01EE641A708DE9, 0xE80E6F4820CC9496 },  // 1.0e+108
+    { 0x884134FE908658B2, 0x3109058D147FDCDE },  // 1.0e+109
+    { 0xAA51823E34A7EEDE, 0xBD4B46F0599FD416 },  // 1.0e+110
+    { 0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91B },  // 1.0e+111
+    { 0x850FADC09923329E, 0x03E2CF6BC604DDB1 },  // 1.0e+112
+    { 0xA6539930BF6BFF45, 0x84DB8346B786151D },  // 1.0e+113
+    { 0xCFE87F7CEF46FF16, 0xE612641865679A64 },  // 1.0e+114
+    { 0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07F },  // 1.0e+115
+    { 0xA26DA3999AEF7749, 0xE3BE5E330F38F09E },  // 1.0e+116
+    { 0xCB090C8001AB551C, 0x5CADF5BFD3072CC6 },  // 1.0e+117
+    { 0xFDCB4FA002162A63, 0x73D9732FC7C8F7F7 },  // 1.0e+118
+    { 0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFB },  // 1.0e+119
+    { 0xC646D63501A1511D, 0xB281E1FD541501B9 },  // 1.0e+120
+    { 0xF7D88BC24209A565, 0x1F225A7CA91A4227 },  // 1.0e+121
+    { 0x9AE757596946075F, 0x3375788DE9B06959 },  // 1.0e+122
+    { 0xC1A12D2FC3978937, 0x0052D6B1641C83AF },  // 1.0e+123
+    { 0xF209787BB47D6B84, 0xC0678C5DBD23A49B },  // 1.0e+124
+    { 0x9745EB4D50CE6332, 0xF840B7BA963646E1 },  // 1.0e+125
+    { 0xBD176620A501FBFF, 0xB650E5A93BC3D899 },  // 1.0e+126
+    { 0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBF },  // 1.0e+127
+    { 0x93BA47C980E98CDF, 0xC66F336C36B10138 },  // 1.0e+128
+    { 0xB8A8D9BBE123F017, 0xB80B0047445D4185 },  // 1.0e+129
+    { 0xE6D3102AD96CEC1D, 0xA60DC059157491E6 },  // 1.0e+130
+    { 0x9043EA1AC7E41392, 0x87C89837AD68DB30 },  // 1.0e+131
+    { 0xB454E4A179DD1877, 0x29BABE4598C311FC },  // 1.0e+132
+    { 0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67B },  // 1.0e+133
+    { 0x8CE2529E2734BB1D, 0x1899E4A65F58660D },  // 1.0e+134
+    { 0xB01AE745B101E9E4, 0x5EC05DCFF72E7F90 },  // 1.0e+135
+    { 0xDC21A1171D42645D, 0x76707543F4FA1F74 },  // 1.0e+136
+    { 0x899504AE72497EBA, 0x6A06494A791C53A9 },  // 1.0e+137
+    { 0xABFA45DA0EDBDE69, 0x0487DB9D17636893 },  // 1.0e+138
+    { 0xD6F8D7509292D603, 0x45A9D2845D3C42B7 },  // 1.0e+139
+    { 0x865B86925B9BC5C2, 0x0B8A2392BA45A9B3 },  // 1.0e+140
+    { 0xA7F26836F282B732, 0x8E6CAC7768D7141F },  // 1.0e+141
+    { 0xD1EF0244AF2364FF, 0x3207D795430CD927 },  // 1.0e+142
+    { 0x8335616AED761F1F, 0x7F44E6BD49E807B9 },  // 1.0e+143
+    { 0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A7 },  // 1.0e+144
+    { 0xCD036837130890A1, 0x36DBA887C37A8C10 },  // 1.0e+145
+    { 0x802221226BE55A64, 0xC2494954DA2C978A },  // 1.0e+146
+    { 0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6D },  // 1.0e+147
+    { 0xC83553C5C8965D3D, 0x6F92829494E5ACC8 },  // 1.0e+148
+    { 0xFA42A8B73ABBF48C, 0xCB772339BA1F17FA },  // 1.0e+149
+    { 0x9C69A97284B578D7, 0xFF2A760414536EFC },  // 1.0e+150
+    { 0xC38413CF25E2D70D, 0xFEF5138519684ABB },  // 1.0e+151
+    { 0xF46518C2EF5B8CD1, 0x7EB258665FC25D6A },  // 1.0e+152
+    { 0x98BF2F79D5993802, 0xEF2F773FFBD97A62 },  // 1.0e+153
+    { 0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FB },  // 1.0e+154
+    { 0xEEAABA2E5DBF6784, 0x95BA2A53F983CF39 },  // 1.0e+155
+    { 0x952AB45CFA97A0B2, 0xDD945A747BF26184 },  // 1.0e+156
+    { 0xBA756174393D88DF, 0x94F971119AEEF9E5 },  // 1.0e+157
+    { 0xE912B9D1478CEB17, 0x7A37CD5601AAB85E },  // 1.0e+158
+    { 0x91ABB422CCB812EE, 0xAC62E055C10AB33B },  // 1.0e+159
+    { 0xB616A12B7FE617AA, 0x577B986B314D600A },  // 1.0e+160
+    { 0xE39C49765FDF9D94, 0xED5A7E85FDA0B80C },  // 1.0e+161
+    { 0x8E41ADE9FBEBC27D, 0x14588F13BE847308 },  // 1.0e+162
+    { 0xB1D219647AE6B31C, 0x596EB2D8AE258FC9 },  // 1.0e+163
+    { 0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BC },  // 1.0e+164
+    { 0x8AEC23D680043BEE, 0x25DE7BB9480D5855 },  // 1.0e+165
+    { 0xADA72CCC20054AE9, 0xAF561AA79A10AE6B },  // 1.0e+166
+    { 0xD910F7FF28069DA4, 0x1B2BA1518094DA05 },  // 1.0e+167
+    { 0x87AA9AFF79042286, 0x90FB44D2F05D0843 },  // 1.0e+168
+    { 0xA99541BF57452B28, 0x353A1607AC744A54 },  // 1.0e+169
+    { 0xD3FA922F2D1675F2, 0x42889B8997915CE9 },  // 1.0e+170
+    { 0x847C9B5D7C2E09B7, 0x69956135FEBADA12 },  // 1.0e+171
+    { 0xA59BC234DB398C25, 0x43FAB9837E699096 },  // 1.0e+172
+    { 0xCF02B2C21207EF2E, 0x94F967E45E03F4BC },  // 1.0e+173
+    { 0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F6 },  // 1.0e+174
+    { 0xA1BA1BA79E1632DC, 0x6462D92A69731733 },  // 1.0e+175
+    { 0xCA28A291859BBF93, 0x7D7B8F7503CFDCFF },  // 1.0e+176
+    { 0xFCB2CB35E702AF78, 0x5CDA735244C3D43F },  // 1.0e+177
+    { 0x9DEFBF01B061ADAB, 0x3A0888136AFA64A8 },  // 1.0e+178
+    { 0xC56BAEC21C7A1916, 0x088AAA1845B8FDD1 },  // 1.0e+179
+    { 0xF6C69A72A3989F5B, 0x8AAD549E57273D46 },  // 1.0e+180
+    { 0x9A3C2087A63F6399, 0x36AC54E2F678864C },  // 1.0e+181
+    { 0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DE },  // 1.0e+182
+    { 0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D6 },  // 1.0e+183
+    { 0x969EB7C47859E743, 0x9F644AE5A4B1B326 },  // 1.0e+184
+    { 0xBC4665B596706114, 0x873D5D9F0DDE1FEF },  // 1.0e+185
+    { 0xEB57FF22FC0C7959, 0xA90CB506D155A7EB },  // 1.0e+186
+    { 0x9316FF75DD87CBD8, 0x09A7F12442D588F3 },  // 1.0e+187
+    { 0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB30 },  // 1.0e+188
+    { 0xE5D3EF282A242E81, 0x8F1668C8A86DA5FB },  // 1.0e+189
+    { 0x8FA475791A569D10, 0xF96E017D694487BD },  // 1.0e+190
+    { 0xB38D92D760EC4455, 0x37C981DCC395A9AD },  // 1.0e+191
+    { 0xE070F78D3927556A, 0x85BBE253F47B1418 },  // 1.0e+192
+    { 0x8C469AB843B89562, 0x93956D7478CCEC8F },  // 1.0e+193
+    { 0xAF58416654A6BABB, 0x387AC8D1970027B3 },  // 1.0e+194
+    { 0xDB2E51BFE9D0696A, 0x06997B05FCC0319F },  // 1.0e+195
+    { 0x88FCF317F22241E2, 0x441FECE3BDF81F04 },  // 1.0e+196
+    { 0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C4 },  // 1.0e+197
+    { 0xD60B3BD56A5586F1, 0x8A71E223D8D3B075 },  // 1.0e+198
+    { 0x85C7056562757456, 0xF6872D5667844E4A },  // 1.0e+199
+    { 0xA738C6BEBB12D16C, 0xB428F8AC016561DC },  // 1.0e+200
+    { 0xD106F86E69D785C7, 0xE13336D701BEBA53 },  // 1.0e+201
+    { 0x82A45B450226B39C, 0xECC0024661173474 },  // 1.0e+202
+    { 0xA34D721642B06084, 0x27F002D7F95D0191 },  // 1.0e+203
+    { 0xCC20CE9BD35C78A5, 0x31EC038DF7B441F5 },  // 1.0e+204
+    { 0xFF290242C83396CE, 0x7E67047175A15272 },  // 1.0e+205
+    { 0x9F79A169BD203E41, 0x0F0062C6E984D387 },  // 1.0e+206
+    { 0xC75809C42C684DD1, 0x52C07B78A3E60869 },  // 1.0e+207
+    { 0xF92E0C3537826145, 0xA7709A56CCDF8A83 },  // 1.0e+208
+    { 0x9BBCC7A142B17CCB, 0x88A66076400BB692 },  // 1.0e+209
+    { 0xC2ABF989935DDBFE, 0x6ACFF893D00EA436 },  // 1.0e+210
+    { 0xF356F7EBF83552FE, 0x0583F6B8C4124D44 },  // 1.0e+211
+    { 0x98165AF37B2153DE, 0xC3727A337A8B704B },  // 1.0e+212
+    { 0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5D },  // 1.0e+213
+    { 0xEDA2EE1C7064130C, 0x1162DEF06F79DF74 },  // 1.0e+214
+    { 0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA9 },  // 1.0e+215
+    { 0xB9A74A0637CE2EE1, 0x6D953E2BD7173693 },  // 1.0e+216
+    { 0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0438 },  // 1.0e+217
+    { 0x910AB1D4DB9914A0, 0x1D9C9892400A22A3 },  // 1.0e+218
+    { 0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4C },  // 1.0e+219
+    { 0xE2A0B5DC971F303A, 0x2E44AE64840FD61E },  // 1.0e+220
+    { 0x8DA471A9DE737E24, 0x5CEAECFED289E5D3 },  // 1.0e+221
+    { 0xB10D8E1456105DAD, 0x7425A83E872C5F48 },  // 1.0e+222
+    { 0xDD50F1996B947518, 0xD12F124E28F7771A },  // 1.0e+223
+    { 0x8A5296FFE33CC92F, 0x82BD6B70D99AAA70 },  // 1.0e+224
+    { 0xACE73CBFDC0BFB7B, 0x636CC64D1001550C },  // 1.0e+225
+    { 0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4F },  // 1.0e+226
+    { 0x8714A775E3E95C78, 0x65ACFAEC34810A72 },  // 1.0e+227
+    { 0xA8D9D1535CE3B396, 0x7F1839A741A14D0E },  // 1.0e+228
+    { 0xD31045A8341CA07C, 0x1EDE48111209A051 },  // 1.0e+229
+    { 0x83EA2B892091E44D, 0x934AED0AAB460433 },  // 1.0e+230
+    { 0xA4E4B66B68B65D60, 0xF81DA84D56178540 },  // 1.0e+231
+    { 0xCE1DE40642E3F4B9, 0x36251260AB9D668F },  // 1.0e+232
+    { 0x80D2AE83E9CE78F3, 0xC1D72B7C6B42601A },  // 1.0e+233
+    { 0xA1075A24E4421730, 0xB24CF65B8612F820 },  // 1.0e+234
+    { 0xC94930AE1D529CFC, 0xDEE033F26797B628 },  // 1.0e+235
+    { 0xFB9B7CD9A4A7443C, 0x169840EF017DA3B2 },  // 1.0e+236
+    { 0x9D412E0806E88AA5, 0x8E1F289560EE864F },  // 1.0e+237
+    { 0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E3 },  // 1.0e+238
+    { 0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DC },  // 1.0e+239
+    { 0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF2A },  // 1.0e+240
+    { 0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF4 },  // 1.0e+241
+    { 0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B1 },  // 1.0e+242
+    { 0x95F83D0A1FB69CD9, 0x4ABDAF101564F98F },  // 1.0e+243
+    { 0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F2 },  // 1.0e+244
+    { 0xEA53DF5FD18D5513, 0x84C86189216DC5EE },  // 1.0e+245
+    { 0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB5 },  // 1.0e+246
+    { 0xB7118682DBB66A77, 0x3FBC8C33221DC2A2 },  // 1.0e+247
+    { 0xE4D5E82392A40515, 0x0FABAF3FEAA5334B },  // 1.0e+248
+    { 0x8F05B1163BA6832D, 0x29CB4D87F2A7400F },  // 1.0e+249
+    { 0xB2C71D5BCA9023F8, 0x743E20E9EF511013 },  // 1.0e+250
+    { 0xDF78E4B2BD342CF6, 0x914DA9246B255417 },  // 1.0e+251
+    { 0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548F },  // 1.0e+252
+    { 0xAE9672ABA3D0C320, 0xA184AC2473B529B2 },  // 1.0e+253
+    { 0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741F },  // 1.0e+254
+    { 0x8865899617FB1871, 0x7E2FA67C7A658893 },  // 1.0e+255
+    { 0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB8 },  // 1.0e+256
+    { 0xD51EA6FA85785631, 0x552A74227F3EA566 },  // 1.0e+257
+    { 0x8533285C936B35DE, 0xD53A88958F872760 },  // 1.0e+258
+    { 0xA67FF273B8460356, 0x8A892ABAF368F138 },  // 1.0e+259
+    { 0xD01FEF10A657842C, 0x2D2B7569B0432D86 },  // 1.0e+260
+    { 0x8213F56A67F6B29B, 0x9C3B29620E29FC74 },  // 1.0e+261
+    { 0xA298F2C501F45F42, 0x8349F3BA91B47B90 },  // 1.0e+262
+    { 0xCB3F2F7642717713, 0x241C70A936219A74 },  // 1.0e+263
+    { 0xFE0EFB53D30DD4D7, 0xED238CD383AA0111 },  // 1.0e+264
+    { 0x9EC95D1463E8A506, 0xF4363804324A40AB },  // 1.0e+265
+    { 0xC67BB4597CE2CE48, 0xB143C6053EDCD0D6 },  // 1.0e+266
+    { 0xF81AA16FDC1B81DA, 0xDD94B7868E94050B },  // 1.0e+267
+    { 0x9B10A4E5E9913128, 0xCA7CF2B4191C8327 },  // 1.0e+268
+    { 0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F1 },  // 1.0e+269
+    { 0xF24A01A73CF2DCCF, 0xBC633B39673C8CED },  // 1.0e+270
+    { 0x976E41088617CA01, 0xD5BE0503E085D814 },  // 1.0e+271
+    { 0xBD49D14AA79DBC82, 0x4B2D8644D8A74E19 },  // 1.0e+272
+    { 0xEC9C459D51852BA2, 0xDDF8E7D60ED1219F },  // 1.0e+273
+    { 0x93E1AB8252F33B45, 0xCABB90E5C942B504 },  // 1.0e+274
+    { 0xB8DA1662E7B00A17, 0x3D6A751F3B936244 },  // 1.0e+275
+    { 0xE7109BFBA19C0C9D, 0x0CC512670A783AD5 },  // 1.0e+276
+    { 0x906A617D450187E2, 0x27FB2B80668B24C6 },  // 1.0e+277
+    { 0xB484F9DC9641E9DA, 0xB1F9F660802DEDF7 },  // 1.0e+278
+    { 0xE1A63853BBD26451, 0x5E7873F8A0396974 },  // 1.0e+279
+    { 0x8D07E33455637EB2, 0xDB0B487B6423E1E9 },  // 1.0e+280
+    { 0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA63 },  // 1.0e+281
+    { 0xDC5C5301C56B75F7, 0x7641A140CC7810FC },  // 1.0e+282
+    { 0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9E },  // 1.0e+283
+    { 0xAC2820D9623BF429, 0x546345FA9FBDCD45 },  // 1.0e+284
+    { 0xD732290FBACAF133, 0xA97C177947AD4096 },  // 1.0e+285
+    { 0x867F59A9D4BED6C0, 0x49ED8EABCCCC485E },  // 1.0e+286
+    { 0xA81F301449EE8C70, 0x5C68F256BFFF5A75 },  // 1.0e+287
+    { 0xD226FC195C6A2F8C, 0x73832EEC6FFF3112 },  // 1.0e+288
+    { 0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAC },  // 1.0e+289
+    { 0xA42E74F3D032F525, 0xBA3E7CA8B77F5E56 },  // 1.0e+290
+    { 0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EC },  // 1.0e+291
+    { 0x80444B5E7AA7CF85, 0x7980D163CF5B81B4 },  // 1.0e+292
+    { 0xA0555E361951C366, 0xD7E105BCC3326220 },  // 1.0e+293
+    { 0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA8 },  // 1.0e+294
+    { 0xFA856334878FC150, 0xB14F98F6F0FEB952 },  // 1.0e+295
+    { 0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D4 },  // 1.0e+296
+    { 0xC3B8358109E84F07, 0x0A862F80EC4700C9 },  // 1.0e+297
+    { 0xF4A642E14C6262C8, 0xCD27BB612758C0FB },  // 1.0e+298
+    { 0x98E7E9CCCFBD7DBD, 0x8038D51CB897789D },  // 1.0e+299
+    { 0xBF21E44003ACDD2C, 0xE0470A63E6BD56C4 },  // 1.0e+300
+    { 0xEEEA5D5004981478, 0x1858CCFCE06CAC75 },  // 1.0e+301
+    { 0x95527A5202DF0CCB, 0x0F37801E0C43EBC9 },  // 1.0e+302
+    { 0xBAA718E68396CFFD, 0xD30560258F54E6BB },  // 1.0e+303
+    { 0xE950DF20247C83FD, 0x47C6B82EF32A206A },  // 1.0e+304
+    { 0x91D28B7416CDD27E, 0x4CDC331D57FA5442 },  // 1.0e+305
+    { 0xB6472E511C81471D, 0xE0133FE4ADF8E953 },  // 1.0e+306
+    { 0xE3D8F9E563A198E5, 0x58180FDDD97723A7 },  // 1.0e+307
+    { 0x8E679C2F5E44FF8F, 0x570F09EAA7EA7649 },  // 1.0e+308
+    { 0xB201833B35D63F73, 0x2CD2CC6551E513DB },  // 1.0e+309
+    { 0xDE81E40A034BCF4F, 0xF8077F7EA65E58D2 },  // 1.0e+310
+    { 0x8B112E86420F6191, 0xFB04AFAF27FAF783 },  // 1.0e+311
+    { 0xADD57A27D29339F6, 0x79C5DB9AF1F9B564 },  // 1.0e+312
+    { 0xD94AD8B1C7380874, 0x18375281AE7822BD },  // 1.0e+313
+    { 0x87CEC76F1C830548, 0x8F2293910D0B15B6 },  // 1.0e+314
+    { 0xA9C2794AE3A3C69A, 0xB2EB3875504DDB23 },  // 1.0e+315
+    { 0xD433179D9C8CB841, 0x5FA60692A46151EC },  // 1.0e+316
+    { 0x849FEEC281D7F328, 0xDBC7C41BA6BCD334 },  // 1.0e+317
+    { 0xA5C7EA73224DEFF3, 0x12B9B522906C0801 },  // 1.0e+318
+    { 0xCF39E50FEAE16BEF, 0xD768226B34870A01 },  // 1.0e+319
+    { 0x81842F29F2CCE375, 0xE6A1158300D46641 },  // 1.0e+320
+    { 0xA1E53AF46F801C53, 0x60495AE3C1097FD1 },  // 1.0e+321
+    { 0xCA5E89B18B602368, 0x385BB19CB14BDFC5 },  // 1.0e+322
+    { 0xFCF62C1DEE382C42, 0x46729E03DD9ED7B6 },  // 1.0e+323
+    { 0x9E19DB92B4E31BA9, 0x6C07A2C26A8346D2 },  // 1.0e+324
   };
-static_assert(noadl::countof(s_decmult_F) == 633);
+static_assert(noadl::countof(s_decmult_F) == 617);
+
+constexpr int s_decmult_F_min = -292;
+
+// These calculate floor(log10(2^e)), floor(log10(3/4 * 2^e)) and floor(log2(10^e)),
+// respectively. They are exact for all exponents of `double`.
+constexpr
+int
+do_flog10_pow2(int e)
+  { return (e * 1262611) >> 22;  }
+
+constexpr
+int
+do_flog10_3q_pow2(int e)
+  { return (e * 1262611 - 524031) >> 22;  }
+
+constexpr
+int
+do_flog2_pow10(int e)
+  { return (e * 1741647) >> 19;  }
+
+inline
+uint64_t
+do_mul_round_odd(const decmult_F& mult, uint64_t cp)
+  {
+    // Multiply the 128-bit multiplier by `cp`, and get the highest 64 bits of the product.
+    // If any bits have been shifted out, set the least significant bit, so the result is
+    // rounded to odd.
+    __extension__ using uint128 = unsigned __int128;
+    uint128 xlo = static_cast<uint128>(mult.lo) * cp;
+    uint128 xhi = static_cast<uint128>(mult.hi) * cp;
+    uint128 xmid = static_cast<uint64_t>(xhi) + (xlo >> 64);
+    uint64_t ireg = static_cast<uint64_t>(xhi >> 64) + static_cast<uint64_t>(xmid >> 64);
+    return ireg | (static_cast<uint64_t>(xmid) > 1);
+  }
+
+void
+do_normalize_F_dec(uint64_t& mant, int& exp, uint64_t ireg, int dexp)
+  {
+    // Normalize the result, so there are 18 digits, and the first one is the most
+    // significant.
+    int ndigits = 1;
+    for(uint64_t t = ireg;  t >= 10;  t /= 10)
+      ndigits++;
+    for(int i = ndigits;  i < 18;  ++i)
+      ireg *= 10;
+
+    // Return the mantissa and exponent.
+    mant = ireg;
+    exp = dexp + ndigits - 1;
+  }
 
 void
 do_xfrexp_F_dec(uint64_t& mant, int& exp, const double& value, bool single)
   {
     // Note if `value` is not finite then the behavior is undefined.
-    // Get the first digit.
-    double freg = ::std::fabs(value);
-    // Locate the last number in the table that is <= `freg`.
-    uint32_t bpos = 1;
-    uint32_t epos = static_cast<uint32_t>(noadl::countof(s_decmult_F));
-    for(;;) {
-      // Stop if the range is empty.
-      if(bpos == epos) {
-        bpos = epos - 1;
-        break;
-      }
-      // Get the median.
-      uint32_t mpos = (bpos + epos) / 2;
-      const double& med = s_decmult_F[mpos].bound;
-      // Stops immediately if `freg` equals `med`.
-      if(::std::memcmp(&freg, &med, sizeof(double)) == 0) {
-        bpos = mpos;
-        break;
-      }
-      // Decend into either subrange.
-      if(freg < med)
-        epos = mpos;
-      else
-        bpos = mpos + 1;
+    // This is the Schubfach algorithm by Raffaello Giulietti, which produces the shortest
+    // decimal number that converts back to `value`. If there are multiple candidates, the
+    // one that is closest to `value` is chosen.
+    // Break the number down into `c * 2^q`. For single precision, the value is converted
+    // back to `float` first.
+    uint64_t c;
+    int q;
+    bool closer;
+    if(ROCKET_UNEXPECT(single)) {
+      float fval = static_cast<float>(value);
+      uint32_t bits;
+      ::std::memcpy(&bits, &fval, sizeof(bits));
+      uint32_t bmant = bits & 0x7FFFFF;
+      int bexp = static_cast<int>(bits >> 23 & 0xFF);
+      c = (bexp != 0) ? (bmant | 0x800000) : bmant;
+      q = ::std::max(bexp, 1) - 150;
+      closer = (bmant == 0) && (bexp > 1);
+    }
+    else {
+      uint64_t bits;
+      ::std::memcpy(&bits, &value, sizeof(bits));
+      uint64_t bmant = bits & 0xFFFFFFFFFFFFF;
+      int bexp = static_cast<int>(bits >> 52 & 0x7FF);
+      c = (bexp != 0) ? (bmant | 0x10000000000000) : bmant;
+      q = ::std::max(bexp, 1) - 1075;
+      closer = (bmant == 0) && (bexp > 1);
     }
-    // Get the multiplier.
-    const auto& mult = s_decmult_F[bpos];
-
-    // Extract the mantissa.
-    freg = ::std::ldexp(freg, mult.bexp);
-    uint64_t ireg = (uint64_t)(int64_t)freg | 1;
-
-    // Multiply two 64-bit values and get the high-order half.
-    // This produces 18 significant figures.
-    // TODO: Modern CPUs have intrinsics for this.
-    uint64_t xhi = ireg >> 32;
-    uint64_t xlo = ireg << 32 >> 32;
-    uint64_t yhi = mult.mant >> 32;
-    uint64_t ylo = mult.mant << 32 >> 32;
-    ireg = xhi * yhi + (((xlo * yhi >> 30) + (xhi * ylo >> 30) + (xlo * ylo >> 62)) >> 2);
-
-    // Round the mantissa. We now have 18 digits.
-    // In the case of single precision we have to drop 8 digits before rounding.
-    if(ROCKET_UNEXPECT(single))
-      ireg /= 100'000'000;
-    // Note that the last digit should be rounded to even.
-    ylo = ireg % 10;
-    ireg -= ylo;
-    if((ylo != 5) ? (ylo > 5) : (ireg % 20))
-      ireg += 10;
-    // Re-fill zeroes in the case of single precision.
-    if(ROCKET_UNEXPECT(single))
-      ireg *= 100'000'000;
 
-    // Return the mantissa and exponent.
-    mant = ireg;
-    exp = static_cast<int>(bpos) - 324;
+    // Get the rounding interval, whose bounds are halfway between `value` and its
+    // neighbors. All these are multiplied by four. If the mantissa is a power of two,
+    // the lower neighbor is closer. If the mantissa is even, the bounds are inclusive.
+    bool incl = (c % 2 == 0);
+    uint64_t cbl = c * 4 - 2 + closer;
+    uint64_t cb = c * 4;
+    uint64_t cbr = c * 4 + 2;
+
+    // Scale them by `10^-k`, so there are 16 or 17 digits in the integral part.
+    int k = closer ? do_flog10_3q_pow2(q) : do_flog10_pow2(q);
+    int h = q + do_flog2_pow10(-k) + 1;
+    const auto& mult = s_decmult_F[-k - s_decmult_F_min];
+    uint64_t vbl = do_mul_round_odd(mult, cbl << h);
+    uint64_t vb = do_mul_round_odd(mult, cb << h);
+    uint64_t vbr = do_mul_round_odd(mult, cbr << h);
+    uint64_t lower = vbl + !incl;
+    uint64_t upper = vbr - !incl;
+
+    // If exactly one of the two numbers with one fewer digit is within the interval,
+    // it is the result.
+    uint64_t ireg = vb / 4;
+    if(ireg >= 10) {
+      uint64_t sp = ireg / 10;
+      bool upin = lower <= sp * 40;
+      bool wpin = sp * 40 + 40 <= upper;
+      if(upin != wpin)
+        return do_normalize_F_dec(mant, exp, sp + wpin, k + 1);
+    }
+
+    // Otherwise, if exactly one of the two numbers around `vb` is within the interval,
+    // it is the result. If both are, choose the closer one, and break ties to even.
+    bool uin = lower <= ireg * 4;
+    bool win = ireg * 4 + 4 <= upper;
+    if(uin != win)
+      ireg += win;
+    else
+      ireg += (vb > ireg * 4 + 2) || ((vb == ireg * 4 + 2) && (ireg % 2 != 0));
+
+    do_normalize_F_dec(mant, exp, ireg, k);
   }
 
 void
@@ -56,7 +56,9 @@ class atomic
           case ::std::memory_order_acq_rel:
             return ::std::memory_order_acquire;
 
-          default:  // relaxed || seq_cst
+          case ::std::memory_order_relaxed:
+          case ::std::memory_order_seq_cst:
+          default:
             return memorderT;
         }
       }
@@ -73,7 +75,9 @@ class atomic
           case ::std::memory_order_acq_rel:
             return ::std::memory_order_release;
 
-          default:  // relaxed || seq_cst
+          case ::std::memory_order_relaxed:
+          case ::std::memory_order_seq_cst:
+          default:
             return memorderT;
         }
       }
@@ -90,7 +94,9 @@ class atomic
           case ::std::memory_order_acq_rel:
             return ::std::memory_order_acq_rel;
 
-          default:  // relaxed || seq_cst
+          case ::std::memory_order_relaxed:
+          case ::std::memory_order_seq_cst:
+          default:
             return memorderT;
         }
       }
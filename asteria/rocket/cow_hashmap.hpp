@@ -11,6 +11,7 @@
 #include "allocator_utilities.hpp"
 #include "hash_table_utilities.hpp"
 #include "reference_counter.hpp"
+#include "atomic.hpp"
 #include <tuple>  // std::forward_as_tuple()
 
 namespace rocket {
@@ -63,6 +64,9 @@ class cow_hashmap
     using const_iterator  = details_cow_hashmap::hashmap_iterator<cow_hashmap, const value_type>;
     using iterator        = details_cow_hashmap::hashmap_iterator<cow_hashmap, value_type>;
 
+    // N.B. This is a non-standard extension.
+    using hint_type  = details_cow_hashmap::lookup_hint;
+
   private:
     details_cow_hashmap::storage_handle<allocator_type, hasher, key_equal> m_sth;
 
@@ -578,6 +582,22 @@ class cow_hashmap
         return iterator(this->m_sth, ptr + tpos);
       }
 
+    // N.B. This is a non-standard extension.
+    // `hint` shall have been default-constructed, or have been used with an equivalent
+    // key. If no element has been erased from this table since, the element is found
+    // without hashing or probing. Otherwise, `hint` is updated if the key is found.
+    template<typename ykeyT>
+    const_iterator
+    find_hinted(hint_type& hint, const ykeyT& key)
+    const
+      {
+        auto ptr = this->do_get_table();
+        if(!this->m_sth.index_of_hinted(hint, key))
+          return this->end();
+
+        return const_iterator(this->m_sth, ptr + hint.index);
+      }
+
     template<typename ykeyT>
     size_t
     count(const ykeyT& key)
@@ -7,11 +7,30 @@
 
 namespace details_cow_hashmap {
 
+// Each table is stamped with a shape, which is replaced whenever elements may have been
+// moved around. As shapes are never reused, a bucket index that has been obtained from a
+// table with the same shape is still valid.
+inline
+uint64_t
+generate_shape()
+noexcept
+  {
+    static atomic_relaxed<uint64_t> s_shape;
+    return s_shape.fetch_add(1U) + 1;
+  }
+
+struct lookup_hint
+  {
+    uint64_t shape = 0;  // no table has this shape
+    size_t index = 0;
+  };
+
 struct storage_header
   {
     void (*dtor)(...);
     mutable reference_counter<long> nref;
     size_t nelem;
+    uint64_t shape;
 
     explicit
     storage_header(void (*xdtor)(...))
@@ -128,6 +147,7 @@ struct pointer_storage : storage_header
             noadl::construct_at(this->data + i);
         }
         this->nelem = 0;
+        this->shape = generate_shape();
       }
 
     ~pointer_storage()
@@ -626,6 +646,32 @@ class storage_handle
         return true;
       }
 
+    template<typename ykeyT>
+    bool
+    index_of_hinted(lookup_hint& hint, const ykeyT& ykey)
+    const
+      {
+        auto ptr = this->m_ptr;
+        if(!ptr)
+          return false;
+
+        // If the table has the same shape, the element is still in the same bucket.
+        if(ptr->shape == hint.shape) {
+          ROCKET_ASSERT(ptr->data[hint.index]);
+          ROCKET_ASSERT(this->as_key_equal()(ptr->data[hint.index]->first, ykey));
+          return true;
+        }
+
+        // Fall back to linear probing.
+        size_type index;
+        if(!this->index_of(index, ykey))
+          return false;
+
+        hint.shape = ptr->shape;
+        hint.index = index;
+        return true;
+      }
+
     bucket_type*
     mut_buckets_unchecked()
     noexcept
@@ -690,6 +736,9 @@ class storage_handle
         auto ptr = this->m_ptr;
         ROCKET_ASSERT(ptr);
 
+        // Elements will be relocated, so hints are invalidated.
+        ptr->shape = generate_shape();
+
         // Erase all elements in [tpos,tpos+tn).
         for(size_type i = tpos; i != tpos + tn; ++i) {
           auto eptr = ptr->data[i].reset();
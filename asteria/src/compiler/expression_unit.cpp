@@ -49,21 +49,29 @@ const
 
         // Perform early lookup when the expression is defined.
         // If a named reference is found, it will not be replaced or hidden by a later-declared one.
-        const Reference* qref;
+        // Local references are resolved to slots, so no name lookup happens at runtime.
         const Abstract_Context* qctx = &ctx;
         uint32_t depth = 0;
+        bool closure = false;
         for(;;) {
           // Look for the name in the current context.
-          qref = qctx->get_named_reference_opt(altr.name);
-          if(qref) {
+          auto qactx = static_cast<const Analytic_Context*>(qctx);
+          auto qslot = qactx->get_local_slot_opt(altr.name);
+          if(qslot) {
+            // If the reference belongs to an enclosing function, it will be captured by a
+            // closure, so it escapes.
+            if(closure)
+              qactx->mark_local_escaping(*qslot);
+
             // A reference declared later has been found. Record the context depth for later lookups.
-            AIR_Node::S_push_local_reference xnode = { altr.sloc, depth, altr.name };
+            AIR_Node::S_push_local_reference xnode = { altr.sloc, depth, *qslot, altr.name };
             code.emplace_back(::std::move(xnode));
             return code;
           }
           // Step out to its parent context.
+          closure |= qactx->is_function();
           qctx = qctx->get_parent_opt();
-          if(!qctx) {
+          if(!qctx || !qctx->is_analytic()) {
             // No name has been found so far. Assume that the name will be found in the global context.
             AIR_Node::S_push_global_reference xnode = { altr.sloc, altr.name };
             code.emplace_back(::std::move(xnode));
@@ -188,8 +196,11 @@ const
         const auto& altr = this->m_stor.as<index_argument_finish>();
 
         // Apply glvalue-to-rvalue conversion if the argument is to be passed by value.
-        if(altr.by_ref)
+        // An argument that is passed by reference may be a local reference, which escapes.
+        if(altr.by_ref) {
+          ctx.mark_all_locals_escaping();
           return code;
+        }
 
         // Encode arguments.
         AIR_Node::S_glvalue_to_prvalue xnode = { altr.sloc };
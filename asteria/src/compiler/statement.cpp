@@ -14,9 +14,8 @@
 namespace asteria {
 namespace {
 
-void
-do_user_declare(cow_vector<phsh_string>* names_opt, Analytic_Context& ctx,
-                const phsh_string& name, const char* desc)
+uint32_t
+do_user_declare(Analytic_Context& ctx, const phsh_string& name, const char* desc)
   {
     // Check for special names.
     if(name.rdstr().empty())
@@ -25,17 +24,8 @@ do_user_declare(cow_vector<phsh_string>* names_opt, Analytic_Context& ctx,
     if(name.rdstr().starts_with("__"))
       ASTERIA_THROW("Reserved name not declarable as $2 (name `$1`)", name);
 
-    // Record this name.
-    if(names_opt) {
-      auto oldp = ::std::find(names_opt->begin(), names_opt->end(), name);
-      if(oldp != names_opt->end())
-        names_opt->erase(oldp);
-
-      names_opt->emplace_back(name);
-    }
-
-    // Just ensure the name exists.
-    ctx.open_named_reference(name) /*= Reference_root::S_void()*/;
+    // Allocate a slot for further name lookups.
+    return ctx.open_local_slot(name);
   }
 
 cow_vector<AIR_Node>&
@@ -99,25 +89,24 @@ do_generate_expression(const Compiler_Options& opts, PTC_Aware ptc, const Analyt
   }
 
 cow_vector<AIR_Node>&
-do_generate_statement_list(cow_vector<AIR_Node>& code, cow_vector<phsh_string>* names_opt, Analytic_Context& ctx,
-                           const Compiler_Options& opts, PTC_Aware ptc, const Statement::S_block& block)
+do_generate_statement_list(cow_vector<AIR_Node>& code, Analytic_Context& ctx, const Compiler_Options& opts, PTC_Aware ptc, const Statement::S_block& block)
   {
     // Statements other than the last one cannot be the end of function.
     for(size_t i = 0;  i < block.stmts.size();  ++i) {
       auto qnext = block.stmts.get_ptr(i + 1);
       bool rvoid = qnext && qnext->is_empty_return();
-      block.stmts[i].generate_code(code, names_opt, ctx, opts, rvoid ? ptc_aware_void :
-                                                               qnext ? ptc_aware_none : ptc);
+      block.stmts[i].generate_code(code, ctx, opts, rvoid ? ptc_aware_void :
+                                                    qnext ? ptc_aware_none : ptc);
     }
     return code;
   }
 
 cow_vector<AIR_Node>
-do_generate_statement_list(cow_vector<phsh_string>* names_opt, Analytic_Context& ctx,
-                           const Compiler_Options& opts, PTC_Aware ptc, const Statement::S_block& block)
+do_generate_statement_list(Analytic_Context& ctx, const Compiler_Options& opts, PTC_Aware ptc,
+                           const Statement::S_block& block)
   {
     cow_vector<AIR_Node> code;
-    do_generate_statement_list(code, names_opt, ctx, opts, ptc, block);
+    do_generate_statement_list(code, ctx, opts, ptc, block);
     return code;
   }
 
@@ -127,7 +116,8 @@ do_generate_block(const Compiler_Options& opts, PTC_Aware ptc, const Analytic_Co
   {
     cow_vector<AIR_Node> code;
     Analytic_Context ctx_stmts(::rocket::ref(ctx));
-    do_generate_statement_list(code, nullptr, ctx_stmts, opts, ptc, block);
+    do_generate_statement_list(code, ctx_stmts, opts, ptc, block);
+    AIR_Node::update_escaping(code, ctx_stmts);
     return code;
   }
 
@@ -135,8 +125,8 @@ do_generate_block(const Compiler_Options& opts, PTC_Aware ptc, const Analytic_Co
 
 cow_vector<AIR_Node>&
 Statement::
-generate_code(cow_vector<AIR_Node>& code, cow_vector<phsh_string>* names_opt,
-              Analytic_Context& ctx, const Compiler_Options& opts, PTC_Aware ptc)
+generate_code(cow_vector<AIR_Node>& code, Analytic_Context& ctx, const Compiler_Options& opts,
+              PTC_Aware ptc)
 const
   {
     switch(this->index()) {
@@ -193,14 +183,16 @@ const
           else
             ROCKET_ASSERT(altr.decls[i].size() == 1);
 
-          // Create dummy references for further name lookups.
+          // Allocate slots for further name lookups.
+          cow_vector<uint32_t> slots;
           for(size_t k = bpos;  k < epos;  ++k)
-            do_user_declare(names_opt, ctx, altr.decls[i][k], "variable placeholder");
+            slots.emplace_back(do_user_declare(ctx, altr.decls[i][k], "variable placeholder"));
 
           if(altr.inits[i].units.empty()) {
             // If no initializer is provided, no further initialization is required.
             for(size_t k = bpos;  k < epos;  ++k) {
-              AIR_Node::S_define_null_variable xnode = { altr.immutable, altr.slocs[i], altr.decls[i][k] };
+              AIR_Node::S_define_null_variable xnode = { altr.immutable, altr.slocs[i], slots[k - bpos],
+                                                         altr.decls[i][k], true };
               code.emplace_back(::std::move(xnode));
             }
           }
@@ -210,7 +202,8 @@ const
 
             // Push uninitialized variables from left to right.
             for(size_t k = bpos;  k < epos;  ++k) {
-              AIR_Node::S_declare_variable xnode = { altr.slocs[i], altr.decls[i][k] };
+              AIR_Node::S_declare_variable xnode = { altr.slocs[i], slots[k - bpos], altr.decls[i][k],
+                                                     true };
               code.emplace_back(::std::move(xnode));
             }
 
@@ -241,11 +234,11 @@ const
       case index_function: {
         const auto& altr = this->m_stor.as<index_function>();
 
-        // Create a dummy reference for further name lookups.
-        do_user_declare(names_opt, ctx, altr.name, "function placeholder");
+        // Allocate a slot for further name lookups.
+        auto slot = do_user_declare(ctx, altr.name, "function placeholder");
 
         // Declare the function, which is effectively an immutable variable.
-        AIR_Node::S_declare_variable xnode_decl = { altr.sloc, altr.name };
+        AIR_Node::S_declare_variable xnode_decl = { altr.sloc, slot, altr.name, true };
         code.emplace_back(::std::move(xnode_decl));
 
         // Generate code
@@ -291,12 +284,11 @@ const
         // Generate code for all clauses.
         cow_vector<cow_vector<AIR_Node>> code_labels;
         cow_vector<cow_vector<AIR_Node>> code_bodies;
-        cow_vector<cow_vector<phsh_string>> names_added;
 
         // Create a fresh context for the `switch` body.
-        // Be advised that all clauses inside a `switch` statement share the same context.
+        // Be advised that all clauses inside a `switch` statement share the same context, so
+        // variables whose declarations are bypassed are left in their slots uninitialized.
         Analytic_Context ctx_body(::rocket::ref(ctx));
-        cow_vector<phsh_string> names;
 
         // Get the number of clauses.
         auto nclauses = altr.labels.size();
@@ -304,18 +296,21 @@ const
 
         for(size_t i = 0;  i < nclauses;  ++i) {
           // Generate code for the label.
-          // Note labels are not part of the body.
-          do_generate_expression(code_labels.emplace_back(), opts, ptc_aware_none, ctx, altr.labels[i]);
-          // Generate code for the clause and accumulate names.
+          // Note labels are not part of the body. The label of a `default` clause must
+          // yield no code at all, which is how it is told apart from `case` clauses.
+          auto& code_label = code_labels.emplace_back();
+          if(!altr.labels[i].units.empty())
+            do_generate_expression(code_label, opts, ptc_aware_none, ctx, altr.labels[i]);
+          // Generate code for the clause.
           // This cannot be PTC'd.
-          do_generate_statement_list(code_bodies.emplace_back(), &names, ctx_body, opts, ptc_aware_none,
+          do_generate_statement_list(code_bodies.emplace_back(), ctx_body, opts, ptc_aware_none,
                                      altr.bodies[i]);
-          names_added.emplace_back(names);
         }
+        for(size_t i = 0;  i < nclauses;  ++i)
+          AIR_Node::update_escaping(code_bodies.mut(i), ctx_body);
 
         // Encode arguments.
-        AIR_Node::S_switch_statement xnode = { ::std::move(code_labels), ::std::move(code_bodies),
-                                               ::std::move(names_added) };
+        AIR_Node::S_switch_statement xnode = { ::std::move(code_labels), ::std::move(code_bodies) };
         code.emplace_back(::std::move(xnode));
         return code;
       }
@@ -360,8 +355,8 @@ const
         // Note that the key and value references outlasts every iteration, so we have to create
         // an outer contexts here.
         Analytic_Context ctx_for(::rocket::ref(ctx));
-        do_user_declare(names_opt, ctx_for, altr.name_key, "key placeholder");
-        do_user_declare(names_opt, ctx_for, altr.name_mapped, "value placeholder");
+        auto slot_key = do_user_declare(ctx_for, altr.name_key, "key placeholder");
+        auto slot_mapped = do_user_declare(ctx_for, altr.name_mapped, "value placeholder");
 
         // Generate code for the range initializer.
         ROCKET_ASSERT(!altr.init.units.empty());
@@ -372,7 +367,7 @@ const
         auto code_body = do_generate_block(opts, ptc_aware_none, ctx_for, altr.body);
 
         // Encode arguments.
-        AIR_Node::S_for_each_statement xnode = { altr.name_key, altr.name_mapped, ::std::move(code_init),
+        AIR_Node::S_for_each_statement xnode = { slot_key, slot_mapped, ::std::move(code_init),
                                                  ::std::move(code_body) };
         code.emplace_back(::std::move(xnode));
         return code;
@@ -386,13 +381,14 @@ const
         Analytic_Context ctx_for(::rocket::ref(ctx));
 
         // Generate code for the initializer, the condition and the loop increment.
-        auto code_init = do_generate_statement_list(nullptr, ctx_for, opts, ptc_aware_none, altr.init);
+        auto code_init = do_generate_statement_list(ctx_for, opts, ptc_aware_none, altr.init);
         auto code_cond = do_generate_expression(opts, ptc_aware_none, ctx_for, altr.cond);
         auto code_step = do_generate_expression(opts, ptc_aware_none, ctx_for, altr.step);
 
         // Generate code for the body.
         // Loop statements cannot be PTC'd.
         auto code_body = do_generate_block(opts, ptc_aware_none, ctx_for, altr.body);
+        AIR_Node::update_escaping(code_init, ctx_for);
 
         // Encode arguments.
         AIR_Node::S_for_statement xnode = { ::std::move(code_init), ::std::move(code_cond),
@@ -409,15 +405,17 @@ const
 
         // Create a fresh context for the `catch` clause.
         Analytic_Context ctx_catch(::rocket::ref(ctx));
-        do_user_declare(names_opt, ctx_catch, altr.name_except, "exception placeholder");
-        ctx_catch.open_named_reference(::rocket::sref("__backtrace"));
+        auto slot_except = do_user_declare(ctx_catch, altr.name_except, "exception placeholder");
+        auto slot_backtrace = ctx_catch.open_local_slot(::rocket::sref("__backtrace"));
         // Generate code for the `catch` body.
         // Unlike the `try` body, this may be PTC'd.
-        auto code_catch = do_generate_statement_list(nullptr, ctx_catch, opts, ptc, altr.body_catch);
+        auto code_catch = do_generate_statement_list(ctx_catch, opts, ptc, altr.body_catch);
+        AIR_Node::update_escaping(code_catch, ctx_catch);
 
         // Encode arguments.
         AIR_Node::S_try_statement xnode = { altr.sloc_try, ::std::move(code_try),
-                                            altr.sloc_catch, altr.name_except, ::std::move(code_catch) };
+                                            altr.sloc_catch, slot_except, slot_backtrace,
+                                            ::std::move(code_catch) };
         code.emplace_back(::std::move(xnode));
         return code;
       }
@@ -513,6 +511,8 @@ const
           // Generate code for the operand.
           if(altr.by_ref) {
             // This may be PTC'd by reference.
+            // The result may be a local reference, which escapes.
+            ctx.mark_all_locals_escaping();
             do_generate_expression(code, opts, ptc_aware_by_ref, ctx, altr.expr);
           }
           else {
@@ -215,8 +215,8 @@ class Statement
       }
 
     cow_vector<AIR_Node>&
-    generate_code(cow_vector<AIR_Node>& code, cow_vector<phsh_string>* names_opt,
-                  Analytic_Context& ctx, const Compiler_Options& opts, PTC_Aware ptc)
+    generate_code(cow_vector<AIR_Node>& code, Analytic_Context& ctx, const Compiler_Options& opts,
+                  PTC_Aware ptc)
     const;
   };
 
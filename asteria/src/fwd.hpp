@@ -175,6 +175,7 @@ class Variable;
 class Variable_Callback;
 class PTC_Arguments;
 class Collector;
+class GC_Workers;
 class Abstract_Context;
 class Analytic_Context;
 class Executive_Context;
@@ -182,6 +183,10 @@ class Global_Context;
 class Genius_Collector;
 class Random_Engine;
 class Loader_Lock;
+class Module_Cache;
+class Regex_Cache;
+class Bytecode_Writer;
+class Bytecode_Reader;
 class Variadic_Arguer;
 class Instantiated_Function;
 class AIR_Node;
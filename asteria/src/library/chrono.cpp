@@ -423,10 +423,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.utc_now"));
     // Parse arguments.
-    if(reader.I().F()) {
-      Reference_root::S_temporary xref = { std_chrono_utc_now() };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_utc_now))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -449,10 +447,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.local_now"));
     // Parse arguments.
-    if(reader.I().F()) {
-      Reference_root::S_temporary xref = { std_chrono_local_now() };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_local_now))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -478,10 +474,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.hires_now"));
     // Parse arguments.
-    if(reader.I().F()) {
-      Reference_root::S_temporary xref = { std_chrono_hires_now() };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_hires_now))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -507,10 +501,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.steady_now"));
     // Parse arguments.
-    if(reader.I().F()) {
-      Reference_root::S_temporary xref = { std_chrono_steady_now() };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_steady_now))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -534,11 +526,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.local_from_utc"));
     // Parse arguments.
-    V_integer time_utc;
-    if(reader.I().v(time_utc).F()) {
-      Reference_root::S_temporary xref = { std_chrono_local_from_utc(::std::move(time_utc)) };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_local_from_utc))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -563,11 +552,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.utc_from_local"));
     // Parse arguments.
-    V_integer time_local;
-    if(reader.I().v(time_local).F()) {
-      Reference_root::S_temporary xref = { std_chrono_utc_from_local(::std::move(time_local)) };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_utc_from_local))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -593,12 +579,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.utc_format"));
     // Parse arguments.
-    V_integer time_point;
-    optV_boolean with_ms;
-    if(reader.I().v(time_point).o(with_ms).F()) {
-      Reference_root::S_temporary xref = { std_chrono_utc_format(::std::move(time_point), with_ms) };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_utc_format))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -625,11 +607,8 @@ create_bindings_chrono(V_object& result, API_Version /*version*/)
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.chrono.utc_parse"));
     // Parse arguments.
-    V_string time_str;
-    if(reader.I().v(time_str).F()) {
-      Reference_root::S_temporary xref = { std_chrono_utc_parse(::std::move(time_str)) };
-      return self = ::std::move(xref);
-    }
+    if(reader.C(self, std_chrono_utc_parse))
+      return self;
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -5,6 +5,9 @@
 #include "io.hpp"
 #include "../runtime/argument_reader.hpp"
 #include "../utilities.hpp"
+#ifdef __SSE2__
+#  include <emmintrin.h>  // _mm_movemask_epi8()
+#endif
 
 namespace asteria {
 namespace {
@@ -47,29 +50,97 @@ do_recover(const IOF_Sentry& fp)
     return err;
   }
 
-size_t
-do_write_utf8_common(const IOF_Sentry& fp, const cow_string& text)
+bool
+do_validate_utf8(size_t& ncps, size_t& offset, const char* str, size_t len)
   {
-    size_t ncps = 0;
-    size_t off = 0;
-    while(off < text.size()) {
-      // Decode a code point from `text`.
+    // Validate UTF-8 sequences and count code points. Upon success, `offset` is set to
+    // `len`. Otherwise, it is set to the offset of the first invalid sequence, and `ncps`
+    // is set to the number of code points before it.
+    const char* sptr = str;
+    const char* eptr = str + len;
+    ncps = 0;
+    for(;;) {
+#ifdef __SSE2__
+      // Skip ASCII characters in bulk. Non-ASCII characters have their MSBs set.
+      while(eptr - sptr >= 16) {
+        auto vchs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sptr));
+        auto mask = static_cast<uint32_t>(_mm_movemask_epi8(vchs));
+        if(mask != 0) {
+          auto nskip = static_cast<uint32_t>(__builtin_ctz(mask));
+          sptr += nskip;
+          ncps += nskip;
+          break;
+        }
+        sptr += 16;
+        ncps += 16;
+      }
+#endif
+      if(sptr == eptr)
+        break;
+
+      // Decode a code point from `str`.
+      const char* rptr = sptr;
       char32_t cp;
-      if(!noadl::utf8_decode(cp, text, off))
-        ASTERIA_THROW("Invalid UTF-8 string (text `$1`, byte offset `$2`)", text, off);
+      if(!noadl::utf8_decode(cp, sptr, static_cast<size_t>(eptr - sptr))) {
+        offset = static_cast<size_t>(rptr - str);
+        return false;
+      }
+      ncps += 1;
+    }
+    offset = len;
+    return true;
+  }
 
-      // Insert it into the output stream.
-      if(::fputwc_unlocked(static_cast<wchar_t>(cp), fp) == WEOF)
+size_t
+do_write_utf8_common(const IOF_Sentry& fp, const cow_string& text)
+  {
+    // Validate the string before writing it.
+    // If it is invalid, characters before the invalid sequence are written nonetheless.
+    size_t ncps, off;
+    bool valid = do_validate_utf8(ncps, off, text.data(), text.size());
+
+    // Insert the valid part into the output stream.
+    if(off != 0) {
+      if(::fwrite_unlocked(text.data(), 1, off, fp) != off)
         ASTERIA_THROW("Error writing standard output\n"
-                      "[`fputwc_unlocked()` failed: $1]",
-                      noadl::format_errno(errno));
-
-      // The return value is the number of code points rather than bytes.
-      ncps += 1;
+                      "[`fwrite_unlocked()` failed: $1]",
+                      noadl::format_errno(do_recover(fp)));
     }
+    if(!valid)
+      ASTERIA_THROW("Invalid UTF-8 string (text `$1`, byte offset `$2`)", text, off);
+
+    // The return value is the number of code points rather than bytes.
     return ncps;
   }
 
+// This is the buffer for `getdelim()`, which is reused by subsequent calls. It is
+// released after a line longer than `cap_max`, so a single long line does not pin
+// memory for the lifetime of the thread.
+struct Line_Buffer
+  {
+    static constexpr size_t cap_max = 65536;
+
+    char* str = nullptr;
+    size_t cap = 0;
+
+    ~Line_Buffer()
+      { ::free(this->str);  }
+
+    void
+    trim()
+    noexcept
+      {
+        if(this->cap <= cap_max)
+          return;
+
+        ::free(this->str);
+        this->str = nullptr;
+        this->cap = 0;
+      }
+  };
+
+thread_local Line_Buffer s_line;
+
 }  // namespace
 
 optV_integer
@@ -82,25 +153,50 @@ std_io_getc()
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard input failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text read from binary-oriented input");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text read from wide-oriented input");
 
-    // Read a UTF code point.
-    wint_t wch = ::fgetwc_unlocked(fp);
-    if(wch == WEOF) {
+    // Read the first byte of a UTF-8 sequence.
+    int ch = ::getc_unlocked(fp);
+    if(ch == EOF) {
       // Throw an exception on error.
       // Return `null` on EOF.
       int err = do_recover(fp);
       if(err != 0)
         ASTERIA_THROW("Error reading standard input\n"
-                      "[`fgetwc_unlocked()` failed: $1]",
+                      "[`getc_unlocked()` failed: $1]",
                       noadl::format_errno(err));
 
       return nullopt;
     }
 
+    // Read trailing bytes, whose number is determined by the first byte.
+    // A non-trailing byte is put back, so it will be read next time.
+    char mbs[4] = { static_cast<char>(ch) };
+    size_t u8len = (ch < 0xC0) ? 1 : static_cast<size_t>(2 + (ch >= 0xE0) + (ch >= 0xF0));
+    size_t nread = 1;
+    while(nread < u8len) {
+      ch = ::getc_unlocked(fp);
+      if(ch == EOF)
+        break;
+
+      if((ch & 0xC0) != 0x80) {
+        ::ungetc(ch, fp);
+        break;
+      }
+      mbs[nread++] = static_cast<char>(ch);
+    }
+
+    // Decode the code point.
+    const char* sptr = mbs;
+    char32_t cp;
+    if(!noadl::utf8_decode(cp, sptr, nread))
+      ASTERIA_THROW("Error reading standard input\n"
+                    "[`getc_unlocked()` failed: $1]",
+                    noadl::format_errno(EILSEQ));
+
     // Zero-extend the code point to an integer.
-    return static_cast<uint32_t>(wch);
+    return static_cast<uint32_t>(cp);
   }
 
 optV_string
@@ -113,39 +209,45 @@ std_io_getln()
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard input failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text read from binary-oriented input");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text read from wide-oriented input");
 
-    // Read a UTF-8 string.
-    cow_string u8str;
-    for(;;) {
-      wint_t wch = ::fgetwc_unlocked(fp);
-      if(wch == WEOF) {
-        // If at least a character has been read, don't fail.
-        if(!u8str.empty())
-          break;
+    // Read a line, which is searched for in the buffer of the stream.
+    // If at least a character has been read before EOF, don't fail.
+    ::ssize_t nread = ::getdelim(&(s_line.str), &(s_line.cap), '\n', fp);
+    if(nread < 0) {
+      // Throw an exception on error.
+      // Return `null` on EOF.
+      int err = do_recover(fp);
+      if(err != 0)
+        ASTERIA_THROW("Error reading standard input\n"
+                      "[`getdelim()` failed: $1]",
+                      noadl::format_errno(err));
 
-        // Throw an exception on error.
-        // Return `null` on EOF.
-        int err = do_recover(fp);
-        if(err != 0)
-          ASTERIA_THROW("Error reading standard input\n"
-                        "[`fgetwc_unlocked()` failed: $1]",
-                        noadl::format_errno(err));
+      return nullopt;
+    }
 
-        return nullopt;
-      }
-      // If a LF is encountered, finish this line.
-      if(wch == L'\n')
-        break;
+    // If a LF is encountered, it is not part of the line.
+    size_t len = static_cast<size_t>(nread);
+    if((len != 0) && (s_line.str[len-1] == '\n'))
+      len -= 1;
+
+    // Validate the line, then copy it.
+    size_t ncps, off;
+    bool valid = do_validate_utf8(ncps, off, s_line.str, len);
+    cow_string line;
+    if(valid)
+      line.append(s_line.str, len);
+
+    // Release the buffer if it has grown too large.
+    s_line.trim();
+    if(!valid)
+      ASTERIA_THROW("Error reading standard input\n"
+                    "[`getdelim()` failed: $1]",
+                    noadl::format_errno(EILSEQ));
 
-      // Append the non-LF character to the result string.
-      char32_t cp = static_cast<uint32_t>(wch);
-      if(!noadl::utf8_encode(u8str, cp))
-        ASTERIA_THROW("Invalid UTF code point from standard input (value `$1`)", wch);
-    }
     // Return the UTF-8 string.
-    return u8str;
+    return line;
   }
 
 optV_integer
@@ -158,26 +260,26 @@ std_io_putc(V_integer value)
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard output failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text write to binary-oriented output");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text write to wide-oriented output");
 
     // Validate the code point.
     char32_t cp = static_cast<uint32_t>(value);
     if(cp != value)
       ASTERIA_THROW("Invalid UTF code point (value `$1`)", value);
 
-    // Check whether it is valid by try encoding it.
-    // The result is discarded.
-    char16_t sbuf[2];
-    char16_t* sp = sbuf;
-    if(!noadl::utf16_encode(sp, cp))
+    // Encode it in UTF-8.
+    char mbs[4];
+    char* sptr = mbs;
+    if(!noadl::utf8_encode(sptr, cp))
       ASTERIA_THROW("Invalid UTF code point (value `$1`)", value);
 
     // Write a UTF code point.
-    if(::fputwc_unlocked(static_cast<wchar_t>(cp), fp) == WEOF)
+    size_t len = static_cast<size_t>(sptr - mbs);
+    if(::fwrite_unlocked(mbs, 1, len, fp) != len)
       ASTERIA_THROW("Error writing standard output\n"
-                    "[`fputwc_unlocked()` failed: $1]",
-                    noadl::format_errno(errno));
+                    "[`fwrite_unlocked()` failed: $1]",
+                    noadl::format_errno(do_recover(fp)));
 
     // Return the number of code points that have been written.
     // This is always 1 for this function.
@@ -194,8 +296,8 @@ std_io_putc(V_string value)
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard output failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text write to binary-oriented output");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text write to wide-oriented output");
 
     // Write only the string.
     size_t ncps = do_write_utf8_common(fp, value);
@@ -214,17 +316,17 @@ std_io_putln(V_string value)
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard output failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text write to binary-oriented output");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text write to wide-oriented output");
 
     // Write the string itself.
     size_t ncps = do_write_utf8_common(fp, value);
 
-    // Append a line feed and flush.
-    if(::fputwc_unlocked(L'\n', fp) == WEOF)
+    // Append a line feed, which may flush the stream.
+    if(::putc_unlocked('\n', fp) == EOF)
       ASTERIA_THROW("Error writing standard output\n"
-                    "[`fputwc_unlocked()` failed: $1]",
-                    noadl::format_errno(errno));
+                    "[`putc_unlocked()` failed: $1]",
+                    noadl::format_errno(do_recover(fp)));
 
     // Return the number of code points that have been written.
     // The implicit LF also counts.
@@ -241,8 +343,8 @@ std_io_putf(V_string templ, cow_vector<Value> values)
     if(::ferror_unlocked(fp))
       ASTERIA_THROW("Standard output failure (error bit set)");
 
-    if(::fwide(fp, +1) < 0)
-      ASTERIA_THROW("Invalid text write to binary-oriented output");
+    if(::fwide(fp, -1) > 0)
+      ASTERIA_THROW("Invalid text write to wide-oriented output");
 
     // Prepare inserters.
     cow_vector<::rocket::formatter> insts;
@@ -278,7 +380,7 @@ std_io_read(optV_integer limit)
       ASTERIA_THROW("Standard input failure (error bit set)");
 
     if(::fwide(fp, -1) > 0)
-      ASTERIA_THROW("Invalid binary read from text-oriented input");
+      ASTERIA_THROW("Invalid binary read from wide-oriented input");
 
     // Read some bytes from the stream.
     cow_string data(rlimit, '\0');
@@ -310,7 +412,7 @@ std_io_write(V_string data)
       ASTERIA_THROW("Standard output failure (error bit set)");
 
     if(::fwide(fp, -1) > 0)
-      ASTERIA_THROW("Invalid binary write to text-oriented output");
+      ASTERIA_THROW("Invalid binary write to wide-oriented output");
 
     // Don't pass zero to `fwrite()`
     if(data.empty())
@@ -357,8 +459,8 @@ create_bindings_io(V_object& result, API_Version /*version*/)
   * Returns the code point that has been read as an integer. If the
     end of input is encountered, `null` is returned.
 
-  * Throws an exception if standard input is binary-oriented, or if
-    a read error occurs.
+  * Throws an exception if a read error occurs, or if source data
+    cannot be converted to a valid UTF code point.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -388,9 +490,8 @@ create_bindings_io(V_object& result, API_Version /*version*/)
   * Returns the line that has been read as a string. If the end of
     input is encountered, `null` is returned.
 
-  * Throws an exception if standard input is binary-oriented, or if
-    a read error occurs, or if source data cannot be converted to a
-    valid UTF code point sequence.
+  * Throws an exception if a read error occurs, or if source data
+    cannot be converted to a valid UTF code point sequence.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -418,9 +519,8 @@ create_bindings_io(V_object& result, API_Version /*version*/)
 
   * Returns the number of UTF code points that have been written.
 
-  * Throws an exception if standard output is binary-oriented, or
-    if source data cannot be converted to a valid UTF code point
-    sequence, or if a write error occurs.
+  * Throws an exception if source data cannot be converted to a
+    valid UTF code point sequence, or if a write error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -456,9 +556,8 @@ create_bindings_io(V_object& result, API_Version /*version*/)
   * Returns the number of UTF code points that have been written,
     including the terminating LF.
 
-  * Throws an exception if standard output is binary-oriented, or
-    if source data cannot be converted to a valid UTF code point
-    sequence, or if a write error occurs.
+  * Throws an exception if source data cannot be converted to a
+    valid UTF code point sequence, or if a write error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -487,9 +586,8 @@ create_bindings_io(V_object& result, API_Version /*version*/)
 
  * Returns the number of UTF code points that have been written.
 
- * Throws an exception if standard output is binary-oriented, or
-   if source data cannot be converted to a valid UTF code point
-   sequence, or if a write error occurs.
+ * Throws an exception if source data cannot be converted to a
+   valid UTF code point sequence, or if a write error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -520,9 +618,7 @@ create_bindings_io(V_object& result, API_Version /*version*/)
   * Returns the bytes that have been read as a string. If the end
     of input is encountered, `null` is returned.
 
-  * Throws an exception if standard input is text-oriented, or if
-    a read error occurs, or if source data cannot be converted to a
-    valid UTF code point sequence.
+  * Throws an exception if a read error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -551,8 +647,7 @@ create_bindings_io(V_object& result, API_Version /*version*/)
 
   * Returns the number of bytes that have been written.
 
-  * Throws an exception if standard output is text-oriented, or if
-    a write error occurs.
+  * Throws an exception if a write error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
 *[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
   {
@@ -577,8 +672,7 @@ create_bindings_io(V_object& result, API_Version /*version*/)
 `std.io.flush()`
 
   * Forces buffered data on standard output to be delivered to its
-    underlying device. This function may be called regardless of
-    the orientation of standard output.
+    underlying device.
 
   * Throws an exception if a write error occurs.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
@@ -5,10 +5,15 @@
 #include "json.hpp"
 #include "../runtime/argument_reader.hpp"
 #include "../runtime/global_context.hpp"
-#include "../compiler/token_stream.hpp"
 #include "../compiler/parser_error.hpp"
-#include "../compiler/enums.hpp"
 #include "../utilities.hpp"
+#include <sys/mman.h>  // ::mmap()
+#include <sys/stat.h>  // ::fstat()
+#include <fcntl.h>  // ::open()
+#include <unistd.h>  // ::read()
+#ifdef __SSE2__
+#  include <emmintrin.h>  // _mm_cmpeq_epi8()
+#endif
 
 namespace asteria {
 namespace {
@@ -428,52 +433,6 @@ do_format_nonrecursive(const Value& value, bool json5, Indenter&& indent)
     return do_format_nonrecursive(value, json5, indent);
   }
 
-opt<Punctuator>
-do_accept_punctuator_opt(Token_Stream& tstrm, initializer_list<Punctuator> accept)
-  {
-    auto qtok = tstrm.peek_opt();
-    if(!qtok)
-      return nullopt;
-
-    if(!qtok->is_punctuator())
-      return nullopt;
-
-    auto punct = qtok->as_punctuator();
-    if(::rocket::is_none_of(punct, accept))
-      return nullopt;
-
-    tstrm.shift();
-    return punct;
-  }
-
-phsh_string
-do_accept_object_key(Token_Stream& tstrm)
-  {
-    auto qtok = tstrm.peek_opt();
-    if(!qtok)
-      throw Parser_Error(parser_status_closed_brace_or_json5_key_expected, tstrm.next_sloc(),
-                         tstrm.next_length());
-
-    cow_string name;
-    if(qtok->is_identifier()) {
-      name = qtok->as_identifier();
-    }
-    else if(qtok->is_string_literal()) {
-      name = qtok->as_string_literal();
-    }
-    else {
-      throw Parser_Error(parser_status_closed_brace_or_json5_key_expected, tstrm.next_sloc(),
-                         tstrm.next_length());
-    }
-    tstrm.shift();
-
-    auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_colon });
-    if(!kpunct)
-      throw Parser_Error(parser_status_colon_expected, tstrm.next_sloc(), tstrm.next_length());
-
-    return name;
-  }
-
 struct S_xparse_array
   {
     V_array array;
@@ -487,54 +446,467 @@ struct S_xparse_object
 
 using Xparse = variant<S_xparse_array, S_xparse_object>;
 
-Value
-do_json_parse_nonrecursive(Token_Stream& tstrm)
+const char*
+do_find_string_special(const char* sptr, const char* eptr, char head)
   {
-    Value value;
+    // Look for the terminating quote mark, a backslash, a control character or a non-ASCII character.
+#ifdef __SSE2__
+    // Note that all bytes in the last two categories compare less than 0x20 as signed integers.
+    auto vhead = _mm_set1_epi8(head);
+    auto vbsl = _mm_set1_epi8('\\');
+    auto vctl = _mm_set1_epi8(0x20);
+    while(eptr - sptr >= 16) {
+      auto vchs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sptr));
+      auto vmat = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(vchs, vhead), _mm_cmpeq_epi8(vchs, vbsl)),
+                               _mm_cmplt_epi8(vchs, vctl));
+      auto mask = static_cast<uint32_t>(_mm_movemask_epi8(vmat));
+      if(mask != 0)
+        return sptr + __builtin_ctz(mask);
+      sptr += 16;
+    }
+#endif
+    // Scan remaining characters one by one.
+    while(sptr != eptr) {
+      uint8_t ch = static_cast<uint8_t>(*sptr);
+      if((ch == static_cast<uint8_t>(head)) || (ch == '\\') || (ch < 0x20) || (ch >= 0x80))
+        return sptr;
+      sptr++;
+    }
+    return eptr;
+  }
 
-    // Implement a non-recursive descent parser.
-    cow_vector<Xparse> stack;
+template<size_t N>
+bool
+do_match_name(const char* tptr, const char* eptr, const char (&name)[N])
+noexcept
+  {
+    return (eptr - tptr == N - 1) && (::std::memcmp(tptr, name, N - 1) == 0);
+  }
 
-    for(;;) {
-      // Accept a value. No other things such as closed brackets are allowed.
-      auto qtok = tstrm.peek_opt();
-      if(!qtok)
-        throw Parser_Error(parser_status_expression_expected, tstrm.next_sloc(), tstrm.next_length());
-
-      switch(noadl::weaken_enum(qtok->index())) {
-        case Token::index_punctuator: {
-          // Accept a `+`, `-`, `[` or `{`.
-          auto punct = qtok->as_punctuator();
-          switch(noadl::weaken_enum(punct)) {
-            case punctuator_add:
-            case punctuator_sub: {
-              cow_string name;
-              qtok = tstrm.peek_opt(1);
-              if(qtok && qtok->is_identifier())
-                name = qtok->as_identifier();
-
-              // Only `Infinity` and `NaN` may follow.
-              // Note that the tokenizer will have merged sign symbols into adjacent number literals.
-              if(::rocket::is_none_of(name, { "Infinity", "NaN" }))
-                throw Parser_Error(parser_status_expression_expected, tstrm.next_sloc(),
-                                   tstrm.next_length());
-
-              // Accept a special numeric value.
-              double sign = (punct == punctuator_add) - 1;
-              double real = (name[0] == 'I') ? ::std::numeric_limits<double>::infinity()
-                                             : ::std::numeric_limits<double>::quiet_NaN();
-
-              value = ::std::copysign(real, sign);
-              tstrm.shift(2);
+// This is a single-pass parser that works on contiguous buffers. It accepts the same extensions that
+// the tokenizer of Asteria does, which used to be reused here.
+class JSON_Parser
+  {
+  private:
+    const char* m_rptr;  // next character to read
+    const char* m_eptr;  // end of input
+    const char* m_lptr;  // beginning of the current line
+    int m_line = 1;
+
+  public:
+    JSON_Parser(const char* bptr, const char* eptr)
+    noexcept
+      : m_rptr(bptr), m_eptr(eptr), m_lptr(bptr)
+      {
+        // Discard the first line if it looks like a shebang.
+        if((eptr - bptr >= 2) && (::std::memcmp(bptr, "#!", 2) == 0)) {
+          auto tptr = static_cast<const char*>(::std::memchr(bptr, '\n', static_cast<size_t>(eptr - bptr)));
+          if(tptr)
+            this->do_new_line(tptr);
+          else
+            this->m_rptr = eptr;
+        }
+      }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(JSON_Parser)
+      { }
+
+  private:
+    void
+    do_new_line(const char* tptr)
+    noexcept
+      {
+        // `tptr` points to an LF character.
+        this->m_rptr = tptr + 1;
+        this->m_lptr = tptr + 1;
+        this->m_line++;
+      }
+
+    Source_Location
+    do_tell(const char* tptr)
+    const noexcept
+      { return Source_Location(::rocket::sref("<JSON text>"), this->m_line,
+                               static_cast<int>(tptr - this->m_lptr));  }
+
+    [[noreturn]]
+    void
+    do_throw(Parser_Status status, const char* tptr, const char* eptr)
+    const
+      { throw Parser_Error(status, this->do_tell(tptr), static_cast<size_t>(eptr - tptr));  }
+
+    char
+    do_at(const char* tptr)
+    const noexcept
+      { return (tptr == this->m_eptr) ? '\0' : *tptr;  }
+
+    const char*
+    do_skip_digits(const char* tptr, uint8_t mask, bool& has_sep)
+    const noexcept
+      {
+        for(;;) {
+          char c = this->do_at(tptr);
+          if(c == '`') {
+            // Skip a digit separator.
+            has_sep = true;
+            tptr++;
+            continue;
+          }
+          if(!noadl::is_cctype(c, mask))
+            return tptr;
+          tptr++;
+        }
+      }
+
+    const char*
+    do_skip_name(const char* tptr)
+    const noexcept
+      {
+        while(noadl::is_cctype(this->do_at(tptr), cctype_namei | cctype_digit))
+          tptr++;
+        return tptr;
+      }
+
+    bool
+    do_accept(int ch)
+      {
+        if(this->peek() != ch)
+          return false;
+
+        this->m_rptr++;
+        return true;
+      }
+
+    V_real
+    do_accept_number()
+      {
+        // numeric-literal ::=
+        //   number-sign-opt ( binary-literal | decimal-literal | hexadecimal-literal ) exponent-suffix-opt
+        // Please refer to the tokenizer for details.
+        const char* tptr = this->m_rptr;
+        const char* eptr = tptr;
+        if(::rocket::is_any_of(*eptr, { '+', '-' }))
+          eptr++;
+
+        // Get the mask of mantissa digits and tell which character initiates the exponent.
+        uint8_t mmask = cctype_digit;
+        char expch = 'e';
+        bool has_sep = false;
+        if(this->do_at(eptr) == '0') {
+          eptr++;
+          // Check the radix identifier.
+          if(::rocket::is_any_of(static_cast<char>(this->do_at(eptr) | 0x20), { 'b', 'x' })) {
+            eptr++;
+            mmask = cctype_xdigit;
+            expch = 'p';
+          }
+        }
+        // Accept the integral part, then the fractional part, then the exponent.
+        eptr = this->do_skip_digits(eptr, mmask, has_sep);
+        if(this->do_at(eptr) == '.')
+          eptr = this->do_skip_digits(eptr + 1, mmask, has_sep);
+
+        if(static_cast<char>(this->do_at(eptr) | 0x20) == expch) {
+          eptr++;
+          if(::rocket::is_any_of(this->do_at(eptr), { '+', '-' }))
+            eptr++;
+          eptr = this->do_skip_digits(eptr, cctype_digit, has_sep);
+        }
+        // Accept numeric suffixes, which are always invalid.
+        eptr = this->do_skip_digits(eptr, cctype_alpha | cctype_digit, has_sep);
+
+        // Digit separators have to be removed before conversion. This is rare.
+        cow_string tstr;
+        const char* bp = tptr;
+        const char* ep = eptr;
+        if(has_sep) {
+          ::std::remove_copy(tptr, eptr, ::std::back_inserter(tstr), '`');
+          bp = tstr.data();
+          ep = bp + tstr.size();
+        }
+        ::rocket::ascii_numget numg;
+        if(!numg.parse_F(bp, ep))
+          this->do_throw(parser_status_numeric_literal_invalid, tptr, eptr);
+
+        if(bp != ep)
+          this->do_throw(parser_status_numeric_literal_suffix_invalid, tptr, eptr);
+
+        // Numbers are always parsed as reals.
+        V_real val;
+        numg.cast_F(val, -DBL_MAX, DBL_MAX);
+        if(numg.overflowed())
+          this->do_throw(parser_status_real_literal_overflow, tptr, eptr);
+
+        if(numg.underflowed())
+          this->do_throw(parser_status_real_literal_underflow, tptr, eptr);
+
+        if(!numg)
+          this->do_throw(parser_status_numeric_literal_invalid, tptr, eptr);
+
+        this->m_rptr = eptr;
+        return val;
+      }
+
+    cow_string
+    do_accept_string()
+      {
+        // string-literal ::=
+        //   PCRE("([^\\]|(\\([abfnrtveZ0'"?\\/]|(x[0-9A-Fa-f]{2})|(u[0-9A-Fa-f]{4})|(U[0-9A-Fa-f]{6}))))*?")
+        //   PCRE('([^\\]|(\\([abfnrtveZ0'"?\\/]|(x[0-9A-Fa-f]{2})|(u[0-9A-Fa-f]{4})|(U[0-9A-Fa-f]{6}))))*?')
+        const char* tptr = this->m_rptr;
+        char head = *tptr;
+        const char* sptr = tptr + 1;
+        cow_string val;
+        for(;;) {
+          // Copy plain characters in bulk.
+          const char* qptr = do_find_string_special(sptr, this->m_eptr, head);
+          val.append(sptr, static_cast<size_t>(qptr - sptr));
+          sptr = qptr;
+
+          // Strings cannot straddle multiple lines.
+          char next = this->do_at(sptr);
+          if((sptr == this->m_eptr) || (next == '\n'))
+            this->do_throw(parser_status_string_literal_unclosed, tptr, sptr);
+
+          if(next == head) {
+            // The end of this string is encountered. Finish.
+            sptr++;
+            break;
+          }
+          if(next == '\0')
+            this->do_throw(parser_status_null_character_disallowed, sptr, sptr + 1);
+
+          if(static_cast<uint8_t>(next) >= 0x80) {
+            // Ensure this is a valid UTF-8 sequence, then copy it as is.
+            char32_t cp;
+            const char* uptr = sptr;
+            if(!noadl::utf8_decode(cp, uptr, static_cast<size_t>(this->m_eptr - sptr)))
+              this->do_throw(parser_status_utf8_sequence_invalid, sptr, this->m_eptr);
+
+            val.append(sptr, static_cast<size_t>(uptr - sptr));
+            sptr = uptr;
+            continue;
+          }
+          if(next != '\\') {
+            // Copy other control characters as is.
+            val.push_back(next);
+            sptr++;
+            continue;
+          }
+
+          // Translate this escape sequence.
+          sptr++;
+          next = this->do_at(sptr);
+          if((sptr == this->m_eptr) || (next == '\n'))
+            this->do_throw(parser_status_escape_sequence_incomplete, tptr, sptr);
+
+          sptr++;
+          int xcnt = 0;
+          switch(next) {
+            case '\'':
+            case '\"':
+            case '\\':
+            case '?':
+            case '/':
+              val.push_back(next);
+              break;
+
+            case 'a':
+              val.push_back('\a');
+              break;
+
+            case 'b':
+              val.push_back('\b');
+              break;
+
+            case 'f':
+              val.push_back('\f');
+              break;
+
+            case 'n':
+              val.push_back('\n');
               break;
+
+            case 'r':
+              val.push_back('\r');
+              break;
+
+            case 't':
+              val.push_back('\t');
+              break;
+
+            case 'v':
+              val.push_back('\v');
+              break;
+
+            case '0':
+              val.push_back('\0');
+              break;
+
+            case 'Z':
+              val.push_back('\x1A');
+              break;
+
+            case 'e':
+              val.push_back('\x1B');
+              break;
+
+            case 'U':
+              xcnt += 2;
+              // Fallthrough
+            case 'u':
+              xcnt += 2;
+              // Fallthrough
+            case 'x': {
+              // How many hex digits are there?
+              xcnt += 2;
+              // Read hex digits.
+              char32_t cp = 0;
+              for(int i = 0;  i < xcnt;  ++i) {
+                // Read a hex digit.
+                char c = this->do_at(sptr);
+                if((sptr == this->m_eptr) || (c == '\n'))
+                  this->do_throw(parser_status_escape_sequence_incomplete, tptr, sptr);
+
+                if(!noadl::is_cctype(c, cctype_xdigit))
+                  this->do_throw(parser_status_escape_sequence_invalid_hex, tptr, sptr);
+
+                sptr++;
+                // Accumulate this digit.
+                cp *= 16;
+                cp += static_cast<uint32_t>((c <= '9') ? (c - '0') : ((c | 0x20) - 'a' + 10));
+              }
+              if(next == 'x') {
+                // Write the character verbatim.
+                val.push_back(static_cast<char>(cp));
+                break;
+              }
+              // Write a Unicode code point.
+              if(!noadl::utf8_encode(val, cp))
+                this->do_throw(parser_status_escape_utf_code_point_invalid, tptr, sptr);
+
+              break;
+            }
+
+            default:
+              this->do_throw(parser_status_escape_sequence_unknown, tptr, sptr);
+          }
+        }
+        this->m_rptr = sptr;
+        return val;
+      }
+
+    bool
+    do_accept_constant(Value& value, double sign)
+      {
+        // Accept `null`, `true`, `false`, `Infinity` or `NaN`.
+        // Only the last two may follow a sign symbol.
+        const char* tptr = this->m_rptr;
+        const char* eptr = this->do_skip_name(tptr);
+        if(do_match_name(tptr, eptr, "Infinity"))
+          value = ::std::copysign(::std::numeric_limits<double>::infinity(), sign);
+        else if(do_match_name(tptr, eptr, "NaN"))
+          value = ::std::copysign(::std::numeric_limits<double>::quiet_NaN(), sign);
+        else if(sign != 0)
+          return false;
+        else if(do_match_name(tptr, eptr, "null"))
+          value = nullptr;
+        else if(do_match_name(tptr, eptr, "true"))
+          value = true;
+        else if(do_match_name(tptr, eptr, "false"))
+          value = false;
+        else
+          return false;
+
+        this->m_rptr = eptr;
+        return true;
+      }
+
+    phsh_string
+    do_accept_object_key()
+      {
+        // Keys may be unquoted if they are valid identifiers.
+        int ch = this->peek();
+        cow_string name;
+        if(noadl::is_cctype(static_cast<char>(ch), cctype_namei)) {
+          const char* eptr = this->do_skip_name(this->m_rptr);
+          name.assign(this->m_rptr, static_cast<size_t>(eptr - this->m_rptr));
+          this->m_rptr = eptr;
+        }
+        else if((ch == '\"') || (ch == '\''))
+          name = this->do_accept_string();
+        else
+          this->do_throw(parser_status_closed_brace_or_json5_key_expected, this->m_rptr, this->m_rptr + 1);
+
+        if(!this->do_accept(':'))
+          this->do_throw(parser_status_colon_expected, this->m_rptr, this->m_rptr + 1);
+
+        return name;
+      }
+
+  public:
+    int
+    peek()
+      {
+        // Skip spaces and comments. Returns the next character, or `EOF` if there are no more characters.
+        for(;;) {
+          if(this->m_rptr == this->m_eptr)
+            return EOF;
+
+          char c = *(this->m_rptr);
+          if(c == '\n') {
+            this->do_new_line(this->m_rptr);
+            continue;
+          }
+          if(noadl::is_cctype(c, cctype_space)) {
+            this->m_rptr++;
+            continue;
+          }
+          if((c == '/') && (this->do_at(this->m_rptr + 1) == '/')) {
+            // Start a line comment. Discard all remaining characters in this line.
+            auto tptr = static_cast<const char*>(::std::memchr(this->m_rptr, '\n',
+                                                     static_cast<size_t>(this->m_eptr - this->m_rptr)));
+            this->m_rptr = tptr ? tptr : this->m_eptr;
+            continue;
+          }
+          if((c == '/') && (this->do_at(this->m_rptr + 1) == '*')) {
+            // Start a block comment. It may straddle multiple lines, but we just mark the first line.
+            auto sloc = this->do_tell(this->m_rptr);
+            const char* tptr = this->m_rptr + 2;
+            for(;;) {
+              if(this->m_eptr - tptr < 2)
+                throw Parser_Error(parser_status_block_comment_unclosed, sloc, 2);
+
+              if((tptr[0] == '*') && (tptr[1] == '/'))
+                break;
+
+              if(tptr[0] == '\n')
+                this->do_new_line(tptr);
+              tptr++;
             }
+            this->m_rptr = tptr + 2;
+            continue;
+          }
+          return static_cast<uint8_t>(c);
+        }
+      }
 
-            case punctuator_bracket_op: {
-              tstrm.shift();
+    Value
+    parse_value()
+      {
+        Value value;
+
+        // Implement a non-recursive descent parser.
+        cow_vector<Xparse> stack;
+
+        for(;;) {
+          // Accept a value. No other things such as closed brackets are allowed.
+          int ch = this->peek();
+          switch(ch) {
+            case '[': {
+              this->m_rptr++;
 
               // Open an array.
-              auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl });
-              if(!kpunct) {
+              if(!this->do_accept(']')) {
                 // Descend into the new array.
                 S_xparse_array ctxa = { V_array() };
                 stack.emplace_back(::std::move(ctxa));
@@ -546,14 +918,13 @@ do_json_parse_nonrecursive(Token_Stream& tstrm)
               break;
             }
 
-            case punctuator_brace_op: {
-              tstrm.shift();
+            case '{': {
+              this->m_rptr++;
 
               // Open an object.
-              auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl });
-              if(!kpunct) {
+              if(!this->do_accept('}')) {
                 // Descend into the new object.
-                S_xparse_object ctxo = { V_object(), do_accept_object_key(tstrm) };
+                S_xparse_object ctxo = { V_object(), this->do_accept_object_key() };
                 stack.emplace_back(::std::move(ctxo));
                 continue;
               }
@@ -563,136 +934,124 @@ do_json_parse_nonrecursive(Token_Stream& tstrm)
               break;
             }
 
-            default:
-              throw Parser_Error(parser_status_expression_expected, tstrm.next_sloc(), tstrm.next_length());
-          }
-          break;
-        }
-
-        case Token::index_identifier: {
-          // Accept a literal.
-          const auto& name = qtok->as_identifier();
-          if(::rocket::is_none_of(name, { "null", "true", "false", "Infinity", "NaN" }))
-            throw Parser_Error(parser_status_expression_expected, tstrm.next_sloc(), tstrm.next_length());
-
-          switch(name[0]) {
-            case 'n':
-              value = nullptr;
+            case '\"':
+            case '\'':
+              // Accept a UTF-8 string.
+              value = this->do_accept_string();
               break;
 
-            case 't':
-              value = true;
+            case '+':
+            case '-': {
+              // A sign symbol shall be followed by a number, `Infinity` or `NaN`.
+              const char* tptr = this->m_rptr;
+              if(noadl::is_cctype(this->do_at(tptr + 1), cctype_digit)) {
+                value = this->do_accept_number();
+                break;
+              }
+              this->m_rptr++;
+              this->peek();
+              if(!this->do_accept_constant(value, (ch == '+') - 0.5))
+                this->do_throw(parser_status_expression_expected, tptr, tptr + 1);
               break;
+            }
 
-            case 'f':
-              value = false;
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+              // Accept a number.
+              value = this->do_accept_number();
               break;
 
-            case 'I':
-              value = ::std::numeric_limits<double>::infinity();
-              break;
+            default: {
+              // Accept a literal.
+              const char* tptr = this->m_rptr;
+              if(ch == EOF)
+                this->do_throw(parser_status_expression_expected, tptr, tptr);
 
-            case 'N':
-              value = ::std::numeric_limits<double>::quiet_NaN();
-              break;
+              if(!noadl::is_cctype(static_cast<char>(ch), cctype_namei)) {
+                if(ch == '\0')
+                  this->do_throw(parser_status_null_character_disallowed, tptr, tptr + 1);
 
-            default:
-              ROCKET_ASSERT(false);
-          }
-          tstrm.shift();
-          break;
-        }
+                if(::std::strchr("!%&()*,./:;<=>?]^|}~", ch))
+                  this->do_throw(parser_status_expression_expected, tptr, tptr + 1);
 
-        case Token::index_real_literal:
-          // Accept a number.
-          value = qtok->as_real_literal();
-          tstrm.shift();
-          break;
+                this->do_throw(parser_status_token_character_unrecognized, tptr, tptr + 1);
+              }
 
-        case Token::index_string_literal:
-          // Accept a UTF-8 string.
-          value = qtok->as_string_literal();
-          tstrm.shift();
-          break;
+              if(!this->do_accept_constant(value, 0))
+                this->do_throw(parser_status_expression_expected, tptr, this->do_skip_name(tptr));
+              break;
+            }
+          }
 
-        default:
-          throw Parser_Error(parser_status_expression_expected, tstrm.next_sloc(), tstrm.next_length());
-      }
+          // A complete value has been accepted. Insert it into its parent array or object.
+          for(;;) {
+            if(stack.empty())
+              // Accept the root value.
+              return value;
 
-      // A complete value has been accepted. Insert it into its parent array or object.
-      for(;;) {
-        if(stack.empty())
-          // Accept the root value.
-          return value;
+            if(stack.back().index() == 0) {
+              auto& ctxa = stack.mut_back().as<0>();
+              ctxa.array.emplace_back(::std::move(value));
 
-        if(stack.back().index() == 0) {
-          auto& ctxa = stack.mut_back().as<0>();
-          ctxa.array.emplace_back(::std::move(value));
-
-          // Look for the next element.
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl, punctuator_comma });
-          if(!kpunct)
-            throw Parser_Error(parser_status_closed_bracket_or_comma_expected, tstrm.next_sloc(),
-                               tstrm.next_length());
-
-          // Check for termination of this array.
-          if(*kpunct != punctuator_bracket_cl) {
-            kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl });
-            if(!kpunct) {
               // Look for the next element.
-              break;
+              ch = this->peek();
+              if(::rocket::is_none_of(ch, { ']', ',' }))
+                this->do_throw(parser_status_closed_bracket_or_comma_expected, this->m_rptr, this->m_rptr + 1);
+
+              // Check for termination of this array.
+              this->m_rptr++;
+              if((ch == ',') && !this->do_accept(']')) {
+                // Look for the next element.
+                break;
+              }
+
+              // Close this array.
+              value = ::std::move(ctxa.array);
             }
-          }
+            else {
+              auto& ctxo = stack.mut_back().as<1>();
+              ctxo.object.insert_or_assign(::std::move(ctxo.key), ::std::move(value));
 
-          // Close this array.
-          value = ::std::move(ctxa.array);
-        }
-        else {
-          auto& ctxo = stack.mut_back().as<1>();
-          ctxo.object.insert_or_assign(::std::move(ctxo.key), ::std::move(value));
-
-          // Look for the next element.
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl, punctuator_comma });
-          if(!kpunct)
-            throw Parser_Error(parser_status_closed_brace_or_comma_expected, tstrm.next_sloc(),
-                               tstrm.next_length());
-
-          // Check for termination of this array.
-          if(*kpunct != punctuator_brace_cl) {
-            kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl });
-            if(!kpunct) {
               // Look for the next element.
-              ctxo.key = do_accept_object_key(tstrm);
-              break;
+              ch = this->peek();
+              if(::rocket::is_none_of(ch, { '}', ',' }))
+                this->do_throw(parser_status_closed_brace_or_comma_expected, this->m_rptr, this->m_rptr + 1);
+
+              // Check for termination of this object.
+              this->m_rptr++;
+              if((ch == ',') && !this->do_accept('}')) {
+                // Look for the next element.
+                ctxo.key = this->do_accept_object_key();
+                break;
+              }
+
+              // Close this object.
+              value = ::std::move(ctxo.object);
             }
+            stack.pop_back();
           }
-
-          // Close this object.
-          value = ::std::move(ctxo.object);
         }
-        stack.pop_back();
       }
-    }
-  }
+  };
 
 Value
-do_json_parse(tinybuf& cbuf)
+do_json_parse(const char* bptr, const char* eptr)
   try {
-    // We reuse the lexer of Asteria here, allowing quite a few extensions e.g. binary numeric
-    // literals and comments.
-    Compiler_Options opts;
-    opts.escapable_single_quotes = true;
-    opts.keywords_as_identifiers = true;
-    opts.integers_as_reals = true;
-
-    Token_Stream tstrm(opts);
-    tstrm.reload(cbuf, ::rocket::sref("<JSON text>"));
-    if(tstrm.empty())
+    // Parse a single value.
+    JSON_Parser parser(bptr, eptr);
+    if(parser.peek() == EOF)
       ASTERIA_THROW("Empty JSON string");
 
-    // Parse a single value.
-    auto value = do_json_parse_nonrecursive(tstrm);
-    if(!tstrm.empty())
+    auto value = parser.parse_value();
+    if(parser.peek() != EOF)
       ASTERIA_THROW("Excess text at end of JSON string");
     return value;
   }
@@ -700,7 +1059,6 @@ do_json_parse(tinybuf& cbuf)
     ASTERIA_THROW("Invalid JSON string: $3 (line $1, offset $2)", except.line(), except.offset(),
                                                                   describe_parser_status(except.status()));
   }
-
 }  // namespace
 
 V_string
@@ -739,25 +1097,63 @@ Value
 std_json_parse(V_string text)
   {
     // Parse characters from the string.
-    ::rocket::tinybuf_str cbuf;
-    cbuf.set_string(text, tinybuf::open_read);
-    return do_json_parse(cbuf);
+    return do_json_parse(text.data(), text.data() + text.size());
   }
 
 Value
 std_json_parse_file(V_string path)
   {
     // Try opening the file.
-    ::rocket::unique_posix_file fp(::fopen(path.safe_c_str(), "rb"), ::fclose);
-    if(!fp)
+    ::rocket::unique_posix_fd fd(::open(path.safe_c_str(), O_RDONLY | O_CLOEXEC), ::close);
+    if(!fd)
       ASTERIA_THROW("Could not open file '$2'\n"
-                    "[`fopen()` failed: $1]",
+                    "[`open()` failed: $1]",
                     noadl::format_errno(errno), path);
 
-    // Parse characters from the file.
-    ::setbuf(fp, nullptr);
-    ::rocket::tinybuf_file cbuf(::std::move(fp));
-    return do_json_parse(cbuf);
+    struct ::stat info;
+    if(::fstat(fd, &info))
+      ASTERIA_THROW("Could not get information about file '$2'\n"
+                    "[`fstat()` failed: $1]",
+                    noadl::format_errno(errno), path);
+
+    if(S_ISREG(info.st_mode) && (info.st_size > 0)) {
+      // Map regular files into memory and parse them in place.
+      auto size = static_cast<size_t>(info.st_size);
+      void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(addr != MAP_FAILED) {
+        Value value;
+        try {
+          auto bptr = static_cast<const char*>(addr);
+          value = do_json_parse(bptr, bptr + size);
+        }
+        catch(...) {
+          ::munmap(addr, size);
+          throw;
+        }
+        ::munmap(addr, size);
+        return value;
+      }
+    }
+
+    // Read other files (such as pipes) into a string.
+    cow_string text;
+    char temp[16384];
+    for(;;) {
+      ::ssize_t nread = ::read(fd, temp, sizeof(temp));
+      if(nread == 0)
+        break;
+
+      if(nread < 0) {
+        if(errno == EINTR)
+          continue;
+
+        ASTERIA_THROW("Error reading file '$2'\n"
+                      "[`read()` failed: $1]",
+                      noadl::format_errno(errno), path);
+      }
+      text.append(temp, static_cast<size_t>(nread));
+    }
+    return do_json_parse(text.data(), text.data() + text.size());
   }
 
 void
@@ -854,7 +1250,7 @@ create_bindings_json(V_object& result, API_Version /*version*/)
 `std.json.parse(text)`
 
   * Parses a string containing data encoded in the JSON format and
-    converts it to a value. This function reuses the tokenizer of
+    converts it to a value. This function accepts the same tokens as
     Asteria and allows quite a few extensions, some of which are
     also supported by JSON5:
 
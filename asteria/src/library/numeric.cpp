@@ -1810,17 +1810,18 @@ create_bindings_numeric(V_object& result, API_Version /*version*/)
 """""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
 `std.numeric.format(value, [base], [ebase])`
 
-  * Converts an integer or real number to a string in `base`. This
-    function writes as many digits as possible to ensure precision.
-    No plus sign precedes the significant figures. If `base` is
-    absent, `10` is assumed. If `ebase` is specified, an exponent
-    is appended to the significand as follows: If `value` is of
-    type integer, the significand is kept as short as possible;
-    otherwise (when `value` is of type real), it is written in
-    scientific notation. In both cases, the exponent comprises at
-    least two digits with an explicit sign. If `ebase` is absent,
-    no exponent appears. The result is exact as long as `base` is a
-    power of two.
+  * Converts an integer or real number to a string in `base`. In
+    base `10`, a real number is written with the fewest digits
+    that convert back to the same value; in other bases, all
+    digits are written. No plus sign precedes the significant
+    figures. If `base` is absent, `10` is assumed. If `ebase` is
+    specified, an exponent is appended to the significand as
+    follows: If `value` is of type integer, the significand is
+    kept as short as possible; otherwise (when `value` is of type
+    real), it is written in scientific notation. In both cases,
+    the exponent comprises at least two digits with an explicit
+    sign. If `ebase` is absent, no exponent appears. The result is
+    exact as long as `base` is a power of two.
 
   * Returns a string converted from `value`.
 
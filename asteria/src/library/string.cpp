@@ -4,6 +4,9 @@
 #include "../precompiled.hpp"
 #include "string.hpp"
 #include "../runtime/argument_reader.hpp"
+#include "../runtime/global_context.hpp"
+#include "../runtime/regex_cache.hpp"
+#include "../llds/regex_automaton.hpp"
 #include "../utilities.hpp"
 #include <endian.h>
 #include <regex>
@@ -510,6 +513,89 @@ do_make_regex(const V_string& pattern)
     ASTERIA_THROW("Invalid regular expression (text `$1`): $2", pattern, stdex.what());
   }
 
+class Compiled_Regex
+final
+  : public Abstract_Opaque
+  {
+  private:
+    V_string m_pattern;
+    rcptr<Regex_Automaton> m_dfa;  // null if the pattern is not supported
+    ::std::regex m_regex;          // used only if `m_dfa` is null
+
+  public:
+    explicit
+    Compiled_Regex(const V_string& pattern)
+      : m_pattern(pattern)
+      {
+        // Prefer the automaton, which runs in linear time. Patterns that it does
+        // not support, such as those with back-references, are left to `std::regex`.
+        auto qdfa = ::rocket::make_refcnt<Regex_Automaton>();
+        if(qdfa->compile(pattern.data(), pattern.size()))
+          this->m_dfa = ::std::move(qdfa);
+        else
+          this->m_regex = do_make_regex(pattern);
+      }
+
+  public:
+    tinyfmt&
+    describe(tinyfmt& fmt)
+    const override
+      { return fmt << "compiled regular expression `" << this->m_pattern << "`";  }
+
+    Variable_Callback&
+    enumerate_variables(Variable_Callback& callback)
+    const override
+      { return callback;  }
+
+    Compiled_Regex*
+    clone_opt(rcptr<Abstract_Opaque>& output)
+    const override
+      {
+        auto qnew = ::rocket::make_unique<Compiled_Regex>(*this);
+        output.reset(qnew.get());
+        return qnew.release();
+      }
+
+    const V_string&
+    pattern()
+    const noexcept
+      { return this->m_pattern;  }
+
+    const Regex_Automaton*
+    automaton_opt()
+    const noexcept
+      { return this->m_dfa.get();  }
+
+    const ::std::regex&
+    regex()
+    const noexcept
+      { return this->m_regex;  }
+  };
+
+V_opaque
+do_compile_regex(Global_Context& global, const V_string& pattern)
+  {
+    // Reuse a compiled pattern if one is found in the cache.
+    auto rcache = global.regex_cache();
+    auto oregex = rcache->find_opt(pattern);
+    if(oregex)
+      return oregex;
+
+    oregex = ::rocket::make_refcnt<Compiled_Regex>(pattern);
+    rcache->insert(pattern, oregex);
+    return oregex;
+  }
+
+rcptr<const Compiled_Regex>
+do_cast_regex(const V_opaque& oregex)
+  {
+    auto qregex = oregex.cast_opt<Compiled_Regex>();
+    if(!qregex)
+      ASTERIA_THROW("Invalid dynamic cast to type `$1` from type `$2`",
+                    typeid(Compiled_Regex).name(), oregex.type().name());
+    return qregex;
+  }
+
 ::std::string
 do_make_regex_replacement(const V_string& replacement)
   {
@@ -558,6 +644,111 @@ do_regex_replace(V_string& res, IterT tbegin, IterT tend,
     return res;
   }
 
+const char*
+do_pointer_of(const V_string& text, V_string::const_iterator pos)
+  {
+    return text.data() + (pos - text.begin());
+  }
+
+// This is the native counterpart of `std::match_results::format()`.
+V_string&
+do_format_replacement(V_string& res, const V_string& replacement, const Regex_Automaton::Submatch* subs,
+                      size_t nsubs, const char* pbegin, const char* send)
+  {
+    auto append_sub = [&](size_t index)
+      {
+        if(subs[index].first)
+          res.append(subs[index].first, subs[index].second);
+      };
+
+    size_t bpos = 0;
+    for(;;) {
+      size_t epos = replacement.find('$', bpos);
+      if(epos == V_string::npos)
+        break;
+
+      res.append(replacement, bpos, epos - bpos);
+      bpos = epos + 1;
+      if(bpos == replacement.size()) {
+        res.push_back('$');
+        break;
+      }
+
+      char c = replacement[bpos];
+      if(c == '$') {
+        res.push_back('$');
+        bpos++;
+      }
+      else if(c == '&') {
+        append_sub(0);
+        bpos++;
+      }
+      else if(c == '`') {
+        res.append(pbegin, subs[0].first);
+        bpos++;
+      }
+      else if(c == '\'') {
+        res.append(subs[0].second, send);
+        bpos++;
+      }
+      else if((c >= '0') && (c <= '9')) {
+        // Up to two digits are accepted.
+        size_t index = static_cast<size_t>(c - '0');
+        bpos++;
+        if((bpos != replacement.size()) && (replacement[bpos] >= '0') && (replacement[bpos] <= '9'))
+          index = index * 10 + static_cast<size_t>(replacement[bpos++] - '0');
+        if(index < nsubs)
+          append_sub(index);
+      }
+      else
+        res.push_back('$');
+    }
+    res.append(replacement, bpos);
+    return res;
+  }
+
+V_string&
+do_regex_replace(V_string& res, const char* bptr, const char* eptr, const Regex_Automaton& dfa,
+                 const V_string& replacement)
+  {
+    // Submatches other than the entire match are only extracted if referenced.
+    size_t nsubs = 1;
+    for(size_t k = 1;  k < replacement.size();  ++k)
+      if((replacement[k-1] == '$') && (replacement[k] >= '0') && (replacement[k] <= '9'))
+        nsubs = dfa.count_groups() + 1;
+
+    cow_vector<Regex_Automaton::Submatch> subs;
+    subs.append(nsubs);
+
+    // This mimics `std::regex_replace()` with `std::regex_iterator`, including how
+    // empty matches are handled.
+    const char* pbegin = bptr;
+    const char* sp = bptr;
+    bool prev_avail = false;
+    bool found = dfa.search(subs.mut_data(), nsubs, sp, eptr, prev_avail);
+    while(found) {
+      do_format_replacement(res.append(pbegin, subs[0].first), replacement, subs.data(), nsubs,
+                            pbegin, eptr);
+      pbegin = subs[0].second;
+      sp = subs[0].second;
+
+      if(subs[0].first == subs[0].second) {
+        if(sp == eptr)
+          break;
+
+        // Try a non-empty match at the same position, then move forward. Like
+        // libstdc++, this ignores the previous character after the first match.
+        if(dfa.match_prefix(subs.mut_data(), nsubs, sp, eptr, prev_avail, true))
+          continue;
+        sp++;
+      }
+      prev_avail = true;
+      found = dfa.search(subs.mut_data(), nsubs, sp, eptr, prev_avail);
+    }
+    res.append(pbegin, eptr);
+    return res;
+  }
+
 }  // namespace
 
 V_string
@@ -1526,35 +1717,91 @@ std_string_format(V_string templ, cow_vector<Value> values)
     return fmt.extract_string();
   }
 
+V_opaque
+std_string_regex_compile(Global_Context& global, V_string pattern)
+  {
+    return do_compile_regex(global, pattern);
+  }
+
 opt<pair<V_integer, V_integer>>
-std_string_regex_find(V_string text, V_integer from, optV_integer length, V_string pattern)
+std_string_regex_find(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                      V_string pattern)
   {
+    return std_string_regex_find(::std::move(text), from, length, do_compile_regex(global, pattern));
+  }
+
+opt<pair<V_integer, V_integer>>
+std_string_regex_find(V_string text, V_integer from, optV_integer length, V_opaque regex)
+  {
+    auto qregex = do_cast_regex(regex);
     auto range = do_slice(text, from, length);
-    auto match = do_regex_search(range.first, range.second, do_make_regex(pattern));
+    if(auto qdfa = qregex->automaton_opt()) {
+      Regex_Automaton::Submatch match;
+      if(!qdfa->search(&match, 1, do_pointer_of(text, range.first), do_pointer_of(text, range.second), false))
+        return nullopt;
+      return ::std::make_pair(match.first - text.data(), match.second - match.first);
+    }
+    auto match = do_regex_search(range.first, range.second, qregex->regex());
     if(!match.matched)
       return nullopt;
     return ::std::make_pair(match.first - text.begin(), match.second - match.first);
   }
 
 optV_array
-std_string_regex_match(V_string text, V_integer from, optV_integer length, V_string pattern)
+std_string_regex_match(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                       V_string pattern)
+  {
+    return std_string_regex_match(::std::move(text), from, length, do_compile_regex(global, pattern));
+  }
+
+optV_array
+std_string_regex_match(V_string text, V_integer from, optV_integer length, V_opaque regex)
   {
+    auto qregex = do_cast_regex(regex);
     auto range = do_slice(text, from, length);
-    auto matches = do_regex_match(range.first, range.second, do_make_regex(pattern));
+    if(auto qdfa = qregex->automaton_opt()) {
+      cow_vector<Regex_Automaton::Submatch> matches;
+      matches.append(qdfa->count_groups() + 1);
+      if(!qdfa->match(matches.mut_data(), matches.size(), do_pointer_of(text, range.first),
+                      do_pointer_of(text, range.second)))
+        return nullopt;
+
+      V_array rval(matches.size());
+      for(size_t i = 0;  i < matches.size();  ++i) {
+        const auto& m = matches[i];
+        if(m.first)
+          rval.mut(i) = V_string(m.first, m.second);
+      }
+      return ::std::move(rval);
+    }
+    auto matches = do_regex_match(range.first, range.second, qregex->regex());
     if(matches.empty())
       return nullopt;
     return do_regex_copy_matches(matches);
   }
 
 V_string
-std_string_regex_replace(V_string text, V_integer from, optV_integer length, V_string pattern,
+std_string_regex_replace(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                         V_string pattern, V_string replacement)
+  {
+    return std_string_regex_replace(::std::move(text), from, length, do_compile_regex(global, pattern),
+                                    ::std::move(replacement));
+  }
+
+V_string
+std_string_regex_replace(V_string text, V_integer from, optV_integer length, V_opaque regex,
                          V_string replacement)
   {
+    auto qregex = do_cast_regex(regex);
     V_string res;
     auto range = do_slice(text, from, length);
     res.append(text.begin(), range.first);
-    do_regex_replace(res, range.first, range.second, do_make_regex(pattern),
-                          do_make_regex_replacement(replacement));
+    if(auto qdfa = qregex->automaton_opt())
+      do_regex_replace(res, do_pointer_of(text, range.first), do_pointer_of(text, range.second),
+                            *qdfa, replacement);
+    else
+      do_regex_replace(res, range.first, range.second, qregex->regex(),
+                            do_make_regex_replacement(replacement));
     res.append(range.second, text.end());
     return res;
   }
@@ -3421,6 +3668,44 @@ create_bindings_string(V_object& result, API_Version /*version*/)
   }
       ));
 
+    //===================================================================
+    // `std.string.regex_compile()`
+    //===================================================================
+    result.insert_or_assign(::rocket::sref("regex_compile"),
+      V_function(
+"""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
+`std.string.regex_compile(pattern)`
+
+  * Compiles the regular expression `pattern`. The result can be
+    passed to `regex_find()`, `regex_match()` and `regex_replace()`
+    in place of `pattern`, so it need not be compiled again. Those
+    functions also keep a bounded number of patterns that have
+    been passed as strings in a cache.
+
+  * Matching takes time linear in the length of the text for most
+    patterns. Back-references, lookahead assertions and a few other
+    rare constructs are matched by backtracking, which may take
+    exponential time.
+
+  * Returns a compiled regular expression as an opaque value.
+
+  * Throws an exception if `pattern` is not a valid regular
+    expression.
+)'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
+  {
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.string.regex_compile"));
+    // Parse arguments.
+    V_string pattern;
+    if(reader.I().v(pattern).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_compile(global, ::std::move(pattern)) };
+      return self = ::std::move(xref);
+    }
+    // Fail.
+    reader.throw_no_matching_function_call();
+  }
+      ));
+
     //===================================================================
     // `std.string.regex_find()`
     //===================================================================
@@ -3469,7 +3754,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
   * Throws an exception if `pattern` is not a valid regular
     expression.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
-*[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.string.regex_find"));
     Argument_Reader::State state;
@@ -3477,7 +3762,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     V_string text;
     V_string pattern;
     if(reader.I().v(text).S(state).v(pattern).F()) {
-      auto kpair = std_string_regex_find(::std::move(text), 0, nullopt, ::std::move(pattern));
+      auto kpair = std_string_regex_find(global, ::std::move(text), 0, nullopt, ::std::move(pattern));
       if(!kpair)
         return self = Reference_root::S_temporary();
       // The binding function returns a `pair`, but we would like to return an array so convert it.
@@ -3486,7 +3771,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     }
     V_integer from;
     if(reader.L(state).v(from).S(state).v(pattern).F()) {
-      auto kpair = std_string_regex_find(::std::move(text), from, nullopt, ::std::move(pattern));
+      auto kpair = std_string_regex_find(global, ::std::move(text), from, nullopt, ::std::move(pattern));
       if(!kpair)
         return self = Reference_root::S_temporary();
       // The binding function returns a `pair`, but we would like to return an array so convert it.
@@ -3495,7 +3780,32 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     }
     optV_integer length;
     if(reader.L(state).o(length).v(pattern).F()) {
-      auto kpair = std_string_regex_find(::std::move(text), from, length, ::std::move(pattern));
+      auto kpair = std_string_regex_find(global, ::std::move(text), from, length, ::std::move(pattern));
+      if(!kpair)
+        return self = Reference_root::S_temporary();
+      // The binding function returns a `pair`, but we would like to return an array so convert it.
+      Reference_root::S_temporary xref = { { kpair->first, kpair->second } };
+      return self = ::std::move(xref);
+    }
+    V_opaque regex;
+    if(reader.I().v(text).S(state).v(regex).F()) {
+      auto kpair = std_string_regex_find(::std::move(text), 0, nullopt, ::std::move(regex));
+      if(!kpair)
+        return self = Reference_root::S_temporary();
+      // The binding function returns a `pair`, but we would like to return an array so convert it.
+      Reference_root::S_temporary xref = { { kpair->first, kpair->second } };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).v(from).S(state).v(regex).F()) {
+      auto kpair = std_string_regex_find(::std::move(text), from, nullopt, ::std::move(regex));
+      if(!kpair)
+        return self = Reference_root::S_temporary();
+      // The binding function returns a `pair`, but we would like to return an array so convert it.
+      Reference_root::S_temporary xref = { { kpair->first, kpair->second } };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).o(length).v(regex).F()) {
+      auto kpair = std_string_regex_find(::std::move(text), from, length, ::std::move(regex));
       if(!kpair)
         return self = Reference_root::S_temporary();
       // The binding function returns a `pair`, but we would like to return an array so convert it.
@@ -3558,7 +3868,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
   * Throws an exception if `pattern` is not a valid regular
     expression.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
-*[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.string.regex_match"));
     Argument_Reader::State state;
@@ -3566,22 +3876,38 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     V_string text;
     V_string pattern;
     if(reader.I().v(text).S(state).v(pattern).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), 0, nullopt,
+      Reference_root::S_temporary xref = { std_string_regex_match(global, ::std::move(text), 0, nullopt,
                                                                   ::std::move(pattern)) };
       return self = ::std::move(xref);
     }
     V_integer from;
     if(reader.L(state).v(from).S(state).v(pattern).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), from, nullopt,
+      Reference_root::S_temporary xref = { std_string_regex_match(global, ::std::move(text), from, nullopt,
                                                                   ::std::move(pattern)) };
       return self = ::std::move(xref);
     }
     optV_integer length;
     if(reader.L(state).o(length).v(pattern).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), from, length,
+      Reference_root::S_temporary xref = { std_string_regex_match(global, ::std::move(text), from, length,
                                                                   ::std::move(pattern)) };
       return self = ::std::move(xref);
     }
+    V_opaque regex;
+    if(reader.I().v(text).S(state).v(regex).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), 0, nullopt,
+                                                                  ::std::move(regex)) };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).v(from).S(state).v(regex).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), from, nullopt,
+                                                                  ::std::move(regex)) };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).o(length).v(regex).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_match(::std::move(text), from, length,
+                                                                  ::std::move(regex)) };
+      return self = ::std::move(xref);
+    }
     // Fail.
     reader.throw_no_matching_function_call();
   }
@@ -3633,7 +3959,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
   * Throws an exception if `pattern` is not a valid regular
     expression.
 )'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
-*[](Reference& self, cow_vector<Reference>&& args, Global_Context& /*global*/) -> Reference&
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
   {
     Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.string.regex_replace"));
     Argument_Reader::State state;
@@ -3642,22 +3968,38 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     V_string pattern;
     V_string replacement;
     if(reader.I().v(text).S(state).v(pattern).v(replacement).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), 0, nullopt,
+      Reference_root::S_temporary xref = { std_string_regex_replace(global, ::std::move(text), 0, nullopt,
                                                           ::std::move(pattern), ::std::move(replacement)) };
       return self = ::std::move(xref);
     }
     V_integer from;
     if(reader.L(state).v(from).S(state).v(pattern).v(replacement).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), from, nullopt,
+      Reference_root::S_temporary xref = { std_string_regex_replace(global, ::std::move(text), from, nullopt,
                                                            ::std::move(pattern), ::std::move(replacement)) };
       return self = ::std::move(xref);
     }
     optV_integer length;
     if(reader.L(state).o(length).v(pattern).v(replacement).F()) {
-      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), from, length,
+      Reference_root::S_temporary xref = { std_string_regex_replace(global, ::std::move(text), from, length,
                                                            ::std::move(pattern), ::std::move(replacement)) };
       return self = ::std::move(xref);
     }
+    V_opaque regex;
+    if(reader.I().v(text).S(state).v(regex).v(replacement).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), 0, nullopt,
+                                                            ::std::move(regex), ::std::move(replacement)) };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).v(from).S(state).v(regex).v(replacement).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), from, nullopt,
+                                                            ::std::move(regex), ::std::move(replacement)) };
+      return self = ::std::move(xref);
+    }
+    if(reader.L(state).o(length).v(regex).v(replacement).F()) {
+      Reference_root::S_temporary xref = { std_string_regex_replace(::std::move(text), from, length,
+                                                            ::std::move(regex), ::std::move(replacement)) };
+      return self = ::std::move(xref);
+    }
     // Fail.
     reader.throw_no_matching_function_call();
   }
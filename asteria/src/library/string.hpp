@@ -245,17 +245,33 @@ std_string_unpack_64le(V_string text);
 V_string
 std_string_format(V_string templ, cow_vector<Value> values);
 
-// `std.stringval`.
+// `std.string.regex_compile`
+V_opaque
+std_string_regex_compile(Global_Context& global, V_string pattern);
+
+// `std.string.regex_find`
+opt<pair<V_integer, V_integer>>
+std_string_regex_find(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                      V_string pattern);
+
 opt<pair<V_integer, V_integer>>
-std_string_regex_find(V_string text, V_integer from, optV_integer length, V_string pattern);
+std_string_regex_find(V_string text, V_integer from, optV_integer length, V_opaque regex);
 
 // `std.string.regex_match`
 optV_array
-std_string_regex_match(V_string text, V_integer from, optV_integer length, V_string pattern);
+std_string_regex_match(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                       V_string pattern);
+
+optV_array
+std_string_regex_match(V_string text, V_integer from, optV_integer length, V_opaque regex);
 
 // `std.string.regex_replace`
 V_string
-std_string_regex_replace(V_string text, V_integer from, optV_integer length, V_string pattern,
+std_string_regex_replace(Global_Context& global, V_string text, V_integer from, optV_integer length,
+                         V_string pattern, V_string replacement);
+
+V_string
+std_string_regex_replace(V_string text, V_integer from, optV_integer length, V_opaque regex,
                          V_string replacement);
 
 // Create an object that is to be referenced as `std.string`.
@@ -7,6 +7,7 @@
 #include "../runtime/global_context.hpp"
 #include "../runtime/genius_collector.hpp"
 #include "../runtime/random_engine.hpp"
+#include "../runtime/variable.hpp"
 #include "../utilities.hpp"
 #include <spawn.h>  // ::posix_spawnp()
 #include <sys/wait.h>  // ::waitpid()
@@ -20,6 +21,88 @@ constexpr int64_t xgcgen_newest = static_cast<int64_t>(gc_generation_newest);
 constexpr int64_t xgcgen_oldest = static_cast<int64_t>(gc_generation_oldest);
 constexpr char s_hex_digits[] = "00112233445566778899AaBbCcDdEeFf";
 
+const char*
+do_describe_adaptation(Collector::Adaptation adapt)
+noexcept
+  {
+    switch(adapt) {
+      case Collector::adaptation_none:
+        return "none";
+
+      case Collector::adaptation_keep:
+        return "keep";
+
+      case Collector::adaptation_grow_survival:
+        return "grow_survival";
+
+      case Collector::adaptation_grow_heap:
+        return "grow_heap";
+
+      case Collector::adaptation_shrink_pause:
+        return "shrink_pause";
+
+      default:
+        return "<unknown>";
+    }
+  }
+
+V_object
+do_describe_policy(const Genius_Collector& gcoll, GC_Generation gc_gen)
+  {
+    const auto& coll = gcoll.get_collector(gc_gen);
+
+    V_object policy;
+    policy.try_emplace(::rocket::sref("adaptive"),
+      V_boolean(
+        coll.is_adaptive()  // whether the threshold is adjusted automatically
+      ));
+    policy.try_emplace(::rocket::sref("threshold"),
+      V_integer(
+        coll.get_threshold()  // current threshold
+      ));
+    policy.try_emplace(::rocket::sref("threshold_min"),
+      V_integer(
+        coll.get_threshold_min()  // lower bound of the threshold
+      ));
+    policy.try_emplace(::rocket::sref("threshold_max"),
+      V_integer(
+        coll.get_threshold_max()  // upper bound of the threshold
+      ));
+    policy.try_emplace(::rocket::sref("pause_target"),
+      V_real(
+        coll.get_pause_target()  // longest pause desired, in milliseconds
+      ));
+    policy.try_emplace(::rocket::sref("pause_time"),
+      V_real(
+        coll.get_pause_time()  // smoothed pause time, in milliseconds
+      ));
+    policy.try_emplace(::rocket::sref("survival_ratio"),
+      V_real(
+        ::rocket::max(coll.get_survival_ratio(), 0.0)  // smoothed ratio of variables that survived
+      ));
+    policy.try_emplace(::rocket::sref("examined"),
+      V_integer(
+        static_cast<int64_t>(coll.get_last_examined())  // variables examined by the last collection
+      ));
+    policy.try_emplace(::rocket::sref("collected"),
+      V_integer(
+        static_cast<int64_t>(coll.get_last_collected())  // variables collected by the last collection
+      ));
+    policy.try_emplace(::rocket::sref("decision"),
+      V_string(
+        ::rocket::sref(do_describe_adaptation(coll.get_last_adaptation()))  // how the threshold was adjusted
+      ));
+    policy.try_emplace(::rocket::sref("pool_size"),
+      V_integer(
+        static_cast<int64_t>(gcoll.get_pool_size())  // variables available for reuse
+      ));
+    policy.try_emplace(::rocket::sref("parallelism"),
+      V_integer(
+        static_cast<int64_t>(gcoll.get_parallelism())  // threads for full collections
+      ));
+    return policy;
+  }
+
 }  // namespace
 
 optV_integer
@@ -57,11 +140,57 @@ std_system_gc_set_threshold(Global_Context& global, V_integer generation, V_inte
 
     // Set the threshold and return its old value.
     auto gcoll = global.genius_collector();
+    // This also disables adaptive thresholds for this generation.
     uint32_t thres = gcoll->get_collector(gc_gen).get_threshold();
-    gcoll->open_collector(gc_gen).set_threshold(static_cast<uint32_t>(::rocket::clamp(threshold, 0, INT32_MAX)));
+    gcoll->open_collector(gc_gen).set_threshold(static_cast<uint32_t>(::rocket::clamp(threshold, 0, INT32_MAX)))
+                                 .set_adaptive(false);
     return static_cast<int64_t>(thres);
   }
 
+optV_object
+std_system_gc_get_policy(Global_Context& global, V_integer generation)
+  {
+    auto gc_gen = static_cast<GC_Generation>(::rocket::clamp(generation, xgcgen_newest, xgcgen_oldest));
+    if(gc_gen != generation)
+      return nullopt;
+
+    auto gcoll = global.genius_collector();
+    return do_describe_policy(*gcoll, gc_gen);
+  }
+
+optV_object
+std_system_gc_set_policy(Global_Context& global, V_integer generation, V_boolean adaptive,
+                         optV_integer threshold_min, optV_integer threshold_max, optV_real pause_target,
+                         optV_integer parallelism)
+  {
+    auto gc_gen = static_cast<GC_Generation>(::rocket::clamp(generation, xgcgen_newest, xgcgen_oldest));
+    if(gc_gen != generation)
+      return nullopt;
+
+    // Set the policy and return the old one.
+    auto gcoll = global.genius_collector();
+    auto policy = do_describe_policy(*gcoll, gc_gen);
+    auto& coll = gcoll->open_collector(gc_gen);
+
+    uint32_t thres_min = coll.get_threshold_min();
+    if(threshold_min)
+      thres_min = static_cast<uint32_t>(::rocket::clamp(*threshold_min, 0, INT32_MAX));
+    uint32_t thres_max = coll.get_threshold_max();
+    if(threshold_max)
+      thres_max = static_cast<uint32_t>(::rocket::clamp(*threshold_max, 0, INT32_MAX));
+    coll.set_threshold_bounds(thres_min, thres_max);
+
+    if(pause_target)
+      coll.set_pause_target(::rocket::max(*pause_target, 0.0));
+    coll.set_adaptive(adaptive);
+
+    // Worker threads are shared by all generations.
+    if(parallelism)
+      gcoll->set_parallelism(static_cast<size_t>(::rocket::clamp(*parallelism, 1,
+                                     static_cast<int64_t>(GC_Workers::parallelism_max))));
+    return ::std::move(policy);
+  }
+
 V_integer
 std_system_gc_collect(Global_Context& global, optV_integer generation_limit)
   {
@@ -77,6 +206,115 @@ std_system_gc_collect(Global_Context& global, optV_integer generation_limit)
     return static_cast<int64_t>(nvars);
   }
 
+V_boolean
+std_system_gc_step(Global_Context& global, optV_integer budget, optV_real time_limit)
+  {
+    // If only a time limit is specified, the amount of work is not limited.
+    size_t work = 1000;
+    if(budget)
+      work = static_cast<size_t>(::rocket::clamp(*budget, 0, INT32_MAX));
+    else if(time_limit)
+      work = SIZE_MAX;
+
+    auto gcoll = global.genius_collector();
+    if(!time_limit)
+      return gcoll->collect_step(work);
+
+    // Perform collection in small chunks, checking the clock in between.
+    ::timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    double deadline = static_cast<double>(ts.tv_sec) * 1.0e3 + static_cast<double>(ts.tv_nsec) / 1.0e6 +
+                      *time_limit;
+    for(;;) {
+      size_t chunk = ::rocket::min(work, size_t(256));
+      work -= chunk;
+      if(gcoll->collect_step(chunk))
+        return true;
+
+      if(work == 0)
+        return false;
+
+      ::clock_gettime(CLOCK_MONOTONIC, &ts);
+      if(static_cast<double>(ts.tv_sec) * 1.0e3 + static_cast<double>(ts.tv_nsec) / 1.0e6 >= deadline)
+        return false;
+    }
+  }
+
+V_object
+std_system_gc_stats(Global_Context& global)
+  {
+    auto gcoll = global.genius_collector();
+    auto stats = gcoll->get_stats();
+    auto slab = Variable::get_slab_stats();
+
+    V_object result;
+    V_array gens;
+    for(const auto& gen : stats.gens) {
+      V_object obj;
+      obj.try_emplace(::rocket::sref("collections"),
+        V_integer(
+          static_cast<int64_t>(gen.ncollections)  // number of collections completed
+        ));
+      obj.try_emplace(::rocket::sref("examined"),
+        V_integer(
+          static_cast<int64_t>(gen.nexamined)  // number of variables examined
+        ));
+      obj.try_emplace(::rocket::sref("collected"),
+        V_integer(
+          static_cast<int64_t>(gen.ncollected)  // number of variables collected
+        ));
+      obj.try_emplace(::rocket::sref("promoted"),
+        V_integer(
+          static_cast<int64_t>(gen.npromoted)  // number of variables moved into the next generation
+        ));
+      obj.try_emplace(::rocket::sref("bytes_freed"),
+        V_integer(
+          static_cast<int64_t>(gen.nbytes_freed)  // approximate number of bytes of values
+        ));
+      obj.try_emplace(::rocket::sref("pause_total"),
+        V_real(
+          gen.pause_total  // sum of pause times, in milliseconds
+        ));
+      obj.try_emplace(::rocket::sref("pause_max"),
+        V_real(
+          gen.pause_max  // longest pause time, in milliseconds
+        ));
+      V_array hist;
+      for(auto count : gen.pause_hist)
+        hist.emplace_back(V_integer(static_cast<int64_t>(count)));
+      obj.try_emplace(::rocket::sref("pause_histogram"), ::std::move(hist));
+      gens.emplace_back(::std::move(obj));
+    }
+    result.try_emplace(::rocket::sref("generations"), ::std::move(gens));
+
+    V_array bounds;
+    for(size_t k = 0;  k != Collector::pause_bucket_count;  ++k)
+      bounds.emplace_back(V_real(Collector::get_pause_bucket_limit(k)));
+    result.try_emplace(::rocket::sref("pause_buckets"), ::std::move(bounds));
+
+    result.try_emplace(::rocket::sref("pool_hits"),
+      V_integer(
+        static_cast<int64_t>(stats.npool_hits)  // number of variables reused from the pool
+      ));
+    result.try_emplace(::rocket::sref("fresh_allocs"),
+      V_integer(
+        static_cast<int64_t>(stats.nfresh_allocs)  // number of variables allocated anew
+      ));
+    result.try_emplace(::rocket::sref("pool_size"),
+      V_integer(
+        static_cast<int64_t>(gcoll->get_pool_size())  // number of variables available for reuse
+      ));
+    result.try_emplace(::rocket::sref("live_variables"),
+      V_integer(
+        static_cast<int64_t>(slab.nlive)  // number of variables allocated and not freed, process-wide
+      ));
+    result.try_emplace(::rocket::sref("bytes_mapped"),
+      V_integer(
+        static_cast<int64_t>(slab.nbytes)  // number of bytes of memory for variables, process-wide
+      ));
+    return result;
+  }
+
 V_integer
 std_system_execute(V_string cmd, optV_array argv, optV_array envp)
   {
@@ -284,6 +522,7 @@ create_bindings_system(V_object& result, API_Version /*version*/)
     silently without failure. A larger `threshold` makes garbage
     collection run less often but slower. Setting `threshold` to
     `0` ensures all unreachable variables be collected immediately.
+    This disables adaptive thresholds for `generation`.
 
   * Returns the threshold before the call. If `generation` is not
     valid, `null` is returned.
@@ -304,6 +543,101 @@ create_bindings_system(V_object& result, API_Version /*version*/)
   }
       ));
 
+    //===================================================================
+    // `std.system.gc_get_policy()`
+    //===================================================================
+    result.insert_or_assign(::rocket::sref("gc_get_policy"),
+      V_function(
+"""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
+`std.system.gc_get_policy(generation)`
+
+  * Gets the threshold policy of the collector for `generation`.
+    Valid values for `generation` are `0`, `1` and `2`.
+
+  * Returns an object with these fields:
+    * `adaptive`        whether the threshold is adjusted
+                        automatically
+    * `threshold`       current threshold
+    * `threshold_min`   lower bound of the threshold
+    * `threshold_max`   upper bound of the threshold
+    * `pause_target`    longest pause desired, in milliseconds
+    * `pause_time`      smoothed pause time, in milliseconds
+    * `survival_ratio`  smoothed ratio of variables that survived
+    * `examined`        number of variables examined by the last
+                        collection
+    * `collected`       number of variables collected by the last
+                        collection
+    * `decision`        how the threshold was adjusted after the
+                        last collection, which is one of `"none"`,
+                        `"keep"`, `"grow_survival"`, `"grow_heap"`
+                        and `"shrink_pause"`
+    * `pool_size`       number of variables available for reuse
+    * `parallelism`     number of threads for full collections,
+                        which is shared by all generations
+    If `generation` is not valid, `null` is returned.
+)'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
+  {
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.system.gc_get_policy"));
+    // Parse arguments.
+    V_integer generation;
+    if(reader.I().v(generation).F()) {
+      Reference_root::S_temporary xref = { std_system_gc_get_policy(global, ::std::move(generation)) };
+      return self = ::std::move(xref);
+    }
+    // Fail.
+    reader.throw_no_matching_function_call();
+  }
+      ));
+
+    //===================================================================
+    // `std.system.gc_set_policy()`
+    //===================================================================
+    result.insert_or_assign(::rocket::sref("gc_set_policy"),
+      V_function(
+"""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
+`std.system.gc_set_policy(generation, adaptive, [threshold_min], [threshold_max], [pause_target], [parallelism])`
+
+  * Sets the threshold policy of the collector for `generation`.
+    Valid values for `generation` are `0`, `1` and `2`. If
+    `adaptive` is `true`, the threshold is adjusted after each
+    collection: it is lowered if pauses exceed `pause_target`
+    milliseconds, and raised if most variables survive, but it is
+    no less than a quarter of the number of variables being tracked.
+    The threshold is kept within `threshold_min` and `threshold_max`
+    in all cases. `parallelism` is the number of threads, including
+    the calling one, that count references and mark variables in
+    full collections of large heaps. It applies to all generations.
+    Threads that cannot be started are left out. Absent arguments
+    leave the corresponding settings unchanged.
+
+  * Returns the policy before the call, as an object described in
+    `gc_get_policy()`. If `generation` is not valid, `null` is
+    returned.
+)'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
+  {
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.system.gc_set_policy"));
+    // Parse arguments.
+    V_integer generation;
+    V_boolean adaptive;
+    optV_integer threshold_min;
+    optV_integer threshold_max;
+    optV_real pause_target;
+    optV_integer parallelism;
+    if(reader.I().v(generation).v(adaptive).o(threshold_min).o(threshold_max).o(pause_target)
+                 .o(parallelism).F()) {
+      Reference_root::S_temporary xref = { std_system_gc_set_policy(global, ::std::move(generation),
+                                                 ::std::move(adaptive), ::std::move(threshold_min),
+                                                 ::std::move(threshold_max), ::std::move(pause_target),
+                                                 ::std::move(parallelism)) };
+      return self = ::std::move(xref);
+    }
+    // Fail.
+    reader.throw_no_matching_function_call();
+  }
+      ));
+
     //===================================================================
     // `std.system.gc_collect()`
     //===================================================================
@@ -333,6 +667,96 @@ create_bindings_system(V_object& result, API_Version /*version*/)
   }
       ));
 
+    //===================================================================
+    // `std.system.gc_step()`
+    //===================================================================
+    result.insert_or_assign(::rocket::sref("gc_step"),
+      V_function(
+"""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
+`std.system.gc_step([budget], [time_limit])`
+
+  * Performs a step of incremental garbage collection, which
+    processes about `budget` variables. If no collection is in
+    progress, a new one is started from the newest generation whose
+    threshold has been exceeded. If `time_limit` is specified, this
+    function also returns after about `time_limit` milliseconds. The
+    default `budget` is `1000`, unless only `time_limit` is
+    specified, in which case there is no limit on the number of
+    variables. The collection in progress is resumed by the next
+    call to this function.
+
+  * Returns `true` if the collection has completed, or `false` if
+    there is more work to do.
+)'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
+  {
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.system.gc_step"));
+    // Parse arguments.
+    optV_integer budget;
+    optV_real time_limit;
+    if(reader.I().o(budget).o(time_limit).F()) {
+      Reference_root::S_temporary xref = { std_system_gc_step(global, ::std::move(budget),
+                                                              ::std::move(time_limit)) };
+      return self = ::std::move(xref);
+    }
+    // Fail.
+    reader.throw_no_matching_function_call();
+  }
+      ));
+
+    //===================================================================
+    // `std.system.gc_stats()`
+    //===================================================================
+    result.insert_or_assign(::rocket::sref("gc_stats"),
+      V_function(
+"""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
+`std.system.gc_stats()`
+
+  * Gets statistics of garbage collection and allocation of
+    variables, which have been accumulated since the global context
+    was created. The exceptions are `live_variables` and
+    `bytes_mapped`, which describe the allocator that is shared by
+    all global contexts in the current process.
+
+  * Returns an object with these fields:
+    * `generations`     an array of three objects, one for each
+                        generation, with these fields:
+      * `collections`     number of collections completed
+      * `examined`        number of variables examined
+      * `collected`       number of variables collected
+      * `promoted`        number of variables that have been moved
+                          into the next generation
+      * `bytes_freed`     approximate number of bytes of values of
+                          collected variables
+      * `pause_total`     sum of pause times, in milliseconds
+      * `pause_max`       longest pause time, in milliseconds
+      * `pause_histogram` an array of numbers of collections, counted
+                          by pause time according to `pause_buckets`
+    * `pause_buckets`   an array of upper bounds of pause times in
+                        milliseconds, one for each element in
+                        `pause_histogram`; the last one is infinity
+    * `pool_hits`       number of variables reused from the pool
+    * `fresh_allocs`    number of variables allocated anew
+    * `pool_size`       number of variables available for reuse
+    * `live_variables`  number of variables in the current process
+                        that have been allocated and not freed,
+                        including those in pools
+    * `bytes_mapped`    number of bytes of memory for variables in
+                        the current process
+)'''''''''''''''" """""""""""""""""""""""""""""""""""""""""""""""",
+*[](Reference& self, cow_vector<Reference>&& args, Global_Context& global) -> Reference&
+  {
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("std.system.gc_stats"));
+    // Parse arguments.
+    if(reader.I().F()) {
+      Reference_root::S_temporary xref = { std_system_gc_stats(global) };
+      return self = ::std::move(xref);
+    }
+    // Fail.
+    reader.throw_no_matching_function_call();
+  }
+      ));
+
     //===================================================================
     // `std.system.execute()`
     //===================================================================
@@ -20,10 +20,28 @@ std_system_gc_get_threshold(Global_Context& global, V_integer generation);
 optV_integer
 std_system_gc_set_threshold(Global_Context& global, V_integer generation, V_integer threshold);
 
+// `std.system.gc_get_policy`
+optV_object
+std_system_gc_get_policy(Global_Context& global, V_integer generation);
+
+// `std.system.gc_set_policy`
+optV_object
+std_system_gc_set_policy(Global_Context& global, V_integer generation, V_boolean adaptive,
+                         optV_integer threshold_min, optV_integer threshold_max, optV_real pause_target,
+                         optV_integer parallelism);
+
 // `std.system.gc_collect`
 V_integer
 std_system_gc_collect(Global_Context& global, optV_integer generation_limit);
 
+// `std.system.gc_step`
+V_boolean
+std_system_gc_step(Global_Context& global, optV_integer budget, optV_real time_limit);
+
+// `std.system.gc_stats`
+V_object
+std_system_gc_stats(Global_Context& global);
+
 // `std.system.execute`
 V_integer
 std_system_execute(V_string path, optV_array argv, optV_array envp);
@@ -240,6 +240,34 @@ AVMC_Queue::
 execute(Executive_Context& ctx)
 const
   {
+#if defined(ASTERIA_ENABLE_COMPUTED_GOTO) && defined(__GNUC__)
+    // This is the threaded implementation.
+    // Each node jumps to the next one directly, and the exception handler is only
+    // installed once. `qnode` always points to the node being executed, so the
+    // failing node can be recovered from it.
+    auto eptr = this->m_bptr + this->m_used;
+    auto qnode = this->m_bptr;
+    ASTERIA_RUNTIME_TRY {
+      static void* const s_jump[] = { &&do_return_, &&do_dispatch_ };
+      AIR_Status status = air_status_next;
+      goto *s_jump[qnode != eptr];
+
+    do_dispatch_:
+      // Call the executor function for this node.
+      status = qnode->executor()(ctx, qnode->uparam(), qnode->sparam());
+      qnode += qnode->total_size_in_headers();
+      goto *s_jump[(status == air_status_next) & (qnode != eptr)];
+
+    do_return_:
+      return status;
+    }
+    ASTERIA_RUNTIME_CATCH(Runtime_Error& except) {
+      if(auto qsyms = qnode->syms_opt())
+        except.push_frame_plain(qsyms->sloc, ::rocket::sref(""));
+      throw;
+    }
+#else
+    // This is the portable implementation.
     auto eptr = this->m_bptr + this->m_used;
     auto next = this->m_bptr;
     while(ROCKET_EXPECT(next != eptr)) {
@@ -260,6 +288,7 @@ const
         return status;
     }
     return air_status_next;
+#endif
   }
 
 Variable_Callback&
@@ -0,0 +1,1725 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "regex_automaton.hpp"
+#include "../utilities.hpp"
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
+namespace asteria {
+namespace {
+
+using Inst = Regex_Automaton::Inst;
+using Byte_Set = Regex_Automaton::Byte_Set;
+using Submatch = Regex_Automaton::Submatch;
+
+enum : uint8_t
+  {
+    op_set     = 0,  // consume a byte in set `arg`, then go to `x`
+    op_split   = 1,  // go to `x`, or to `y` with a lower priority
+    op_save    = 2,  // store the current position into capture slot `arg`, then go to `x`
+    op_assert  = 3,  // check assertion `arg`, then go to `x`
+    op_match   = 4,
+  };
+
+enum : uint8_t
+  {
+    assert_left_edge   = 0,  // `^` forwards, or `$` backwards
+    assert_right_edge  = 1,  // `$` forwards, or `^` backwards
+    assert_word        = 2,  // `\b`
+    assert_not_word    = 3,  // `\B`
+  };
+
+// Assertions only need to know whether either side of a position is an edge of the
+// subject, a word character or another character.
+enum : int
+  {
+    ctx_edge   = 0,
+    ctx_other  = 1,
+    ctx_word   = 2,
+  };
+
+// These are limits of patterns that are accepted. Larger ones are left to `std::regex`.
+constexpr uint32_t s_max_depth = 256;
+constexpr uint32_t s_max_count = 1000;
+constexpr size_t s_max_insts = 100000;
+
+// This is the maximum number of transitions of each DFA. If it is exceeded, the DFA
+// is discarded and the NFA is simulated instead.
+constexpr size_t s_max_trans = 1 << 16;
+
+// These are classes of the "C" locale, which `std::regex` uses by default.
+constexpr bool
+do_is_digit(uint32_t c) noexcept
+  { return (c - '0') < 10;  }
+
+constexpr bool
+do_is_upper(uint32_t c) noexcept
+  { return (c - 'A') < 26;  }
+
+constexpr bool
+do_is_lower(uint32_t c) noexcept
+  { return (c - 'a') < 26;  }
+
+constexpr bool
+do_is_alpha(uint32_t c) noexcept
+  { return do_is_upper(c) || do_is_lower(c);  }
+
+constexpr bool
+do_is_alnum(uint32_t c) noexcept
+  { return do_is_alpha(c) || do_is_digit(c);  }
+
+constexpr bool
+do_is_word(uint32_t c) noexcept
+  { return do_is_alnum(c) || (c == '_');  }
+
+constexpr bool
+do_is_xdigit(uint32_t c) noexcept
+  { return do_is_digit(c) || ((c | 0x20) - 'a' < 6);  }
+
+constexpr bool
+do_is_space(uint32_t c) noexcept
+  { return ((c - '\t') < 5) || (c == ' ');  }
+
+constexpr bool
+do_is_blank(uint32_t c) noexcept
+  { return (c == '\t') || (c == ' ');  }
+
+constexpr bool
+do_is_cntrl(uint32_t c) noexcept
+  { return (c < 0x20) || (c == 0x7F);  }
+
+constexpr bool
+do_is_print(uint32_t c) noexcept
+  { return (c - 0x20) < 0x5F;  }
+
+constexpr bool
+do_is_graph(uint32_t c) noexcept
+  { return (c - 0x21) < 0x5E;  }
+
+constexpr bool
+do_is_punct(uint32_t c) noexcept
+  { return do_is_graph(c) && !do_is_alnum(c);  }
+
+inline
+int
+do_ctx_of(uint8_t c) noexcept
+  { return do_is_word(c) ? ctx_word : ctx_other;  }
+
+inline
+bool
+do_test_set(const Byte_Set& set, uint8_t c) noexcept
+  { return (set.bits[c / 64] >> (c % 64)) & 1;  }
+
+inline
+void
+do_add_set(Byte_Set& set, uint8_t c) noexcept
+  { set.bits[c / 64] |= UINT64_C(1) << (c % 64);  }
+
+template<typename PredT>
+Byte_Set
+do_make_set(PredT&& pred)
+  {
+    Byte_Set set = { };
+    for(uint32_t c = 0;  c != 256;  ++c)
+      if(pred(c))
+        do_add_set(set, static_cast<uint8_t>(c));
+    return set;
+  }
+
+Byte_Set&
+do_invert_set(Byte_Set& set) noexcept
+  {
+    for(auto& word : set.bits)
+      word = ~word;
+    return set;
+  }
+
+Byte_Set&
+do_merge_set(Byte_Set& set, const Byte_Set& other) noexcept
+  {
+    for(size_t k = 0;  k != 4;  ++k)
+      set.bits[k] |= other.bits[k];
+    return set;
+  }
+
+bool
+do_check_assert(uint32_t kind, int lctx, int rctx) noexcept
+  {
+    switch(kind) {
+      case assert_left_edge:
+        return lctx == ctx_edge;
+
+      case assert_right_edge:
+        return rctx == ctx_edge;
+
+      case assert_word:
+        return (lctx == ctx_word) != (rctx == ctx_word);
+
+      case assert_not_word:
+        return (lctx == ctx_word) == (rctx == ctx_word);
+
+      default:
+        ROCKET_ASSERT(false);
+    }
+  }
+
+// This is a set of instruction indices which remembers the order of insertion. It
+// can be cleared in constant time.
+struct Sparse_Set
+  {
+    cow_vector<uint32_t> dense;
+    cow_vector<uint32_t> sparse;
+    uint32_t size = 0;
+
+    void
+    reset(size_t capacity)
+      {
+        this->dense.clear();
+        this->dense.append(capacity);
+        this->sparse.clear();
+        this->sparse.append(capacity);
+        this->size = 0;
+      }
+
+    bool
+    insert(uint32_t value) noexcept
+      {
+        uint32_t index = this->sparse[value];
+        if((index < this->size) && (this->dense[index] == value))
+          return false;
+
+        this->sparse.mut(value) = this->size;
+        this->dense.mut(this->size) = value;
+        this->size += 1;
+        return true;
+      }
+  };
+
+///////////////////////////////////////////////////////////////////////////////
+// Parser
+///////////////////////////////////////////////////////////////////////////////
+
+enum : uint8_t
+  {
+    node_empty   = 0,
+    node_set     = 1,  // `arg` is the byte set
+    node_assert  = 2,  // `arg` is the assertion
+    node_group   = 3,  // `arg` is the capturing group, or zero if non-capturing
+    node_concat  = 4,
+    node_alt     = 5,
+    node_repeat  = 6,  // `min` and `max` are counts, and `greedy` is the mode
+  };
+
+struct Node
+  {
+    uint8_t type;
+    bool greedy;
+    uint32_t arg;
+    uint32_t min;
+    uint32_t max;  // `UINT32_MAX` means infinity
+    cow_vector<uint32_t> subs;
+  };
+
+// This accepts the subset of the ECMAScript grammar of libstdc++, and rejects anything
+// else, including malformed patterns, so `std::regex` can report errors.
+class Parser
+  {
+  private:
+    const uint8_t* m_bp;
+    const uint8_t* m_ep;
+    cow_vector<Node>& m_nodes;
+    cow_vector<Byte_Set>& m_sets;
+    uint32_t m_ngroups = 0;
+    uint32_t m_depth = 0;
+
+  public:
+    Parser(const char* pattern, size_t length, cow_vector<Node>& nodes, cow_vector<Byte_Set>& sets)
+    noexcept
+      : m_bp(reinterpret_cast<const uint8_t*>(pattern)),
+        m_ep(reinterpret_cast<const uint8_t*>(pattern) + length),
+        m_nodes(nodes), m_sets(sets)
+      { }
+
+  private:
+    uint32_t
+    do_push_node(uint8_t type, uint32_t arg, cow_vector<uint32_t>&& subs = { })
+      {
+        Node node = { type, true, arg, 0, 0, ::std::move(subs) };
+        this->m_nodes.emplace_back(::std::move(node));
+        return static_cast<uint32_t>(this->m_nodes.size() - 1);
+      }
+
+    uint32_t
+    do_push_set(const Byte_Set& set)
+      {
+        // Reuse an identical set if one exists.
+        uint32_t index = 0;
+        while((index != this->m_sets.size()) &&
+              (::std::memcmp(this->m_sets[index].bits, set.bits, sizeof(set.bits)) != 0))
+          index++;
+        if(index == this->m_sets.size())
+          this->m_sets.emplace_back(set);
+        return this->do_push_node(node_set, index);
+      }
+
+    static
+    bool
+    do_is_quantifier(uint8_t c) noexcept
+      { return (c == '*') || (c == '+') || (c == '?') || (c == '{');  }
+
+    static
+    Byte_Set
+    do_make_quoted_class(uint8_t c)
+      {
+        Byte_Set set;
+        switch(c | 0x20) {
+          case 'd':
+            set = do_make_set(do_is_digit);
+            break;
+
+          case 'w':
+            set = do_make_set(do_is_word);
+            break;
+
+          default:
+            ROCKET_ASSERT((c | 0x20) == 's');
+            set = do_make_set(do_is_space);
+            break;
+        }
+        // `\D`, `\S` and `\W` are complements.
+        if(do_is_upper(c))
+          do_invert_set(set);
+        return set;
+      }
+
+    bool
+    do_get_hex(uint8_t& value)
+      {
+        // Exactly two hexadecimal digits are required.
+        if((this->m_ep - this->m_bp < 2) || !do_is_xdigit(this->m_bp[0]) || !do_is_xdigit(this->m_bp[1]))
+          return false;
+
+        uint32_t n = 0;
+        for(size_t k = 0;  k != 2;  ++k) {
+          uint32_t c = *(this->m_bp++);
+          n = n * 16 + (do_is_digit(c) ? (c - '0') : ((c | 0x20) - 'a' + 10));
+        }
+        value = static_cast<uint8_t>(n);
+        return true;
+      }
+
+    bool
+    do_get_count(uint32_t& count)
+      {
+        if((this->m_bp == this->m_ep) || !do_is_digit(*(this->m_bp)))
+          return false;
+
+        count = 0;
+        while((this->m_bp != this->m_ep) && do_is_digit(*(this->m_bp))) {
+          count = count * 10 + static_cast<uint32_t>(*(this->m_bp++) - '0');
+          if(count > s_max_count)
+            return false;
+        }
+        return true;
+      }
+
+    // A bracket expression consists of characters, classes and dashes. Escape sequences
+    // are decoded here.
+    enum : uint8_t { btok_end, btok_char, btok_dash, btok_class };
+
+    bool
+    do_bracket_token(uint8_t& type, uint8_t& value, Byte_Set& set)
+      {
+        if(this->m_bp == this->m_ep)
+          return false;
+
+        uint8_t c = *(this->m_bp++);
+        if(c == ']') {
+          type = btok_end;
+          return true;
+        }
+        if(c == '-') {
+          type = btok_dash;
+          return true;
+        }
+        if(c == '[') {
+          if(this->m_bp == this->m_ep)
+            return false;
+
+          // Collating symbols and equivalence classes are not supported.
+          if((*(this->m_bp) == '.') || (*(this->m_bp) == '='))
+            return false;
+
+          if(*(this->m_bp) != ':') {
+            type = btok_char;
+            value = c;
+            return true;
+          }
+
+          // Get a character class name, which is case-insensitive.
+          this->m_bp++;
+          cow_string name;
+          while((this->m_bp != this->m_ep) && (*(this->m_bp) != ':'))
+            name.push_back(static_cast<char>(*(this->m_bp++) | 0x20));
+          if((this->m_ep - this->m_bp < 2) || (this->m_bp[1] != ']'))
+            return false;
+          this->m_bp += 2;
+
+          static constexpr struct { char name[8]; bool (*pred)(uint32_t);  } s_classes[] =
+            {
+              { "d",       do_is_digit   },
+              { "w",       do_is_word    },
+              { "s",       do_is_space   },
+              { "alnum",   do_is_alnum   },
+              { "alpha",   do_is_alpha   },
+              { "blank",   do_is_blank   },
+              { "cntrl",   do_is_cntrl   },
+              { "digit",   do_is_digit   },
+              { "graph",   do_is_graph   },
+              { "lower",   do_is_lower   },
+              { "print",   do_is_print   },
+              { "punct",   do_is_punct   },
+              { "space",   do_is_space   },
+              { "upper",   do_is_upper   },
+              { "xdigit",  do_is_xdigit  },
+            };
+
+          auto qcls = ::std::find_if(begin(s_classes), end(s_classes),
+                                     [&](const auto& cls) { return name == cls.name;  });
+          if(qcls == end(s_classes))
+            return false;
+
+          type = btok_class;
+          set = do_make_set(qcls->pred);
+          return true;
+        }
+        if(c != '\\') {
+          type = btok_char;
+          value = c;
+          return true;
+        }
+
+        // Decode an escape sequence. Unlike elsewhere, `\b` denotes a backspace.
+        if(this->m_bp == this->m_ep)
+          return false;
+
+        c = *(this->m_bp++);
+        type = btok_char;
+        switch(c) {
+          case 'd':
+          case 'D':
+          case 's':
+          case 'S':
+          case 'w':
+          case 'W':
+            type = btok_class;
+            set = do_make_quoted_class(c);
+            return true;
+
+          case 'b':
+            value = '\b';
+            return true;
+
+          case 'x':
+            return this->do_get_hex(value);
+
+          default:
+            if(::std::strchr("Bcu123456789", c))
+              return false;
+            value = (c == '0') ? '\0' : (c == 'f') ? '\f' : (c == 'n') ? '\n' : (c == 'r') ? '\r'
+                    : (c == 't') ? '\t' : (c == 'v') ? '\v' : c;
+            return true;
+        }
+      }
+
+    bool
+    do_bracket(uint32_t& node)
+      {
+        bool negative = false;
+        if((this->m_bp != this->m_ep) && (*(this->m_bp) == '^')) {
+          negative = true;
+          this->m_bp++;
+        }
+
+        // This mimics `_Compiler::_M_expression_term()` of libstdc++. A character may
+        // be the start of a range, so it is added only after the next term is seen.
+        Byte_Set set = { };
+        int last = -1;  // a character, or `-1` for nothing, or `-2` for a class
+        uint8_t type, value;
+        Byte_Set cls;
+
+        auto push_char = [&](uint8_t ch)
+          {
+            if(last >= 0)
+              do_add_set(set, static_cast<uint8_t>(last));
+            last = ch;
+          };
+
+        auto push_range = [&](uint8_t lo, uint8_t hi)
+          {
+            // Characters are compared as `char`, which is signed.
+            if(static_cast<int8_t>(lo) > static_cast<int8_t>(hi))
+              return false;
+            for(uint32_t c = 0;  c != 256;  ++c)
+              if((static_cast<int8_t>(lo) <= static_cast<int8_t>(c)) &&
+                 (static_cast<int8_t>(c) <= static_cast<int8_t>(hi)))
+                do_add_set(set, static_cast<uint8_t>(c));
+            last = -1;
+            return true;
+          };
+
+        // A dash at the beginning is an ordinary character.
+        if(!this->do_bracket_token(type, value, cls))
+          return false;
+        if(type == btok_char)
+          last = value;
+        else if(type == btok_dash)
+          last = '-';
+        else
+          goto m_term;
+
+        for(;;) {
+          if(!this->do_bracket_token(type, value, cls))
+            return false;
+
+      m_term:
+          if(type == btok_end)
+            break;
+
+          if(type == btok_class) {
+            push_char(0);
+            last = -2;
+            do_merge_set(set, cls);
+            continue;
+          }
+
+          if(type == btok_char) {
+            push_char(value);
+            continue;
+          }
+
+          // Look at the term after the dash, which may be put back.
+          auto bp_dash = this->m_bp;
+          if(!this->do_bracket_token(type, value, cls))
+            return false;
+
+          if(type == btok_end) {
+            push_char('-');
+            break;
+          }
+
+          if(last == -2)
+            return false;
+
+          if(last >= 0) {
+            if(type == btok_char) {
+              if(!push_range(static_cast<uint8_t>(last), value))
+                return false;
+            }
+            else if(type == btok_dash) {
+              if(!push_range(static_cast<uint8_t>(last), '-'))
+                return false;
+            }
+            else
+              return false;
+            continue;
+          }
+
+          push_char('-');
+          this->m_bp = bp_dash;
+        }
+        if(last >= 0)
+          do_add_set(set, static_cast<uint8_t>(last));
+
+        if(negative)
+          do_invert_set(set);
+        node = this->do_push_set(set);
+        return true;
+      }
+
+    bool
+    do_atom(uint32_t& node)
+      {
+        uint8_t c = *(this->m_bp++);
+        switch(c) {
+          case '.':
+            // This matches anything other than line terminators.
+            node = this->do_push_set(do_make_set([](uint32_t ch) { return (ch != '\n') && (ch != '\r');  }));
+            return true;
+
+          case '(': {
+            uint32_t index = 0;
+            if((this->m_bp != this->m_ep) && (*(this->m_bp) == '?')) {
+              // Lookahead assertions are not supported.
+              if((this->m_ep - this->m_bp < 2) || (this->m_bp[1] != ':'))
+                return false;
+              this->m_bp += 2;
+            }
+            else
+              index = ++(this->m_ngroups);
+
+            uint32_t sub;
+            if(!this->do_disjunction(sub))
+              return false;
+            if((this->m_bp == this->m_ep) || (*(this->m_bp) != ')'))
+              return false;
+            this->m_bp++;
+            node = this->do_push_node(node_group, index, { sub });
+            return true;
+          }
+
+          case '[':
+            return this->do_bracket(node);
+
+          case '\\': {
+            if(this->m_bp == this->m_ep)
+              return false;
+
+            c = *(this->m_bp++);
+            switch(c) {
+              case 'd':
+              case 'D':
+              case 's':
+              case 'S':
+              case 'w':
+              case 'W':
+                node = this->do_push_set(do_make_quoted_class(c));
+                return true;
+
+              case 'x': {
+                uint8_t value;
+                if(!this->do_get_hex(value))
+                  return false;
+                c = value;
+                break;
+              }
+
+              default:
+                // Back-references are not supported. `\c` and `\u` are not either,
+                // as their behavior is quirky.
+                if(::std::strchr("bBcu123456789", c))
+                  return false;
+                c = (c == '0') ? '\0' : (c == 'f') ? '\f' : (c == 'n') ? '\n' : (c == 'r') ? '\r'
+                    : (c == 't') ? '\t' : (c == 'v') ? '\v' : c;
+                break;
+            }
+            node = this->do_push_set(do_make_set([&](uint32_t ch) { return ch == c;  }));
+            return true;
+          }
+
+          case '*':
+          case '+':
+          case '?':
+          case '{':
+          case '^':
+          case '$':
+          case '|':
+          case ')':
+            return false;
+
+          default:
+            // Note that `]` and `}` are ordinary characters.
+            node = this->do_push_set(do_make_set([&](uint32_t ch) { return ch == c;  }));
+            return true;
+        }
+      }
+
+    bool
+    do_term(uint32_t& node)
+      {
+        // Check for assertions, which cannot be quantified.
+        uint8_t c = *(this->m_bp);
+        int kind = -1;
+        if(c == '^')
+          kind = assert_left_edge;
+        else if(c == '$')
+          kind = assert_right_edge;
+        else if((c == '\\') && (this->m_ep - this->m_bp >= 2) && ((this->m_bp[1] | 0x20) == 'b'))
+          kind = (this->m_bp[1] == 'b') ? assert_word : assert_not_word;
+
+        if(kind >= 0) {
+          this->m_bp += (c == '\\') ? 2 : 1;
+          if((this->m_bp != this->m_ep) && do_is_quantifier(*(this->m_bp)))
+            return false;
+          node = this->do_push_node(node_assert, static_cast<uint32_t>(kind));
+          return true;
+        }
+
+        uint32_t atom;
+        if(!this->do_atom(atom))
+          return false;
+
+        if((this->m_bp == this->m_ep) || !do_is_quantifier(*(this->m_bp))) {
+          node = atom;
+          return true;
+        }
+
+        uint32_t min = 0;
+        uint32_t max = UINT32_MAX;
+        c = *(this->m_bp++);
+        if(c == '+')
+          min = 1;
+        else if(c == '?')
+          max = 1;
+        else if(c == '{') {
+          if(!this->do_get_count(min))
+            return false;
+          max = min;
+          if((this->m_bp != this->m_ep) && (*(this->m_bp) == ',')) {
+            this->m_bp++;
+            max = UINT32_MAX;
+            if((this->m_bp != this->m_ep) && (*(this->m_bp) != '}') && !this->do_get_count(max))
+              return false;
+          }
+          if((this->m_bp == this->m_ep) || (*(this->m_bp) != '}') || (min > max))
+            return false;
+          this->m_bp++;
+        }
+
+        bool greedy = true;
+        if((this->m_bp != this->m_ep) && (*(this->m_bp) == '?')) {
+          greedy = false;
+          this->m_bp++;
+        }
+
+        // libstdc++ allows quantifiers to be stacked, but the behavior is obscure.
+        if((this->m_bp != this->m_ep) && do_is_quantifier(*(this->m_bp)))
+          return false;
+
+        node = this->do_push_node(node_repeat, 0, { atom });
+        auto& rep = this->m_nodes.mut(node);
+        rep.greedy = greedy;
+        rep.min = min;
+        rep.max = max;
+        return true;
+      }
+
+    bool
+    do_alternative(uint32_t& node)
+      {
+        cow_vector<uint32_t> terms;
+        while((this->m_bp != this->m_ep) && (*(this->m_bp) != '|') && (*(this->m_bp) != ')')) {
+          uint32_t term;
+          if(!this->do_term(term))
+            return false;
+          terms.emplace_back(term);
+        }
+        if(terms.empty())
+          node = this->do_push_node(node_empty, 0);
+        else if(terms.size() == 1)
+          node = terms[0];
+        else
+          node = this->do_push_node(node_concat, 0, ::std::move(terms));
+        return true;
+      }
+
+    bool
+    do_disjunction(uint32_t& node)
+      {
+        if(this->m_depth >= s_max_depth)
+          return false;
+
+        this->m_depth++;
+        cow_vector<uint32_t> alts;
+        for(;;) {
+          uint32_t alt;
+          if(!this->do_alternative(alt))
+            return false;
+          alts.emplace_back(alt);
+          if((this->m_bp == this->m_ep) || (*(this->m_bp) != '|'))
+            break;
+          this->m_bp++;
+        }
+        this->m_depth--;
+
+        if(alts.size() == 1)
+          node = alts[0];
+        else
+          node = this->do_push_node(node_alt, 0, ::std::move(alts));
+        return true;
+      }
+
+  public:
+    uint32_t
+    count_groups()
+    const noexcept
+      { return this->m_ngroups;  }
+
+    bool
+    parse(uint32_t& root)
+      {
+        if(!this->do_disjunction(root))
+          return false;
+        // Reject unbalanced parentheses.
+        return this->m_bp == this->m_ep;
+      }
+  };
+
+///////////////////////////////////////////////////////////////////////////////
+// Code generator
+///////////////////////////////////////////////////////////////////////////////
+
+// Programs are generated backwards, so the next instruction of every node is known
+// when it is emitted. If a program becomes too large, it is left incomplete, and the
+// caller shall check its size.
+class Generator
+  {
+  private:
+    const cow_vector<Node>& m_nodes;
+    cow_vector<Inst>& m_prog;
+    bool m_reverse;
+
+  public:
+    Generator(const cow_vector<Node>& nodes, cow_vector<Inst>& prog, bool reverse)
+    noexcept
+      : m_nodes(nodes), m_prog(prog), m_reverse(reverse)
+      { }
+
+  private:
+    uint32_t
+    do_push(uint8_t op, uint32_t arg, uint32_t x, uint32_t y = 0)
+      {
+        Inst inst = { op, arg, x, y };
+        this->m_prog.emplace_back(inst);
+        return static_cast<uint32_t>(this->m_prog.size() - 1);
+      }
+
+    uint32_t
+    do_split(bool greedy, uint32_t more, uint32_t less)
+      {
+        return greedy ? this->do_push(op_split, 0, more, less)
+                      : this->do_push(op_split, 0, less, more);
+      }
+
+  public:
+    uint32_t
+    emit(uint32_t index, uint32_t next)
+      {
+        if(this->m_prog.size() > s_max_insts)
+          return next;
+
+        const auto& node = this->m_nodes[index];
+        switch(node.type) {
+          case node_empty:
+            return next;
+
+          case node_set:
+            return this->do_push(op_set, node.arg, next);
+
+          case node_assert: {
+            uint32_t kind = node.arg;
+            if(this->m_reverse && (kind == assert_left_edge))
+              kind = assert_right_edge;
+            else if(this->m_reverse && (kind == assert_right_edge))
+              kind = assert_left_edge;
+            return this->do_push(op_assert, kind, next);
+          }
+
+          case node_group: {
+            if(this->m_reverse || (node.arg == 0))
+              return this->emit(node.subs[0], next);
+
+            uint32_t end = this->do_push(op_save, node.arg * 2 + 1, next);
+            uint32_t body = this->emit(node.subs[0], end);
+            return this->do_push(op_save, node.arg * 2, body);
+          }
+
+          case node_concat: {
+            if(this->m_reverse)
+              for(size_t k = 0;  k != node.subs.size();  ++k)
+                next = this->emit(node.subs[k], next);
+            else
+              for(size_t k = node.subs.size();  k != 0;  --k)
+                next = this->emit(node.subs[k-1], next);
+            return next;
+          }
+
+          case node_alt: {
+            cow_vector<uint32_t> entries;
+            for(size_t k = 0;  k != node.subs.size();  ++k)
+              entries.emplace_back(this->emit(node.subs[k], next));
+
+            uint32_t head = entries.back();
+            for(size_t k = entries.size() - 1;  k != 0;  --k)
+              head = this->do_push(op_split, 0, entries[k-1], head);
+            return head;
+          }
+
+          case node_repeat: {
+            uint32_t sub = node.subs[0];
+            uint32_t head = next;
+            if(node.max == UINT32_MAX) {
+              // Create a loop. The split is patched after the body is emitted.
+              uint32_t loop = this->do_push(op_split, 0, 0, 0);
+              uint32_t body = this->emit(sub, loop);
+              auto& inst = this->m_prog.mut(loop);
+              inst.x = node.greedy ? body : next;
+              inst.y = node.greedy ? next : body;
+              head = loop;
+            }
+            else {
+              // `x{2,4}` is `xx(x(x)?)?`.
+              for(uint32_t k = node.min;  k != node.max;  ++k) {
+                uint32_t body = this->emit(sub, head);
+                head = this->do_split(node.greedy, body, next);
+              }
+            }
+            for(uint32_t k = 0;  k != node.min;  ++k)
+              head = this->emit(sub, head);
+            return head;
+          }
+
+          default:
+            ROCKET_ASSERT(false);
+        }
+      }
+  };
+
+bool
+do_is_nullable(const cow_vector<Node>& nodes, uint32_t index)
+  {
+    const auto& node = nodes[index];
+    switch(node.type) {
+      case node_set:
+        return false;
+
+      case node_group:
+        return do_is_nullable(nodes, node.subs[0]);
+
+      case node_concat:
+        return ::std::all_of(node.subs.begin(), node.subs.end(),
+                             [&](uint32_t sub) { return do_is_nullable(nodes, sub);  });
+
+      case node_alt:
+        return ::std::any_of(node.subs.begin(), node.subs.end(),
+                             [&](uint32_t sub) { return do_is_nullable(nodes, sub);  });
+
+      case node_repeat:
+        return (node.min == 0) || do_is_nullable(nodes, node.subs[0]);
+
+      default:
+        return true;
+    }
+  }
+
+// ECMAScript stops repeating an atom as soon as it matches an empty string, and
+// submatches in such cases are hard to get right, so these patterns are rejected.
+bool
+do_check_repeats(const cow_vector<Node>& nodes)
+  {
+    return ::std::none_of(nodes.begin(), nodes.end(),
+               [&](const Node& node) {
+                 return (node.type == node_repeat) && (node.max != node.min) &&
+                        do_is_nullable(nodes, node.subs[0]);
+               });
+  }
+
+bool
+do_is_anchored(const cow_vector<Node>& nodes, uint32_t index)
+  {
+    const auto& node = nodes[index];
+    switch(node.type) {
+      case node_assert:
+        return node.arg == assert_left_edge;
+
+      case node_group:
+        return do_is_anchored(nodes, node.subs[0]);
+
+      case node_concat:
+        return do_is_anchored(nodes, node.subs[0]);
+
+      case node_alt:
+        return ::std::all_of(node.subs.begin(), node.subs.end(),
+                             [&](uint32_t sub) { return do_is_anchored(nodes, sub);  });
+
+      case node_repeat:
+        return (node.min != 0) && do_is_anchored(nodes, node.subs[0]);
+
+      default:
+        return false;
+    }
+  }
+
+// Appends the literal string that all matches of a node begin with. If the node may
+// match more than that string, `false` is returned.
+bool
+do_append_prefix(cow_string& prefix, const cow_vector<Node>& nodes, const cow_vector<Byte_Set>& sets,
+                 uint32_t index)
+  {
+    const auto& node = nodes[index];
+    switch(node.type) {
+      case node_empty:
+      case node_assert:
+        return true;
+
+      case node_set: {
+        const auto& set = sets[node.arg];
+        uint32_t count = 0;
+        for(uint64_t word : set.bits)
+          count += static_cast<uint32_t>(__builtin_popcountll(word));
+        if(count != 1)
+          return false;
+
+        uint32_t c = 0;
+        while(!do_test_set(set, static_cast<uint8_t>(c)))
+          c++;
+        prefix.push_back(static_cast<char>(c));
+        return true;
+      }
+
+      case node_group:
+        return do_append_prefix(prefix, nodes, sets, node.subs[0]);
+
+      case node_concat:
+        return ::std::all_of(node.subs.begin(), node.subs.end(),
+                             [&](uint32_t sub) { return do_append_prefix(prefix, nodes, sets, sub);  });
+
+      case node_repeat:
+        if(node.min != 0)
+          do_append_prefix(prefix, nodes, sets, node.subs[0]);
+        return false;
+
+      default:
+        return false;
+    }
+  }
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// DFA
+///////////////////////////////////////////////////////////////////////////////
+
+// A DFA state is an ordered list of NFA instructions that have yet to be closed,
+// together with the context on the left. For leftmost-first searches, instructions
+// are ordered by priority, and those with lower priorities than a match are dropped.
+struct Regex_Automaton::Dfa
+  {
+    enum : uint8_t
+      {
+        flag_ctx    = 0x03,  // context on the left
+        flag_loop   = 0x04,  // new threads may start
+        flag_match  = 0x08,  // a match ended right before the last byte
+        flag_dead   = 0x10,  // no thread is alive
+        flag_start  = 0x20,  // nothing has been matched
+        flag_eknown = 0x40,  // whether a match ends at the right edge is known
+        flag_ematch = 0x80,  // a match ends at the right edge
+      };
+
+    const Inst* prog;
+    uint32_t start;
+    uint32_t nclasses;
+    bool anchored;
+    bool longest;
+
+    cow_vector<uint8_t> flags;     // flags of each state
+    cow_vector<uint32_t> koffs;    // offset of the kernel of each state, plus the end
+    cow_vector<uint32_t> kernels;
+    cow_vector<uint32_t> trans;    // `nclasses` transitions of each state, or zero
+    cow_dictionary<uint32_t> index;
+    uint32_t starts[3];
+    bool skip;  // whether start states can be skipped with the literal prefix
+
+    // Transitions are stored as entries, which are offsets into `trans`, shifted
+    // left, so the hot loop needs neither multiplication nor lookups of flags. The
+    // low bits denote states that need attention.
+    enum : uint32_t
+      {
+        entry_match  = 0x01,
+        entry_dead   = 0x02,
+        entry_skip   = 0x04,
+        entry_shift  = 3,
+      };
+
+    // These are scratch buffers.
+    Sparse_Set list;
+    Sparse_Set kset;
+    cow_vector<uint32_t> stack;
+    cow_string key;
+
+    void
+    clear()
+      {
+        // State zero is a placeholder, so zero can denote unknown transitions.
+        this->flags.clear();
+        this->flags.emplace_back(flag_dead);
+        this->koffs.clear();
+        this->koffs.emplace_back(0);
+        this->koffs.emplace_back(0);
+        this->kernels.clear();
+        this->trans.clear();
+        this->trans.append(this->nclasses);
+        this->index.clear();
+        ::std::fill_n(this->starts, 3, 0);
+      }
+
+    // Follows all instructions that consume nothing, and collects those that do in
+    // `list`. The return value indicates whether a match has been found.
+    bool
+    close(const uint32_t* kbp, const uint32_t* kep, bool loop, int lctx, int rctx, bool& cut)
+      {
+        this->list.size = 0;
+        bool matched = false;
+        cut = false;
+
+        auto visit = [&](uint32_t pc0)
+          {
+            this->stack.clear();
+            this->stack.emplace_back(pc0);
+            while(!this->stack.empty()) {
+              uint32_t pc = this->stack.back();
+              this->stack.pop_back();
+              if(!this->list.insert(pc))
+                continue;
+
+              const auto& inst = this->prog[pc];
+              switch(inst.op) {
+                case op_split:
+                  this->stack.emplace_back(inst.y);
+                  this->stack.emplace_back(inst.x);
+                  break;
+
+                case op_save:
+                  this->stack.emplace_back(inst.x);
+                  break;
+
+                case op_assert:
+                  if(do_check_assert(inst.arg, lctx, rctx))
+                    this->stack.emplace_back(inst.x);
+                  break;
+
+                case op_match:
+                  matched = true;
+                  // Drop everything with a lower priority.
+                  if(!this->longest) {
+                    cut = true;
+                    return false;
+                  }
+                  break;
+              }
+            }
+            return true;
+          };
+
+        for(auto kp = kbp;  kp != kep;  ++kp)
+          if(!visit(*kp))
+            return matched;
+        if(loop)
+          visit(this->start);
+        return matched;
+      }
+
+    uint32_t
+    entry_of(uint32_t sid)
+    const noexcept
+      {
+        uint8_t sflags = this->flags[sid];
+        return (sid * this->nclasses) << entry_shift
+               | ((sflags & flag_match) ? entry_match : 0U)
+               | ((sflags & flag_dead) ? entry_dead : 0U)
+               | ((this->skip && (sflags & flag_start)) ? entry_skip : 0U);
+      }
+
+    uint32_t
+    sid_of(uint32_t entry)
+    const noexcept
+      { return (entry >> entry_shift) / this->nclasses;  }
+
+    uint32_t
+    intern(uint8_t sflags, const uint32_t* kbp, const uint32_t* kep)
+      {
+        if(kbp == kep)
+          sflags |= (sflags & flag_loop) ? ((sflags & flag_match) ? 0 : flag_start) : flag_dead;
+
+        this->key.clear();
+        this->key.push_back(static_cast<char>(sflags));
+        this->key.append(reinterpret_cast<const char*>(kbp), reinterpret_cast<const char*>(kep));
+        auto qstate = this->index.find(this->key);
+        if(qstate != this->index.end())
+          return qstate->second;
+
+        // Check whether the DFA has become too large.
+        if(this->trans.size() + this->nclasses > s_max_trans)
+          return 0;
+
+        auto sid = static_cast<uint32_t>(this->flags.size());
+        this->flags.emplace_back(sflags);
+        this->kernels.append(kbp, kep);
+        this->koffs.emplace_back(static_cast<uint32_t>(this->kernels.size()));
+        this->trans.append(this->nclasses);
+        this->index.try_emplace(this->key, sid);
+        return sid;
+      }
+  };
+
+auto
+Regex_Automaton::
+do_get_dfa(uint32_t which)
+const
+  -> Dfa&
+  {
+    // 0: forwards, unanchored, leftmost-first
+    // 1: forwards, anchored, leftmost-first
+    // 2: forwards, anchored, longest
+    // 3: backwards, anchored, longest
+    auto& qdfa = this->m_dfas[which];
+    if(ROCKET_EXPECT(qdfa))
+      return *qdfa;
+
+    qdfa = ::rocket::make_unique<Dfa>();
+    qdfa->prog = (which == 3) ? this->m_rev.data() : this->m_fwd.data();
+    qdfa->start = (which == 3) ? this->m_rev_start : this->m_fwd_start;
+    qdfa->nclasses = this->m_nclasses;
+    qdfa->skip = (which == 0) && !this->m_prefix.empty();
+    qdfa->anchored = which != 0;
+    qdfa->longest = which >= 2;
+    size_t nprog = (which == 3) ? this->m_rev.size() : this->m_fwd.size();
+    qdfa->list.reset(nprog);
+    qdfa->kset.reset(nprog);
+    qdfa->clear();
+    return *qdfa;
+  }
+
+uint32_t
+Regex_Automaton::
+do_dfa_transit(Dfa& dfa, uint32_t entry, uint8_t byte)
+const
+  {
+    uint32_t sid = dfa.sid_of(entry);
+    uint8_t sflags = dfa.flags[sid];
+    bool loop = sflags & Dfa::flag_loop;
+    bool cut;
+    bool matched = dfa.close(dfa.kernels.data() + dfa.koffs[sid], dfa.kernels.data() + dfa.koffs[sid+1],
+                             loop, sflags & Dfa::flag_ctx, do_ctx_of(byte), cut);
+
+    // Advance all threads that accept this byte.
+    dfa.kset.size = 0;
+    for(uint32_t k = 0;  k != dfa.list.size;  ++k) {
+      const auto& inst = dfa.prog[dfa.list.dense[k]];
+      if((inst.op == op_set) && do_test_set(this->m_sets[inst.arg], byte))
+        dfa.kset.insert(inst.x);
+    }
+
+    uint8_t nflags = static_cast<uint8_t>(do_ctx_of(byte));
+    if(loop && !cut)
+      nflags |= Dfa::flag_loop;
+    if(matched)
+      nflags |= Dfa::flag_match;
+    uint32_t next = dfa.intern(nflags, dfa.kset.dense.data(), dfa.kset.dense.data() + dfa.kset.size);
+    if(!next)
+      return 0;
+
+    // Save the transition for later use.
+    next = dfa.entry_of(next);
+    dfa.trans.mut((entry >> Dfa::entry_shift) + this->m_classes[byte]) = next;
+    return next;
+  }
+
+bool
+Regex_Automaton::
+do_dfa_check_end(Dfa& dfa, uint32_t sid, int rctx)
+const
+  {
+    uint8_t sflags = dfa.flags[sid];
+    if((rctx == ctx_edge) && (sflags & Dfa::flag_eknown))
+      return sflags & Dfa::flag_ematch;
+
+    bool cut;
+    bool matched = dfa.close(dfa.kernels.data() + dfa.koffs[sid], dfa.kernels.data() + dfa.koffs[sid+1],
+                             sflags & Dfa::flag_loop, sflags & Dfa::flag_ctx, rctx, cut);
+    if(rctx == ctx_edge)
+      dfa.flags.mut(sid) = static_cast<uint8_t>(sflags | Dfa::flag_eknown | (matched ? Dfa::flag_ematch : 0));
+    return matched;
+  }
+
+int
+Regex_Automaton::
+do_dfa_scan_forward(const char*& mend, Dfa& dfa, const char* bptr, const char* eptr, int lctx)
+const
+  {
+    auto get_start = [&](int ctx)
+      {
+        auto& sid = dfa.starts[ctx];
+        if(!sid) {
+          uint8_t sflags = static_cast<uint8_t>(ctx | (dfa.anchored ? 0 : Dfa::flag_loop));
+          sid = dfa.intern(sflags, &(dfa.start), &(dfa.start) + dfa.anchored);
+        }
+        return sid ? dfa.entry_of(sid) : 0;
+      };
+
+    uint32_t cur = get_start(lctx);
+    if(!cur)
+      return dfa.clear(), -1;
+
+    const char* last = nullptr;
+    auto sp = reinterpret_cast<const uint8_t*>(bptr);
+    auto ep = reinterpret_cast<const uint8_t*>(eptr);
+
+    for(;;) {
+      if(cur & Dfa::entry_skip) {
+        // Skip bytes that cannot start a match.
+        auto qnext = reinterpret_cast<const uint8_t*>(this->do_find_prefix(reinterpret_cast<const char*>(sp), eptr));
+        if(!qnext)
+          break;
+
+        if(qnext != sp) {
+          sp = qnext;
+          cur = get_start(do_ctx_of(sp[-1]));
+          if(!cur)
+            return dfa.clear(), -1;
+        }
+      }
+
+      // This is the hot loop. It stops at states that need attention.
+      const uint32_t* trans = dfa.trans.data();
+      uint32_t next = 0;
+      while(sp != ep) {
+        next = trans[(cur >> Dfa::entry_shift) + this->m_classes[*sp]];
+        if(ROCKET_UNEXPECT(next & (Dfa::entry_match | Dfa::entry_dead | Dfa::entry_skip)) || ROCKET_UNEXPECT(!next))
+          break;
+        cur = next;
+        sp++;
+      }
+
+      if(sp == ep) {
+        if(this->do_dfa_check_end(dfa, dfa.sid_of(cur), ctx_edge))
+          last = eptr;
+        break;
+      }
+
+      if(!next) {
+        next = this->do_dfa_transit(dfa, cur, *sp);
+        if(!next)
+          return dfa.clear(), -1;
+      }
+      cur = next;
+      sp++;
+
+      if(cur & Dfa::entry_match)
+        last = reinterpret_cast<const char*>(sp - 1);
+      if(cur & Dfa::entry_dead)
+        break;
+    }
+    if(!last)
+      return 0;
+
+    mend = last;
+    return 1;
+  }
+
+int
+Regex_Automaton::
+do_dfa_scan_backward(const char*& mbeg, Dfa& dfa, const char* bptr, const char* eptr, int lctx,
+                     int rctx)
+const
+  {
+    // This runs from `eptr` to `bptr`, so the context on the right of the subject is
+    // the context on the left of the automaton, and vice versa.
+    auto& sid = dfa.starts[rctx];
+    if(!sid)
+      sid = dfa.intern(static_cast<uint8_t>(rctx), &(dfa.start), &(dfa.start) + 1);
+    if(!sid)
+      return dfa.clear(), -1;
+
+    uint32_t cur = dfa.entry_of(sid);
+    const char* last = nullptr;
+    auto sp = reinterpret_cast<const uint8_t*>(eptr);
+    auto bp = reinterpret_cast<const uint8_t*>(bptr);
+
+    for(;;) {
+      const uint32_t* trans = dfa.trans.data();
+      uint32_t next = 0;
+      while(sp != bp) {
+        next = trans[(cur >> Dfa::entry_shift) + this->m_classes[sp[-1]]];
+        if(ROCKET_UNEXPECT(next & (Dfa::entry_match | Dfa::entry_dead)) || ROCKET_UNEXPECT(!next))
+          break;
+        cur = next;
+        sp--;
+      }
+
+      if(sp == bp) {
+        if(this->do_dfa_check_end(dfa, dfa.sid_of(cur), lctx))
+          last = bptr;
+        break;
+      }
+
+      if(!next) {
+        next = this->do_dfa_transit(dfa, cur, sp[-1]);
+        if(!next)
+          return dfa.clear(), -1;
+      }
+      cur = next;
+      sp--;
+
+      if(cur & Dfa::entry_match)
+        last = reinterpret_cast<const char*>(sp + 1);
+      if(cur & Dfa::entry_dead)
+        break;
+    }
+    if(!last)
+      return 0;
+
+    mbeg = last;
+    return 1;
+  }
+
+const char*
+Regex_Automaton::
+do_find_prefix(const char* bptr, const char* eptr)
+const noexcept
+  {
+    const char* pbp = this->m_prefix.data();
+    size_t plen = this->m_prefix.size();
+    if(static_cast<size_t>(eptr - bptr) < plen)
+      return nullptr;
+
+    if(plen == 1)
+      return static_cast<const char*>(::std::memchr(bptr, pbp[0], static_cast<size_t>(eptr - bptr)));
+
+    const char* sp = bptr;
+    const char* lp = eptr - plen + 1;  // last possible start, plus one
+
+#ifdef __SSE2__
+    // Compare the first and the last bytes of the prefix at sixteen positions at a
+    // time, then verify candidates.
+    __m128i tfirst = _mm_set1_epi8(pbp[0]);
+    __m128i tlast = _mm_set1_epi8(pbp[plen-1]);
+    while(lp - sp >= 16) {
+      __m128i tf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sp));
+      __m128i tl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sp + plen - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(tf, tfirst),
+                                                                            _mm_cmpeq_epi8(tl, tlast))));
+      while(mask != 0) {
+        uint32_t k = static_cast<uint32_t>(__builtin_ctz(mask));
+        if(::std::memcmp(sp + k + 1, pbp + 1, plen - 2) == 0)
+          return sp + k;
+        mask &= mask - 1;
+      }
+      sp += 16;
+    }
+#endif
+    return static_cast<const char*>(::memmem(sp, static_cast<size_t>(eptr - sp), pbp, plen));
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+// Pike VM
+///////////////////////////////////////////////////////////////////////////////
+
+// Threads are kept in the order of priority, each of which has its own submatches.
+// Submatches are saved and restored on a stack when instructions are closed.
+struct Regex_Automaton::Pike
+  {
+    struct Frame
+      {
+        uint32_t pc;
+        uint32_t slot;  // `UINT32_MAX` if this is not a restoration
+        const char* saved;
+      };
+
+    uint32_t ncaps;
+    Sparse_Set lists[2];
+    cow_vector<const char*> caps[2];
+    cow_vector<const char*> work;
+    cow_vector<Frame> stack;
+
+    void
+    add(uint32_t which, const Inst* prog, uint32_t pc0, const char* const* src, const char* pos,
+        int lctx, int rctx)
+      {
+        auto& list = this->lists[which];
+        auto wcaps = this->work.mut_data();
+        if(src)
+          ::std::copy_n(src, this->ncaps, wcaps);
+        else
+          ::std::fill_n(wcaps, this->ncaps, nullptr);
+
+        this->stack.clear();
+        this->stack.push_back({ pc0, UINT32_MAX, nullptr });
+        while(!this->stack.empty()) {
+          auto frame = this->stack.back();
+          this->stack.pop_back();
+          if(frame.slot != UINT32_MAX) {
+            wcaps[frame.slot] = frame.saved;
+            continue;
+          }
+
+          uint32_t pc = frame.pc;
+          if(!list.insert(pc))
+            continue;
+
+          const auto& inst = prog[pc];
+          switch(inst.op) {
+            case op_split:
+              this->stack.push_back({ inst.y, UINT32_MAX, nullptr });
+              this->stack.push_back({ inst.x, UINT32_MAX, nullptr });
+              break;
+
+            case op_save:
+              this->stack.push_back({ 0, inst.arg, wcaps[inst.arg] });
+              wcaps[inst.arg] = pos;
+              this->stack.push_back({ inst.x, UINT32_MAX, nullptr });
+              break;
+
+            case op_assert:
+              if(do_check_assert(inst.arg, lctx, rctx))
+                this->stack.push_back({ inst.x, UINT32_MAX, nullptr });
+              break;
+
+            default:
+              ::std::copy_n(wcaps, this->ncaps, this->caps[which].mut_data() + pc * this->ncaps);
+              break;
+          }
+        }
+      }
+  };
+
+bool
+Regex_Automaton::
+do_pike(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, int lctx,
+        bool anchored, bool full, bool not_null)
+const
+  {
+    auto& qpike = this->m_pike;
+    if(!qpike) {
+      qpike = ::rocket::make_unique<Pike>();
+      qpike->ncaps = this->m_ngroups * 2 + 2;
+      for(size_t k = 0;  k != 2;  ++k) {
+        qpike->lists[k].reset(this->m_fwd.size());
+        qpike->caps[k].append(this->m_fwd.size() * qpike->ncaps);
+      }
+      qpike->work.append(qpike->ncaps);
+    }
+    auto& pike = *qpike;
+    const Inst* prog = this->m_fwd.data();
+
+    uint32_t cur = 0;
+    pike.lists[cur].size = 0;
+    bool matched = false;
+
+    for(const char* sp = bptr;  ;  ++sp) {
+      int lc = (sp == bptr) ? lctx : do_ctx_of(static_cast<uint8_t>(sp[-1]));
+      int rc = (sp == eptr) ? ctx_edge : do_ctx_of(static_cast<uint8_t>(sp[0]));
+
+      // Start a new thread with the lowest priority.
+      if(!matched && (!anchored || (sp == bptr)))
+        pike.add(cur, prog, this->m_fwd_start, nullptr, sp, lc, rc);
+
+      auto& clist = pike.lists[cur];
+      if(clist.size == 0)
+        break;
+
+      int nrc = ((sp == eptr) || (sp + 1 == eptr)) ? ctx_edge : do_ctx_of(static_cast<uint8_t>(sp[1]));
+      pike.lists[cur ^ 1].size = 0;
+      for(uint32_t k = 0;  k != clist.size;  ++k) {
+        uint32_t pc = clist.dense[k];
+        const auto& inst = prog[pc];
+        const char* const* tcaps = pike.caps[cur].data() + pc * pike.ncaps;
+
+        if(inst.op == op_match) {
+          if(full && (sp != eptr))
+            continue;
+          if(not_null && (sp == bptr))
+            continue;
+
+          // Accept this thread, and drop those with lower priorities.
+          for(size_t i = 0;  i != nsubs;  ++i)
+            if(tcaps[i*2] && tcaps[i*2+1])
+              subs[i] = { tcaps[i*2], tcaps[i*2+1] };
+            else
+              subs[i] = { nullptr, nullptr };
+          matched = true;
+          break;
+        }
+
+        if((inst.op == op_set) && (sp != eptr) && do_test_set(this->m_sets[inst.arg], static_cast<uint8_t>(*sp)))
+          pike.add(cur ^ 1, prog, inst.x, tcaps, sp + 1, do_ctx_of(static_cast<uint8_t>(*sp)), nrc);
+      }
+      cur ^= 1;
+
+      if(sp == eptr)
+        break;
+    }
+    return matched;
+  }
+
+///////////////////////////////////////////////////////////////////////////////
+// Public interfaces
+///////////////////////////////////////////////////////////////////////////////
+
+Regex_Automaton::
+Regex_Automaton()
+noexcept
+  {
+  }
+
+Regex_Automaton::
+~Regex_Automaton()
+  {
+  }
+
+bool
+Regex_Automaton::
+compile(const char* pattern, size_t length)
+  {
+    cow_vector<Node> nodes;
+    cow_vector<Byte_Set> sets;
+    uint32_t root;
+    Parser parser(pattern, length, nodes, sets);
+    if(!parser.parse(root) || !do_check_repeats(nodes))
+      return false;
+
+    // Generate the forward program, which saves the entire match as group zero.
+    cow_vector<Inst> fwd;
+    Generator fgen(nodes, fwd, false);
+    fwd.push_back({ op_match, 0, 0, 0 });
+    fwd.push_back({ op_save, 1, 0, 0 });
+    uint32_t fwd_start = fgen.emit(root, 1);
+    fwd.push_back({ op_save, 0, fwd_start, 0 });
+    fwd_start = static_cast<uint32_t>(fwd.size() - 1);
+    if(fwd.size() > s_max_insts)
+      return false;
+
+    // Generate the backward program.
+    cow_vector<Inst> rev;
+    Generator rgen(nodes, rev, true);
+    rev.push_back({ op_match, 0, 0, 0 });
+    uint32_t rev_start = rgen.emit(root, 0);
+    if(rev.size() > s_max_insts)
+      return false;
+
+    // Divide bytes into classes. Two bytes are in the same class only if every byte
+    // set contains either both or neither of them, and they are both word characters
+    // or both not.
+    uint8_t classes[256] = { };
+    uint32_t nclasses = 1;
+    auto refine = [&](const Byte_Set& set)
+      {
+        uint32_t remap[256][2];
+        ::std::memset(remap, 0xFF, sizeof(remap));
+        uint32_t count = 0;
+        for(uint32_t c = 0;  c != 256;  ++c) {
+          auto& id = remap[classes[c]][do_test_set(set, static_cast<uint8_t>(c))];
+          if(id == UINT32_MAX)
+            id = count++;
+          classes[c] = static_cast<uint8_t>(id);
+        }
+        nclasses = count;
+      };
+
+    refine(do_make_set(do_is_word));
+    for(const auto& set : sets)
+      refine(set);
+
+    // Commit the result.
+    this->m_fwd = ::std::move(fwd);
+    this->m_rev = ::std::move(rev);
+    this->m_sets = ::std::move(sets);
+    this->m_fwd_start = fwd_start;
+    this->m_rev_start = rev_start;
+    this->m_ngroups = parser.count_groups();
+    this->m_anchored = do_is_anchored(nodes, root);
+    this->m_prefix.clear();
+    do_append_prefix(this->m_prefix, nodes, this->m_sets, root);
+    ::std::memcpy(this->m_classes, classes, sizeof(classes));
+    this->m_nclasses = nclasses;
+
+    for(auto& qdfa : this->m_dfas)
+      qdfa.reset();
+    this->m_pike.reset();
+    return true;
+  }
+
+bool
+Regex_Automaton::
+search(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, bool prev_avail)
+const
+  {
+    ROCKET_ASSERT(nsubs != 0);
+    nsubs = ::rocket::min(nsubs, this->m_ngroups + size_t(1));
+    int lctx = prev_avail ? do_ctx_of(static_cast<uint8_t>(bptr[-1])) : ctx_edge;
+
+    // If all matches begin with `^`, only the beginning needs to be checked.
+    if(this->m_anchored && prev_avail)
+      return false;
+
+    // Find the end of the leftmost match.
+    const char* mend;
+    int r = this->do_dfa_scan_forward(mend, this->do_get_dfa(this->m_anchored), bptr, eptr, lctx);
+    if(r == 0)
+      return false;
+    if(r < 0)
+      return this->do_pike(subs, nsubs, bptr, eptr, lctx, this->m_anchored, false, false);
+
+    // Find its start. This is the leftmost position from which a match ends there.
+    const char* mbeg = bptr;
+    if(!this->m_anchored) {
+      int rctx = (mend == eptr) ? ctx_edge : do_ctx_of(static_cast<uint8_t>(*mend));
+      r = this->do_dfa_scan_backward(mbeg, this->do_get_dfa(3), bptr, mend, lctx, rctx);
+      if(r < 0)
+        return this->do_pike(subs, nsubs, bptr, eptr, lctx, false, false, false);
+      ROCKET_ASSERT(r == 1);
+    }
+
+    subs[0] = { mbeg, mend };
+    if(nsubs == 1)
+      return true;
+
+    // Extract submatches from the match, which is known.
+    int mctx = (mbeg == bptr) ? lctx : do_ctx_of(static_cast<uint8_t>(mbeg[-1]));
+    bool found = this->do_pike(subs, nsubs, mbeg, eptr, mctx, true, false, false);
+    ROCKET_ASSERT(found && (subs[0].second == mend));
+    return found;
+  }
+
+bool
+Regex_Automaton::
+match_prefix(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, bool prev_avail,
+             bool not_null)
+const
+  {
+    ROCKET_ASSERT(nsubs != 0);
+    nsubs = ::rocket::min(nsubs, this->m_ngroups + size_t(1));
+    int lctx = prev_avail ? do_ctx_of(static_cast<uint8_t>(bptr[-1])) : ctx_edge;
+    return this->do_pike(subs, nsubs, bptr, eptr, lctx, true, false, not_null);
+  }
+
+bool
+Regex_Automaton::
+match(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr)
+const
+  {
+    ROCKET_ASSERT(nsubs != 0);
+    nsubs = ::rocket::min(nsubs, this->m_ngroups + size_t(1));
+
+    // Check whether there is a match at all, which is relatively fast.
+    auto& dfa = this->do_get_dfa(2);
+    auto& sid = dfa.starts[ctx_edge];
+    if(!sid)
+      sid = dfa.intern(ctx_edge, &(dfa.start), &(dfa.start) + 1);
+
+    uint32_t cur = sid ? dfa.entry_of(sid) : 0;
+    auto sp = reinterpret_cast<const uint8_t*>(bptr);
+    auto ep = reinterpret_cast<const uint8_t*>(eptr);
+    while(cur && !(cur & Dfa::entry_dead) && (sp != ep)) {
+      uint32_t next = dfa.trans[(cur >> Dfa::entry_shift) + this->m_classes[*sp]];
+      if(ROCKET_UNEXPECT(!next))
+        next = this->do_dfa_transit(dfa, cur, *sp);
+      cur = next;
+      sp++;
+    }
+
+    if(!cur)
+      dfa.clear();
+    else if((sp != ep) || !this->do_dfa_check_end(dfa, dfa.sid_of(cur), ctx_edge))
+      return false;
+    else if(nsubs == 1) {
+      subs[0] = { bptr, eptr };
+      return true;
+    }
+    return this->do_pike(subs, nsubs, bptr, eptr, ctx_edge, true, true, false);
+  }
+
+}  // namespace asteria
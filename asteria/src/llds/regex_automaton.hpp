@@ -0,0 +1,144 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_LLDS_REGEX_AUTOMATON_HPP_
+#define ASTERIA_LLDS_REGEX_AUTOMATON_HPP_
+
+#include "../fwd.hpp"
+
+namespace asteria {
+
+// This is a regular expression engine whose matching time is linear in the length of
+// the subject. It accepts a subset of the ECMAScript grammar of `std::regex`, which
+// excludes back-references and lookahead assertions, with identical semantics.
+//
+// Patterns are compiled to Thompson NFAs. Searches are performed by DFAs that are
+// built lazily from them, one forwards to find the end of the leftmost match, then
+// one backwards to find its start. If the pattern begins with a literal string, bytes
+// that cannot start a match are skipped with SIMD instructions. Submatches are only
+// extracted when requested, by simulating the NFA (the Pike VM) over the match.
+class Regex_Automaton
+final
+  : public Rcfwd<Regex_Automaton>
+  {
+  public:
+    // A submatch is denoted by two pointers into the subject. Both pointers are
+    // null if the group did not participate in the match.
+    struct Submatch
+      {
+        const char* first;
+        const char* second;
+      };
+
+    struct Inst
+      {
+        uint8_t op;
+        uint32_t arg;  // byte set, capture slot or assertion
+        uint32_t x;    // next instruction, or the preferred one of a split
+        uint32_t y;    // the other alternative of a split
+      };
+
+    struct Byte_Set
+      {
+        uint64_t bits[4];
+      };
+
+    struct Dfa;
+    struct Pike;
+
+  private:
+    cow_vector<Inst> m_fwd;  // forwards, with capturing groups
+    cow_vector<Inst> m_rev;  // backwards, without capturing groups
+    cow_vector<Byte_Set> m_sets;
+    uint32_t m_fwd_start = 0;
+    uint32_t m_rev_start = 0;
+    uint32_t m_ngroups = 0;
+    bool m_anchored = false;  // all matches begin with `^`
+    cow_string m_prefix;      // all matches begin with this string
+
+    // Bytes that no instruction can distinguish are mapped to the same class, so
+    // DFA transition tables need only one entry for each class.
+    uint8_t m_classes[256];
+    uint32_t m_nclasses = 0;
+
+    // These are built on demand.
+    mutable uptr<Dfa> m_dfas[4];
+    mutable uptr<Pike> m_pike;
+
+  public:
+    Regex_Automaton()
+    noexcept;
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Regex_Automaton);
+
+  private:
+    Dfa&
+    do_get_dfa(uint32_t which)
+    const;
+
+    uint32_t
+    do_dfa_transit(Dfa& dfa, uint32_t entry, uint8_t byte)
+    const;
+
+    bool
+    do_dfa_check_end(Dfa& dfa, uint32_t sid, int rctx)
+    const;
+
+    int
+    do_dfa_scan_forward(const char*& mend, Dfa& dfa, const char* bptr, const char* eptr, int lctx)
+    const;
+
+    int
+    do_dfa_scan_backward(const char*& mbeg, Dfa& dfa, const char* bptr, const char* eptr, int lctx,
+                         int rctx)
+    const;
+
+    const char*
+    do_find_prefix(const char* bptr, const char* eptr)
+    const noexcept;
+
+    bool
+    do_pike(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, int lctx,
+            bool anchored, bool full, bool not_null)
+    const;
+
+  public:
+    // Compiles a pattern. If the pattern is not supported, `false` is returned, and
+    // this object shall not be used for matching. The pattern may be invalid; in this
+    // case it shall also be rejected by `std::regex`.
+    bool
+    compile(const char* pattern, size_t length);
+
+    // Gets the number of capturing groups, excluding the entire match.
+    size_t
+    count_groups()
+    const noexcept
+      { return this->m_ngroups;  }
+
+    // Searches `[bptr, eptr)` for the leftmost match, like `std::regex_search()`. If
+    // `prev_avail` is set, `bptr[-1]` is taken into account by `^` and `\b`, like
+    // `std::regex_constants::match_prev_avail`. Up to `nsubs` submatches are stored
+    // into `subs`, where the first one denotes the entire match; `nsubs` shall not be
+    // zero. Extracting submatches other than the first one is relatively expensive.
+    bool
+    search(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, bool prev_avail)
+    const;
+
+    // Checks for a match that starts at `bptr`, like `std::regex_search()` with
+    // `std::regex_constants::match_continuous`. If `not_null` is set, empty matches
+    // are ignored, like `std::regex_constants::match_not_null`.
+    bool
+    match_prefix(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr, bool prev_avail,
+                 bool not_null)
+    const;
+
+    // Checks whether `[bptr, eptr)` matches the pattern entirely, like
+    // `std::regex_match()`.
+    bool
+    match(Submatch* subs, size_t nsubs, const char* bptr, const char* eptr)
+    const;
+  };
+
+}  // namespace asteria
+
+#endif
@@ -0,0 +1,310 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "variable_slab.hpp"
+#include "../runtime/variable.hpp"
+#include "../utilities.hpp"
+#include <sys/mman.h>  // ::mmap(), ::munmap()
+
+namespace asteria {
+
+struct Variable_Slab::Slab
+  {
+    Slab* next;     // the next slab in the [non-circular] list
+    Slab* prev;     // the previous slab in the [non-circular] list
+    Block* free;    // the most recently deallocated block
+    char* bump;     // the first block that has never been allocated
+    size_t nused;   // number of blocks in use
+  };
+
+namespace {
+
+constexpr size_t s_block_align = alignof(::std::max_align_t);
+constexpr size_t s_slab_mask = Variable_Slab::slab_size - 1;
+
+constexpr
+size_t
+do_align_up(size_t size)
+noexcept
+  { return (size + s_block_align - 1) / s_block_align * s_block_align;  }
+
+}  // namespace
+
+Variable_Slab::
+~Variable_Slab()
+  {
+    // Slabs that are still in use are leaked, as variables that live in them may
+    // be destroyed later.
+    while(auto slab = this->m_spare) {
+      this->m_spare = slab->next;
+      this->do_destroy_slab(slab);
+    }
+  }
+
+Variable_Slab::Slab*
+Variable_Slab::
+do_create_slab()
+  {
+    // Map twice as much memory as needed, then unmap the excess, so the slab is aligned
+    // to its size.
+    auto base = ::mmap(nullptr, slab_size * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(base == MAP_FAILED)
+      throw ::std::bad_alloc();
+
+    auto addr = reinterpret_cast<uintptr_t>(base);
+    auto slab = reinterpret_cast<Slab*>((addr + s_slab_mask) & ~s_slab_mask);
+    auto nhead = reinterpret_cast<uintptr_t>(slab) - addr;
+    if(nhead != 0)
+      ::munmap(base, nhead);
+    if(nhead != slab_size)
+      ::munmap(reinterpret_cast<char*>(slab) + slab_size, slab_size - nhead);
+
+    // Initialize the header, which is followed by blocks. All blocks are free.
+    slab->next = nullptr;
+    slab->prev = nullptr;
+    slab->free = nullptr;
+    slab->bump = reinterpret_cast<char*>(slab) + do_align_up(sizeof(Slab));
+    slab->nused = 0;
+
+    this->m_stats.nslabs++;
+    this->m_stats.nbytes += slab_size;
+    this->m_stats.nbytes_peak = ::rocket::max(this->m_stats.nbytes_peak, this->m_stats.nbytes);
+    this->m_stats.nslab_allocs++;
+    return slab;
+  }
+
+void
+Variable_Slab::
+do_destroy_slab(Slab* slab)
+noexcept
+  {
+    ROCKET_ASSERT(slab->nused == 0);
+    ::munmap(slab, slab_size);
+
+    this->m_stats.nslabs--;
+    this->m_stats.nbytes -= slab_size;
+    this->m_stats.nslab_frees++;
+  }
+
+void
+Variable_Slab::
+do_list_attach(Slab* slab)
+noexcept
+  {
+    // Insert the slab before `m_avail`.
+    auto next = ::std::exchange(this->m_avail, slab);
+    slab->next = next;
+    slab->prev = nullptr;
+    if(next)
+      next->prev = slab;
+  }
+
+void
+Variable_Slab::
+do_list_detach(Slab* slab)
+noexcept
+  {
+    auto next = slab->next;
+    auto prev = slab->prev;
+    (prev ? prev->next : this->m_avail) = next;
+    if(next)
+      next->prev = prev;
+  }
+
+size_t
+Variable_Slab::
+block_size()
+noexcept
+  {
+    return do_align_up(sizeof(Variable));
+  }
+
+Variable_Slab::Block*
+Variable_Slab::
+do_pop_block()
+  {
+    // Get a slab that has free blocks. If there is none, allocate a new one.
+    auto slab = this->m_avail;
+    if(ROCKET_UNEXPECT(!slab)) {
+      slab = this->m_spare;
+      if(slab) {
+        this->m_spare = slab->next;
+        this->m_nspare--;
+      }
+      else
+        slab = this->do_create_slab();
+      this->do_list_attach(slab);
+    }
+
+    // Prefer the most recently deallocated block, which is likely still in cache.
+    // If there is none, take one that has never been used.
+    auto end = reinterpret_cast<char*>(slab) + slab_size;
+    auto qblk = slab->free;
+    if(ROCKET_EXPECT(qblk))
+      slab->free = qblk->next;
+    else
+      qblk = reinterpret_cast<Block*>(::std::exchange(slab->bump, slab->bump + block_size()));
+
+    // If the slab has been exhausted, remove it from the list.
+    slab->nused++;
+    if(!slab->free && (end - slab->bump < static_cast<ptrdiff_t>(block_size())))
+      this->do_list_detach(slab);
+
+    this->m_stats.nlive++;
+    return qblk;
+  }
+
+void
+Variable_Slab::
+do_push_block(Block* qblk)
+noexcept
+  {
+    // Locate the slab from the block.
+    auto slab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(qblk) & ~s_slab_mask);
+    ROCKET_ASSERT(slab->nused > 0);
+    auto end = reinterpret_cast<char*>(slab) + slab_size;
+    bool avail = slab->free || (end - slab->bump >= static_cast<ptrdiff_t>(block_size()));
+
+    // Push the block onto the free list.
+    qblk->next = slab->free;
+    slab->free = qblk;
+
+    // Move the slab to the beginning of the list, so its blocks will be reused first.
+    if(avail)
+      this->do_list_detach(slab);
+    this->do_list_attach(slab);
+
+    this->m_stats.nlive--;
+    slab->nused--;
+    if(slab->nused != 0)
+      return;
+
+    // The slab is empty now. Reset it, so blocks will be allocated in address order again.
+    this->do_list_detach(slab);
+    slab->free = nullptr;
+    slab->bump = reinterpret_cast<char*>(slab) + do_align_up(sizeof(Slab));
+
+    // Keep some empty slabs, so variables that are allocated and deallocated repeatedly
+    // will not cause slabs to be mapped and unmapped every time.
+    if(this->m_nspare < spare_max) {
+      slab->next = ::std::exchange(this->m_spare, slab);
+      this->m_nspare++;
+    }
+    else
+      this->do_destroy_slab(slab);
+  }
+
+void*
+Variable_Slab::
+allocate()
+  {
+    ::rocket::mutex::unique_lock lock(this->m_mutex);
+    auto qblk = this->do_pop_block();
+    this->m_stats.nallocs++;
+    return qblk;
+  }
+
+void
+Variable_Slab::
+deallocate(void* ptr)
+noexcept
+  {
+    ROCKET_ASSERT(ptr);
+    ::rocket::mutex::unique_lock lock(this->m_mutex);
+    this->do_push_block(static_cast<Block*>(ptr));
+    this->m_stats.nfrees++;
+  }
+
+Variable_Slab::Stats
+Variable_Slab::
+get_stats()
+const noexcept
+  {
+    ::rocket::mutex::unique_lock lock(this->m_mutex);
+    return this->m_stats;
+  }
+
+Variable_Slab::Cache::
+~Cache()
+  {
+    // If a variable is allocated or deallocated after the cache has been destroyed,
+    // which may happen during program termination, it bypasses the cache.
+    this->flush();
+    this->m_limit = 0;
+  }
+
+void*
+Variable_Slab::Cache::
+do_refill_and_allocate()
+  {
+    auto slab = this->m_slab;
+    if(ROCKET_UNEXPECT(this->m_limit == 0))
+      return slab->allocate();
+
+    // Take a batch of blocks from slabs. The first one is returned to the caller.
+    ::rocket::mutex::unique_lock lock(slab->m_mutex);
+    auto qblk = slab->do_pop_block();
+    try {
+      for(size_t k = 1;  k < batch_size;  ++k) {
+        auto qnext = slab->do_pop_block();
+        qnext->next = this->m_head;
+        this->m_head = qnext;
+        this->m_count++;
+      }
+    }
+    catch(::std::exception& /*stdex*/) {
+      // Give back all blocks that have been taken, then report the failure.
+      slab->do_push_block(qblk);
+      while(auto qnext = this->m_head) {
+        this->m_head = qnext->next;
+        this->m_count--;
+        slab->do_push_block(qnext);
+      }
+      throw;
+    }
+    slab->m_stats.nallocs += ::std::exchange(this->m_nallocs, 0) + 1;
+    slab->m_stats.nfrees += ::std::exchange(this->m_nfrees, 0);
+    return qblk;
+  }
+
+void
+Variable_Slab::Cache::
+do_drain_and_deallocate(void* ptr)
+noexcept
+  {
+    auto slab = this->m_slab;
+    if(ROCKET_UNEXPECT(this->m_limit == 0))
+      return slab->deallocate(ptr);
+
+    // Return a batch of blocks to slabs, including `ptr`.
+    ::rocket::mutex::unique_lock lock(slab->m_mutex);
+    slab->do_push_block(static_cast<Block*>(ptr));
+    for(size_t k = 1;  k < batch_size;  ++k) {
+      auto qblk = this->m_head;
+      this->m_head = qblk->next;
+      this->m_count--;
+      slab->do_push_block(qblk);
+    }
+    slab->m_stats.nallocs += ::std::exchange(this->m_nallocs, 0);
+    slab->m_stats.nfrees += ::std::exchange(this->m_nfrees, 0) + 1;
+  }
+
+Variable_Slab::Cache&
+Variable_Slab::Cache::
+flush()
+noexcept
+  {
+    auto slab = this->m_slab;
+    ::rocket::mutex::unique_lock lock(slab->m_mutex);
+    while(auto qblk = this->m_head) {
+      this->m_head = qblk->next;
+      this->m_count--;
+      slab->do_push_block(qblk);
+    }
+    slab->m_stats.nallocs += ::std::exchange(this->m_nallocs, 0);
+    slab->m_stats.nfrees += ::std::exchange(this->m_nfrees, 0);
+    return *this;
+  }
+
+}  // namespace asteria
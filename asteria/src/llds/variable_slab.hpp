@@ -0,0 +1,182 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_LLDS_VARIABLE_SLAB_HPP_
+#define ASTERIA_LLDS_VARIABLE_SLAB_HPP_
+
+#include "../fwd.hpp"
+#include "../../rocket/mutex.hpp"
+
+namespace asteria {
+
+// This is a fixed-size allocator for `Variable`s. Storage is carved from slabs of
+// `slab_size` bytes, each of which is aligned to its size, so the slab that a block
+// belongs to can be located by masking its address. Each slab has a LIFO free list,
+// and the slab that has been most recently deallocated into is preferred, so freed
+// blocks are reused while they are still in cache. Slabs are mapped from the system
+// directly. Up to `spare_max` empty slabs are kept for reuse, the most recently emptied
+// one first, so a heap that shrinks and grows again does not cause slabs to be mapped
+// and faulted in again; further empty ones are unmapped.
+class Variable_Slab
+  {
+  public:
+    class Cache;
+
+    static constexpr size_t slab_size = 65536;
+    static constexpr size_t spare_max = 256;  // 16 MiB
+
+    struct Stats
+      {
+        size_t nlive = 0;          // number of blocks in use, including cached ones
+        size_t nslabs = 0;         // number of slabs mapped, including empty ones
+        size_t nbytes = 0;         // number of bytes mapped from the system
+        size_t nbytes_peak = 0;    // maximum value of `nbytes` ever
+        uint64_t nallocs = 0;      // number of blocks allocated in total
+        uint64_t nfrees = 0;       // number of blocks deallocated in total
+        uint64_t nslab_allocs = 0; // number of slabs mapped in total
+        uint64_t nslab_frees = 0;  // number of slabs unmapped in total
+      };
+
+  private:
+    struct Block
+      {
+        Block* next;  // the next free block
+      };
+
+    struct Slab;
+
+    mutable ::rocket::mutex m_mutex;
+    Slab* m_avail = nullptr;  // slabs with free blocks, the most recently used first
+    Slab* m_spare = nullptr;  // empty slabs that are kept for reuse, the most recent first
+    size_t m_nspare = 0;
+    Stats m_stats;
+
+  public:
+    constexpr
+    Variable_Slab()
+    noexcept
+      { }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Variable_Slab);
+
+  private:
+    inline
+    Block*
+    do_pop_block();
+
+    inline
+    void
+    do_push_block(Block* qblk)
+    noexcept;
+
+    Slab*
+    do_create_slab();
+
+    void
+    do_destroy_slab(Slab* slab)
+    noexcept;
+
+    inline
+    void
+    do_list_attach(Slab* slab)
+    noexcept;
+
+    inline
+    void
+    do_list_detach(Slab* slab)
+    noexcept;
+
+  public:
+    // Gets the size of each block. This is always `sizeof(Variable)` rounded up.
+    static
+    size_t
+    block_size()
+    noexcept;
+
+    // Allocates a block. Only `block_size()` bytes are accessible.
+    void*
+    allocate();
+
+    // Deallocates a block. `ptr` shall have been returned by `allocate()` of the same slab
+    // allocator, and shall not be null.
+    void
+    deallocate(void* ptr)
+    noexcept;
+
+    Stats
+    get_stats()
+    const noexcept;
+  };
+
+// Each thread may keep a small number of free blocks in a cache, so most allocations
+// and deallocations do not have to lock the slab allocator. Blocks are exchanged with
+// slabs in batches. Counters of allocations and deallocations are also accumulated
+// here, and are added to those of the slab allocator when blocks are exchanged.
+class Variable_Slab::Cache
+  {
+  public:
+    static constexpr size_t capacity = 64;
+    static constexpr size_t batch_size = 32;
+
+  private:
+    Variable_Slab* m_slab;
+    Block* m_head = nullptr;
+    size_t m_count = 0;
+    size_t m_limit = capacity;  // zero after destruction
+    uint64_t m_nallocs = 0;
+    uint64_t m_nfrees = 0;
+
+  public:
+    explicit constexpr
+    Cache(Variable_Slab& slab)
+    noexcept
+      : m_slab(&slab)
+      { }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Cache);
+
+  private:
+    void*
+    do_refill_and_allocate();
+
+    void
+    do_drain_and_deallocate(void* ptr)
+    noexcept;
+
+  public:
+    void*
+    allocate()
+      {
+        auto qblk = this->m_head;
+        if(ROCKET_UNEXPECT(!qblk))
+          return this->do_refill_and_allocate();
+
+        this->m_head = qblk->next;
+        this->m_count--;
+        this->m_nallocs++;
+        return qblk;
+      }
+
+    void
+    deallocate(void* ptr)
+    noexcept
+      {
+        if(ROCKET_UNEXPECT(this->m_count >= this->m_limit))
+          return this->do_drain_and_deallocate(ptr);
+
+        auto qblk = static_cast<Block*>(ptr);
+        qblk->next = this->m_head;
+        this->m_head = qblk;
+        this->m_count++;
+        this->m_nfrees++;
+      }
+
+    // Returns all cached blocks to slabs.
+    Cache&
+    flush()
+    noexcept;
+  };
+
+}  // namespace asteria
+
+#endif
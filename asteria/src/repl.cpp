@@ -32,6 +32,7 @@ do_print_help_and_exit(const char* self)
 """""""""""""""""""""""""""""""""""""""""""""""""""""""""" R"'''''''''''''''(
 Usage: %s [OPTIONS] [[--] FILE [ARGUMENTS]...]
 
+  -c OUT  compile FILE into bytecode, write it to OUT, then exit
   -h      show help message then exit
   -I      suppress interactive mode [default = auto]
   -i      force interactive mode [default = auto]
@@ -49,6 +50,9 @@ specified and standard input is connected to a terminal, and is disabled
 otherwise. Be advised that specifying `-` explicitly disables interactive
 mode.
 
+Bytecode files that have been generated with `-c` can be executed in place
+of source files. They are recognized by their signatures.
+
 When running in non-interactive mode, characters are read from FILE, then
 compiled and executed. If the script returns an integer, it is truncated to
 an 8-bit unsigned integer and then used as the exit status. If the script
@@ -128,6 +132,7 @@ struct Command_Line_Options
     // options
     bool verbose = false;
     bool interactive = false;
+    cow_string output;
 
     // non-options
     cow_string path;
@@ -250,6 +255,7 @@ do_parse_command_line(int argc, char** argv)
     opt<bool> verbose;
     opt<bool> interactive;
     opt<cow_string> path;
+    opt<cow_string> output;
     cow_vector<Value> args;
 
     // Check for some common options before calling `getopt()`.
@@ -263,9 +269,13 @@ do_parse_command_line(int argc, char** argv)
 
     // Parse command-line options.
     int ch;
-    while((ch = ::getopt(argc, argv, "+hIiO::Vv")) != -1) {
+    while((ch = ::getopt(argc, argv, "+c:hIiO::Vv")) != -1) {
       // Identify a single option.
       switch(ch) {
+        case 'c':
+          output = cow_string(optarg);
+          continue;
+
         case 'h':
           help = true;
           continue;
@@ -330,10 +340,14 @@ do_parse_command_line(int argc, char** argv)
 
     // Interactive mode is enabled when no FILE is given (not even `-`) and standard input is
     // connected to a terminal.
+    // Compiling a script implies non-interactive mode.
     if(interactive)
       cmdline.interactive = *interactive;
     else
-      cmdline.interactive = !path && ::isatty(STDIN_FILENO);
+      cmdline.interactive = !path && !output && ::isatty(STDIN_FILENO);
+
+    if(output)
+      cmdline.output = ::std::move(*output);
 
     // These arguments are always overwritten.
     cmdline.path = path.move_value_or(::rocket::sref("-"));
@@ -555,6 +569,10 @@ do_single_noreturn()
       script.open_options().verbose_single_step_traps = true;
     }
 
+    // Code is only kept if it is to be saved.
+    if(!cmdline.output.empty())
+      script.set_retain_code(true);
+
     // Consume all data from standard input.
     try {
       if(cmdline.path == "-")
@@ -566,6 +584,17 @@ do_single_noreturn()
       // Report the error and exit.
       { do_exit(exit_parser_error, "! error: %s\n", except.what());  }
 
+    // If an output file has been specified, write bytecode to it instead.
+    if(!cmdline.output.empty()) {
+      try {
+        script.save_bytecode_file(cmdline.output.safe_c_str());
+      }
+      catch(exception& except)
+        { do_exit(exit_system_error, "! could not write bytecode: %s\n", except.what());  }
+
+      do_exit(exit_success);
+    }
+
     // Execute the script.
     ASTERIA_RUNTIME_TRY {
       const auto ref = script.execute(global, ::std::move(cmdline.args));
@@ -589,7 +618,7 @@ do_single_noreturn()
 int
 main(int argc, char** argv)
   try {
-    // Select the C locale. UTF-8 is required for wide-oriented standard streams.
+    // Select the C locale, with UTF-8 as the multibyte encoding.
     ::setlocale(LC_ALL, "C.UTF-8");
 
     // Note that this function shall not return in case of errors.
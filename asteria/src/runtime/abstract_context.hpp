@@ -39,11 +39,6 @@ class Abstract_Context
     const noexcept
       = 0;
 
-    virtual
-    Reference*
-    do_lazy_lookup_opt(const phsh_string& name)
-      = 0;
-
   public:
     bool
     is_analytic()
@@ -58,13 +53,7 @@ class Abstract_Context
     const Reference*
     get_named_reference_opt(const phsh_string& name)
     const
-      {
-        auto qref = this->m_named_refs.get_opt(name);
-        // Initialize builtins only when needed.
-        if(ROCKET_UNEXPECT(!qref))
-          qref = const_cast<Abstract_Context*>(this)->do_lazy_lookup_opt(name);
-        return qref;
-      }
+      { return this->m_named_refs.get_opt(name);  }
 
     Reference&
     open_named_reference(const phsh_string& name)
@@ -14,6 +14,8 @@
 #include "variable.hpp"
 #include "ptc_arguments.hpp"
 #include "loader_lock.hpp"
+#include "module_cache.hpp"
+#include "bytecode.hpp"
 #include "air_optimizer.hpp"
 #include "../compiler/token_stream.hpp"
 #include "../compiler/statement_sequence.hpp"
@@ -61,8 +63,9 @@ do_forward_if_opt(bool dirty, XNodeT&& xnode)
       return nullopt;
   }
 
-Executive_Context&
-do_set_temporary(Executive_Context& ctx, bool assign, Reference_root::S_temporary&& xref)
+template<typename ContextT>
+ContextT&
+do_set_temporary(ContextT& ctx, bool assign, Reference_root::S_temporary&& xref)
   {
     ROCKET_ASSERT(!ctx.stack().empty());
 
@@ -104,9 +107,9 @@ do_evaluate_subexpression(Executive_Context& ctx, bool assign, const AVMC_Queue&
   }
 
 Reference&
-do_declare(Executive_Context& ctx, const phsh_string& name)
+do_declare(Executive_Context& ctx, uint32_t slot)
   {
-    return ctx.open_named_reference(name) = Reference_root::S_void();
+    return ctx.open_local_reference(slot) = Reference_root::S_void();
   }
 
 AIR_Status
@@ -126,6 +129,22 @@ do_execute_block(const AVMC_Queue& queue, const Executive_Context& ctx)
     return status;
   }
 
+const Reference&
+do_get_local_reference(const Executive_Context& ctx, uint32_t depth, uint32_t slot, const phsh_string& name)
+  {
+    // Get the context.
+    const Executive_Context* qctx = &ctx;
+    ::rocket::ranged_for(UINT32_C(0), depth, [&](uint32_t) { qctx = qctx->get_parent_opt();  });
+    ROCKET_ASSERT(qctx);
+
+    // Get the reference in its slot.
+    // Check if control flow has bypassed its initialization.
+    auto qref = qctx->get_local_reference_opt(slot);
+    if(!qref || qref->is_void())
+      ASTERIA_THROW("Use of bypassed variable `$1`", name);
+    return *qref;
+  }
+
 // These are user-defined parameter types for AVMC nodes.
 // The `enumerate_variables()` callback is optional.
 
@@ -169,7 +188,6 @@ struct Sparam_switch
   {
     cow_vector<AVMC_Queue> queues_labels;
     cow_vector<AVMC_Queue> queues_bodies;
-    cow_vector<cow_vector<phsh_string>> names_added;
 
     Variable_Callback&
     enumerate_variables(Variable_Callback& callback)
@@ -183,8 +201,8 @@ struct Sparam_switch
 
 struct Sparam_for_each
   {
-    phsh_string name_key;
-    phsh_string name_mapped;
+    uint32_t slot_key;
+    uint32_t slot_mapped;
     AVMC_Queue queue_init;
     AVMC_Queue queue_body;
 
@@ -203,7 +221,8 @@ struct Sparam_try_catch
     Source_Location sloc_try;
     AVMC_Queue queue_try;
     Source_Location sloc_catch;
-    phsh_string name_except;
+    uint32_t slot_except;
+    uint32_t slot_backtrace;
     AVMC_Queue queue_catch;
 
     Variable_Callback&
@@ -247,6 +266,49 @@ struct Sparam_defer
       }
   };
 
+struct Sparam_local_immediate
+  {
+    Source_Location sloc_local;
+    Source_Location sloc_oper;
+    phsh_string name;
+    Value value;
+
+    Variable_Callback&
+    enumerate_variables(Variable_Callback& callback)
+    const
+      {
+        this->value.enumerate_variables(callback);
+        return callback;
+      }
+  };
+
+struct Sparam_local_immediate_branch
+  {
+    Source_Location sloc_local;
+    Source_Location sloc_oper;
+    phsh_string name;
+    Value value;
+    bool negative;
+    AVMC_Queue queue_true;
+    AVMC_Queue queue_false;
+
+    Variable_Callback&
+    enumerate_variables(Variable_Callback& callback)
+    const
+      {
+        this->value.enumerate_variables(callback);
+        this->queue_true.enumerate_variables(callback);
+        this->queue_false.enumerate_variables(callback);
+        return callback;
+      }
+  };
+
+struct Sparam_member_cache
+  {
+    phsh_string name;
+    mutable V_object::hint_type hint;
+  };
+
 // These are traits for individual AIR node types.
 // Each traits struct must contain the `execute()` function, and optionally,
 // these functions: `make_uparam()`, `make_sparam()`, `make_symbols()`.
@@ -275,7 +337,7 @@ struct AIR_Traits<AIR_Node::S_clear_stack>
 bool
 do_solidify_code(AVMC_Queue& queue, const cow_vector<AIR_Node>& code)
   {
-    return ::rocket::all_of(code, [&](const AIR_Node& node) { return node.solidify(queue);  });
+    return AIR_Node::solidify_code(queue, code);
   }
 
 template<>
@@ -304,9 +366,19 @@ struct AIR_Traits<AIR_Node::S_execute_block>
 template<>
 struct AIR_Traits<AIR_Node::S_declare_variable>
   {
-    // `Uparam` is unused.
+    // `Uparam` is `escaping` and the slot.
     // `Sparam` is the source location and name;
 
+    static
+    AVMC_Queue::Uparam
+    make_uparam(bool& /*reachable*/, const AIR_Node::S_declare_variable& altr)
+      {
+        AVMC_Queue::Uparam up;
+        up.y8s[0] = altr.escaping;
+        up.y32 = altr.slot;
+        return up;
+      }
+
     static
     Sparam_sloc_name
     make_sparam(bool& /*reachable*/, const AIR_Node::S_declare_variable& altr)
@@ -328,15 +400,16 @@ struct AIR_Traits<AIR_Node::S_declare_variable>
 
     static
     AIR_Status
-    execute(Executive_Context& ctx, const Sparam_sloc_name& sp)
+    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_sloc_name& sp)
       {
         // Allocate an uninitialized variable.
+        // If it does not escape, it need not be tracked.
         auto gcoll = ctx.global().genius_collector();
-        auto var = gcoll->create_variable();
+        auto var = up.y8s[0] ? gcoll->create_variable() : gcoll->create_local_variable();
 
         // Inject the variable into the current context.
         Reference_root::S_variable xref = { ::std::move(var) };
-        ctx.open_named_reference(sp.name) = xref;  // it'll be used later so don't move!
+        ctx.open_local_reference(up.y32) = xref;  // it'll be used later so don't move!
 
         // Call the hook function if any.
         if(auto qhooks = ctx.global().get_hooks_opt())
@@ -454,7 +527,6 @@ struct AIR_Traits<AIR_Node::S_switch_statement>
         Sparam_switch sp;
         do_xsolidify_code(sp.queues_labels, altr.code_labels);
         do_xsolidify_code(sp.queues_bodies, altr.code_bodies);
-        sp.names_added = altr.names_added;
         return sp;
       }
 
@@ -465,7 +537,6 @@ struct AIR_Traits<AIR_Node::S_switch_statement>
         // Get the number of clauses.
         auto nclauses = sp.queues_labels.size();
         ROCKET_ASSERT(nclauses == sp.queues_bodies.size());
-        ROCKET_ASSERT(nclauses == sp.names_added.size());
 
         // Read the value of the condition.
         auto cond = ctx.stack().get_top().read();
@@ -494,12 +565,9 @@ struct AIR_Traits<AIR_Node::S_switch_statement>
         // Skip this statement if no matching clause has been found.
         if(bp != SIZE_MAX) {
           // Note that all clauses share the same context.
+          // Variables whose declarations have been bypassed are left void.
           Executive_Context ctx_body(::rocket::ref(ctx));
 
-          // Inject all bypassed variables into the scope.
-          for(const auto& name : sp.names_added[bp])
-            do_declare(ctx_body, name);
-
           AIR_Status status;
           ASTERIA_RUNTIME_TRY {
             do {
@@ -631,8 +699,8 @@ struct AIR_Traits<AIR_Node::S_for_each_statement>
     make_sparam(bool& /*reachable*/, const AIR_Node::S_for_each_statement& altr)
       {
         Sparam_for_each sp;
-        sp.name_key = altr.name_key;
-        sp.name_mapped = altr.name_mapped;
+        sp.slot_key = altr.slot_key;
+        sp.slot_mapped = altr.slot_mapped;
         do_solidify_code(sp.queue_init, altr.code_init);
         do_solidify_code(sp.queue_body, altr.code_body);
         return sp;
@@ -653,10 +721,10 @@ struct AIR_Traits<AIR_Node::S_for_each_statement>
         const auto vkey = gcoll->create_variable();
         // Inject the variable into the current context.
         Reference_root::S_variable xref = { vkey };
-        ctx_for.open_named_reference(sp.name_key) = xref;
+        ctx_for.open_local_reference(sp.slot_key) = xref;
 
         // Create the mapped reference.
-        auto& mapped = do_declare(ctx_for, sp.name_mapped);
+        auto& mapped = do_declare(ctx_for, sp.slot_mapped);
         // Evaluate the range initializer.
         auto status = sp.queue_init.execute(ctx_for);
         ROCKET_ASSERT(status == air_status_next);
@@ -789,7 +857,8 @@ struct AIR_Traits<AIR_Node::S_try_statement>
         sp.sloc_try = altr.sloc_try;
         bool rtry = do_solidify_code(sp.queue_try, altr.code_try);
         sp.sloc_catch = altr.sloc_catch;
-        sp.name_except = altr.name_except;
+        sp.slot_except = altr.slot_except;
+        sp.slot_backtrace = altr.slot_backtrace;
         bool rcatch = do_solidify_code(sp.queue_catch, altr.code_catch);
         reachable &= rtry | rcatch;
         return sp;
@@ -819,7 +888,7 @@ struct AIR_Traits<AIR_Node::S_try_statement>
         ASTERIA_RUNTIME_TRY {
           // Set the exception reference.
           Reference_root::S_temporary xref = { except.value() };
-          ctx_catch.open_named_reference(sp.name_except) = ::std::move(xref);
+          ctx_catch.open_local_reference(sp.slot_except) = ::std::move(xref);
 
           // Set backtrace frames.
           V_array backtrace;
@@ -838,7 +907,7 @@ struct AIR_Traits<AIR_Node::S_try_statement>
             backtrace.emplace_back(::std::move(r));
           }
           xref.val = ::std::move(backtrace);
-          ctx_catch.open_named_reference(::rocket::sref("__backtrace")) = ::std::move(xref);
+          ctx_catch.open_local_reference(sp.slot_backtrace) = ::std::move(xref);
 
           // Execute the `catch` clause.
           status = sp.queue_catch.execute(ctx_catch);
@@ -1040,15 +1109,19 @@ struct AIR_Traits<AIR_Node::S_push_global_reference>
 template<>
 struct AIR_Traits<AIR_Node::S_push_local_reference>
   {
-    // `Uparam` is the depth.
+    // `Uparam` is the depth and slot.
     // `Sparam` is the source location and name;
 
     static
     AVMC_Queue::Uparam
     make_uparam(bool& /*reachable*/, const AIR_Node::S_push_local_reference& altr)
       {
+        if(altr.depth > UINT16_MAX)
+          ASTERIA_THROW("Context nesting too deep (depth `$1` for `$2`)", altr.depth, altr.name);
+
         AVMC_Queue::Uparam up;
-        up.x32 = altr.depth;
+        up.x16 = static_cast<uint16_t>(altr.depth);
+        up.x32 = altr.slot;
         return up;
       }
 
@@ -1075,22 +1148,8 @@ struct AIR_Traits<AIR_Node::S_push_local_reference>
     AIR_Status
     execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_sloc_name& sp)
       {
-        // Get the context.
-        const Executive_Context* qctx = &ctx;
-        ::rocket::ranged_for(UINT32_C(0), up.x32, [&](uint32_t) { qctx = qctx->get_parent_opt();  });
-        ROCKET_ASSERT(qctx);
-
-        // Look for the name in the context.
-        auto qref = qctx->get_named_reference_opt(sp.name);
-        if(!qref)
-          ASTERIA_THROW("Undeclared identifier `$1`", sp.name);
-
-        // Check if control flow has bypassed its initialization.
-        if(qref->is_void())
-          ASTERIA_THROW("Use of bypassed variable `$1`", sp.name);
-
         // Push a copy of it.
-        ctx.stack().push(*qref);
+        ctx.stack().push(do_get_local_reference(ctx, up.x16, up.x32, sp.name));
         return air_status_next;
       }
   };
@@ -1269,6 +1328,9 @@ do_invoke_nontail(Reference& self, const Source_Location& sloc, Executive_Contex
     }
     if(auto qhooks = ctx.global().get_hooks_opt())
       qhooks->on_function_return(sloc, target, self);
+
+    // If `args` has not been consumed by the target, reuse its storage.
+    ctx.global().recycle_reference_buffer(::std::move(args));
     return self;
   }
 
@@ -1299,8 +1361,8 @@ do_function_call_common(Reference& self, const Source_Location& sloc, Executive_
 cow_vector<Reference>
 do_pop_positional_arguments(Executive_Context& ctx, size_t nargs)
   {
-    cow_vector<Reference> args;
-    args.resize(nargs, Reference_root::S_void());
+    auto args = ctx.global().allocate_reference_buffer();
+    args.append(nargs, Reference_root::S_void());
     for(size_t i = args.size() - 1;  i != SIZE_MAX;  --i) {
       // Get an argument. Ensure it is dereferenceable.
       auto& arg = ctx.stack().open_top();
@@ -1428,9 +1490,10 @@ struct AIR_Traits<AIR_Node::S_push_unnamed_array>
         return syms;
       }
 
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // Pop elements from the stack and store them in an array backwards.
         V_array array;
@@ -1470,9 +1533,10 @@ struct AIR_Traits<AIR_Node::S_push_unnamed_object>
         return syms;
       }
 
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const cow_vector<phsh_string>& keys)
+    execute(ContextT& ctx, const cow_vector<phsh_string>& keys)
       {
         // Pop elements from the stack and store them in an object backwards.
         V_object object;
@@ -1665,109 +1729,103 @@ do_check_trunci(double value)
     return int64_t(value);
   }
 
-cow_string
-do_string_dup(const cow_string& src, int64_t count)
+cow_string&
+do_string_dup(cow_string& str, int64_t count)
   {
     if(count < 0)
       ASTERIA_THROW("Negative duplicate count (count was `$2`)", count);
 
-    cow_string res;
-    size_t nchars = src.size();
+    size_t nchars = str.size();
     if((nchars == 0) || (count == 0))
-      return res;
+      return str.clear();
 
-    if(nchars > res.max_size() / static_cast<uint64_t>(count))
-      ASTERIA_THROW("String length overflow (`$1` * `$2` > `$3`)", nchars, count, res.max_size());
+    if(nchars > str.max_size() / static_cast<uint64_t>(count))
+      ASTERIA_THROW("String length overflow (`$1` * `$2` > `$3`)", nchars, count, str.max_size());
 
     size_t times = static_cast<size_t>(count);
     if(nchars == 1) {
       // Fast fill.
-      res.append(times, src.front());
+      str.append(times - 1, str.front());
     }
     else {
-      // Reserve space for the result string.
-      res.append(nchars * times, '*');
-      char* ptr = res.mut_data();
-
-      // Make the first copy of the src string.
-      ::std::memcpy(ptr, src.data(), nchars);
+      // Reserve space for the result string. The first copy is the string itself.
+      str.append(nchars * (times - 1), '*');
+      char* ptr = str.mut_data();
 
       // Append the result string to itself, doubling its length, until more than half of
       // the result string has been populated.
-      for(; nchars <= res.size() / 2; nchars *= 2)
+      for(; nchars <= str.size() / 2; nchars *= 2)
         ::std::memcpy(ptr + nchars, ptr, nchars);
 
       // Copy remaining characters, if any.
-      if(nchars < res.size())
-        ::std::memcpy(ptr + nchars, ptr, res.size() - nchars);
+      if(nchars < str.size())
+        ::std::memcpy(ptr + nchars, ptr, str.size() - nchars);
     }
-    return res;
+    return str;
   }
 
-cow_string
-do_string_sll(const cow_string& lhs, int64_t rhs)
+cow_string&
+do_string_sll(cow_string& lhs, int64_t rhs)
   {
     if(rhs < 0)
       ASTERIA_THROW("Negative shift count (operands were `$1` and `$2`)", lhs, rhs);
 
-    cow_string res;
-    res.append(lhs.size(), ' ');
-    if(static_cast<uint64_t>(rhs) >= lhs.size())
-      return res;
+    size_t count = static_cast<size_t>(::rocket::min(static_cast<uint64_t>(rhs), lhs.size()));
+    if(count == 0)
+      return lhs;
 
-    // Copy the substring in the right.
-    size_t count = static_cast<size_t>(rhs);
-    ::std::memcpy(res.mut_data(), lhs.data() + count, lhs.size() - count);
-    return res;
+    char* ptr = lhs.mut_data();
+
+    // Move the substring in the right to the left, then fill space characters in the right.
+    ::std::memmove(ptr, ptr + count, lhs.size() - count);
+    ::std::memset(ptr + lhs.size() - count, ' ', count);
+    return lhs;
   }
 
-cow_string
-do_string_srl(const cow_string& lhs, int64_t rhs)
+cow_string&
+do_string_srl(cow_string& lhs, int64_t rhs)
   {
     if(rhs < 0)
       ASTERIA_THROW("Negative shift count (operands were `$1` and `$2`)", lhs, rhs);
 
-    cow_string res;
-    res.append(lhs.size(), ' ');
-    if(static_cast<uint64_t>(rhs) >= lhs.size())
-      return res;
+    size_t count = static_cast<size_t>(::rocket::min(static_cast<uint64_t>(rhs), lhs.size()));
+    if(count == 0)
+      return lhs;
 
-    // Copy the substring in the left.
-    size_t count = static_cast<size_t>(rhs);
-    ::std::memcpy(res.mut_data() + count, lhs.data(), lhs.size() - count);
-    return res;
+    char* ptr = lhs.mut_data();
+
+    // Move the substring in the left to the right, then fill space characters in the left.
+    ::std::memmove(ptr + count, ptr, lhs.size() - count);
+    ::std::memset(ptr, ' ', count);
+    return lhs;
   }
 
-cow_string
-do_string_sla(const cow_string& lhs, int64_t rhs)
+cow_string&
+do_string_sla(cow_string& lhs, int64_t rhs)
   {
     if(rhs < 0)
       ASTERIA_THROW("Negative shift count (operands were `$1` and `$2`)", lhs, rhs);
 
-    cow_string res;
-    if(static_cast<uint64_t>(rhs) >= res.max_size() - lhs.size())
-      ASTERIA_THROW("String length overflow (`$1` + `$2` > `$3`)", lhs.size(), rhs, res.max_size());
+    if(static_cast<uint64_t>(rhs) >= lhs.max_size() - lhs.size())
+      ASTERIA_THROW("String length overflow (`$1` + `$2` > `$3`)", lhs.size(), rhs, lhs.max_size());
 
-    // Append spaces in the right and return the result.
+    // Append spaces in the right.
     size_t count = static_cast<size_t>(rhs);
-    res.assign(lhs).append(count, ' ');
-    return res;
+    return lhs.append(count, ' ');
   }
 
-cow_string
-do_string_sra(const cow_string& lhs, int64_t rhs)
+cow_string&
+do_string_sra(cow_string& lhs, int64_t rhs)
   {
     if(rhs < 0)
       ASTERIA_THROW("Negative shift count (operands were `$1` and `$2`)", lhs, rhs);
 
-    cow_string res;
     if(static_cast<uint64_t>(rhs) >= lhs.size())
-      return res;
+      return lhs.clear();
 
-    // Return the substring in the left.
+    // Discard characters from the right.
     size_t count = static_cast<size_t>(rhs);
-    res.append(lhs.data(), lhs.size() - count);
-    return res;
+    return lhs.erase(lhs.size() - count);
   }
 
 cow_string
@@ -1855,9 +1913,10 @@ struct AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_inc_post> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& lhs = ctx.stack().get_top().open();
@@ -1885,9 +1944,10 @@ struct AIR_Traits_Xop<xop_inc_post> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_dec_post> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& lhs = ctx.stack().get_top().open();
@@ -1915,9 +1975,10 @@ struct AIR_Traits_Xop<xop_dec_post> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_subscr> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -1950,9 +2011,10 @@ struct AIR_Traits_Xop<xop_subscr> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_pos> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -1967,9 +2029,10 @@ struct AIR_Traits_Xop<xop_pos> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_neg> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -1997,9 +2060,10 @@ struct AIR_Traits_Xop<xop_neg> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_notb> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2032,9 +2096,10 @@ struct AIR_Traits_Xop<xop_notb> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_notl> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2052,9 +2117,10 @@ struct AIR_Traits_Xop<xop_notl> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_inc_pre> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& rhs = ctx.stack().get_top().open();
@@ -2080,9 +2146,10 @@ struct AIR_Traits_Xop<xop_inc_pre> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_dec_pre> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& rhs = ctx.stack().get_top().open();
@@ -2108,9 +2175,10 @@ struct AIR_Traits_Xop<xop_dec_pre> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_unset> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().unset() };
@@ -2124,9 +2192,10 @@ struct AIR_Traits_Xop<xop_unset> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_countof> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2161,9 +2230,10 @@ struct AIR_Traits_Xop<xop_countof> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_typeof> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2181,9 +2251,10 @@ struct AIR_Traits_Xop<xop_typeof> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sqrt> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2211,9 +2282,10 @@ struct AIR_Traits_Xop<xop_sqrt> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_isnan> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2241,9 +2313,10 @@ struct AIR_Traits_Xop<xop_isnan> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_isinf> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2271,9 +2344,10 @@ struct AIR_Traits_Xop<xop_isinf> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_abs> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2301,9 +2375,10 @@ struct AIR_Traits_Xop<xop_abs> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sign> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2331,9 +2406,10 @@ struct AIR_Traits_Xop<xop_sign> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_round> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2360,9 +2436,10 @@ struct AIR_Traits_Xop<xop_round> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_floor> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2389,9 +2466,10 @@ struct AIR_Traits_Xop<xop_floor> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_ceil> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2418,9 +2496,10 @@ struct AIR_Traits_Xop<xop_ceil> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_trunc> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2447,9 +2526,10 @@ struct AIR_Traits_Xop<xop_trunc> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_roundi> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2476,9 +2556,10 @@ struct AIR_Traits_Xop<xop_roundi> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_floori> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2505,9 +2586,10 @@ struct AIR_Traits_Xop<xop_floori> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_ceili> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2534,9 +2616,10 @@ struct AIR_Traits_Xop<xop_ceili> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_trunci> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is unary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2563,9 +2646,10 @@ struct AIR_Traits_Xop<xop_trunci> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_eq> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2586,9 +2670,10 @@ struct AIR_Traits_Xop<xop_cmp_eq> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_ne> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2609,9 +2694,10 @@ struct AIR_Traits_Xop<xop_cmp_ne> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_lt> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2633,9 +2719,10 @@ struct AIR_Traits_Xop<xop_cmp_lt> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_gt> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2657,9 +2744,10 @@ struct AIR_Traits_Xop<xop_cmp_gt> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_lte> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2681,9 +2769,10 @@ struct AIR_Traits_Xop<xop_cmp_lte> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_gte> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2705,9 +2794,10 @@ struct AIR_Traits_Xop<xop_cmp_gte> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_cmp_3way> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2746,9 +2836,10 @@ struct AIR_Traits_Xop<xop_cmp_3way> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_add> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2775,6 +2866,12 @@ struct AIR_Traits_Xop<xop_add> : AIR_Traits<AIR_Node::S_apply_operator>
 
           case vmask_string:
             // For the `string` type, concatenate the operands in lexical order to create a new string.
+            // If this is an assignment, append the RHS operand to the LHS operand in place, so building
+            // a string piece by piece does not copy it again and again.
+            if(up.v8s[0]) {
+              ctx.stack().get_top().open().open_string().append(rhs.as_string());
+              return air_status_next;
+            }
             rhs.open_string().insert(0, lhs.as_string());
             break;
 
@@ -2789,9 +2886,10 @@ struct AIR_Traits_Xop<xop_add> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sub> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2827,9 +2925,10 @@ struct AIR_Traits_Xop<xop_sub> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_mul> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2854,12 +2953,23 @@ struct AIR_Traits_Xop<xop_mul> : AIR_Traits<AIR_Node::S_apply_operator>
             rhs.mutate_into_real() *= lhs.convert_to_real();
             break;
 
-          case vmask_integer | vmask_string:
+          case vmask_integer | vmask_string: {
             // If either operand has type `string` and the other has type `integer`, duplicate
             // the string up to the specified number of times and return the result.
-            rhs = lhs.is_string() ? do_string_dup(lhs.as_string(), rhs.as_integer())
-                                  : do_string_dup(rhs.as_string(), lhs.as_integer());
+            if(rhs.is_string()) {
+              do_string_dup(rhs.open_string(), lhs.as_integer());
+              break;
+            }
+            if(up.v8s[0]) {
+              // Modify the LHS operand in place.
+              do_string_dup(ctx.stack().get_top().open().open_string(), rhs.as_integer());
+              return air_status_next;
+            }
+            int64_t count = rhs.as_integer();
+            rhs = lhs.as_string();
+            do_string_dup(rhs.open_string(), count);
             break;
+          }
 
           default:
             ASTERIA_THROW("Infix multiplication not applicable (operands were `$1` and `$2`)", lhs, rhs);
@@ -2872,9 +2982,10 @@ struct AIR_Traits_Xop<xop_mul> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_div> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2905,9 +3016,10 @@ struct AIR_Traits_Xop<xop_div> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_mod> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2938,9 +3050,10 @@ struct AIR_Traits_Xop<xop_mod> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sll> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2958,11 +3071,19 @@ struct AIR_Traits_Xop<xop_sll> : AIR_Traits<AIR_Node::S_apply_operator>
             rhs = do_check_sll(lhs.as_integer(), rhs.as_integer());
             break;
 
-          case vmask_string:
+          case vmask_string: {
             // If the LHS operand has type `string`, fill space characters in the right and discard characters from
             // the left. The number of bytes in the LHS operand will be preserved.
-            rhs = do_string_sll(lhs.as_string(), rhs.as_integer());
+            if(up.v8s[0]) {
+              // Modify the LHS operand in place.
+              do_string_sll(ctx.stack().get_top().open().open_string(), rhs.as_integer());
+              return air_status_next;
+            }
+            int64_t count = rhs.as_integer();
+            rhs = lhs.as_string();
+            do_string_sll(rhs.open_string(), count);
             break;
+          }
 
           default:
             ASTERIA_THROW("Infix logical left shift not applicable (operands were `$1` and `$2`)", lhs, rhs);
@@ -2975,9 +3096,10 @@ struct AIR_Traits_Xop<xop_sll> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_srl> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -2995,11 +3117,19 @@ struct AIR_Traits_Xop<xop_srl> : AIR_Traits<AIR_Node::S_apply_operator>
             rhs = do_check_srl(lhs.as_integer(), rhs.as_integer());
             break;
 
-          case vmask_string:
+          case vmask_string: {
             // If the LHS operand has type `string`, fill space characters in the left and discard characters from
             // the right. The number of bytes in the LHS operand will be preserved.
-            rhs = do_string_srl(lhs.as_string(), rhs.as_integer());
+            if(up.v8s[0]) {
+              // Modify the LHS operand in place.
+              do_string_srl(ctx.stack().get_top().open().open_string(), rhs.as_integer());
+              return air_status_next;
+            }
+            int64_t count = rhs.as_integer();
+            rhs = lhs.as_string();
+            do_string_srl(rhs.open_string(), count);
             break;
+          }
 
           default:
             ASTERIA_THROW("Infix logical right shift not applicable (operands were `$1` and `$2`)", lhs, rhs);
@@ -3012,9 +3142,10 @@ struct AIR_Traits_Xop<xop_srl> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sla> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3034,10 +3165,18 @@ struct AIR_Traits_Xop<xop_sla> : AIR_Traits<AIR_Node::S_apply_operator>
             rhs = do_check_sla(lhs.as_integer(), rhs.as_integer());
             break;
 
-          case vmask_string:
+          case vmask_string: {
             // If the LHS operand has type `string`, fill space characters in the right.
-            rhs = do_string_sla(lhs.as_string(), rhs.as_integer());
+            if(up.v8s[0]) {
+              // Modify the LHS operand in place.
+              do_string_sla(ctx.stack().get_top().open().open_string(), rhs.as_integer());
+              return air_status_next;
+            }
+            int64_t count = rhs.as_integer();
+            rhs = lhs.as_string();
+            do_string_sla(rhs.open_string(), count);
             break;
+          }
 
           default:
             ASTERIA_THROW("Infix arithmetic left shift not applicable (operands were `$1` and `$2`)", lhs, rhs);
@@ -3050,9 +3189,10 @@ struct AIR_Traits_Xop<xop_sla> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_sra> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3071,10 +3211,18 @@ struct AIR_Traits_Xop<xop_sra> : AIR_Traits<AIR_Node::S_apply_operator>
             rhs = do_check_sra(lhs.as_integer(), rhs.as_integer());
             break;
 
-          case vmask_string:
+          case vmask_string: {
             // If the LHS operand has type `string`, discard characters from the right.
-            rhs = do_string_sra(lhs.as_string(), rhs.as_integer());
+            if(up.v8s[0]) {
+              // Modify the LHS operand in place.
+              do_string_sra(ctx.stack().get_top().open().open_string(), rhs.as_integer());
+              return air_status_next;
+            }
+            int64_t count = rhs.as_integer();
+            rhs = lhs.as_string();
+            do_string_sra(rhs.open_string(), count);
             break;
+          }
 
           default:
             ASTERIA_THROW("Infix arithmetic right shift not applicable (operands were `$1` and `$2`)", lhs, rhs);
@@ -3087,9 +3235,10 @@ struct AIR_Traits_Xop<xop_sra> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_andb> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3125,9 +3274,10 @@ struct AIR_Traits_Xop<xop_andb> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_orb> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3163,9 +3313,10 @@ struct AIR_Traits_Xop<xop_orb> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_xorb> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is binary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3201,9 +3352,10 @@ struct AIR_Traits_Xop<xop_xorb> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_assign> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // Pop the RHS operand.
         auto rhs = ctx.stack().get_top().read();
@@ -3218,9 +3370,10 @@ struct AIR_Traits_Xop<xop_assign> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_fma> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& up)
       {
         // This operator is ternary.
         Reference_root::S_temporary xref = { ctx.stack().get_top().read() };
@@ -3249,9 +3402,10 @@ struct AIR_Traits_Xop<xop_fma> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_head> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& lref = ctx.stack().open_top();
@@ -3265,9 +3419,10 @@ struct AIR_Traits_Xop<xop_head> : AIR_Traits<AIR_Node::S_apply_operator>
 template<>
 struct AIR_Traits_Xop<xop_tail> : AIR_Traits<AIR_Node::S_apply_operator>
   {
+    template<typename ContextT>
     static
     AIR_Status
-    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& /*up*/)
+    execute(ContextT& ctx, const AVMC_Queue::Uparam& /*up*/)
       {
         // This operator is unary.
         auto& lref = ctx.stack().open_top();
@@ -3405,7 +3560,7 @@ struct AIR_Traits<AIR_Node::S_unpack_struct_object>
 template<>
 struct AIR_Traits<AIR_Node::S_define_null_variable>
   {
-    // `Uparam` is `immutable`.
+    // `Uparam` is `immutable`, `escaping` and the slot.
     // `Sparam` is the source location and name.
 
     static
@@ -3413,7 +3568,9 @@ struct AIR_Traits<AIR_Node::S_define_null_variable>
     make_uparam(bool& /*reachable*/, const AIR_Node::S_define_null_variable& altr)
       {
         AVMC_Queue::Uparam up;
-        up.v8s[0] = altr.immutable;
+        up.y8s[0] = altr.immutable;
+        up.y8s[1] = altr.escaping;
+        up.y32 = altr.slot;
         return up;
       }
 
@@ -3441,19 +3598,20 @@ struct AIR_Traits<AIR_Node::S_define_null_variable>
     execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_sloc_name& sp)
       {
         // Allocate an uninitialized variable.
+        // If it does not escape, it need not be tracked.
         auto gcoll = ctx.global().genius_collector();
-        auto var = gcoll->create_variable();
+        auto var = up.y8s[1] ? gcoll->create_variable() : gcoll->create_local_variable();
 
         // Inject the variable into the current context.
         Reference_root::S_variable xref = { var };
-        ctx.open_named_reference(sp.name) = ::std::move(xref);
+        ctx.open_local_reference(up.y32) = ::std::move(xref);
 
         // Call the hook function if any.
         if(auto qhooks = ctx.global().get_hooks_opt())
           qhooks->on_variable_declare(sp.sloc, sp.name);
 
         // Initialize the variable to `null`.
-        var->initialize(V_null(), up.v8s[0]);
+        var->initialize(V_null(), up.y8s[0]);
         return air_status_next;
       }
   };
@@ -3720,21 +3878,28 @@ struct AIR_Traits<AIR_Node::S_import_call>
 
         path.assign(abspath);
 
-        // Compile the script file into a function object.
+        // Lock the script file. This also denies recursive imports.
         Loader_Lock::Unique_Stream strm;
         strm.reset(ctx.global().loader_lock(), path.safe_c_str());
 
-        // Parse source code.
-        Token_Stream tstrm(sp.opts);
-        tstrm.reload(strm, path);
-
-        Statement_Sequence stmtq(sp.opts);
-        stmtq.reload(tstrm);
-
-        // Instantiate the function.
-        AIR_Optimizer optmz(sp.opts);
-        optmz.reload(nullptr, cow_vector<phsh_string>(1, ::rocket::sref("...")), stmtq);
-        auto qtarget = optmz.create_function(Source_Location(path, 0, 0), ::rocket::sref("<file scope>"));
+        // Reuse the function object if the file has been compiled with the same options.
+        auto mcache = ctx.global().module_cache();
+        auto stamp = Module_Cache::stamp_file(strm.get().get_handle(), path);
+        auto qtarget = mcache->find_opt(path, stamp, sp.opts);
+        if(!qtarget) {
+          // Parse source code.
+          Token_Stream tstrm(sp.opts);
+          tstrm.reload(strm, path);
+
+          Statement_Sequence stmtq(sp.opts);
+          stmtq.reload(tstrm);
+
+          // Instantiate the function.
+          AIR_Optimizer optmz(sp.opts);
+          optmz.reload(nullptr, cow_vector<phsh_string>(1, ::rocket::sref("...")), stmtq);
+          qtarget = optmz.create_function(Source_Location(path, 0, 0), ::rocket::sref("<file scope>"));
+          mcache->insert(path, stamp, sp.opts, *qtarget);
+        }
 
         // Update the first argument to `import` if it was passed by reference.
         // `this` is null for imported scripts.
@@ -3743,7 +3908,7 @@ struct AIR_Traits<AIR_Node::S_import_call>
           self.open() = path;
         self = Reference_root::S_constant();
 
-        return do_function_call_common(self, sp.sloc, ctx, qtarget, ptc_aware_none, ::std::move(args));
+        return do_function_call_common(self, sp.sloc, ctx, *qtarget, ptc_aware_none, ::std::move(args));
       }
   };
 
@@ -3786,149 +3951,501 @@ struct AIR_Traits<AIR_Node::S_break_or_continue>
       }
   };
 
-// These are helper type traits.
-// Depending on the existence of Uparam, Sparam and Symbols, the code will look very different.
-
-// check for `make_uparam`
-template<typename TraitsT, typename XaNodeT, typename = void>
-struct Uparam_of
-  : ::std::enable_if<true>  // `::type` is void
-  { };
-
-template<typename TraitsT, typename XaNodeT>
-struct Uparam_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_uparam))>
-  : ::std::decay<decltype(TraitsT::make_uparam(::std::declval<bool&>(), ::std::declval<const XaNodeT&>()))>
-  { };
+// These are fused nodes, which are emitted by `AIR_Node::solidify_code()` for
+// common sequences of IR nodes. Each one performs the work of all of its
+// components with a single dispatch, but leaves the stack in the same state.
+struct Fused_local_immediate_operator
+  {
+    const AIR_Node::S_push_local_reference* local;
+    const AIR_Node::S_push_immediate* imm;
+    const AIR_Node::S_apply_operator* oper;
+  };
 
-// check for `make_sparam`
-template<typename TraitsT, typename XaNodeT, typename = void>
-struct Sparam_of
-  : ::std::enable_if<true>  // `::type` is void
-  { };
+struct Fused_local_immediate_branch
+  {
+    Fused_local_immediate_operator cond;
+    const AIR_Node::S_if_statement* branch;
+  };
 
-template<typename TraitsT, typename XaNodeT>
-struct Sparam_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_sparam))>
-  : ::std::decay<decltype(TraitsT::make_sparam(::std::declval<bool&>(), ::std::declval<const XaNodeT&>()))>
-  { };
+struct Fused_member_read
+  {
+    const AIR_Node::S_member_access* access;
+  };
 
-// check for `make_symbols`
-template<typename TraitsT, typename XaNodeT, typename = void>
-struct Symbols_of
-  : ::std::enable_if<true>  // `::type` is void
-  { };
+struct Fused_local_read
+  {
+    const AIR_Node::S_push_local_reference* local;
+  };
 
-template<typename TraitsT, typename XaNodeT>
-struct Symbols_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_symbols))>
-  : ::std::decay<decltype(TraitsT::make_symbols(::std::declval<const XaNodeT&>()))>
+// These operators have fast paths for `integer` operands.
+template<Xop xopT>
+struct Integer_fast_path
+  : ::std::false_type
   { };
 
-// executor thunk
-template<typename TraitsT, typename UparamT, typename SparamT>
-struct executor_of
+template<>
+struct Integer_fast_path<xop_add>
+  : ::std::true_type
   {
     static
-    AIR_Status
-    thunk(Executive_Context& ctx, AVMC_Queue::Uparam up, const void* sp)
-      { return TraitsT::execute(ctx, UparamT(up), *(const SparamT*)sp);  }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return do_check_add(lhs, rhs);  }
   };
 
-template<typename TraitsT, typename UparamT>
-struct executor_of<TraitsT, UparamT, void>
+template<>
+struct Integer_fast_path<xop_sub>
+  : ::std::true_type
   {
     static
-    AIR_Status
-    thunk(Executive_Context& ctx, AVMC_Queue::Uparam up, const void* /*sp*/)
-      { return TraitsT::execute(ctx, UparamT(up));  }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return do_check_sub(lhs, rhs);  }
   };
 
-template<typename TraitsT, typename SparamT>
-struct executor_of<TraitsT, void, SparamT>
+template<>
+struct Integer_fast_path<xop_cmp_eq>
+  : ::std::true_type
   {
     static
-    AIR_Status
-    thunk(Executive_Context& ctx, AVMC_Queue::Uparam /*up*/, const void* sp)
-      { return TraitsT::execute(ctx, *(const SparamT*)sp);  }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs == rhs;  }
   };
 
-template<typename TraitsT>
-struct executor_of<TraitsT, void, void>
+template<>
+struct Integer_fast_path<xop_cmp_ne>
+  : ::std::true_type
   {
     static
-    AIR_Status
-    thunk(Executive_Context& ctx, AVMC_Queue::Uparam /*up*/, const void* /*sp*/)
-      { return TraitsT::execute(ctx);  }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs != rhs;  }
   };
 
-// enumerator thunk
-template<typename SparamT, typename = void>
-struct enumerator_of
+template<>
+struct Integer_fast_path<xop_cmp_lt>
+  : ::std::true_type
   {
-    static constexpr AVMC_Queue::Enumerator* thunk = nullptr;
+    static
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs < rhs;  }
   };
 
-template<typename SparamT>
-struct enumerator_of<SparamT, ROCKET_VOID_T(decltype(&SparamT::enumerate_variables))>
+template<>
+struct Integer_fast_path<xop_cmp_gt>
+  : ::std::true_type
   {
     static
-    Variable_Callback&
-    thunk(Variable_Callback& callback, AVMC_Queue::Uparam /*up*/, const void* sp)
-      { return ((const SparamT*)sp)->enumerate_variables(callback);  }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs > rhs;  }
   };
 
-// Finally...
-template<typename TraitsT, typename XaNodeT, typename UparamT, typename SparamT, typename SymbolT>
-struct AVMC_Appender
+template<>
+struct Integer_fast_path<xop_cmp_lte>
+  : ::std::true_type
   {
     static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, UparamT, SparamT>::thunk,
-                              enumerator_of<SparamT>::thunk>(
-                              TraitsT::make_symbols(altr),
-                              TraitsT::make_uparam(reachable, altr),
-                              TraitsT::make_sparam(reachable, altr));
-        queue.shrink_to_fit();
-        return reachable;
-      }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs <= rhs;  }
   };
 
-template<typename TraitsT, typename XaNodeT, typename UparamT, typename SparamT>
-struct AVMC_Appender<TraitsT, XaNodeT, UparamT, SparamT, void>
+template<>
+struct Integer_fast_path<xop_cmp_gte>
+  : ::std::true_type
   {
     static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, UparamT, SparamT>::thunk,
-                              enumerator_of<SparamT>::thunk>(
-                              TraitsT::make_uparam(reachable, altr),
-                              TraitsT::make_sparam(reachable, altr));
-        queue.shrink_to_fit();
-        return reachable;
-      }
+    Value
+    apply(int64_t lhs, int64_t rhs)
+      { return lhs >= rhs;  }
   };
 
-template<typename TraitsT, typename XaNodeT, typename UparamT, typename SymbolT>
-struct AVMC_Appender<TraitsT, XaNodeT, UparamT, void, SymbolT>
+template<Xop xopT>
+struct AIR_Traits_Fused_Xop
   {
+    // `Uparam` is the depth, `assign` and slot.
+    // `Sparam` is the source locations, the name and value of the immediate operand.
+    // There are no symbols. Errors are reported at the local reference or the
+    // operator, whichever has raised them, as if the nodes had not been fused.
+
     static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+    AVMC_Queue::Uparam
+    make_uparam(bool& /*reachable*/, const Fused_local_immediate_operator& altr)
       {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, UparamT, void>::thunk,
-                              nullptr>(
-                              TraitsT::make_symbols(altr),
-                              TraitsT::make_uparam(reachable, altr));
+        ROCKET_ASSERT(altr.local->depth <= UINT8_MAX);
+
+        AVMC_Queue::Uparam up;
+        up.y8s[0] = static_cast<uint8_t>(altr.local->depth);
+        up.y8s[1] = altr.oper->assign;
+        up.y32 = altr.local->slot;
+        return up;
+      }
+
+    static
+    Sparam_local_immediate
+    make_sparam(bool& /*reachable*/, const Fused_local_immediate_operator& altr)
+      {
+        Sparam_local_immediate sp;
+        sp.sloc_local = altr.local->sloc;
+        sp.sloc_oper = altr.oper->sloc;
+        sp.name = altr.local->name;
+        sp.value = altr.imm->value;
+        return sp;
+      }
+
+    static
+    AIR_Status
+    do_apply(Executive_Context& ctx, bool assign, const Value& value, ::std::false_type)
+      {
+        // Push the immediate operand and apply the operator as usual.
+        Reference_root::S_constant xref = { value };
+        ctx.stack().push(::std::move(xref));
+
+        AVMC_Queue::Uparam up;
+        up.v8s[0] = assign;
+        return AIR_Traits_Xop<xopT>::execute(ctx, up);
+      }
+
+    static
+    AIR_Status
+    do_apply(Executive_Context& ctx, bool assign, const Value& value, ::std::true_type)
+      {
+        const auto& lhs = ctx.stack().get_top().read();
+        if(!lhs.is_integer() || !value.is_integer())
+          return do_apply(ctx, assign, value, ::std::false_type());
+
+        // Calculate the result without pushing the immediate operand.
+        Reference_root::S_temporary xref = { Integer_fast_path<xopT>::apply(lhs.as_integer(),
+                                                                            value.as_integer()) };
+        do_set_temporary(ctx, assign, ::std::move(xref));
+        return air_status_next;
+      }
+
+    static
+    void
+    do_push_local(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Source_Location& sloc,
+                  const phsh_string& name)
+      {
+        ASTERIA_RUNTIME_TRY {
+          ctx.stack().push(do_get_local_reference(ctx, up.y8s[0], up.y32, name));
+        }
+        ASTERIA_RUNTIME_CATCH(Runtime_Error& except) {
+          except.push_frame_plain(sloc, ::rocket::sref(""));
+          throw;
+        }
+      }
+
+    static
+    AIR_Status
+    do_apply_at(Executive_Context& ctx, bool assign, const Source_Location& sloc, const Value& value)
+      {
+        ASTERIA_RUNTIME_TRY {
+          return do_apply(ctx, assign, value, Integer_fast_path<xopT>());
+        }
+        ASTERIA_RUNTIME_CATCH(Runtime_Error& except) {
+          except.push_frame_plain(sloc, ::rocket::sref(""));
+          throw;
+        }
+      }
+
+    static
+    AIR_Status
+    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_local_immediate& sp)
+      {
+        do_push_local(ctx, up, sp.sloc_local, sp.name);
+        return do_apply_at(ctx, up.y8s[1], sp.sloc_oper, sp.value);
+      }
+  };
+
+template<Xop xopT>
+struct AIR_Traits_Fused_Branch
+  {
+    // `Uparam` is the depth, `assign` and slot.
+    // `Sparam` is the source locations, the name and value of the immediate operand,
+    // and the two branches.
+
+    static
+    AVMC_Queue::Uparam
+    make_uparam(bool& reachable, const Fused_local_immediate_branch& altr)
+      {
+        return AIR_Traits_Fused_Xop<xopT>::make_uparam(reachable, altr.cond);
+      }
+
+    static
+    Sparam_local_immediate_branch
+    make_sparam(bool& reachable, const Fused_local_immediate_branch& altr)
+      {
+        Sparam_local_immediate_branch sp;
+        sp.sloc_local = altr.cond.local->sloc;
+        sp.sloc_oper = altr.cond.oper->sloc;
+        sp.name = altr.cond.local->name;
+        sp.value = altr.cond.imm->value;
+        sp.negative = altr.branch->negative;
+        bool rtrue = do_solidify_code(sp.queue_true, altr.branch->code_true);
+        bool rfalse = do_solidify_code(sp.queue_false, altr.branch->code_false);
+        reachable &= rtrue | rfalse;
+        return sp;
+      }
+
+    static
+    AIR_Status
+    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_local_immediate_branch& sp)
+      {
+        // Evaluate the condition.
+        AIR_Traits_Fused_Xop<xopT>::do_push_local(ctx, up, sp.sloc_local, sp.name);
+        AIR_Traits_Fused_Xop<xopT>::do_apply_at(ctx, up.y8s[1], sp.sloc_oper, sp.value);
+
+        // Check the value of the condition.
+        if(ctx.stack().get_top().read().test() != sp.negative)
+          // Execute the true branch and forward the status verbatim.
+          return do_execute_block(sp.queue_true, ctx);
+
+        // Execute the false branch and forward the status verbatim.
+        return do_execute_block(sp.queue_false, ctx);
+      }
+  };
+
+struct AIR_Traits_Member_Read
+  {
+    // `Uparam` is unused.
+    // `Sparam` is the name and the inline cache.
+
+    static
+    Sparam_member_cache
+    make_sparam(bool& /*reachable*/, const Fused_member_read& altr)
+      {
+        Sparam_member_cache sp;
+        sp.name = altr.access->name;
+        return sp;
+      }
+
+    static
+    AVMC_Queue::Symbols
+    make_symbols(const Fused_member_read& altr)
+      {
+        AVMC_Queue::Symbols syms;
+        syms.sloc = altr.access->sloc;
+        return syms;
+      }
+
+    static
+    AIR_Status
+    execute(Executive_Context& ctx, const Sparam_member_cache& sp)
+      {
+        auto& self = ctx.stack().open_top();
+        const auto& parent = self.read();
+        if(!parent.is_object()) {
+          // Let the modifier deal with `null`s and errors.
+          Reference_modifier::S_object_key xmod = { sp.name };
+          self.zoom_in(::std::move(xmod));
+          Reference_root::S_temporary xref = { self.read() };
+          self = ::std::move(xref);
+          return air_status_next;
+        }
+
+        // If the object has not changed its shape since the member was found last
+        // time, it is still in the same bucket. Otherwise, a full probe is performed.
+        const auto& obj = parent.as_object();
+#ifdef ROCKET_DEBUG
+        auto shape = sp.hint.shape;
+        auto q = obj.find_hinted(sp.hint, sp.name);
+        ctx.global().record_inline_cache_lookup((q != obj.end()) && (sp.hint.shape == shape));
+#else
+        auto q = obj.find_hinted(sp.hint, sp.name);
+#endif
+
+        // Replace the top reference with a temporary reference to the member.
+        Reference_root::S_temporary xref;
+        if(q != obj.end())
+          xref.val = q->second;
+        self = ::std::move(xref);
+        return air_status_next;
+      }
+  };
+
+struct AIR_Traits_Local_Read
+  {
+    // `Uparam` is the depth and slot.
+    // `Sparam` is the source location and name;
+
+    static
+    AVMC_Queue::Uparam
+    make_uparam(bool& reachable, const Fused_local_read& altr)
+      {
+        return AIR_Traits<AIR_Node::S_push_local_reference>::make_uparam(reachable, *(altr.local));
+      }
+
+    static
+    Sparam_sloc_name
+    make_sparam(bool& reachable, const Fused_local_read& altr)
+      {
+        return AIR_Traits<AIR_Node::S_push_local_reference>::make_sparam(reachable, *(altr.local));
+      }
+
+    static
+    AVMC_Queue::Symbols
+    make_symbols(const Fused_local_read& altr)
+      {
+        return AIR_Traits<AIR_Node::S_push_local_reference>::make_symbols(*(altr.local));
+      }
+
+    static
+    AIR_Status
+    execute(Executive_Context& ctx, const AVMC_Queue::Uparam& up, const Sparam_sloc_name& sp)
+      {
+        // Push a copy of its value, instead of the reference.
+        Reference_root::S_temporary xref = { do_get_local_reference(ctx, up.x16, up.x32, sp.name).read() };
+        ctx.stack().push(::std::move(xref));
+        return air_status_next;
+      }
+  };
+
+// These are helper type traits.
+// Depending on the existence of Uparam, Sparam and Symbols, the code will look very different.
+
+// check for `make_uparam`
+template<typename TraitsT, typename XaNodeT, typename = void>
+struct Uparam_of
+  : ::std::enable_if<true>  // `::type` is void
+  { };
+
+template<typename TraitsT, typename XaNodeT>
+struct Uparam_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_uparam))>
+  : ::std::decay<decltype(TraitsT::make_uparam(::std::declval<bool&>(), ::std::declval<const XaNodeT&>()))>
+  { };
+
+// check for `make_sparam`
+template<typename TraitsT, typename XaNodeT, typename = void>
+struct Sparam_of
+  : ::std::enable_if<true>  // `::type` is void
+  { };
+
+template<typename TraitsT, typename XaNodeT>
+struct Sparam_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_sparam))>
+  : ::std::decay<decltype(TraitsT::make_sparam(::std::declval<bool&>(), ::std::declval<const XaNodeT&>()))>
+  { };
+
+// check for `make_symbols`
+template<typename TraitsT, typename XaNodeT, typename = void>
+struct Symbols_of
+  : ::std::enable_if<true>  // `::type` is void
+  { };
+
+template<typename TraitsT, typename XaNodeT>
+struct Symbols_of<TraitsT, XaNodeT, ROCKET_VOID_T(decltype(&TraitsT::make_symbols))>
+  : ::std::decay<decltype(TraitsT::make_symbols(::std::declval<const XaNodeT&>()))>
+  { };
+
+// executor thunk
+template<typename TraitsT, typename UparamT, typename SparamT>
+struct executor_of
+  {
+    static
+    AIR_Status
+    thunk(Executive_Context& ctx, AVMC_Queue::Uparam up, const void* sp)
+      { return TraitsT::execute(ctx, UparamT(up), *(const SparamT*)sp);  }
+  };
+
+template<typename TraitsT, typename UparamT>
+struct executor_of<TraitsT, UparamT, void>
+  {
+    static
+    AIR_Status
+    thunk(Executive_Context& ctx, AVMC_Queue::Uparam up, const void* /*sp*/)
+      { return TraitsT::execute(ctx, UparamT(up));  }
+  };
+
+template<typename TraitsT, typename SparamT>
+struct executor_of<TraitsT, void, SparamT>
+  {
+    static
+    AIR_Status
+    thunk(Executive_Context& ctx, AVMC_Queue::Uparam /*up*/, const void* sp)
+      { return TraitsT::execute(ctx, *(const SparamT*)sp);  }
+  };
+
+template<typename TraitsT>
+struct executor_of<TraitsT, void, void>
+  {
+    static
+    AIR_Status
+    thunk(Executive_Context& ctx, AVMC_Queue::Uparam /*up*/, const void* /*sp*/)
+      { return TraitsT::execute(ctx);  }
+  };
+
+// enumerator thunk
+template<typename SparamT, typename = void>
+struct enumerator_of
+  {
+    static constexpr AVMC_Queue::Enumerator* thunk = nullptr;
+  };
+
+template<typename SparamT>
+struct enumerator_of<SparamT, ROCKET_VOID_T(decltype(&SparamT::enumerate_variables))>
+  {
+    static
+    Variable_Callback&
+    thunk(Variable_Callback& callback, AVMC_Queue::Uparam /*up*/, const void* sp)
+      { return ((const SparamT*)sp)->enumerate_variables(callback);  }
+  };
+
+// Finally...
+template<typename TraitsT, typename XaNodeT, typename UparamT, typename SparamT, typename SymbolT>
+struct AVMC_Appender
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, UparamT, SparamT>::thunk,
+                              enumerator_of<SparamT>::thunk>(
+                              TraitsT::make_symbols(altr),
+                              TraitsT::make_uparam(reachable, altr),
+                              TraitsT::make_sparam(reachable, altr));
+        queue.shrink_to_fit();
         return reachable;
       }
   };
 
-template<typename TraitsT, typename XaNodeT, typename UparamT>
-struct AVMC_Appender<TraitsT, XaNodeT, UparamT, void, void>
+template<typename TraitsT, typename XaNodeT, typename UparamT, typename SparamT>
+struct AVMC_Appender<TraitsT, XaNodeT, UparamT, SparamT, void>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, UparamT, SparamT>::thunk,
+                              enumerator_of<SparamT>::thunk>(
+                              TraitsT::make_uparam(reachable, altr),
+                              TraitsT::make_sparam(reachable, altr));
+        queue.shrink_to_fit();
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT, typename UparamT, typename SymbolT>
+struct AVMC_Appender<TraitsT, XaNodeT, UparamT, void, SymbolT>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, UparamT, void>::thunk,
+                              nullptr>(
+                              TraitsT::make_symbols(altr),
+                              TraitsT::make_uparam(reachable, altr));
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT, typename UparamT>
+struct AVMC_Appender<TraitsT, XaNodeT, UparamT, void, void>
   {
     static
     bool
@@ -3940,304 +4457,1846 @@ struct AVMC_Appender<TraitsT, XaNodeT, UparamT, void, void>
                               TraitsT::make_uparam(reachable, altr));
         return reachable;
       }
-  };
+  };
+
+template<typename TraitsT, typename XaNodeT, typename SparamT, typename SymbolT>
+struct AVMC_Appender<TraitsT, XaNodeT, void, SparamT, SymbolT>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, void, SparamT>::thunk,
+                              enumerator_of<SparamT>::thunk>(
+                              TraitsT::make_symbols(altr),
+                              AVMC_Queue::Uparam(),
+                              TraitsT::make_sparam(reachable, altr));
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT, typename SparamT>
+struct AVMC_Appender<TraitsT, XaNodeT, void, SparamT, void>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, void, SparamT>::thunk,
+                              enumerator_of<SparamT>::thunk>(
+                              AVMC_Queue::Uparam(),
+                              TraitsT::make_sparam(reachable, altr));
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT, typename SymbolT>
+struct AVMC_Appender<TraitsT, XaNodeT, void, void, SymbolT>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& altr)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, void, void>::thunk,
+                              nullptr>(
+                              TraitsT::make_symbols(altr),
+                              AVMC_Queue::Uparam());
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT>
+struct AVMC_Appender<TraitsT, XaNodeT, void, void, void>
+  {
+    static
+    bool
+    do_append(AVMC_Queue& queue, const XaNodeT& /*altr*/)
+      {
+        bool reachable = true;
+        queue.template append<executor_of<TraitsT, void, void>::thunk,
+                              nullptr>(
+                              AVMC_Queue::Uparam());
+        return reachable;
+      }
+  };
+
+template<typename TraitsT, typename XaNodeT>
+inline
+bool
+do_solidify_explicit(AVMC_Queue& queue, const XaNodeT& altr)
+  {
+    bool r = AVMC_Appender<TraitsT, XaNodeT,
+                           typename Uparam_of<TraitsT, XaNodeT>::type,
+                           typename Sparam_of<TraitsT, XaNodeT>::type,
+                           typename Symbols_of<TraitsT, XaNodeT>::type>
+               ::do_append(queue, altr);
+    queue.shrink_to_fit();
+    return r;
+  }
+
+template<typename XaNodeT>
+inline
+bool
+do_solidify(AVMC_Queue& queue, const XaNodeT& altr)
+  {
+    return do_solidify_explicit<AIR_Traits<XaNodeT>>(queue, altr);
+  }
+
+template<Xop xopT>
+inline
+bool
+do_solidify(AVMC_Queue& queue, const AIR_Node::S_apply_operator& altr)
+  {
+    return do_solidify_explicit<AIR_Traits_Xop<xopT>>(queue, altr);
+  }
+
+template<template<Xop> class TraitsT, typename XaNodeT>
+opt<bool>
+do_solidify_fused_opt(AVMC_Queue& queue, Xop xop, const XaNodeT& altr)
+  {
+    switch(xop) {
+      case xop_subscr:
+        return do_solidify_explicit<TraitsT<xop_subscr>>(queue, altr);
+
+      case xop_cmp_eq:
+        return do_solidify_explicit<TraitsT<xop_cmp_eq>>(queue, altr);
+
+      case xop_cmp_ne:
+        return do_solidify_explicit<TraitsT<xop_cmp_ne>>(queue, altr);
+
+      case xop_cmp_lt:
+        return do_solidify_explicit<TraitsT<xop_cmp_lt>>(queue, altr);
+
+      case xop_cmp_gt:
+        return do_solidify_explicit<TraitsT<xop_cmp_gt>>(queue, altr);
+
+      case xop_cmp_lte:
+        return do_solidify_explicit<TraitsT<xop_cmp_lte>>(queue, altr);
+
+      case xop_cmp_gte:
+        return do_solidify_explicit<TraitsT<xop_cmp_gte>>(queue, altr);
+
+      case xop_cmp_3way:
+        return do_solidify_explicit<TraitsT<xop_cmp_3way>>(queue, altr);
+
+      case xop_add:
+        return do_solidify_explicit<TraitsT<xop_add>>(queue, altr);
+
+      case xop_sub:
+        return do_solidify_explicit<TraitsT<xop_sub>>(queue, altr);
+
+      case xop_mul:
+        return do_solidify_explicit<TraitsT<xop_mul>>(queue, altr);
+
+      case xop_div:
+        return do_solidify_explicit<TraitsT<xop_div>>(queue, altr);
+
+      case xop_mod:
+        return do_solidify_explicit<TraitsT<xop_mod>>(queue, altr);
+
+      case xop_sll:
+        return do_solidify_explicit<TraitsT<xop_sll>>(queue, altr);
+
+      case xop_srl:
+        return do_solidify_explicit<TraitsT<xop_srl>>(queue, altr);
+
+      case xop_sla:
+        return do_solidify_explicit<TraitsT<xop_sla>>(queue, altr);
+
+      case xop_sra:
+        return do_solidify_explicit<TraitsT<xop_sra>>(queue, altr);
+
+      case xop_andb:
+        return do_solidify_explicit<TraitsT<xop_andb>>(queue, altr);
+
+      case xop_orb:
+        return do_solidify_explicit<TraitsT<xop_orb>>(queue, altr);
+
+      case xop_xorb:
+        return do_solidify_explicit<TraitsT<xop_xorb>>(queue, altr);
+
+      case xop_inc_post:
+      case xop_dec_post:
+      case xop_pos:
+      case xop_neg:
+      case xop_notb:
+      case xop_notl:
+      case xop_inc_pre:
+      case xop_dec_pre:
+      case xop_unset:
+      case xop_countof:
+      case xop_typeof:
+      case xop_sqrt:
+      case xop_isnan:
+      case xop_isinf:
+      case xop_abs:
+      case xop_sign:
+      case xop_round:
+      case xop_floor:
+      case xop_ceil:
+      case xop_trunc:
+      case xop_roundi:
+      case xop_floori:
+      case xop_ceili:
+      case xop_trunci:
+      case xop_assign:
+      case xop_fma:
+      case xop_head:
+      case xop_tail:
+        // These operators are not fused.
+        return nullopt;
+
+      default:
+        ASTERIA_TERMINATE("invalid operator type (xop `$1`)", xop);
+    }
+  }
+
+// Constant folding
+class Folding_Context
+  {
+  private:
+    Evaluation_Stack m_stack;
+
+  public:
+    // Operators that are eligible for folding touch nothing but the stack.
+    Evaluation_Stack&
+    stack()
+    noexcept
+      { return this->m_stack;  }
+  };
+
+template<typename TraitsT, typename... ParamsT>
+opt<Value>
+do_fold_constant_opt(const cow_vector<Value>& args, const ParamsT&... params)
+  {
+    Folding_Context ctx;
+    try {
+      // Push all operands as constants.
+      for(const auto& arg : args) {
+        Reference_root::S_constant xref = { arg };
+        ctx.stack().push(::std::move(xref));
+      }
+      // Evaluate the node as if it was executed at runtime.
+      auto status = TraitsT::execute(ctx, params...);
+      ROCKET_ASSERT(status == air_status_next);
+      ROCKET_ASSERT(ctx.stack().size() == 1);
+      return ctx.stack().get_top().read();
+    }
+    catch(::std::exception& /*stdex*/) {
+      // Leave the error to runtime, as it is possible that this node is never executed.
+      return nullopt;
+    }
+  }
+
+uint32_t
+do_get_foldable_arity(Xop xop)
+noexcept
+  {
+    switch(xop) {
+      case xop_pos:
+      case xop_neg:
+      case xop_notb:
+      case xop_notl:
+      case xop_countof:
+      case xop_typeof:
+      case xop_sqrt:
+      case xop_isnan:
+      case xop_isinf:
+      case xop_abs:
+      case xop_sign:
+      case xop_round:
+      case xop_floor:
+      case xop_ceil:
+      case xop_trunc:
+      case xop_roundi:
+      case xop_floori:
+      case xop_ceili:
+      case xop_trunci:
+        return 1;
+
+      case xop_cmp_eq:
+      case xop_cmp_ne:
+      case xop_cmp_lt:
+      case xop_cmp_gt:
+      case xop_cmp_lte:
+      case xop_cmp_gte:
+      case xop_cmp_3way:
+      case xop_add:
+      case xop_sub:
+      case xop_mul:
+      case xop_div:
+      case xop_mod:
+      case xop_sll:
+      case xop_srl:
+      case xop_sla:
+      case xop_sra:
+      case xop_andb:
+      case xop_orb:
+      case xop_xorb:
+        return 2;
+
+      case xop_fma:
+        return 3;
+
+      case xop_inc_post:
+      case xop_dec_post:
+      case xop_subscr:
+      case xop_inc_pre:
+      case xop_dec_pre:
+      case xop_unset:
+      case xop_assign:
+      case xop_head:
+      case xop_tail:
+        // These operators have side effects or yield references.
+        return 0;
+
+      default:
+        ASTERIA_TERMINATE("invalid operator type (xop `$1`)", xop);
+    }
+  }
+
+opt<Value>
+do_fold_operator_opt(const AIR_Node::S_apply_operator& altr, const cow_vector<Value>& args)
+  {
+    ROCKET_ASSERT(!altr.assign);
+    ROCKET_ASSERT(args.size() == do_get_foldable_arity(altr.xop));
+
+    // Don't create long strings, which would otherwise be embedded into the code.
+    if(::rocket::is_any_of(altr.xop, { xop_mul, xop_sla }))
+      if(::rocket::any_of(args, [&](const Value& arg) { return arg.is_string();  }))
+        return nullopt;
+
+    bool reachable = true;
+    auto up = AIR_Traits<AIR_Node::S_apply_operator>::make_uparam(reachable, altr);
+
+    switch(altr.xop) {
+      case xop_pos:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_pos>>(args, up);
+
+      case xop_neg:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_neg>>(args, up);
+
+      case xop_notb:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_notb>>(args, up);
+
+      case xop_notl:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_notl>>(args, up);
+
+      case xop_countof:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_countof>>(args, up);
+
+      case xop_typeof:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_typeof>>(args, up);
+
+      case xop_sqrt:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sqrt>>(args, up);
+
+      case xop_isnan:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_isnan>>(args, up);
+
+      case xop_isinf:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_isinf>>(args, up);
+
+      case xop_abs:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_abs>>(args, up);
+
+      case xop_sign:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sign>>(args, up);
+
+      case xop_round:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_round>>(args, up);
+
+      case xop_floor:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_floor>>(args, up);
+
+      case xop_ceil:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_ceil>>(args, up);
+
+      case xop_trunc:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_trunc>>(args, up);
+
+      case xop_roundi:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_roundi>>(args, up);
+
+      case xop_floori:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_floori>>(args, up);
+
+      case xop_ceili:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_ceili>>(args, up);
+
+      case xop_trunci:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_trunci>>(args, up);
+
+      case xop_cmp_eq:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_eq>>(args, up);
+
+      case xop_cmp_ne:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_ne>>(args, up);
+
+      case xop_cmp_lt:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_lt>>(args, up);
+
+      case xop_cmp_gt:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_gt>>(args, up);
+
+      case xop_cmp_lte:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_lte>>(args, up);
+
+      case xop_cmp_gte:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_gte>>(args, up);
+
+      case xop_cmp_3way:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_cmp_3way>>(args, up);
+
+      case xop_add:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_add>>(args, up);
+
+      case xop_sub:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sub>>(args, up);
+
+      case xop_mul:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_mul>>(args, up);
+
+      case xop_div:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_div>>(args, up);
+
+      case xop_mod:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_mod>>(args, up);
+
+      case xop_sll:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sll>>(args, up);
+
+      case xop_srl:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_srl>>(args, up);
+
+      case xop_sla:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sla>>(args, up);
+
+      case xop_sra:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_sra>>(args, up);
+
+      case xop_andb:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_andb>>(args, up);
+
+      case xop_orb:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_orb>>(args, up);
+
+      case xop_xorb:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_xorb>>(args, up);
+
+      case xop_fma:
+        return do_fold_constant_opt<AIR_Traits_Xop<xop_fma>>(args, up);
+
+      case xop_inc_post:
+      case xop_dec_post:
+      case xop_subscr:
+      case xop_inc_pre:
+      case xop_dec_pre:
+      case xop_unset:
+      case xop_assign:
+      case xop_head:
+      case xop_tail:
+      default:
+        ASTERIA_TERMINATE("operator not foldable (xop `$1`)", altr.xop);
+    }
+  }
+
+bool&
+do_optimize_nodes(bool& dirty, cow_vector<AIR_Node>& code, const Compiler_Options& opts)
+  {
+    dirty |= AIR_Node::optimize_code(code, opts);
+    return dirty;
+  }
+
+bool&
+do_optimize_nodes(bool& dirty, cow_vector<cow_vector<AIR_Node>>& seqs, const Compiler_Options& opts)
+  {
+    for(size_t k = 0;  k < seqs.size();  ++k) {
+      // Don't trigger copy-on-write unless the sequence needs rewriting.
+      auto code = seqs[k];
+      if(!AIR_Node::optimize_code(code, opts))
+        continue;
+      dirty |= true;
+      seqs.mut(k) = ::std::move(code);
+    }
+    return dirty;
+  }
+
+// Check whether an operator reads its rightmost operand, which is at the top of
+// the stack, before doing anything else.
+bool
+do_reads_top_first(const AIR_Node::S_apply_operator& altr)
+  {
+    switch(altr.xop) {
+      case xop_pos:
+      case xop_neg:
+      case xop_notb:
+      case xop_notl:
+      case xop_countof:
+      case xop_typeof:
+      case xop_sqrt:
+      case xop_isnan:
+      case xop_isinf:
+      case xop_abs:
+      case xop_sign:
+      case xop_round:
+      case xop_floor:
+      case xop_ceil:
+      case xop_trunc:
+      case xop_roundi:
+      case xop_floori:
+      case xop_ceili:
+      case xop_trunci:
+        // Unary operators write the result back if `assign` is set.
+        return !altr.assign;
+
+      case xop_subscr:
+      case xop_cmp_eq:
+      case xop_cmp_ne:
+      case xop_cmp_lt:
+      case xop_cmp_gt:
+      case xop_cmp_lte:
+      case xop_cmp_gte:
+      case xop_cmp_3way:
+      case xop_add:
+      case xop_sub:
+      case xop_mul:
+      case xop_div:
+      case xop_mod:
+      case xop_sll:
+      case xop_srl:
+      case xop_sla:
+      case xop_sra:
+      case xop_andb:
+      case xop_orb:
+      case xop_xorb:
+      case xop_assign:
+      case xop_fma:
+        // Binary and ternary operators may write the leftmost operand only.
+        return true;
+
+      case xop_inc_post:
+      case xop_dec_post:
+      case xop_inc_pre:
+      case xop_dec_pre:
+      case xop_unset:
+      case xop_head:
+      case xop_tail:
+        // These operators require an lvalue.
+        return false;
+
+      default:
+        ASTERIA_TERMINATE("invalid operator type (xop `$1`)", altr.xop);
+    }
+  }
+
+Bytecode_Writer&
+do_put_codes(Bytecode_Writer& writer, const cow_vector<cow_vector<AIR_Node>>& seqs)
+  {
+    writer.put_varint(seqs.size());
+    for(const auto& code : seqs)
+      AIR_Node::serialize_code(writer, code);
+    return writer;
+  }
+
+cow_vector<cow_vector<AIR_Node>>
+do_get_codes(Bytecode_Reader& reader, AIR_Node::Load_Scope& scope)
+  {
+    cow_vector<cow_vector<AIR_Node>> seqs;
+    uint64_t count = reader.get_varint();
+    while(count-- != 0)
+      seqs.emplace_back(AIR_Node::deserialize_code(reader, scope));
+    return seqs;
+  }
+
+Bytecode_Writer&
+do_put_names(Bytecode_Writer& writer, const cow_vector<phsh_string>& names)
+  {
+    writer.put_varint(names.size());
+    for(const auto& name : names)
+      writer.put_string(name.rdstr());
+    return writer;
+  }
+
+cow_vector<phsh_string>
+do_get_names(Bytecode_Reader& reader)
+  {
+    cow_vector<phsh_string> names;
+    uint64_t count = reader.get_varint();
+    while(count-- != 0)
+      names.emplace_back(reader.get_string());
+    return names;
+  }
+
+uint32_t
+do_get_uint32(Bytecode_Reader& reader)
+  {
+    uint64_t value = reader.get_varint();
+    if(value > UINT32_MAX)
+      ASTERIA_THROW("Integer out of range in bytecode (value `$1`)", value);
+    return static_cast<uint32_t>(value);
+  }
+
+uint32_t
+do_get_declared_slot(Bytecode_Reader& reader, AIR_Node::Load_Scope& scope)
+  {
+    // Slots are allocated in ascending order, so a new slot shall follow the last one.
+    // An existing slot may be reused by another variable with the same name.
+    uint32_t slot = do_get_uint32(reader);
+    if(slot > scope.nslots)
+      ASTERIA_THROW("Invalid slot of variable in bytecode (slot `$1`)", slot);
+    scope.nslots = ::rocket::max(scope.nslots, slot + 1);
+    return slot;
+  }
+
+void
+do_check_local_reference(const AIR_Node::Load_Scope& scope, uint32_t depth, uint32_t slot)
+  {
+    // The context shall exist, and the variable shall have been declared in it.
+    // Otherwise `do_get_local_reference()` would walk past the outermost context.
+    auto qscope = &scope;
+    for(uint32_t k = 0;  qscope && (k != depth);  ++k)
+      qscope = qscope->parent_opt;
+    if(!qscope || (slot >= qscope->nslots))
+      ASTERIA_THROW("Invalid local reference in bytecode (depth `$1`, slot `$2`)", depth, slot);
+  }
+
+template<typename EnumT>
+EnumT
+do_get_enum(Bytecode_Reader& reader, EnumT last)
+  {
+    uint8_t value = reader.get_byte();
+    if(value > noadl::weaken_enum(last))
+      ASTERIA_THROW("Enumeration out of range in bytecode (value `$1`)", value);
+    return static_cast<EnumT>(value);
+  }
+
+}  // namespace
+
+opt<AIR_Node>
+AIR_Node::
+rebind_opt(const Abstract_Context& ctx)
+const
+  {
+    switch(this->index()) {
+      case index_clear_stack:
+        // There is nothing to rebind.
+        return nullopt;
+
+      case index_execute_block: {
+        const auto& altr = this->m_stor.as<index_execute_block>();
+
+        // Rebind the body.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_body, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_declare_variable:
+      case index_initialize_variable:
+        // There is nothing to rebind.
+        return nullopt;
+
+      case index_if_statement: {
+        const auto& altr = this->m_stor.as<index_if_statement>();
+
+        // Rebind both branches.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_true, ctx_body);
+        do_rebind_nodes(dirty, bound.code_false, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_switch_statement: {
+        const auto& altr = this->m_stor.as<index_switch_statement>();
+
+        // Rebind all clauses.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_labels, ctx);  // this is not part of the body!
+        do_rebind_nodes(dirty, bound.code_bodies, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_do_while_statement: {
+        const auto& altr = this->m_stor.as<index_do_while_statement>();
+
+        // Rebind the body and the condition.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_body, ctx_body);
+        do_rebind_nodes(dirty, bound.code_cond, ctx);  // this is not part of the body!
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_while_statement: {
+        const auto& altr = this->m_stor.as<index_while_statement>();
+
+        // Rebind the condition and the body.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_cond, ctx);  // this is not part of the body!
+        do_rebind_nodes(dirty, bound.code_body, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_for_each_statement: {
+        const auto& altr = this->m_stor.as<index_for_each_statement>();
+
+        // Rebind the range initializer and the body.
+        Analytic_Context ctx_for(::rocket::ref(ctx));
+        Analytic_Context ctx_body(::rocket::ref(ctx_for));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_init, ctx_for);
+        do_rebind_nodes(dirty, bound.code_body, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_for_statement: {
+        const auto& altr = this->m_stor.as<index_for_statement>();
+
+        // Rebind the initializer, the condition, the loop increment and the body.
+        Analytic_Context ctx_for(::rocket::ref(ctx));
+        Analytic_Context ctx_body(::rocket::ref(ctx_for));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_init, ctx_for);
+        do_rebind_nodes(dirty, bound.code_cond, ctx_for);
+        do_rebind_nodes(dirty, bound.code_step, ctx_for);
+        do_rebind_nodes(dirty, bound.code_body, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_try_statement: {
+        const auto& altr = this->m_stor.as<index_try_statement>();
+
+        // Rebind the `try` and `catch` clauses.
+        Analytic_Context ctx_body(::rocket::ref(ctx));
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_try, ctx_body);
+        do_rebind_nodes(dirty, bound.code_catch, ctx_body);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_throw_statement:
+      case index_assert_statement:
+      case index_return_statement:
+      case index_glvalue_to_prvalue:
+      case index_push_immediate:
+      case index_push_global_reference:
+        // There is nothing to rebind.
+        return nullopt;
+
+      case index_push_local_reference: {
+        const auto& altr = this->m_stor.as<index_push_local_reference>();
+
+        // Get the context.
+        // Don't bind references in analytic contexts.
+        const Abstract_Context* qctx = &ctx;
+        ::rocket::ranged_for(uint32_t(0), altr.depth, [&](uint32_t) { qctx = qctx->get_parent_opt();  });
+        ROCKET_ASSERT(qctx);
+        if(qctx->is_analytic())
+          return nullopt;
+
+        // Look for the reference in the context.
+        // If its declaration has not been executed, bind a void reference, which is
+        // diagnosed as a bypassed variable when it is used.
+        auto qref = static_cast<const Executive_Context*>(qctx)->get_local_reference_opt(altr.slot);
+        if(!qref) {
+          S_push_bound_reference xnode = { Reference_root::S_void() };
+          return ::std::move(xnode);
+        }
+
+        // Bind it now.
+        S_push_bound_reference xnode = { *qref };
+        return ::std::move(xnode);
+      }
+
+      case index_push_bound_reference:
+        // There is nothing to rebind.
+        return nullopt;
+
+      case index_define_function: {
+        const auto& altr = this->m_stor.as<index_define_function>();
+
+        // Rebind the function body.
+        Analytic_Context ctx_func(&ctx, altr.params);
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_body, ctx_func);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_branch_expression: {
+        const auto& altr = this->m_stor.as<index_branch_expression>();
+
+        // Rebind the expression.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_true, ctx);
+        do_rebind_nodes(dirty, bound.code_false, ctx);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_coalescence: {
+        const auto& altr = this->m_stor.as<index_coalescence>();
+
+        // Rebind the expression.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_null, ctx);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_function_call:
+      case index_member_access:
+      case index_push_unnamed_array:
+      case index_push_unnamed_object:
+      case index_apply_operator:
+      case index_unpack_struct_array:
+      case index_unpack_struct_object:
+      case index_define_null_variable:
+      case index_single_step_trap:
+      case index_variadic_call:
+        // There is nothing to rebind.
+        return nullopt;
+
+      case index_defer_expression: {
+        const auto& altr = this->m_stor.as<index_defer_expression>();
+
+        // Rebind the expression.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_rebind_nodes(dirty, bound.code_body, ctx);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_import_call:
+      case index_break_or_continue:
+        // There is nothing to rebind.
+        return nullopt;
+
+      default:
+        ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
+    }
+  }
+
+bool
+AIR_Node::
+is_prvalue_pushed()
+const noexcept
+  {
+    switch(this->index()) {
+      case index_push_immediate:
+      case index_push_unnamed_array:
+      case index_push_unnamed_object:
+        // These always push temporary values.
+        return true;
+
+      case index_apply_operator: {
+        const auto& altr = this->m_stor.as<index_apply_operator>();
+
+        // Operators that are eligible for folding always yield temporaries.
+        return !altr.assign && do_get_foldable_arity(altr.xop);
+      }
+
+      case index_clear_stack:
+      case index_execute_block:
+      case index_declare_variable:
+      case index_initialize_variable:
+      case index_if_statement:
+      case index_switch_statement:
+      case index_do_while_statement:
+      case index_while_statement:
+      case index_for_each_statement:
+      case index_for_statement:
+      case index_try_statement:
+      case index_throw_statement:
+      case index_assert_statement:
+      case index_return_statement:
+      case index_glvalue_to_prvalue:
+      case index_push_global_reference:
+      case index_push_local_reference:
+      case index_push_bound_reference:
+      case index_define_function:
+      case index_branch_expression:
+      case index_coalescence:
+      case index_function_call:
+      case index_member_access:
+      case index_unpack_struct_array:
+      case index_unpack_struct_object:
+      case index_define_null_variable:
+      case index_single_step_trap:
+      case index_variadic_call:
+      case index_defer_expression:
+      case index_import_call:
+      case index_break_or_continue:
+        return false;
+
+      default:
+        ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
+    }
+  }
+
+opt<AIR_Node>
+AIR_Node::
+optimize_opt(const Compiler_Options& opts)
+const
+  {
+    switch(this->index()) {
+      case index_clear_stack:
+        // There is nothing to optimize.
+        return nullopt;
+
+      case index_execute_block: {
+        const auto& altr = this->m_stor.as<index_execute_block>();
+
+        // Optimize the body.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_body, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_declare_variable:
+      case index_initialize_variable:
+        // There is nothing to optimize.
+        return nullopt;
+
+      case index_if_statement: {
+        const auto& altr = this->m_stor.as<index_if_statement>();
+
+        // Optimize both branches.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_true, opts);
+        do_optimize_nodes(dirty, bound.code_false, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_switch_statement: {
+        const auto& altr = this->m_stor.as<index_switch_statement>();
+
+        // Optimize all clauses.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_labels, opts);
+        do_optimize_nodes(dirty, bound.code_bodies, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_do_while_statement: {
+        const auto& altr = this->m_stor.as<index_do_while_statement>();
+
+        // Optimize the body and the condition.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_body, opts);
+        do_optimize_nodes(dirty, bound.code_cond, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_while_statement: {
+        const auto& altr = this->m_stor.as<index_while_statement>();
+
+        // Optimize the condition and the body.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_cond, opts);
+        do_optimize_nodes(dirty, bound.code_body, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_for_each_statement: {
+        const auto& altr = this->m_stor.as<index_for_each_statement>();
+
+        // Optimize the range initializer and the body.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_init, opts);
+        do_optimize_nodes(dirty, bound.code_body, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_for_statement: {
+        const auto& altr = this->m_stor.as<index_for_statement>();
+
+        // Optimize the initializer, the condition, the loop increment and the body.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_init, opts);
+        do_optimize_nodes(dirty, bound.code_cond, opts);
+        do_optimize_nodes(dirty, bound.code_step, opts);
+        do_optimize_nodes(dirty, bound.code_body, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_try_statement: {
+        const auto& altr = this->m_stor.as<index_try_statement>();
+
+        // Optimize the `try` and `catch` clauses.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_try, opts);
+        do_optimize_nodes(dirty, bound.code_catch, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_throw_statement:
+      case index_assert_statement:
+      case index_return_statement:
+      case index_glvalue_to_prvalue:
+      case index_push_immediate:
+      case index_push_global_reference:
+      case index_push_local_reference:
+      case index_push_bound_reference:
+        // There is nothing to optimize.
+        return nullopt;
+
+      case index_define_function:
+        // The body has been optimized when it was generated.
+        return nullopt;
+
+      case index_branch_expression: {
+        const auto& altr = this->m_stor.as<index_branch_expression>();
+
+        // Optimize both branches.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_true, opts);
+        do_optimize_nodes(dirty, bound.code_false, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_coalescence: {
+        const auto& altr = this->m_stor.as<index_coalescence>();
+
+        // Optimize the null branch.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_null, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_function_call:
+      case index_member_access:
+      case index_push_unnamed_array:
+      case index_push_unnamed_object:
+      case index_apply_operator:
+      case index_unpack_struct_array:
+      case index_unpack_struct_object:
+      case index_define_null_variable:
+      case index_single_step_trap:
+      case index_variadic_call:
+        // There is nothing to optimize.
+        return nullopt;
+
+      case index_defer_expression: {
+        const auto& altr = this->m_stor.as<index_defer_expression>();
+
+        // Optimize the expression.
+        bool dirty = false;
+        auto bound = altr;
+
+        do_optimize_nodes(dirty, bound.code_body, opts);
+
+        return do_forward_if_opt(dirty, ::std::move(bound));
+      }
+
+      case index_import_call:
+      case index_break_or_continue:
+        // There is nothing to optimize.
+        return nullopt;
+
+      default:
+        ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
+    }
+  }
+
+bool
+AIR_Node::
+optimize_code(cow_vector<AIR_Node>& code, const Compiler_Options& opts)
+  {
+    if(opts.optimization_level <= 0)
+      return false;
+
+    // Get the values of the last `nargs` nodes if all of them are `S_push_immediate`.
+    // This is the main source of constants.
+    cow_vector<AIR_Node> out;
+    cow_vector<Value> args;
+    auto collect_immediates = [&](size_t nargs) {
+      if(out.size() < nargs)
+        return false;
+
+      for(size_t k = out.size() - nargs;  k < out.size();  ++k)
+        if(out[k].index() != index_push_immediate)
+          return false;
+
+      args.clear();
+      for(size_t k = out.size() - nargs;  k < out.size();  ++k)
+        args.emplace_back(out[k].m_stor.as<index_push_immediate>().value);
+      return true;
+    };
+
+    // Replace the operands with the result of constant folding.
+    auto replace_immediates = [&](size_t nargs, opt<Value>&& qval) {
+      if(!qval)
+        return false;
+
+      out.pop_back(nargs);
+      S_push_immediate xnode = { ::std::move(*qval) };
+      out.emplace_back(::std::move(xnode));
+      return true;
+    };
+
+    bool dirty = false;
+    for(size_t i = 0;  i < code.size();  ++i) {
+      // Optimize nested code first.
+      auto qnode = code[i].optimize_opt(opts);
+      dirty |= !!qnode;
+      const auto& node = qnode ? *qnode : code[i];
+
+      switch(node.index()) {
+        case index_apply_operator: {
+          const auto& altr = node.m_stor.as<index_apply_operator>();
+
+          // Fold operators that have no side effects.
+          auto nargs = altr.assign ? 0 : do_get_foldable_arity(altr.xop);
+          if(nargs && collect_immediates(nargs) && replace_immediates(nargs, do_fold_operator_opt(altr, args))) {
+            dirty |= true;
+            continue;
+          }
+          break;
+        }
+
+        case index_push_unnamed_array: {
+          const auto& altr = node.m_stor.as<index_push_unnamed_array>();
+
+          // Fold arrays whose elements are all constants.
+          bool reachable = true;
+          auto up = AIR_Traits<S_push_unnamed_array>::make_uparam(reachable, altr);
+          if(collect_immediates(altr.nelems) &&
+             replace_immediates(altr.nelems, do_fold_constant_opt<AIR_Traits<S_push_unnamed_array>>(args, up))) {
+            dirty |= true;
+            continue;
+          }
+          break;
+        }
+
+        case index_push_unnamed_object: {
+          const auto& altr = node.m_stor.as<index_push_unnamed_object>();
+
+          // Fold objects whose values are all constants.
+          if(collect_immediates(altr.keys.size()) &&
+             replace_immediates(altr.keys.size(),
+                                do_fold_constant_opt<AIR_Traits<S_push_unnamed_object>>(args, altr.keys))) {
+            dirty |= true;
+            continue;
+          }
+          break;
+        }
+
+        case index_glvalue_to_prvalue: {
+          if(out.empty())
+            break;
+
+          // Drop this conversion if the operand is known to be a prvalue.
+          if(out.back().is_prvalue_pushed()) {
+            dirty |= true;
+            continue;
+          }
+          break;
+        }
+
+        case index_if_statement: {
+          const auto& altr = node.m_stor.as<index_if_statement>();
+
+          // Prune the branch that is never taken if the condition is a constant.
+          if((opts.optimization_level < 2) || !collect_immediates(1))
+            break;
+
+          const auto& code_taken = (args[0].test() != altr.negative) ? altr.code_true : altr.code_false;
+          out.pop_back();
+          if(code_taken.size()) {
+            S_execute_block xnode = { code_taken };
+            out.emplace_back(::std::move(xnode));
+          }
+          dirty |= true;
+          continue;
+        }
+
+        case index_branch_expression: {
+          const auto& altr = node.m_stor.as<index_branch_expression>();
+
+          // Prune the branch that is never taken if the condition is a constant.
+          // An empty branch leaves the condition on the stack as the result.
+          if((opts.optimization_level < 2) || altr.assign || !collect_immediates(1))
+            break;
+
+          const auto& code_taken = args[0].test() ? altr.code_true : altr.code_false;
+          if(code_taken.size()) {
+            out.pop_back();
+            out.append(code_taken.begin(), code_taken.end());
+          }
+          dirty |= true;
+          continue;
+        }
+
+        case index_coalescence: {
+          const auto& altr = node.m_stor.as<index_coalescence>();
+
+          // Prune the null branch if the condition is a constant.
+          if((opts.optimization_level < 2) || altr.assign || !collect_immediates(1))
+            break;
+
+          if(args[0].is_null() && altr.code_null.size()) {
+            out.pop_back();
+            out.append(altr.code_null.begin(), altr.code_null.end());
+          }
+          dirty |= true;
+          continue;
+        }
+
+        case index_throw_statement:
+        case index_return_statement:
+        case index_break_or_continue: {
+          // Discard all nodes after this one, which are unreachable.
+          out.emplace_back(node);
+          dirty |= i + 1 < code.size();
+          i = code.size();
+          continue;
+        }
+
+        case index_clear_stack:
+        case index_execute_block:
+        case index_declare_variable:
+        case index_initialize_variable:
+        case index_switch_statement:
+        case index_do_while_statement:
+        case index_while_statement:
+        case index_for_each_statement:
+        case index_for_statement:
+        case index_try_statement:
+        case index_assert_statement:
+        case index_push_immediate:
+        case index_push_global_reference:
+        case index_push_local_reference:
+        case index_push_bound_reference:
+        case index_define_function:
+        case index_function_call:
+        case index_member_access:
+        case index_unpack_struct_array:
+        case index_unpack_struct_object:
+        case index_define_null_variable:
+        case index_single_step_trap:
+        case index_variadic_call:
+        case index_defer_expression:
+        case index_import_call:
+          // There is nothing to do.
+          break;
+
+        default:
+          ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", node.index());
+      }
+      out.emplace_back(node);
+    }
+
+    if(!dirty)
+      return false;
+
+    code = ::std::move(out);
+    return true;
+  }
+
+bool
+AIR_Node::
+solidify_code(AVMC_Queue& queue, const cow_vector<AIR_Node>& code)
+  {
+    size_t k = 0;
+    while(k != code.size()) {
+      opt<bool> qreach;
+
+      // Look for `local <op> immediate`, optionally followed by an `if` statement.
+      if((k + 2 < code.size()) && (code[k].index() == index_push_local_reference) &&
+         (code[k+1].index() == index_push_immediate) && (code[k+2].index() == index_apply_operator)) {
+        const auto& local = code[k].m_stor.as<index_push_local_reference>();
+        const auto& imm = code[k+1].m_stor.as<index_push_immediate>();
+        const auto& oper = code[k+2].m_stor.as<index_apply_operator>();
+
+        if(local.depth <= UINT8_MAX) {
+          Fused_local_immediate_operator cond = { &local, &imm, &oper };
+          if((k + 3 < code.size()) && (code[k+3].index() == index_if_statement)) {
+            Fused_local_immediate_branch fused = { cond, &(code[k+3].m_stor.as<index_if_statement>()) };
+            qreach = do_solidify_fused_opt<AIR_Traits_Fused_Branch>(queue, oper.xop, fused);
+            if(qreach)
+              k += 4;
+          }
+          if(!qreach) {
+            qreach = do_solidify_fused_opt<AIR_Traits_Fused_Xop>(queue, oper.xop, cond);
+            if(qreach)
+              k += 3;
+          }
+        }
+      }
+
+      // Look for a member access whose result is read immediately. It can be
+      // looked up eagerly, using an inline cache.
+      if(!qreach && (k + 1 < code.size()) && (code[k].index() == index_member_access) &&
+         ((code[k+1].index() == index_glvalue_to_prvalue) ||
+          ((code[k+1].index() == index_apply_operator) &&
+           do_reads_top_first(code[k+1].m_stor.as<index_apply_operator>())))) {
+        Fused_member_read fused = { &(code[k].m_stor.as<index_member_access>()) };
+        qreach = do_solidify_explicit<AIR_Traits_Member_Read>(queue, fused);
+        k += 1;
+
+        // The result is a prvalue already.
+        if(code[k].index() == index_glvalue_to_prvalue)
+          k += 1;
+      }
+
+      // Look for a local reference whose value is read immediately. Its value can be
+      // pushed directly.
+      if(!qreach && (k + 1 < code.size()) && (code[k].index() == index_push_local_reference) &&
+         (code[k+1].index() == index_glvalue_to_prvalue)) {
+        Fused_local_read fused = { &(code[k].m_stor.as<index_push_local_reference>()) };
+        qreach = do_solidify_explicit<AIR_Traits_Local_Read>(queue, fused);
+        k += 2;
+      }
+
+      // Solidify this node alone if it has not been fused.
+      if(!qreach) {
+        qreach = code[k].solidify(queue);
+        k += 1;
+      }
+
+      // Stop at the first unreachable node.
+      if(!*qreach)
+        return false;
+    }
+    return true;
+  }
+
+void
+AIR_Node::
+update_escaping(cow_vector<AIR_Node>& code, const Analytic_Context& ctx)
+  {
+    // Nested code has been generated in other contexts, so only top-level
+    // declarations have to be updated.
+    for(size_t i = 0;  i < code.size();  ++i) {
+      if(code[i].index() == index_declare_variable) {
+        const auto& altr = code[i].m_stor.as<index_declare_variable>();
+        if(altr.escaping && !ctx.is_local_escaping(altr.slot))
+          code.mut(i).m_stor.as<index_declare_variable>().escaping = false;
+      }
+      else if(code[i].index() == index_define_null_variable) {
+        const auto& altr = code[i].m_stor.as<index_define_null_variable>();
+        if(altr.escaping && !ctx.is_local_escaping(altr.slot))
+          code.mut(i).m_stor.as<index_define_null_variable>().escaping = false;
+      }
+    }
+  }
+
+bool
+AIR_Node::
+solidify(AVMC_Queue& queue)
+const
+  {
+    switch(this->index()) {
+      case index_clear_stack: {
+        const auto& altr = this->m_stor.as<index_clear_stack>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_execute_block: {
+        const auto& altr = this->m_stor.as<index_execute_block>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_declare_variable: {
+        const auto& altr = this->m_stor.as<index_declare_variable>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_initialize_variable: {
+        const auto& altr = this->m_stor.as<index_initialize_variable>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_if_statement: {
+        const auto& altr = this->m_stor.as<index_if_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_switch_statement: {
+        const auto& altr = this->m_stor.as<index_switch_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_do_while_statement: {
+        const auto& altr = this->m_stor.as<index_do_while_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_while_statement: {
+        const auto& altr = this->m_stor.as<index_while_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_for_each_statement: {
+        const auto& altr = this->m_stor.as<index_for_each_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_for_statement: {
+        const auto& altr = this->m_stor.as<index_for_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_try_statement: {
+        const auto& altr = this->m_stor.as<index_try_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_throw_statement: {
+        const auto& altr = this->m_stor.as<index_throw_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_assert_statement: {
+        const auto& altr = this->m_stor.as<index_assert_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_return_statement: {
+        const auto& altr = this->m_stor.as<index_return_statement>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_glvalue_to_prvalue: {
+        const auto& altr = this->m_stor.as<index_glvalue_to_prvalue>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_immediate: {
+        const auto& altr = this->m_stor.as<index_push_immediate>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_global_reference: {
+        const auto& altr = this->m_stor.as<index_push_global_reference>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_local_reference: {
+        const auto& altr = this->m_stor.as<index_push_local_reference>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_bound_reference: {
+        const auto& altr = this->m_stor.as<index_push_bound_reference>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_define_function: {
+        const auto& altr = this->m_stor.as<index_define_function>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_branch_expression: {
+        const auto& altr = this->m_stor.as<index_branch_expression>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_coalescence: {
+        const auto& altr = this->m_stor.as<index_coalescence>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_function_call: {
+        const auto& altr = this->m_stor.as<index_function_call>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_member_access: {
+        const auto& altr = this->m_stor.as<index_member_access>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_unnamed_array: {
+        const auto& altr = this->m_stor.as<index_push_unnamed_array>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_push_unnamed_object: {
+        const auto& altr = this->m_stor.as<index_push_unnamed_object>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_apply_operator: {
+        const auto& altr = this->m_stor.as<index_apply_operator>();
+
+        switch(altr.xop) {
+          case xop_inc_post:
+            return do_solidify<xop_inc_post>(queue, altr);
+
+          case xop_dec_post:
+            return do_solidify<xop_dec_post>(queue, altr);
+
+          case xop_subscr:
+            return do_solidify<xop_subscr>(queue, altr);
+
+          case xop_pos:
+            return do_solidify<xop_pos>(queue, altr);
+
+          case xop_neg:
+            return do_solidify<xop_neg>(queue, altr);
+
+          case xop_notb:
+            return do_solidify<xop_notb>(queue, altr);
+
+          case xop_notl:
+            return do_solidify<xop_notl>(queue, altr);
+
+          case xop_inc_pre:
+            return do_solidify<xop_inc_pre>(queue, altr);
+
+          case xop_dec_pre:
+            return do_solidify<xop_dec_pre>(queue, altr);
+
+          case xop_unset:
+            return do_solidify<xop_unset>(queue, altr);
+
+          case xop_countof:
+            return do_solidify<xop_countof>(queue, altr);
+
+          case xop_typeof:
+            return do_solidify<xop_typeof>(queue, altr);
+
+          case xop_sqrt:
+            return do_solidify<xop_sqrt>(queue, altr);
+
+          case xop_isnan:
+            return do_solidify<xop_isnan>(queue, altr);
+
+          case xop_isinf:
+            return do_solidify<xop_isinf>(queue, altr);
+
+          case xop_abs:
+            return do_solidify<xop_abs>(queue, altr);
+
+          case xop_sign:
+            return do_solidify<xop_sign>(queue, altr);
+
+          case xop_round:
+            return do_solidify<xop_round>(queue, altr);
+
+          case xop_floor:
+            return do_solidify<xop_floor>(queue, altr);
+
+          case xop_ceil:
+            return do_solidify<xop_ceil>(queue, altr);
+
+          case xop_trunc:
+            return do_solidify<xop_trunc>(queue, altr);
+
+          case xop_roundi:
+            return do_solidify<xop_roundi>(queue, altr);
+
+          case xop_floori:
+            return do_solidify<xop_floori>(queue, altr);
+
+          case xop_ceili:
+            return do_solidify<xop_ceili>(queue, altr);
+
+          case xop_trunci:
+            return do_solidify<xop_trunci>(queue, altr);
+
+          case xop_cmp_eq:
+            return do_solidify<xop_cmp_eq>(queue, altr);
+
+          case xop_cmp_ne:
+            return do_solidify<xop_cmp_ne>(queue, altr);
+
+          case xop_cmp_lt:
+            return do_solidify<xop_cmp_lt>(queue, altr);
+
+          case xop_cmp_gt:
+            return do_solidify<xop_cmp_gt>(queue, altr);
+
+          case xop_cmp_lte:
+            return do_solidify<xop_cmp_lte>(queue, altr);
+
+          case xop_cmp_gte:
+            return do_solidify<xop_cmp_gte>(queue, altr);
+
+          case xop_cmp_3way:
+            return do_solidify<xop_cmp_3way>(queue, altr);
+
+          case xop_add:
+            return do_solidify<xop_add>(queue, altr);
+
+          case xop_sub:
+            return do_solidify<xop_sub>(queue, altr);
+
+          case xop_mul:
+            return do_solidify<xop_mul>(queue, altr);
+
+          case xop_div:
+            return do_solidify<xop_div>(queue, altr);
+
+          case xop_mod:
+            return do_solidify<xop_mod>(queue, altr);
+
+          case xop_sll:
+            return do_solidify<xop_sll>(queue, altr);
+
+          case xop_srl:
+            return do_solidify<xop_srl>(queue, altr);
+
+          case xop_sla:
+            return do_solidify<xop_sla>(queue, altr);
+
+          case xop_sra:
+            return do_solidify<xop_sra>(queue, altr);
+
+          case xop_andb:
+            return do_solidify<xop_andb>(queue, altr);
+
+          case xop_orb:
+            return do_solidify<xop_orb>(queue, altr);
+
+          case xop_xorb:
+            return do_solidify<xop_xorb>(queue, altr);
+
+          case xop_assign:
+            return do_solidify<xop_assign>(queue, altr);
+
+          case xop_fma:
+            return do_solidify<xop_fma>(queue, altr);
+
+          case xop_head:
+            return do_solidify<xop_head>(queue, altr);
+
+          case xop_tail:
+            return do_solidify<xop_tail>(queue, altr);
+
+          default:
+            ASTERIA_TERMINATE("invalid operator type (xop `$1`)", altr.xop);
+        }
+      }
+
+      case index_unpack_struct_array: {
+        const auto& altr = this->m_stor.as<index_unpack_struct_array>();
+        return do_solidify(queue, altr);
+      }
+
+      case index_unpack_struct_object: {
+        const auto& altr = this->m_stor.as<index_unpack_struct_object>();
+        return do_solidify(queue, altr);
+      }
 
-template<typename TraitsT, typename XaNodeT, typename SparamT, typename SymbolT>
-struct AVMC_Appender<TraitsT, XaNodeT, void, SparamT, SymbolT>
-  {
-    static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, void, SparamT>::thunk,
-                              enumerator_of<SparamT>::thunk>(
-                              TraitsT::make_symbols(altr),
-                              AVMC_Queue::Uparam(),
-                              TraitsT::make_sparam(reachable, altr));
-        return reachable;
+      case index_define_null_variable: {
+        const auto& altr = this->m_stor.as<index_define_null_variable>();
+        return do_solidify(queue, altr);
       }
-  };
 
-template<typename TraitsT, typename XaNodeT, typename SparamT>
-struct AVMC_Appender<TraitsT, XaNodeT, void, SparamT, void>
-  {
-    static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, void, SparamT>::thunk,
-                              enumerator_of<SparamT>::thunk>(
-                              AVMC_Queue::Uparam(),
-                              TraitsT::make_sparam(reachable, altr));
-        return reachable;
+      case index_single_step_trap: {
+        const auto& altr = this->m_stor.as<index_single_step_trap>();
+        return do_solidify(queue, altr);
       }
-  };
 
-template<typename TraitsT, typename XaNodeT, typename SymbolT>
-struct AVMC_Appender<TraitsT, XaNodeT, void, void, SymbolT>
-  {
-    static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& altr)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, void, void>::thunk,
-                              nullptr>(
-                              TraitsT::make_symbols(altr),
-                              AVMC_Queue::Uparam());
-        return reachable;
+      case index_variadic_call: {
+        const auto& altr = this->m_stor.as<index_variadic_call>();
+        return do_solidify(queue, altr);
       }
-  };
 
-template<typename TraitsT, typename XaNodeT>
-struct AVMC_Appender<TraitsT, XaNodeT, void, void, void>
-  {
-    static
-    bool
-    do_append(AVMC_Queue& queue, const XaNodeT& /*altr*/)
-      {
-        bool reachable = true;
-        queue.template append<executor_of<TraitsT, void, void>::thunk,
-                              nullptr>(
-                              AVMC_Queue::Uparam());
-        return reachable;
+      case index_defer_expression: {
+        const auto& altr = this->m_stor.as<index_defer_expression>();
+        return do_solidify(queue, altr);
       }
-  };
 
-template<typename TraitsT, typename XaNodeT>
-inline
-bool
-do_solidify_explicit(AVMC_Queue& queue, const XaNodeT& altr)
-  {
-    bool r = AVMC_Appender<TraitsT, XaNodeT,
-                           typename Uparam_of<TraitsT, XaNodeT>::type,
-                           typename Sparam_of<TraitsT, XaNodeT>::type,
-                           typename Symbols_of<TraitsT, XaNodeT>::type>
-               ::do_append(queue, altr);
-    queue.shrink_to_fit();
-    return r;
-  }
+      case index_import_call: {
+        const auto& altr = this->m_stor.as<index_import_call>();
+        return do_solidify(queue, altr);
+      }
 
-template<typename XaNodeT>
-inline
-bool
-do_solidify(AVMC_Queue& queue, const XaNodeT& altr)
-  {
-    return do_solidify_explicit<AIR_Traits<XaNodeT>>(queue, altr);
-  }
+      case index_break_or_continue: {
+        const auto& altr = this->m_stor.as<index_break_or_continue>();
+        return do_solidify(queue, altr);
+      }
 
-template<Xop xopT>
-inline
-bool
-do_solidify(AVMC_Queue& queue, const AIR_Node::S_apply_operator& altr)
-  {
-    return do_solidify_explicit<AIR_Traits_Xop<xopT>>(queue, altr);
+      default:
+        ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
+    }
   }
 
-}  // namespace
-
-opt<AIR_Node>
+Variable_Callback&
 AIR_Node::
-rebind_opt(const Abstract_Context& ctx)
+enumerate_variables(Variable_Callback& callback)
 const
   {
     switch(this->index()) {
       case index_clear_stack:
-        // There is nothing to rebind.
-        return nullopt;
+        return callback;
 
       case index_execute_block: {
         const auto& altr = this->m_stor.as<index_execute_block>();
-
-        // Rebind the body.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_body, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_declare_variable:
       case index_initialize_variable:
-        // There is nothing to rebind.
-        return nullopt;
+        return callback;
 
       case index_if_statement: {
         const auto& altr = this->m_stor.as<index_if_statement>();
-
-        // Rebind both branches.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_true, ctx_body);
-        do_rebind_nodes(dirty, bound.code_false, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_true, callback);
+        ::rocket::for_each(altr.code_false, callback);
+        return callback;
       }
 
       case index_switch_statement: {
         const auto& altr = this->m_stor.as<index_switch_statement>();
-
-        // Rebind all clauses.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_labels, ctx);  // this is not part of the body!
-        do_rebind_nodes(dirty, bound.code_bodies, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        for(size_t i = 0;  i < altr.code_labels.size();  ++i) {
+          ::rocket::for_each(altr.code_labels.at(i), callback);
+          ::rocket::for_each(altr.code_bodies.at(i), callback);
+        }
+        return callback;
       }
 
       case index_do_while_statement: {
         const auto& altr = this->m_stor.as<index_do_while_statement>();
-
-        // Rebind the body and the condition.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_body, ctx_body);
-        do_rebind_nodes(dirty, bound.code_cond, ctx);  // this is not part of the body!
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_body, callback);
+        ::rocket::for_each(altr.code_cond, callback);
+        return callback;
       }
 
       case index_while_statement: {
         const auto& altr = this->m_stor.as<index_while_statement>();
-
-        // Rebind the condition and the body.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_cond, ctx);  // this is not part of the body!
-        do_rebind_nodes(dirty, bound.code_body, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_cond, callback);
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_for_each_statement: {
         const auto& altr = this->m_stor.as<index_for_each_statement>();
-
-        // Rebind the range initializer and the body.
-        Analytic_Context ctx_for(::rocket::ref(ctx));
-        Analytic_Context ctx_body(::rocket::ref(ctx_for));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_init, ctx_for);
-        do_rebind_nodes(dirty, bound.code_body, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_init, callback);
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_for_statement: {
         const auto& altr = this->m_stor.as<index_for_statement>();
-
-        // Rebind the initializer, the condition, the loop increment and the body.
-        Analytic_Context ctx_for(::rocket::ref(ctx));
-        Analytic_Context ctx_body(::rocket::ref(ctx_for));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_init, ctx_for);
-        do_rebind_nodes(dirty, bound.code_cond, ctx_for);
-        do_rebind_nodes(dirty, bound.code_step, ctx_for);
-        do_rebind_nodes(dirty, bound.code_body, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_init, callback);
+        ::rocket::for_each(altr.code_cond, callback);
+        ::rocket::for_each(altr.code_step, callback);
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_try_statement: {
         const auto& altr = this->m_stor.as<index_try_statement>();
-
-        // Rebind the `try` and `catch` clauses.
-        Analytic_Context ctx_body(::rocket::ref(ctx));
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_try, ctx_body);
-        do_rebind_nodes(dirty, bound.code_catch, ctx_body);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_try, callback);
+        ::rocket::for_each(altr.code_catch, callback);
+        return callback;
       }
 
       case index_throw_statement:
       case index_assert_statement:
       case index_return_statement:
       case index_glvalue_to_prvalue:
-      case index_push_immediate:
-      case index_push_global_reference:
-        // There is nothing to rebind.
-        return nullopt;
-
-      case index_push_local_reference: {
-        const auto& altr = this->m_stor.as<index_push_local_reference>();
-
-        // Get the context.
-        // Don't bind references in analytic contexts.
-        const Abstract_Context* qctx = &ctx;
-        ::rocket::ranged_for(uint32_t(0), altr.depth, [&](uint32_t) { qctx = qctx->get_parent_opt();  });
-        ROCKET_ASSERT(qctx);
-        if(qctx->is_analytic())
-          return nullopt;
-
-        // Look for the name in the context.
-        auto qref = qctx->get_named_reference_opt(altr.name);
-        if(!qref)
-          return nullopt;
+        return callback;
 
-        // Bind it now.
-        S_push_bound_reference xnode = { *qref };
-        return ::std::move(xnode);
+      case index_push_immediate: {
+        const auto& altr = this->m_stor.as<index_push_immediate>();
+        altr.value.enumerate_variables(callback);
+        return callback;
       }
 
-      case index_push_bound_reference:
-        // There is nothing to rebind.
-        return nullopt;
+      case index_push_global_reference:
+      case index_push_local_reference:
+        return callback;
+
+      case index_push_bound_reference: {
+        const auto& altr = this->m_stor.as<index_push_bound_reference>();
+        altr.ref.enumerate_variables(callback);
+        return callback;
+      }
 
       case index_define_function: {
         const auto& altr = this->m_stor.as<index_define_function>();
-
-        // Rebind the function body.
-        Analytic_Context ctx_func(&ctx, altr.params);
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_body, ctx_func);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_branch_expression: {
         const auto& altr = this->m_stor.as<index_branch_expression>();
-
-        // Rebind the expression.
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_true, ctx);
-        do_rebind_nodes(dirty, bound.code_false, ctx);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_true, callback);
+        ::rocket::for_each(altr.code_false, callback);
+        return callback;
       }
 
       case index_coalescence: {
         const auto& altr = this->m_stor.as<index_coalescence>();
-
-        // Rebind the expression.
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_null, ctx);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_null, callback);
+        return callback;
       }
 
       case index_function_call:
@@ -4250,358 +6309,257 @@ const
       case index_define_null_variable:
       case index_single_step_trap:
       case index_variadic_call:
-        // There is nothing to rebind.
-        return nullopt;
+        return callback;
 
       case index_defer_expression: {
         const auto& altr = this->m_stor.as<index_defer_expression>();
-
-        // Rebind the expression.
-        bool dirty = false;
-        auto bound = altr;
-
-        do_rebind_nodes(dirty, bound.code_body, ctx);
-
-        return do_forward_if_opt(dirty, ::std::move(bound));
+        ::rocket::for_each(altr.code_body, callback);
+        return callback;
       }
 
       case index_import_call:
       case index_break_or_continue:
-        // There is nothing to rebind.
-        return nullopt;
+        return callback;
 
       default:
         ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
     }
   }
 
-bool
+Bytecode_Writer&
 AIR_Node::
-solidify(AVMC_Queue& queue)
+serialize(Bytecode_Writer& writer)
 const
   {
+    writer.put_byte(this->index());
+
     switch(this->index()) {
-      case index_clear_stack: {
-        const auto& altr = this->m_stor.as<index_clear_stack>();
-        return do_solidify(queue, altr);
-      }
+      case index_clear_stack:
+        return writer;
 
       case index_execute_block: {
         const auto& altr = this->m_stor.as<index_execute_block>();
-        return do_solidify(queue, altr);
+        return serialize_code(writer, altr.code_body);
       }
 
       case index_declare_variable: {
         const auto& altr = this->m_stor.as<index_declare_variable>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        writer.put_varint(altr.slot);
+        writer.put_string(altr.name.rdstr());
+        return writer.put_byte(altr.escaping);
       }
 
       case index_initialize_variable: {
         const auto& altr = this->m_stor.as<index_initialize_variable>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        return writer.put_byte(altr.immutable);
       }
 
       case index_if_statement: {
         const auto& altr = this->m_stor.as<index_if_statement>();
-        return do_solidify(queue, altr);
+        writer.put_byte(altr.negative);
+        serialize_code(writer, altr.code_true);
+        return serialize_code(writer, altr.code_false);
       }
 
       case index_switch_statement: {
         const auto& altr = this->m_stor.as<index_switch_statement>();
-        return do_solidify(queue, altr);
+        do_put_codes(writer, altr.code_labels);
+        return do_put_codes(writer, altr.code_bodies);
       }
 
       case index_do_while_statement: {
         const auto& altr = this->m_stor.as<index_do_while_statement>();
-        return do_solidify(queue, altr);
+        serialize_code(writer, altr.code_body);
+        writer.put_byte(altr.negative);
+        return serialize_code(writer, altr.code_cond);
       }
 
       case index_while_statement: {
         const auto& altr = this->m_stor.as<index_while_statement>();
-        return do_solidify(queue, altr);
+        writer.put_byte(altr.negative);
+        serialize_code(writer, altr.code_cond);
+        return serialize_code(writer, altr.code_body);
       }
 
       case index_for_each_statement: {
         const auto& altr = this->m_stor.as<index_for_each_statement>();
-        return do_solidify(queue, altr);
+        writer.put_varint(altr.slot_key);
+        writer.put_varint(altr.slot_mapped);
+        serialize_code(writer, altr.code_init);
+        return serialize_code(writer, altr.code_body);
       }
 
       case index_for_statement: {
         const auto& altr = this->m_stor.as<index_for_statement>();
-        return do_solidify(queue, altr);
+        serialize_code(writer, altr.code_init);
+        serialize_code(writer, altr.code_cond);
+        serialize_code(writer, altr.code_step);
+        return serialize_code(writer, altr.code_body);
       }
 
       case index_try_statement: {
         const auto& altr = this->m_stor.as<index_try_statement>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc_try);
+        serialize_code(writer, altr.code_try);
+        writer.put_source_location(altr.sloc_catch);
+        writer.put_varint(altr.slot_except);
+        writer.put_varint(altr.slot_backtrace);
+        return serialize_code(writer, altr.code_catch);
       }
 
       case index_throw_statement: {
         const auto& altr = this->m_stor.as<index_throw_statement>();
-        return do_solidify(queue, altr);
+        return writer.put_source_location(altr.sloc);
       }
 
       case index_assert_statement: {
         const auto& altr = this->m_stor.as<index_assert_statement>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        writer.put_byte(altr.negative);
+        return writer.put_string(altr.msg);
       }
 
       case index_return_statement: {
         const auto& altr = this->m_stor.as<index_return_statement>();
-        return do_solidify(queue, altr);
+        return writer.put_byte(altr.status);
       }
 
       case index_glvalue_to_prvalue: {
         const auto& altr = this->m_stor.as<index_glvalue_to_prvalue>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_immediate: {
-        const auto& altr = this->m_stor.as<index_push_immediate>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_global_reference: {
-        const auto& altr = this->m_stor.as<index_push_global_reference>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_local_reference: {
-        const auto& altr = this->m_stor.as<index_push_local_reference>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_bound_reference: {
-        const auto& altr = this->m_stor.as<index_push_bound_reference>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_define_function: {
-        const auto& altr = this->m_stor.as<index_define_function>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_branch_expression: {
-        const auto& altr = this->m_stor.as<index_branch_expression>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_coalescence: {
-        const auto& altr = this->m_stor.as<index_coalescence>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_function_call: {
-        const auto& altr = this->m_stor.as<index_function_call>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_member_access: {
-        const auto& altr = this->m_stor.as<index_member_access>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_unnamed_array: {
-        const auto& altr = this->m_stor.as<index_push_unnamed_array>();
-        return do_solidify(queue, altr);
-      }
-
-      case index_push_unnamed_object: {
-        const auto& altr = this->m_stor.as<index_push_unnamed_object>();
-        return do_solidify(queue, altr);
+        return writer.put_source_location(altr.sloc);
       }
 
-      case index_apply_operator: {
-        const auto& altr = this->m_stor.as<index_apply_operator>();
-
-        switch(altr.xop) {
-          case xop_inc_post:
-            return do_solidify<xop_inc_post>(queue, altr);
-
-          case xop_dec_post:
-            return do_solidify<xop_dec_post>(queue, altr);
-
-          case xop_subscr:
-            return do_solidify<xop_subscr>(queue, altr);
-
-          case xop_pos:
-            return do_solidify<xop_pos>(queue, altr);
-
-          case xop_neg:
-            return do_solidify<xop_neg>(queue, altr);
-
-          case xop_notb:
-            return do_solidify<xop_notb>(queue, altr);
-
-          case xop_notl:
-            return do_solidify<xop_notl>(queue, altr);
-
-          case xop_inc_pre:
-            return do_solidify<xop_inc_pre>(queue, altr);
-
-          case xop_dec_pre:
-            return do_solidify<xop_dec_pre>(queue, altr);
-
-          case xop_unset:
-            return do_solidify<xop_unset>(queue, altr);
-
-          case xop_countof:
-            return do_solidify<xop_countof>(queue, altr);
-
-          case xop_typeof:
-            return do_solidify<xop_typeof>(queue, altr);
-
-          case xop_sqrt:
-            return do_solidify<xop_sqrt>(queue, altr);
-
-          case xop_isnan:
-            return do_solidify<xop_isnan>(queue, altr);
-
-          case xop_isinf:
-            return do_solidify<xop_isinf>(queue, altr);
-
-          case xop_abs:
-            return do_solidify<xop_abs>(queue, altr);
-
-          case xop_sign:
-            return do_solidify<xop_sign>(queue, altr);
-
-          case xop_round:
-            return do_solidify<xop_round>(queue, altr);
-
-          case xop_floor:
-            return do_solidify<xop_floor>(queue, altr);
-
-          case xop_ceil:
-            return do_solidify<xop_ceil>(queue, altr);
-
-          case xop_trunc:
-            return do_solidify<xop_trunc>(queue, altr);
-
-          case xop_roundi:
-            return do_solidify<xop_roundi>(queue, altr);
-
-          case xop_floori:
-            return do_solidify<xop_floori>(queue, altr);
-
-          case xop_ceili:
-            return do_solidify<xop_ceili>(queue, altr);
-
-          case xop_trunci:
-            return do_solidify<xop_trunci>(queue, altr);
-
-          case xop_cmp_eq:
-            return do_solidify<xop_cmp_eq>(queue, altr);
-
-          case xop_cmp_ne:
-            return do_solidify<xop_cmp_ne>(queue, altr);
-
-          case xop_cmp_lt:
-            return do_solidify<xop_cmp_lt>(queue, altr);
-
-          case xop_cmp_gt:
-            return do_solidify<xop_cmp_gt>(queue, altr);
-
-          case xop_cmp_lte:
-            return do_solidify<xop_cmp_lte>(queue, altr);
-
-          case xop_cmp_gte:
-            return do_solidify<xop_cmp_gte>(queue, altr);
-
-          case xop_cmp_3way:
-            return do_solidify<xop_cmp_3way>(queue, altr);
-
-          case xop_add:
-            return do_solidify<xop_add>(queue, altr);
-
-          case xop_sub:
-            return do_solidify<xop_sub>(queue, altr);
-
-          case xop_mul:
-            return do_solidify<xop_mul>(queue, altr);
-
-          case xop_div:
-            return do_solidify<xop_div>(queue, altr);
-
-          case xop_mod:
-            return do_solidify<xop_mod>(queue, altr);
-
-          case xop_sll:
-            return do_solidify<xop_sll>(queue, altr);
+      case index_push_immediate: {
+        const auto& altr = this->m_stor.as<index_push_immediate>();
+        return writer.put_value(altr.value);
+      }
 
-          case xop_srl:
-            return do_solidify<xop_srl>(queue, altr);
+      case index_push_global_reference: {
+        const auto& altr = this->m_stor.as<index_push_global_reference>();
+        writer.put_source_location(altr.sloc);
+        return writer.put_string(altr.name.rdstr());
+      }
 
-          case xop_sla:
-            return do_solidify<xop_sla>(queue, altr);
+      case index_push_local_reference: {
+        const auto& altr = this->m_stor.as<index_push_local_reference>();
+        writer.put_source_location(altr.sloc);
+        writer.put_varint(altr.depth);
+        writer.put_varint(altr.slot);
+        return writer.put_string(altr.name.rdstr());
+      }
 
-          case xop_sra:
-            return do_solidify<xop_sra>(queue, altr);
+      case index_push_bound_reference:
+        ASTERIA_THROW("Bound references not serializable");
 
-          case xop_andb:
-            return do_solidify<xop_andb>(queue, altr);
+      case index_define_function: {
+        const auto& altr = this->m_stor.as<index_define_function>();
+        writer.put_options(altr.opts);
+        writer.put_source_location(altr.sloc);
+        writer.put_string(altr.func);
+        do_put_names(writer, altr.params);
+        return serialize_code(writer, altr.code_body);
+      }
 
-          case xop_orb:
-            return do_solidify<xop_orb>(queue, altr);
+      case index_branch_expression: {
+        const auto& altr = this->m_stor.as<index_branch_expression>();
+        writer.put_source_location(altr.sloc);
+        serialize_code(writer, altr.code_true);
+        serialize_code(writer, altr.code_false);
+        return writer.put_byte(altr.assign);
+      }
 
-          case xop_xorb:
-            return do_solidify<xop_xorb>(queue, altr);
+      case index_coalescence: {
+        const auto& altr = this->m_stor.as<index_coalescence>();
+        writer.put_source_location(altr.sloc);
+        serialize_code(writer, altr.code_null);
+        return writer.put_byte(altr.assign);
+      }
 
-          case xop_assign:
-            return do_solidify<xop_assign>(queue, altr);
+      case index_function_call: {
+        const auto& altr = this->m_stor.as<index_function_call>();
+        writer.put_source_location(altr.sloc);
+        writer.put_varint(altr.nargs);
+        return writer.put_byte(altr.ptc);
+      }
 
-          case xop_fma:
-            return do_solidify<xop_fma>(queue, altr);
+      case index_member_access: {
+        const auto& altr = this->m_stor.as<index_member_access>();
+        writer.put_source_location(altr.sloc);
+        return writer.put_string(altr.name.rdstr());
+      }
 
-          case xop_head:
-            return do_solidify<xop_head>(queue, altr);
+      case index_push_unnamed_array: {
+        const auto& altr = this->m_stor.as<index_push_unnamed_array>();
+        writer.put_source_location(altr.sloc);
+        return writer.put_varint(altr.nelems);
+      }
 
-          case xop_tail:
-            return do_solidify<xop_tail>(queue, altr);
+      case index_push_unnamed_object: {
+        const auto& altr = this->m_stor.as<index_push_unnamed_object>();
+        writer.put_source_location(altr.sloc);
+        return do_put_names(writer, altr.keys);
+      }
 
-          default:
-            ASTERIA_TERMINATE("invalid operator type (xop `$1`)", altr.xop);
-        }
+      case index_apply_operator: {
+        const auto& altr = this->m_stor.as<index_apply_operator>();
+        writer.put_source_location(altr.sloc);
+        writer.put_byte(altr.xop);
+        return writer.put_byte(altr.assign);
       }
 
       case index_unpack_struct_array: {
         const auto& altr = this->m_stor.as<index_unpack_struct_array>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        writer.put_byte(altr.immutable);
+        return writer.put_varint(altr.nelems);
       }
 
       case index_unpack_struct_object: {
         const auto& altr = this->m_stor.as<index_unpack_struct_object>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        writer.put_byte(altr.immutable);
+        return do_put_names(writer, altr.keys);
       }
 
       case index_define_null_variable: {
         const auto& altr = this->m_stor.as<index_define_null_variable>();
-        return do_solidify(queue, altr);
+        writer.put_byte(altr.immutable);
+        writer.put_source_location(altr.sloc);
+        writer.put_varint(altr.slot);
+        writer.put_string(altr.name.rdstr());
+        return writer.put_byte(altr.escaping);
       }
 
       case index_single_step_trap: {
         const auto& altr = this->m_stor.as<index_single_step_trap>();
-        return do_solidify(queue, altr);
+        return writer.put_source_location(altr.sloc);
       }
 
       case index_variadic_call: {
         const auto& altr = this->m_stor.as<index_variadic_call>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        return writer.put_byte(altr.ptc);
       }
 
       case index_defer_expression: {
         const auto& altr = this->m_stor.as<index_defer_expression>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        return serialize_code(writer, altr.code_body);
       }
 
       case index_import_call: {
         const auto& altr = this->m_stor.as<index_import_call>();
-        return do_solidify(queue, altr);
+        writer.put_options(altr.opts);
+        writer.put_source_location(altr.sloc);
+        return writer.put_varint(altr.nargs);
       }
 
       case index_break_or_continue: {
         const auto& altr = this->m_stor.as<index_break_or_continue>();
-        return do_solidify(queue, altr);
+        writer.put_source_location(altr.sloc);
+        return writer.put_byte(altr.status);
       }
 
       default:
@@ -4609,144 +6567,271 @@ const
     }
   }
 
-Variable_Callback&
+AIR_Node
 AIR_Node::
-enumerate_variables(Variable_Callback& callback)
-const
+deserialize(Bytecode_Reader& reader, Load_Scope& scope)
   {
-    switch(this->index()) {
-      case index_clear_stack:
-        return callback;
+    // Fields are read in the order they are listed in the initializer, which is
+    // guaranteed to be left-to-right.
+    // Scopes are created where executive contexts will be created. See `rebind_opt()`.
+    auto index = static_cast<Index>(reader.get_byte());
+
+    switch(index) {
+      case index_clear_stack: {
+        S_clear_stack xnode = { };
+        return ::std::move(xnode);
+      }
 
       case index_execute_block: {
-        const auto& altr = this->m_stor.as<index_execute_block>();
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        Load_Scope scope_body = { &scope, 0 };
+        S_execute_block xnode = { deserialize_code(reader, scope_body) };
+        return ::std::move(xnode);
       }
 
-      case index_declare_variable:
-      case index_initialize_variable:
-        return callback;
+      case index_declare_variable: {
+        S_declare_variable xnode = { reader.get_source_location(), do_get_declared_slot(reader, scope),
+                                     reader.get_string(), reader.get_byte() != 0 };
+        return ::std::move(xnode);
+      }
+
+      case index_initialize_variable: {
+        S_initialize_variable xnode = { reader.get_source_location(), reader.get_byte() != 0 };
+        return ::std::move(xnode);
+      }
 
       case index_if_statement: {
-        const auto& altr = this->m_stor.as<index_if_statement>();
-        ::rocket::for_each(altr.code_true, callback);
-        ::rocket::for_each(altr.code_false, callback);
-        return callback;
+        Load_Scope scope_true = { &scope, 0 };
+        Load_Scope scope_false = { &scope, 0 };
+        S_if_statement xnode = { reader.get_byte() != 0, deserialize_code(reader, scope_true),
+                                 deserialize_code(reader, scope_false) };
+        return ::std::move(xnode);
       }
 
       case index_switch_statement: {
-        const auto& altr = this->m_stor.as<index_switch_statement>();
-        for(size_t i = 0;  i < altr.code_labels.size();  ++i) {
-          ::rocket::for_each(altr.code_labels.at(i), callback);
-          ::rocket::for_each(altr.code_bodies.at(i), callback);
-        }
-        return callback;
+        // All clauses share the same context. Labels are not part of it.
+        Load_Scope scope_body = { &scope, 0 };
+        S_switch_statement xnode = { do_get_codes(reader, scope), do_get_codes(reader, scope_body) };
+        if(xnode.code_labels.size() != xnode.code_bodies.size())
+          ASTERIA_THROW("Invalid `switch` statement in bytecode");
+        return ::std::move(xnode);
       }
 
       case index_do_while_statement: {
-        const auto& altr = this->m_stor.as<index_do_while_statement>();
-        ::rocket::for_each(altr.code_body, callback);
-        ::rocket::for_each(altr.code_cond, callback);
-        return callback;
+        Load_Scope scope_body = { &scope, 0 };
+        S_do_while_statement xnode = { deserialize_code(reader, scope_body), reader.get_byte() != 0,
+                                       deserialize_code(reader, scope) };
+        return ::std::move(xnode);
       }
 
       case index_while_statement: {
-        const auto& altr = this->m_stor.as<index_while_statement>();
-        ::rocket::for_each(altr.code_cond, callback);
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        Load_Scope scope_body = { &scope, 0 };
+        S_while_statement xnode = { reader.get_byte() != 0, deserialize_code(reader, scope),
+                                    deserialize_code(reader, scope_body) };
+        return ::std::move(xnode);
       }
 
       case index_for_each_statement: {
-        const auto& altr = this->m_stor.as<index_for_each_statement>();
-        ::rocket::for_each(altr.code_init, callback);
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        Load_Scope scope_for = { &scope, 0 };
+        Load_Scope scope_body = { &scope_for, 0 };
+        S_for_each_statement xnode = { do_get_declared_slot(reader, scope_for),
+                                       do_get_declared_slot(reader, scope_for),
+                                       deserialize_code(reader, scope_for),
+                                       deserialize_code(reader, scope_body) };
+        return ::std::move(xnode);
       }
 
       case index_for_statement: {
-        const auto& altr = this->m_stor.as<index_for_statement>();
-        ::rocket::for_each(altr.code_init, callback);
-        ::rocket::for_each(altr.code_cond, callback);
-        ::rocket::for_each(altr.code_step, callback);
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        Load_Scope scope_for = { &scope, 0 };
+        Load_Scope scope_body = { &scope_for, 0 };
+        S_for_statement xnode = { deserialize_code(reader, scope_for), deserialize_code(reader, scope_for),
+                                  deserialize_code(reader, scope_for), deserialize_code(reader, scope_body) };
+        return ::std::move(xnode);
       }
 
       case index_try_statement: {
-        const auto& altr = this->m_stor.as<index_try_statement>();
-        ::rocket::for_each(altr.code_try, callback);
-        ::rocket::for_each(altr.code_catch, callback);
-        return callback;
+        Load_Scope scope_try = { &scope, 0 };
+        Load_Scope scope_catch = { &scope, 0 };
+        S_try_statement xnode = { reader.get_source_location(), deserialize_code(reader, scope_try),
+                                  reader.get_source_location(), do_get_declared_slot(reader, scope_catch),
+                                  do_get_declared_slot(reader, scope_catch),
+                                  deserialize_code(reader, scope_catch) };
+        return ::std::move(xnode);
       }
 
-      case index_throw_statement:
-      case index_assert_statement:
-      case index_return_statement:
-      case index_glvalue_to_prvalue:
-        return callback;
+      case index_throw_statement: {
+        S_throw_statement xnode = { reader.get_source_location() };
+        return ::std::move(xnode);
+      }
+
+      case index_assert_statement: {
+        S_assert_statement xnode = { reader.get_source_location(), reader.get_byte() != 0,
+                                     reader.get_string().rdstr() };
+        return ::std::move(xnode);
+      }
+
+      case index_return_statement: {
+        S_return_statement xnode = { do_get_enum(reader, air_status_continue_for) };
+        return ::std::move(xnode);
+      }
+
+      case index_glvalue_to_prvalue: {
+        S_glvalue_to_prvalue xnode = { reader.get_source_location() };
+        return ::std::move(xnode);
+      }
 
       case index_push_immediate: {
-        const auto& altr = this->m_stor.as<index_push_immediate>();
-        altr.value.enumerate_variables(callback);
-        return callback;
+        S_push_immediate xnode = { reader.get_value() };
+        return ::std::move(xnode);
       }
 
-      case index_push_global_reference:
-      case index_push_local_reference:
-        return callback;
+      case index_push_global_reference: {
+        S_push_global_reference xnode = { reader.get_source_location(), reader.get_string() };
+        return ::std::move(xnode);
+      }
 
-      case index_push_bound_reference: {
-        const auto& altr = this->m_stor.as<index_push_bound_reference>();
-        altr.ref.enumerate_variables(callback);
-        return callback;
+      case index_push_local_reference: {
+        S_push_local_reference xnode = { reader.get_source_location(), do_get_uint32(reader),
+                                         do_get_uint32(reader), reader.get_string() };
+        do_check_local_reference(scope, xnode.depth, xnode.slot);
+        return ::std::move(xnode);
       }
 
       case index_define_function: {
-        const auto& altr = this->m_stor.as<index_define_function>();
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        S_define_function xnode = { reader.get_options(), reader.get_source_location(),
+                                    reader.get_string().rdstr(), do_get_names(reader), { } };
+        xnode.code_body = deserialize_function_code(reader, &scope, xnode.params);
+        return ::std::move(xnode);
       }
 
       case index_branch_expression: {
-        const auto& altr = this->m_stor.as<index_branch_expression>();
-        ::rocket::for_each(altr.code_true, callback);
-        ::rocket::for_each(altr.code_false, callback);
-        return callback;
+        S_branch_expression xnode = { reader.get_source_location(), deserialize_code(reader, scope),
+                                      deserialize_code(reader, scope), reader.get_byte() != 0 };
+        return ::std::move(xnode);
       }
 
       case index_coalescence: {
-        const auto& altr = this->m_stor.as<index_coalescence>();
-        ::rocket::for_each(altr.code_null, callback);
-        return callback;
+        S_coalescence xnode = { reader.get_source_location(), deserialize_code(reader, scope),
+                                reader.get_byte() != 0 };
+        return ::std::move(xnode);
       }
 
-      case index_function_call:
-      case index_member_access:
-      case index_push_unnamed_array:
-      case index_push_unnamed_object:
-      case index_apply_operator:
-      case index_unpack_struct_array:
-      case index_unpack_struct_object:
-      case index_define_null_variable:
-      case index_single_step_trap:
-      case index_variadic_call:
-        return callback;
+      case index_function_call: {
+        S_function_call xnode = { reader.get_source_location(), do_get_uint32(reader),
+                                  do_get_enum(reader, ptc_aware_void) };
+        return ::std::move(xnode);
+      }
+
+      case index_member_access: {
+        S_member_access xnode = { reader.get_source_location(), reader.get_string() };
+        return ::std::move(xnode);
+      }
+
+      case index_push_unnamed_array: {
+        S_push_unnamed_array xnode = { reader.get_source_location(), do_get_uint32(reader) };
+        return ::std::move(xnode);
+      }
+
+      case index_push_unnamed_object: {
+        S_push_unnamed_object xnode = { reader.get_source_location(), do_get_names(reader) };
+        return ::std::move(xnode);
+      }
+
+      case index_apply_operator: {
+        S_apply_operator xnode = { reader.get_source_location(), do_get_enum(reader, xop_tail),
+                                   reader.get_byte() != 0 };
+        return ::std::move(xnode);
+      }
+
+      case index_unpack_struct_array: {
+        S_unpack_struct_array xnode = { reader.get_source_location(), reader.get_byte() != 0,
+                                        do_get_uint32(reader) };
+        return ::std::move(xnode);
+      }
+
+      case index_unpack_struct_object: {
+        S_unpack_struct_object xnode = { reader.get_source_location(), reader.get_byte() != 0,
+                                         do_get_names(reader) };
+        return ::std::move(xnode);
+      }
+
+      case index_define_null_variable: {
+        S_define_null_variable xnode = { reader.get_byte() != 0, reader.get_source_location(),
+                                         do_get_declared_slot(reader, scope), reader.get_string(),
+                                         reader.get_byte() != 0 };
+        return ::std::move(xnode);
+      }
+
+      case index_single_step_trap: {
+        S_single_step_trap xnode = { reader.get_source_location() };
+        return ::std::move(xnode);
+      }
+
+      case index_variadic_call: {
+        S_variadic_call xnode = { reader.get_source_location(), do_get_enum(reader, ptc_aware_void) };
+        return ::std::move(xnode);
+      }
 
       case index_defer_expression: {
-        const auto& altr = this->m_stor.as<index_defer_expression>();
-        ::rocket::for_each(altr.code_body, callback);
-        return callback;
+        S_defer_expression xnode = { reader.get_source_location(), deserialize_code(reader, scope) };
+        return ::std::move(xnode);
       }
 
-      case index_import_call:
-      case index_break_or_continue:
-        return callback;
+      case index_import_call: {
+        S_import_call xnode = { reader.get_options(), reader.get_source_location(),
+                                do_get_uint32(reader) };
+        return ::std::move(xnode);
+      }
+
+      case index_break_or_continue: {
+        S_break_or_continue xnode = { reader.get_source_location(),
+                                      do_get_enum(reader, air_status_continue_for) };
+        return ::std::move(xnode);
+      }
 
+      case index_push_bound_reference:
       default:
-        ASTERIA_TERMINATE("invalid AIR node type (index `$1`)", this->index());
+        ASTERIA_THROW("Invalid AIR node type in bytecode (index `$1`)", index);
     }
   }
 
+Bytecode_Writer&
+AIR_Node::
+serialize_code(Bytecode_Writer& writer, const cow_vector<AIR_Node>& code)
+  {
+    writer.put_varint(code.size());
+    for(const auto& node : code)
+      node.serialize(writer);
+    return writer;
+  }
+
+cow_vector<AIR_Node>
+AIR_Node::
+deserialize_code(Bytecode_Reader& reader, Load_Scope& scope)
+  {
+    cow_vector<AIR_Node> code;
+    uint64_t count = reader.get_varint();
+    while(count-- != 0)
+      code.emplace_back(deserialize(reader, scope));
+    return code;
+  }
+
+cow_vector<AIR_Node>
+AIR_Node::
+deserialize_function_code(Bytecode_Reader& reader, const Load_Scope* parent_opt,
+                          const cow_vector<phsh_string>& params)
+  {
+    // Parameters are followed by `__varg`, `__this` and `__func`. The variadic
+    // placeholder occupies no slot. See `Analytic_Context::do_prepare_function()`.
+    size_t nparams = params.size();
+    for(size_t i = 0;  i < params.size();  ++i)
+      if(params[i] == "...") {
+        if(i != params.size() - 1)
+          ASTERIA_THROW("Invalid parameter list in bytecode");
+        nparams = i;
+      }
+
+    Load_Scope scope_func = { parent_opt, static_cast<uint32_t>(nparams + 3) };
+    return deserialize_code(reader, scope_func);
+  }
+
 }  // namespace asteria
@@ -26,7 +26,9 @@ class AIR_Node
     struct S_declare_variable
       {
         Source_Location sloc;
+        uint32_t slot;
         phsh_string name;
+        bool escaping;
       };
 
     struct S_initialize_variable
@@ -46,7 +48,6 @@ class AIR_Node
       {
         cow_vector<cow_vector<AIR_Node>> code_labels;
         cow_vector<cow_vector<AIR_Node>> code_bodies;
-        cow_vector<cow_vector<phsh_string>> names_added;
       };
 
     struct S_do_while_statement
@@ -65,8 +66,8 @@ class AIR_Node
 
     struct S_for_each_statement
       {
-        phsh_string name_key;
-        phsh_string name_mapped;
+        uint32_t slot_key;
+        uint32_t slot_mapped;
         cow_vector<AIR_Node> code_init;
         cow_vector<AIR_Node> code_body;
       };
@@ -84,7 +85,8 @@ class AIR_Node
         Source_Location sloc_try;
         cow_vector<AIR_Node> code_try;
         Source_Location sloc_catch;
-        phsh_string name_except;
+        uint32_t slot_except;
+        uint32_t slot_backtrace;
         cow_vector<AIR_Node> code_catch;
       };
 
@@ -125,6 +127,7 @@ class AIR_Node
       {
         Source_Location sloc;
         uint32_t depth;
+        uint32_t slot;
         phsh_string name;
       };
 
@@ -207,7 +210,9 @@ class AIR_Node
       {
         bool immutable;
         Source_Location sloc;
+        uint32_t slot;
         phsh_string name;
+        bool escaping;
       };
 
     struct S_single_step_trap
@@ -320,6 +325,13 @@ class AIR_Node
 
     static_assert(::std::is_nothrow_copy_assignable<Storage>::value);
 
+    // This describes a scope of bytecode that is being read. See `deserialize()`.
+    struct Load_Scope
+      {
+        const Load_Scope* parent_opt;
+        uint32_t nslots;  // number of slots that have been declared
+      };
+
   private:
     Storage m_stor;
 
@@ -355,6 +367,35 @@ class AIR_Node
     rebind_opt(const Abstract_Context& ctx)
     const;
 
+    // Check whether this node always pushes a prvalue onto the stack.
+    bool
+    is_prvalue_pushed()
+    const noexcept;
+
+    // Optimize this node.
+    // Nested code is optimized recursively. If this node has been rewritten,
+    // the new node is returned.
+    opt<AIR_Node>
+    optimize_opt(const Compiler_Options& opts)
+    const;
+
+    // Optimize a sequence of nodes in place, according to `opts.optimization_level`.
+    // Level 1 folds constant subexpressions, removes redundant glvalue-to-prvalue
+    // conversions and unreachable nodes after `return`, `throw`, `break` and
+    // `continue`. Level 2 also prunes branches with constant conditions.
+    // The return value indicates whether `code` has been modified.
+    static
+    bool
+    optimize_code(cow_vector<AIR_Node>& code, const Compiler_Options& opts);
+
+    // Update variables that are declared by nodes in `code`, which has been generated in
+    // `ctx`, with results of escape analysis. Nested code is not affected, as it has been
+    // generated in other contexts. Variables that do not escape are not tracked by the
+    // garbage collector.
+    static
+    void
+    update_escaping(cow_vector<AIR_Node>& code, const Analytic_Context& ctx);
+
     // Compress this IR node.
     // The return value indicates whether this node terminates control flow i.e.
     // all subsequent nodes are unreachable.
@@ -362,6 +403,46 @@ class AIR_Node
     solidify(AVMC_Queue& queue)
     const;
 
+    // Compress a sequence of IR nodes.
+    // Common sequences, such as an operator applied to a local reference and
+    // an immediate value, are fused into superinstructions.
+    // The return value indicates whether control flow may fall through the
+    // end of `code`.
+    static
+    bool
+    solidify_code(AVMC_Queue& queue, const cow_vector<AIR_Node>& code);
+
+    // Write this node as bytecode.
+    // An exception is thrown if this node contains something that can't be serialized,
+    // such as a bound reference.
+    Bytecode_Writer&
+    serialize(Bytecode_Writer& writer)
+    const;
+
+    // Read a node from bytecode.
+    // Bytecode is untrusted, so local references are checked against `scope`, which
+    // corresponds to the executive context where the node will be executed. Variables
+    // that are declared by the node are added to it.
+    static
+    AIR_Node
+    deserialize(Bytecode_Reader& reader, Load_Scope& scope);
+
+    // Write or read a sequence of nodes, prefixed by its length.
+    static
+    Bytecode_Writer&
+    serialize_code(Bytecode_Writer& writer, const cow_vector<AIR_Node>& code);
+
+    static
+    cow_vector<AIR_Node>
+    deserialize_code(Bytecode_Reader& reader, Load_Scope& scope);
+
+    // Read the body of a function with these parameters. `parent_opt` is the scope
+    // where the function is defined, or a null pointer for the outermost function.
+    static
+    cow_vector<AIR_Node>
+    deserialize_function_code(Bytecode_Reader& reader, const Load_Scope* parent_opt,
+                              const cow_vector<phsh_string>& params);
+
     // This is needed because the body of a closure should not be solidified.
     Variable_Callback&
     enumerate_variables(Variable_Callback& callback)
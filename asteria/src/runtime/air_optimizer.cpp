@@ -26,12 +26,14 @@ reload(const Abstract_Context* ctx_opt, const cow_vector<phsh_string>& params,
     // Generate code for all statements.
     Analytic_Context ctx_func(ctx_opt, this->m_params);
     for(size_t i = 0;  i < stmts.size();  ++i) {
-      stmts[i].generate_code(this->m_code, nullptr, ctx_func, this->m_opts,
+      stmts[i].generate_code(this->m_code, ctx_func, this->m_opts,
                      ((i + 1 == stmts.size()) || stmts.at(i + 1).is_empty_return())
                           ? ptc_aware_void : ptc_aware_none);
     }
+    AIR_Node::update_escaping(this->m_code, ctx_func);
 
-    // TODO: Insert optimization passes
+    // Perform optimization passes.
+    AIR_Node::optimize_code(this->m_code, this->m_opts);
     return *this;
   }
 
@@ -53,7 +55,8 @@ rebind(const Abstract_Context* ctx_opt, const cow_vector<phsh_string>& params,
       this->m_code.mut(i) = ::std::move(*qnode);
     }
 
-    // TODO: Insert optimization passes
+    // Code has been optimized when it was generated, so don't bother doing it again.
+    // Closures are rebound each time they are defined, which must be fast.
     return *this;
   }
 
@@ -16,7 +16,11 @@ void
 Analytic_Context::
 do_prepare_function(const cow_vector<phsh_string>& params)
   {
+    this->m_func = true;
+
     // Set parameters, which are local references.
+    // The `i`-th parameter always occupies the `i`-th slot, even if it is unnamed.
+    uint32_t nparams = static_cast<uint32_t>(params.size());
     for(size_t i = 0;  i < params.size();  ++i) {
       const auto& name = params.at(i);
       if(name.empty())
@@ -28,17 +32,49 @@ do_prepare_function(const cow_vector<phsh_string>& params)
       if(name == "...") {
         // Nothing is set for the variadic placeholder, but the parameter list terminates here.
         ROCKET_ASSERT(i == params.size() - 1);
+        nparams = static_cast<uint32_t>(i);
         break;
       }
-      // Its contents are out of interest.
-      this->open_named_reference(name) /*= Reference_root::S_void()*/;
+      // A later parameter hides an earlier one with the same name.
+      this->m_slots.insert_or_assign(name, static_cast<uint32_t>(i));
     }
+    this->m_nslots = nparams;
 
     // Set pre-defined references.
     // N.B. If you have ever changed these, remember to update 'executive_context.cpp' as well.
-    this->open_named_reference(::rocket::sref("__varg")) /*= Reference_root::S_void()*/;
-    this->open_named_reference(::rocket::sref("__this")) /*= Reference_root::S_void()*/;
-    this->open_named_reference(::rocket::sref("__func")) /*= Reference_root::S_void()*/;
+    this->open_local_slot(::rocket::sref("__varg"));
+    this->open_local_slot(::rocket::sref("__this"));
+    this->open_local_slot(::rocket::sref("__func"));
+  }
+
+const Analytic_Context&
+Analytic_Context::
+mark_local_escaping(uint32_t slot)
+const
+  {
+    if(slot >= this->m_escaped.size())
+      this->m_escaped.append(slot + 1 - this->m_escaped.size(), false);
+    this->m_escaped.mut(slot) = true;
+    return *this;
+  }
+
+const Analytic_Context&
+Analytic_Context::
+mark_all_locals_escaping()
+const
+  {
+    auto qctx = this;
+    for(;;) {
+      qctx->m_nescaped = qctx->m_nslots;
+      if(qctx->m_func)
+        return *this;
+
+      // Step out to the parent context.
+      auto qparent = qctx->m_parent_opt;
+      if(!qparent || !qparent->is_analytic())
+        return *this;
+      qctx = static_cast<const Analytic_Context*>(qparent);
+    }
   }
 
 }  // namespace asteria
@@ -15,6 +15,19 @@ class Analytic_Context
   private:
     const Abstract_Context* m_parent_opt;
 
+    // This maps names of local references to their slots in the
+    // corresponding executive context.
+    cow_dictionary<uint32_t> m_slots;
+    uint32_t m_nslots = 0;
+    bool m_func = false;
+
+    // These are results of escape analysis. A local reference escapes if it may be
+    // referenced after its scope has been exited, for example, when it is captured by
+    // a closure, or is passed or returned by reference. All slots below `m_nescaped`
+    // escape, as well as those which are marked in `m_escaped`.
+    mutable cow_vector<bool> m_escaped;
+    mutable uint32_t m_nescaped = 0;
+
   public:
     template<typename ContextT,
     ROCKET_ENABLE_IF(::std::is_base_of<Abstract_Context, ContextT>::value)>
@@ -45,11 +58,6 @@ class Analytic_Context
     const noexcept override
       { return this->get_parent_opt();  }
 
-    Reference*
-    do_lazy_lookup_opt(const phsh_string& /*name*/)
-    override
-      { return nullptr;  }
-
   public:
     bool
     is_analytic()
@@ -60,6 +68,53 @@ class Analytic_Context
     get_parent_opt()
     const noexcept
       { return this->m_parent_opt;  }
+
+    // Check whether this is the outermost context of a function.
+    bool
+    is_function()
+    const noexcept
+      { return this->m_func;  }
+
+    // Get the slot of a local reference, or a null pointer if it has not been declared.
+    const uint32_t*
+    get_local_slot_opt(const phsh_string& name)
+    const
+      { return this->m_slots.get_ptr(name);  }
+
+    // Allocate a slot for a local reference.
+    // If a reference with the same name exists, its slot is reused, as the old one
+    // can't be referenced any further.
+    uint32_t
+    open_local_slot(const phsh_string& name)
+      {
+        auto result = this->m_slots.try_emplace(name, this->m_nslots);
+        this->m_nslots += result.second;
+        return result.first->second;
+      }
+
+    uint32_t
+    count_local_slots()
+    const noexcept
+      { return this->m_nslots;  }
+
+    bool
+    is_local_escaping(uint32_t slot)
+    const noexcept
+      { return (slot < this->m_nescaped) || ((slot < this->m_escaped.size()) && this->m_escaped[slot]);  }
+
+    // Mark a local reference escaping.
+    // This is done when a closure references a local reference of an enclosing function.
+    const Analytic_Context&
+    mark_local_escaping(uint32_t slot)
+    const;
+
+    // Mark all local references that have been declared so far escaping, in this context
+    // as well as all enclosing ones of the same function.
+    // This is done when a reference is passed or returned by reference, as we don't track
+    // where it comes from.
+    const Analytic_Context&
+    mark_all_locals_escaping()
+    const;
   };
 
 }  // namespace asteria
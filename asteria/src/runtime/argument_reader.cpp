@@ -6,12 +6,205 @@
 #include "../utilities.hpp"
 
 namespace asteria {
+namespace {
+
+// These are encodings of parameters in the overload list.
+// Required and optional parameters also carry the type code, plus one.
+enum : uint8_t
+  {
+    pcode_finish    = 0x00,
+    pcode_required  = 0x10,
+    pcode_optional  = 0x20,
+    pcode_generic   = 0x30,
+    pcode_variadic  = 0x40,
+  };
+
+// These are traits for argument types.
+// `test()` checks whether a value can be read as the desired type, and `get()` reads it.
+template<typename XValT>
+struct Vtype_Traits;
+
+template<>
+struct Vtype_Traits<V_boolean>
+  {
+    static constexpr Vtype vtype = vtype_boolean;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_boolean();  }
+
+    static
+    V_boolean
+    get(const Value& val)
+      { return val.as_boolean();  }
+  };
+
+template<>
+struct Vtype_Traits<V_integer>
+  {
+    static constexpr Vtype vtype = vtype_integer;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_integer();  }
+
+    static
+    V_integer
+    get(const Value& val)
+      { return val.as_integer();  }
+  };
+
+template<>
+struct Vtype_Traits<V_real>
+  {
+    static constexpr Vtype vtype = vtype_real;
+
+    // This performs integer-to-real conversions as necessary.
+    static
+    bool
+    test(const Value& val)
+      { return val.is_convertible_to_real();  }
+
+    static
+    V_real
+    get(const Value& val)
+      { return val.convert_to_real();  }
+  };
+
+template<>
+struct Vtype_Traits<V_string>
+  {
+    static constexpr Vtype vtype = vtype_string;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_string();  }
+
+    static
+    const V_string&
+    get(const Value& val)
+      { return val.as_string();  }
+  };
+
+template<>
+struct Vtype_Traits<V_opaque>
+  {
+    static constexpr Vtype vtype = vtype_opaque;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_opaque();  }
+
+    static
+    const V_opaque&
+    get(const Value& val)
+      { return val.as_opaque();  }
+  };
+
+template<>
+struct Vtype_Traits<V_function>
+  {
+    static constexpr Vtype vtype = vtype_function;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_function();  }
+
+    static
+    const V_function&
+    get(const Value& val)
+      { return val.as_function();  }
+  };
+
+template<>
+struct Vtype_Traits<V_array>
+  {
+    static constexpr Vtype vtype = vtype_array;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_array();  }
+
+    static
+    const V_array&
+    get(const Value& val)
+      { return val.as_array();  }
+  };
+
+template<>
+struct Vtype_Traits<V_object>
+  {
+    static constexpr Vtype vtype = vtype_object;
+
+    static
+    bool
+    test(const Value& val)
+      { return val.is_object();  }
+
+    static
+    const V_object&
+    get(const Value& val)
+      { return val.as_object();  }
+  };
+
+cow_string&
+do_describe_parameter(cow_string& str, uint8_t code)
+  {
+    switch(code & 0xF0) {
+      case pcode_required:
+        return str << describe_vtype(static_cast<Vtype>((code & 0x0F) - 1));
+
+      case pcode_optional:
+        return str << '[' << describe_vtype(static_cast<Vtype>((code & 0x0F) - 1)) << ']';
+
+      case pcode_generic:
+        return str << "<generic>";
+
+      case pcode_variadic:
+        return str << "...";
+
+      default:
+        ASTERIA_TERMINATE("invalid parameter code (code `$1`)", code);
+    }
+  }
+
+}  // namespace
 
 Argument_Reader::
 ~Argument_Reader()
   {
   }
 
+void
+Argument_Reader::
+do_push_parameter_code(uint8_t code)
+noexcept
+  {
+    // If the overload list is full, discard this parameter. The list will be
+    // truncated in diagnostic messages, which are the only place it is used.
+    if(this->m_ovlds.size() < this->m_ovlds.capacity())
+      this->m_ovlds.push_back(code);
+    else
+      this->m_ovlds_lost = true;
+  }
+
+void
+Argument_Reader::
+do_discard_unfinished_overload()
+noexcept
+  {
+    // If the current overload has not been finished, remove its parameters, so
+    // they will not be mistaken as a part of the next overload.
+    if(!this->m_state.finished)
+      this->m_ovlds.pop_back(this->m_ovlds.size() - ::rocket::min(this->m_state.hoff, this->m_ovlds.size()));
+  }
+
 void
 Argument_Reader::
 do_record_parameter_required(Vtype vtype)
@@ -20,7 +213,7 @@ do_record_parameter_required(Vtype vtype)
       ASTERIA_THROW("Argument reader finished and disposed");
 
     // Record a parameter and increment the number of parameters in total.
-    this->m_state.history << ", " << describe_vtype(vtype);
+    this->do_push_parameter_code(static_cast<uint8_t>(pcode_required + vtype + 1));
     this->m_state.nparams++;
   }
 
@@ -32,7 +225,7 @@ do_record_parameter_optional(Vtype vtype)
       ASTERIA_THROW("Argument reader finished and disposed");
 
     // Record a parameter and increment the number of parameters in total.
-    this->m_state.history << ", [" << describe_vtype(vtype) << ']';
+    this->do_push_parameter_code(static_cast<uint8_t>(pcode_optional + vtype + 1));
     this->m_state.nparams++;
   }
 
@@ -44,7 +237,7 @@ do_record_parameter_generic()
       ASTERIA_THROW("Argument reader finished and disposed");
 
     // Record a parameter and increment the number of parameters in total.
-    this->m_state.history << ", <generic>";
+    this->do_push_parameter_code(pcode_generic);
     this->m_state.nparams++;
   }
 
@@ -56,7 +249,7 @@ do_record_parameter_variadic()
       ASTERIA_THROW("Argument reader finished and disposed");
 
     // Terminate the parameter list.
-    this->m_state.history << ", ...";
+    this->do_push_parameter_code(pcode_variadic);
   }
 
 void
@@ -67,9 +260,8 @@ do_record_parameter_finish()
       ASTERIA_THROW("Argument reader finished and disposed");
 
     // Terminate this overload.
-    this->m_state.history.push_back('\0');
-    // Append it to the overload list as a single operation.
-    this->m_ovlds.append(this->m_state.history);
+    this->do_push_parameter_code(pcode_finish);
+    this->m_state.finished = true;
   }
 
 const Reference*
@@ -100,13 +292,85 @@ const
     return ::rocket::min(index, this->m_args->size());
   }
 
+template<typename XValT>
+Argument_Reader&
+Argument_Reader::
+do_read_required(XValT& xval)
+  {
+    this->do_record_parameter_required(Vtype_Traits<XValT>::vtype);
+
+    // Get the next argument.
+    auto karg = this->do_peek_argument_opt();
+    if(!karg) {
+      this->m_state.succeeded = false;
+      return *this;
+    }
+    const auto& val = karg->read();
+
+    // If the value doesn't have the desired type, fail.
+    if(!Vtype_Traits<XValT>::test(val)) {
+      this->m_state.succeeded = false;
+      return *this;
+    }
+    xval = Vtype_Traits<XValT>::get(val);
+    return *this;
+  }
+
+template<typename XValT, typename XOptT>
+Argument_Reader&
+Argument_Reader::
+do_read_optional(XOptT& xopt)
+  {
+    this->do_record_parameter_optional(Vtype_Traits<XValT>::vtype);
+
+    // Get the next argument.
+    auto karg = this->do_peek_argument_opt();
+    if(!karg) {
+      xopt.reset();
+      return *this;
+    }
+    const auto& val = karg->read();
+    if(val.is_null()) {
+      xopt.reset();
+      return *this;
+    }
+
+    // If the value doesn't have the desired type, fail.
+    if(!Vtype_Traits<XValT>::test(val)) {
+      this->m_state.succeeded = false;
+      return *this;
+    }
+    xopt = Vtype_Traits<XValT>::get(val);
+    return *this;
+  }
+
+Argument_Reader&
+Argument_Reader::
+L(const State& state)
+noexcept
+  {
+    this->do_discard_unfinished_overload();
+
+    // Start a new overload with parameters copied from the saved one.
+    auto hoff = static_cast<uint32_t>(this->m_ovlds.size());
+    auto hend = ::rocket::min(state.hoff + state.nparams, hoff);
+    for(auto k = state.hoff;  k < hend;  ++k)
+      this->do_push_parameter_code(this->m_ovlds[k]);
+
+    this->m_state = state;
+    this->m_state.hoff = hoff;
+    return *this;
+  }
+
 Argument_Reader&
 Argument_Reader::
 I()
 noexcept
   {
+    this->do_discard_unfinished_overload();
+
     // Clear internal states.
-    this->m_state.history.clear();
+    this->m_state.hoff = static_cast<uint32_t>(this->m_ovlds.size());
     this->m_state.nparams = 0;
     this->m_state.finished = false;
     this->m_state.succeeded = true;
@@ -183,184 +447,56 @@ Argument_Reader&
 Argument_Reader::
 v(V_boolean& xval)
   {
-    this->do_record_parameter_required(vtype_boolean);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_boolean()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_boolean();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_integer& xval)
   {
-    this->do_record_parameter_required(vtype_integer);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_integer()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_integer();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_real& xval)
   {
-    this->do_record_parameter_required(vtype_real);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_convertible_to_real()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.convert_to_real();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_string& xval)
   {
-    this->do_record_parameter_required(vtype_string);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_string()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_string();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_opaque& xval)
   {
-    this->do_record_parameter_required(vtype_opaque);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_opaque()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_opaque();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_function& xval)
   {
-    this->do_record_parameter_required(vtype_function);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_function()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_function();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_array& xval)
   {
-    this->do_record_parameter_required(vtype_array);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_array()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_array();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
 Argument_Reader::
 v(V_object& xval)
   {
-    this->do_record_parameter_required(vtype_object);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    const auto& val = karg->read();
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_object()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xval = val.as_object();
-    return *this;
+    return this->do_read_required(xval);
   }
 
 Argument_Reader&
@@ -399,216 +535,56 @@ Argument_Reader&
 Argument_Reader::
 o(optV_boolean& xopt)
   {
-    this->do_record_parameter_optional(vtype_boolean);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_boolean()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_boolean();
-    return *this;
+    return this->do_read_optional<V_boolean>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_integer& xopt)
   {
-    this->do_record_parameter_optional(vtype_integer);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_integer()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_integer();
-    return *this;
+    return this->do_read_optional<V_integer>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_real& xopt)
   {
-    this->do_record_parameter_optional(vtype_real);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_convertible_to_real()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.convert_to_real();
-    return *this;
+    return this->do_read_optional<V_real>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_string& xopt)
   {
-    this->do_record_parameter_optional(vtype_string);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_string()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_string();
-    return *this;
+    return this->do_read_optional<V_string>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_opaque& xopt)
   {
-    this->do_record_parameter_optional(vtype_opaque);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_opaque()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_opaque();
-    return *this;
+    return this->do_read_optional<V_opaque>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_function& xopt)
   {
-    this->do_record_parameter_optional(vtype_function);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_function()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_function();
-    return *this;
+    return this->do_read_optional<V_function>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_array& xopt)
   {
-    this->do_record_parameter_optional(vtype_array);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_array()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_array();
-    return *this;
+    return this->do_read_optional<V_array>(xopt);
   }
 
 Argument_Reader&
 Argument_Reader::
 o(optV_object& xopt)
   {
-    this->do_record_parameter_optional(vtype_object);
-
-    // Get the next argument.
-    auto karg = this->do_peek_argument_opt();
-    if(!karg) {
-      xopt.reset();
-      return *this;
-    }
-    const auto& val = karg->read();
-    if(val.is_null()) {
-      xopt.reset();
-      return *this;
-    }
-
-    // If the value doesn't have the desired type, fail.
-    if(!val.is_object()) {
-      this->m_state.succeeded = false;
-      return *this;
-    }
-    xopt = val.as_object();
-    return *this;
+    return this->do_read_optional<V_object>(xopt);
   }
 
 void
@@ -631,26 +607,33 @@ const
     }
 
     // Append the list of overloads.
+    // Parameters of the current overload are ignored if it has not been finished.
     cow_string ovlds_str;
     const auto& ovlds = this->m_ovlds;
-    if(!ovlds.empty()) {
-      ovlds_str << "\n[list of overloads:\n  ";
+    size_t kend = this->m_state.finished ? ovlds.size() : ::rocket::min(this->m_state.hoff, ovlds.size());
+    if(kend != 0) {
+      ovlds_str << "\n[list of overloads:";
       size_t k = 0;
-      for(;;) {
-        ovlds_str << '`' << this->m_name << '(';
+      while(k != kend) {
+        ovlds_str << "\n  `" << this->m_name << '(';
         // Get the current parameter list.
-        const char* sparams = ovlds.data() + k;
-        size_t nchars = ::std::strlen(sparams);
-        // If the parameter list is not empty, it always start with a ", " so skip it.
-        if(nchars != 0)
-          ovlds_str.append(sparams + 2, nchars - 2);
-        k += nchars;
+        bool comma = false;
+        while((k != kend) && (ovlds[k] != pcode_finish)) {
+          if(comma)
+            ovlds_str << ", ";
+          do_describe_parameter(ovlds_str, ovlds[k]);
+          comma = true;
+          k++;
+        }
+        // If the list has been truncated, say so.
+        if(k == kend)
+          ovlds_str << (comma ? ", " : "") << "<truncated>";
+        else
+          k++;
         ovlds_str << ')' << '`';
-        // Seek to the next overload.
-        if(++k == ovlds.size())
-          break;
-        ovlds_str << "\n  ";
       }
+      if(this->m_ovlds_lost)
+        ovlds_str << "\n  (some overloads have been omitted)";
       ovlds_str << "\n  -- end of list of overloads]";
     }
 
@@ -7,6 +7,7 @@
 #include "../fwd.hpp"
 #include "reference.hpp"
 #include "../value.hpp"
+#include <tuple>  // std::tuple, std::get()
 
 namespace asteria {
 
@@ -15,7 +16,7 @@ class Argument_Reader
   public:
     struct State
       {
-        cow_string history;
+        uint32_t hoff;  // offset of the current overload in `m_ovlds`
         uint32_t nparams;
         bool finished;
         bool succeeded;
@@ -26,7 +27,12 @@ class Argument_Reader
     cow_string m_name;
 
     // `m_ovlds` contains all overloads that have been tested so far.
-    cow_string m_ovlds;
+    // Each parameter is encoded as a single byte, and each overload is terminated by
+    // a zero byte. The text is only composed if no overload matches, so successful
+    // calls do not allocate memory. If the buffer fills up, `m_ovlds_lost` is set and
+    // diagnostic messages will say that some overloads have been omitted.
+    sso_vector<uint8_t, 255> m_ovlds;
+    bool m_ovlds_lost = false;
     // `m_state` can be copied elsewhere and back; any further operations will resume
     // from that point.
     State m_state = { };
@@ -40,6 +46,16 @@ class Argument_Reader
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Argument_Reader);
 
   private:
+    inline
+    void
+    do_push_parameter_code(uint8_t code)
+    noexcept;
+
+    inline
+    void
+    do_discard_unfinished_overload()
+    noexcept;
+
     inline
     void
     do_record_parameter_optional(Vtype vtype);
@@ -70,6 +86,16 @@ class Argument_Reader
     do_check_finish_opt()
     const;
 
+    template<typename XValT>
+    inline
+    Argument_Reader&
+    do_read_required(XValT& xval);
+
+    template<typename XValT, typename XOptT>
+    inline
+    Argument_Reader&
+    do_read_optional(XOptT& xopt);
+
   public:
     size_t
     count_arguments()
@@ -106,11 +132,7 @@ class Argument_Reader
     // `L` stands for `load`.
     Argument_Reader&
     L(const State& state)
-    noexcept
-      {
-        this->m_state = state;
-        return *this;
-      }
+    noexcept;
 
     // Start recording an overload.
     // `I` stands for `initiate` or `initialize`.
@@ -193,11 +215,53 @@ class Argument_Reader
     Argument_Reader&
     o(optV_object& xopt);
 
+    // Try an overload whose parameters are described by the signature of `func`.
+    // Parameters of `V_*` types are required, and those of `optV_*` types, `Value` and
+    // `Reference` are optional. If all arguments match, `func` is called and its result
+    // is stored into `self` as a temporary; otherwise `false` is returned.
+    // `C` stands for `call`.
+    template<typename ResultT, typename... ParamsT>
+    bool
+    C(Reference& self, ResultT (*func)(ParamsT...))
+      { return this->do_call_typed(self, func, ::std::index_sequence_for<ParamsT...>());  }
+
     // Throw an exception saying there are no viable overloads.
     [[noreturn]]
     void
     throw_no_matching_function_call()
     const;
+
+  private:
+    // A parameter is required if `v()` accepts it, and is optional otherwise.
+    template<typename XArgT>
+    auto
+    do_read_typed(XArgT& xarg, int)
+    -> decltype(this->v(xarg))
+      { return this->v(xarg);  }
+
+    template<typename XArgT>
+    Argument_Reader&
+    do_read_typed(XArgT& xarg, ...)
+      { return this->o(xarg);  }
+
+    template<typename ResultT, typename... ParamsT, size_t... indicesT>
+    bool
+    do_call_typed(Reference& self, ResultT (*func)(ParamsT...), ::std::index_sequence<indicesT...>)
+      {
+        // Read arguments according to the parameter types of `func`.
+        ::std::tuple<typename ::std::decay<ParamsT>::type...> xargs;
+        (void)xargs;
+        this->I();
+        int dummy[] = { 0, ((void)this->do_read_typed(::std::get<indicesT>(xargs), 0), 0)... };
+        (void)dummy;
+        if(!this->F())
+          return false;
+
+        // Call `func` and return its result as a temporary.
+        Reference_root::S_temporary xref = { func(::std::move(::std::get<indicesT>(xargs))...) };
+        self = ::std::move(xref);
+        return true;
+      }
   };
 
 }  // namespace asteria
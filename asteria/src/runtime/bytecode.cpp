@@ -0,0 +1,360 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "bytecode.hpp"
+#include "../value.hpp"
+#include "../utilities.hpp"
+
+namespace asteria {
+
+Bytecode_Writer::
+~Bytecode_Writer()
+  {
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_byte(uint8_t byte)
+  {
+    this->m_buf.putc(static_cast<char>(byte));
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_varint(uint64_t value)
+  {
+    // Write seven bits at a time, least significant group first.
+    char bytes[10];
+    size_t n = 0;
+    while(value >= 0x80) {
+      bytes[n++] = static_cast<char>((value & 0x7F) | 0x80);
+      value >>= 7;
+    }
+    bytes[n++] = static_cast<char>(value);
+    this->m_buf.putn(bytes, n);
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_integer(int64_t value)
+  {
+    uint64_t bits = static_cast<uint64_t>(value);
+    return this->put_varint((bits << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_real(double value)
+  {
+    uint64_t bits;
+    ::std::memcpy(&bits, &value, sizeof(bits));
+
+    // Write all bits in little-endian order.
+    char bytes[8];
+    for(size_t i = 0;  i < 8;  ++i)
+      bytes[i] = static_cast<char>(bits >> (i * 8));
+    this->m_buf.putn(bytes, 8);
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_string(const cow_string& str)
+  {
+    // If this string has been written before, write its index only.
+    auto result = this->m_strings.try_emplace(str, static_cast<uint32_t>(this->m_strings.size()));
+    this->put_varint(result.first->second);
+    if(!result.second)
+      return *this;
+
+    // Otherwise, its index equals the number of strings so far, and its contents follow.
+    this->put_varint(str.size());
+    this->m_buf.putn(str.data(), str.size());
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_source_location(const Source_Location& sloc)
+  {
+    this->put_string(sloc.file());
+    this->put_integer(sloc.line());
+    this->put_integer(sloc.offset());
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_options(const Compiler_Options& opts)
+  {
+    // Options are written one byte per field, prefixed by the number of fields,
+    // which changes when new options are added.
+    this->put_varint(7);
+    this->put_byte(opts.version);
+    this->put_byte(opts.escapable_single_quotes);
+    this->put_byte(opts.keywords_as_identifiers);
+    this->put_byte(opts.integers_as_reals);
+    this->put_byte(opts.proper_tail_calls);
+    this->put_byte(static_cast<uint8_t>(opts.optimization_level));
+    this->put_byte(opts.verbose_single_step_traps);
+    return *this;
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_value(const Value& value)
+  {
+    this->put_byte(value.vtype());
+
+    switch(value.vtype()) {
+      case vtype_null:
+        return *this;
+
+      case vtype_boolean:
+        return this->put_byte(value.as_boolean());
+
+      case vtype_integer:
+        return this->put_integer(value.as_integer());
+
+      case vtype_real:
+        return this->put_real(value.as_real());
+
+      case vtype_string:
+        return this->put_string(value.as_string());
+
+      case vtype_opaque:
+      case vtype_function:
+        ASTERIA_THROW("Value not serializable (value `$1`)", value);
+
+      case vtype_array: {
+        const auto& arr = value.as_array();
+        this->put_varint(arr.size());
+        for(const auto& elem : arr)
+          this->put_value(elem);
+        return *this;
+      }
+
+      case vtype_object: {
+        const auto& obj = value.as_object();
+        this->put_varint(obj.size());
+        for(const auto& pair : obj) {
+          this->put_string(pair.first.rdstr());
+          this->put_value(pair.second);
+        }
+        return *this;
+      }
+
+      default:
+        ASTERIA_TERMINATE("invalid value type (type `$1`)", value.vtype());
+    }
+  }
+
+Bytecode_Writer&
+Bytecode_Writer::
+put_header()
+  {
+    this->m_buf.putn(bytecode_signature, sizeof(bytecode_signature));
+    this->put_varint(bytecode_version);
+    return *this;
+  }
+
+Bytecode_Reader::
+~Bytecode_Reader()
+  {
+  }
+
+void
+Bytecode_Reader::
+do_throw_truncated()
+const
+  {
+    ASTERIA_THROW("Bytecode truncated or corrupted");
+  }
+
+bool
+Bytecode_Reader::
+has_signature(const void* data, size_t size)
+noexcept
+  {
+    return (size >= sizeof(bytecode_signature)) &&
+           (::std::memcmp(data, bytecode_signature, sizeof(bytecode_signature)) == 0);
+  }
+
+uint8_t
+Bytecode_Reader::
+get_byte()
+  {
+    if(this->m_bptr == this->m_eptr)
+      this->do_throw_truncated();
+    return *(this->m_bptr++);
+  }
+
+uint64_t
+Bytecode_Reader::
+get_varint()
+  {
+    uint64_t value = 0;
+    for(uint32_t shift = 0;  shift < 64;  shift += 7) {
+      uint8_t byte = this->get_byte();
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if(!(byte & 0x80))
+        return value;
+    }
+    this->do_throw_truncated();
+  }
+
+int64_t
+Bytecode_Reader::
+get_integer()
+  {
+    uint64_t bits = this->get_varint();
+    return static_cast<int64_t>((bits >> 1) ^ (0 - (bits & 1)));
+  }
+
+double
+Bytecode_Reader::
+get_real()
+  {
+    if(this->m_eptr - this->m_bptr < 8)
+      this->do_throw_truncated();
+
+    // Read all bits in little-endian order.
+    uint64_t bits = 0;
+    for(size_t i = 0;  i < 8;  ++i)
+      bits |= static_cast<uint64_t>(this->m_bptr[i]) << (i * 8);
+    this->m_bptr += 8;
+
+    double value;
+    ::std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+phsh_string
+Bytecode_Reader::
+get_string()
+  {
+    // A string that has been read before is referenced by its index.
+    uint64_t index = this->get_varint();
+    if(index < this->m_strings.size())
+      return this->m_strings[static_cast<size_t>(index)];
+
+    // Otherwise, its contents follow.
+    if(index != this->m_strings.size())
+      this->do_throw_truncated();
+
+    uint64_t len = this->get_varint();
+    if(len > static_cast<uint64_t>(this->m_eptr - this->m_bptr))
+      this->do_throw_truncated();
+
+    cow_string str(reinterpret_cast<const char*>(this->m_bptr), static_cast<size_t>(len));
+    this->m_bptr += len;
+    return this->m_strings.emplace_back(::std::move(str));
+  }
+
+Source_Location
+Bytecode_Reader::
+get_source_location()
+  {
+    auto file = this->get_string();
+    auto line = this->get_integer();
+    auto offset = this->get_integer();
+    return Source_Location(file.rdstr(), static_cast<int>(line), static_cast<int>(offset));
+  }
+
+Compiler_Options
+Bytecode_Reader::
+get_options()
+  {
+    // Fields are read one by one. Copying raw bytes into `bool` members would
+    // be undefined behavior for bytes other than 0 and 1.
+    Compiler_Options opts;
+    if(this->get_varint() != 7)
+      ASTERIA_THROW("Bytecode compiled with incompatible options");
+
+    if(this->get_byte() != opts.version)
+      ASTERIA_THROW("Bytecode compiled with incompatible options");
+
+    opts.escapable_single_quotes = this->get_byte() != 0;
+    opts.keywords_as_identifiers = this->get_byte() != 0;
+    opts.integers_as_reals = this->get_byte() != 0;
+    opts.proper_tail_calls = this->get_byte() != 0;
+    opts.optimization_level = static_cast<int8_t>(this->get_byte());
+    opts.verbose_single_step_traps = this->get_byte() != 0;
+    return opts;
+  }
+
+Value
+Bytecode_Reader::
+do_get_value(uint32_t depth)
+  {
+    if(depth > bytecode_max_value_depth)
+      ASTERIA_THROW("Bytecode value nested too deeply (limit `$1`)", bytecode_max_value_depth);
+
+    auto vtype = static_cast<Vtype>(this->get_byte());
+
+    switch(vtype) {
+      case vtype_null:
+        return V_null();
+
+      case vtype_boolean:
+        return V_boolean(this->get_byte() != 0);
+
+      case vtype_integer:
+        return V_integer(this->get_integer());
+
+      case vtype_real:
+        return V_real(this->get_real());
+
+      case vtype_string:
+        return V_string(this->get_string().rdstr());
+
+      case vtype_array: {
+        V_array arr;
+        uint64_t count = this->get_varint();
+        while(count-- != 0)
+          arr.emplace_back(this->do_get_value(depth + 1));
+        return ::std::move(arr);
+      }
+
+      case vtype_object: {
+        V_object obj;
+        uint64_t count = this->get_varint();
+        while(count-- != 0) {
+          auto key = this->get_string();
+          obj.insert_or_assign(::std::move(key), this->do_get_value(depth + 1));
+        }
+        return ::std::move(obj);
+      }
+
+      case vtype_opaque:
+      case vtype_function:
+      default:
+        this->do_throw_truncated();
+    }
+  }
+
+Value
+Bytecode_Reader::
+get_value()
+  {
+    return this->do_get_value(0);
+  }
+
+Bytecode_Reader&
+Bytecode_Reader::
+get_header()
+  {
+    if(!this->has_signature(this->m_bptr, static_cast<size_t>(this->m_eptr - this->m_bptr)))
+      ASTERIA_THROW("Bytecode signature not found");
+    this->m_bptr += sizeof(bytecode_signature);
+
+    uint64_t version = this->get_varint();
+    if(version != bytecode_version)
+      ASTERIA_THROW("Bytecode version mismatch (expecting `$1`, got `$2`)", bytecode_version, version);
+    return *this;
+  }
+
+}  // namespace asteria
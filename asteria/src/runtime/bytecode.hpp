@@ -0,0 +1,140 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_RUNTIME_BYTECODE_HPP_
+#define ASTERIA_RUNTIME_BYTECODE_HPP_
+
+#include "../fwd.hpp"
+#include "../source_location.hpp"
+
+namespace asteria {
+
+// Precompiled scripts begin with this signature, followed by the format version
+// `bytecode_version`, which shall be bumped whenever the encoding of any IR node
+// changes. Integers are encoded as LEB128 variable-length integers. Strings are
+// interned: each one is written only at its first occurrence and referenced by
+// index afterwards.
+constexpr char bytecode_signature[8] = { '\x7F', 'A', 'I', 'R', '\r', '\n', '\x1A', '\n' };
+constexpr uint32_t bytecode_version = 3;
+
+// This is the maximum depth of nested arrays and objects in constant values.
+// Bytecode is untrusted input, so it must not be able to exhaust the stack.
+constexpr uint32_t bytecode_max_value_depth = 256;
+
+class Bytecode_Writer
+  {
+  private:
+    tinybuf& m_buf;
+    cow_dictionary<uint32_t> m_strings;
+
+  public:
+    explicit
+    Bytecode_Writer(tinybuf& buf)
+    noexcept
+      : m_buf(buf)
+      { }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Bytecode_Writer);
+
+  public:
+    Bytecode_Writer&
+    put_byte(uint8_t byte);
+
+    Bytecode_Writer&
+    put_varint(uint64_t value);
+
+    // Negative values are zigzag-encoded.
+    Bytecode_Writer&
+    put_integer(int64_t value);
+
+    Bytecode_Writer&
+    put_real(double value);
+
+    Bytecode_Writer&
+    put_string(const cow_string& str);
+
+    Bytecode_Writer&
+    put_source_location(const Source_Location& sloc);
+
+    Bytecode_Writer&
+    put_options(const Compiler_Options& opts);
+
+    // Only `null`, `boolean`, `integer`, `real`, `string`, `array` and `object`
+    // values can be written. An exception is thrown otherwise.
+    Bytecode_Writer&
+    put_value(const Value& value);
+
+    // Write the signature and version.
+    Bytecode_Writer&
+    put_header();
+  };
+
+class Bytecode_Reader
+  {
+  private:
+    const unsigned char* m_bptr;
+    const unsigned char* m_eptr;
+    cow_vector<phsh_string> m_strings;
+
+  public:
+    Bytecode_Reader(const void* data, size_t size)
+    noexcept
+      : m_bptr(static_cast<const unsigned char*>(data)),
+        m_eptr(static_cast<const unsigned char*>(data) + size)
+      { }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Bytecode_Reader);
+
+  private:
+    [[noreturn]]
+    void
+    do_throw_truncated()
+    const;
+
+    Value
+    do_get_value(uint32_t depth);
+
+  public:
+    // Check whether a block of data starts with `bytecode_signature`.
+    static
+    bool
+    has_signature(const void* data, size_t size)
+    noexcept;
+
+    bool
+    at_end()
+    const noexcept
+      { return this->m_bptr == this->m_eptr;  }
+
+    uint8_t
+    get_byte();
+
+    uint64_t
+    get_varint();
+
+    int64_t
+    get_integer();
+
+    double
+    get_real();
+
+    phsh_string
+    get_string();
+
+    Source_Location
+    get_source_location();
+
+    Compiler_Options
+    get_options();
+
+    Value
+    get_value();
+
+    // Check the signature and version. An exception is thrown if either mismatches.
+    Bytecode_Reader&
+    get_header();
+  };
+
+}  // namespace asteria
+
+#endif
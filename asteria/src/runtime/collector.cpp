@@ -5,7 +5,9 @@
 #include "collector.hpp"
 #include "variable.hpp"
 #include "variable_callback.hpp"
+#include "gc_workers.hpp"
 #include "../utilities.hpp"
+#include <time.h>  // ::clock_gettime()
 
 namespace asteria {
 namespace {
@@ -61,18 +63,279 @@ do_traverse(const ContT& cont, FuncT&& func)
 
 struct Variable_Wiper : Variable_Callback
   {
-    bool
-    process(const rcptr<Variable>& var)
-    override
+    void
+    wipe(Variable& var)
       {
         // Don't modify variables in place which might have side effects.
-        auto value = ::std::move(var->open_value());
-        var->uninitialize();
+        auto value = ::std::move(var.open_value());
+        var.uninitialize();
 
         // Uninitialize all children.
         value.enumerate_variables(*this);
+      }
+
+    bool
+    process(const rcptr<Variable>& var)
+    override
+      {
+        this->wipe(*var);
+        return false;
+      }
+  };
+
+double
+do_get_time_ms()
+noexcept
+  {
+    ::timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<double>(ts.tv_sec) * 1.0e3 + static_cast<double>(ts.tv_nsec) / 1.0e6;
+  }
+
+inline
+void
+do_consume(size_t& work, size_t count)
+noexcept
+  {
+    work -= ::rocket::min(work, count);
+  }
+
+enum : uint8_t
+  {
+    phase_idle       = 0,  // no collection is in progress
+    phase_stage      = 1,  // add variables into `m_staging`
+    phase_count      = 2,  // drop references from `m_staging`
+    phase_mark       = 3,  // mark reachable variables
+    phase_gather     = 4,  // gather unreachable variables into `m_unreached`
+  };
+
+inline
+void
+do_release(Variable* var)
+noexcept
+  {
+    // Drop a reference that has been taken from a list. This may destroy `var`.
+    rcptr<Variable> hold(var);
+  }
+
+// These are upper bounds of buckets of pause times, in milliseconds.
+constexpr double s_pause_limits[] = { 0.1, 0.3, 1, 3, 10, 30, 100, HUGE_VAL };
+
+static_assert(::rocket::countof(s_pause_limits) == Collector::pause_bucket_count, "");
+
+size_t
+do_estimate_size(const Value& value)
+noexcept
+  {
+    // Only storage that is owned by `value` directly is counted.
+    size_t size = sizeof(Value);
+    if(value.is_string())
+      size += value.as_string().size();
+    else if(value.is_array())
+      size += value.as_array().size() * sizeof(Value);
+    else if(value.is_object())
+      size += value.as_object().size() * (sizeof(phsh_string) + sizeof(Value));
+    return size;
+  }
+
+enum : uint8_t
+  {
+    mark_staged      = 0x01,  // the variable is on `m_staging`
+    mark_unreached   = 0x02,  // the variable is on `m_unreached`
+  };
+
+// Small heaps are always collected serially, as threads would only add the cost of
+// synchronization. This threshold has not been tuned: on a single core, parallel
+// collection is slower at any size, and scaling on multiple cores is yet to be measured.
+constexpr size_t s_parallel_min = 65536;
+constexpr size_t s_parallel_chunk = 256;
+
+class Parallel_Marker
+  {
+  private:
+    // Each worker marks variables on its own stack. When it has too much work and others
+    // are idle, it moves a chunk of its stack into its own deque, from where others steal
+    // chunks. The owner takes chunks from the back and thieves take them from the front,
+    // as older ones tend to lead to more variables.
+    struct Deque
+      {
+        ::rocket::mutex mutex;
+        cow_vector<cow_vector<Variable*>> chunks;
+      };
+
+    const cow_vector<Variable*>& m_vars;
+    size_t m_nworkers;
+    Deque m_deques[GC_Workers::parallelism_max];
+    ::rocket::atomic_relaxed<size_t> m_next_root;
+
+    // These are hints that are read without locking. Sequential consistency makes sure
+    // that either an idle worker sees a new chunk, or the worker who has shared it sees
+    // the idle one and wakes it up.
+    ::rocket::atomic_seq_cst<size_t> m_nchunks;
+    ::rocket::atomic_seq_cst<size_t> m_nidle_hint;
+
+    // The marking completes when all workers are idle, which implies all deques are empty.
+    ::rocket::mutex m_mutex;
+    ::rocket::condition_variable m_avail;
+    size_t m_nidle = 0;
+    bool m_done = false;
+    bool m_failed = false;
+
+  public:
+    explicit
+    Parallel_Marker(const cow_vector<Variable*>& vars, size_t nworkers)
+    noexcept
+      : m_vars(vars), m_nworkers(nworkers)
+      { }
+
+  private:
+    void
+    do_share(size_t index, cow_vector<Variable*>& stack)
+      {
+        // Move the bottom half of `stack`, which is the oldest, into our deque.
+        size_t nshare = stack.size() / 2;
+        cow_vector<Variable*> chunk(stack.begin(), stack.begin() + static_cast<ptrdiff_t>(nshare));
+        stack.erase(0, nshare);
+
+        auto& own = this->m_deques[index];
+        ::rocket::mutex::unique_lock lock(own.mutex);
+        own.chunks.emplace_back(::std::move(chunk));
+        lock.unlock();
+
+        this->m_nchunks.fetch_add(1U);
+        if(this->m_nidle_hint.load() == 0)
+          return;
+
+        lock.lock(this->m_mutex);
+        this->m_avail.notify_one();
+      }
+
+    bool
+    do_take(size_t index, cow_vector<Variable*>& stack)
+      {
+        // Take back the newest chunk of our own, which is likely to be in cache.
+        auto& own = this->m_deques[index];
+        ::rocket::mutex::unique_lock lock(own.mutex);
+        if(own.chunks.size()) {
+          stack = ::std::move(own.chunks.mut_back());
+          own.chunks.pop_back();
+          this->m_nchunks.fetch_sub(1U);
+          return true;
+        }
+        lock.unlock();
+
+        // Steal the oldest chunk of another worker.
+        for(size_t k = 1;  (k != this->m_nworkers) && this->m_nchunks.load();  ++k) {
+          auto& victim = this->m_deques[(index + k) % this->m_nworkers];
+          lock.lock(victim.mutex);
+          if(victim.chunks.size()) {
+            stack = ::std::move(victim.chunks.mut_front());
+            victim.chunks.erase(0, 1);
+            this->m_nchunks.fetch_sub(1U);
+            return true;
+          }
+          lock.unlock();
+        }
         return false;
       }
+
+    void
+    do_drain(size_t index, cow_vector<Variable*>& stack)
+      {
+        while(stack.size()) {
+          auto var = stack.back();
+          stack.pop_back();
+
+          // Mark children, and push them onto `stack`, so grandchildren will be marked.
+          do_traverse(*var,
+            [&](const rcptr<Variable>& child) {
+              if(!(child->get_gc_links().mark & mark_staged))
+                return false;
+
+              auto gcref = child->get_gcref_atomic();
+              if((gcref >= 0) && child->mark_gcref_atomic(gcref))
+                stack.emplace_back(child.get());
+              // This is not going to be recursive.
+              return false;
+            });
+
+          // Share work if there are more idle workers than chunks to steal.
+          if((stack.size() >= s_parallel_chunk * 2) && (this->m_nidle_hint.load() > this->m_nchunks.load()))
+            this->do_share(index, stack);
+        }
+      }
+
+    void
+    do_mark(size_t index)
+      {
+        // Mark variables that are reachable directly, in chunks.
+        cow_vector<Variable*> stack;
+        for(;;) {
+          size_t bpos = this->m_next_root.fetch_add(s_parallel_chunk);
+          if(bpos >= this->m_vars.size())
+            break;
+
+          size_t epos = ::rocket::min(bpos + s_parallel_chunk, this->m_vars.size());
+          for(size_t k = bpos;  k != epos;  ++k) {
+            auto var = this->m_vars[k];
+            auto gcref = var->get_gcref_atomic();
+            if((gcref >= 0) && (gcref < var->use_count()) && var->mark_gcref_atomic(gcref))
+              stack.emplace_back(var);
+            this->do_drain(index, stack);
+          }
+        }
+
+        // Mark variables that are reachable indirectly, which have been shared by others.
+        for(;;) {
+          this->do_drain(index, stack);
+          if(this->do_take(index, stack))
+            continue;
+
+          // Nothing can be stolen, so wait for new chunks.
+          ::rocket::mutex::unique_lock lock(this->m_mutex);
+          if(this->m_nchunks.load())
+            continue;
+
+          this->m_nidle++;
+          this->m_nidle_hint.store(this->m_nidle);
+          if(this->m_nidle == this->m_nworkers) {
+            this->m_done = true;
+            this->m_avail.notify_all();
+            return;
+          }
+
+          this->m_avail.wait(lock, [&] { return this->m_done || this->m_nchunks.load();  });
+          if(this->m_done)
+            return;
+
+          this->m_nidle--;
+          this->m_nidle_hint.store(this->m_nidle);
+        }
+      }
+
+  public:
+    // If memory cannot be allocated for a stack or a chunk, some variables may have been
+    // marked without their children. All workers stop, and the caller shall finish the
+    // marking serially, which does not allocate memory.
+    bool
+    failed()
+    const noexcept
+      { return this->m_failed;  }
+
+    void
+    operator()(size_t index)
+    noexcept
+      {
+        try {
+          this->do_mark(index);
+        }
+        catch(::std::exception& /*stdex*/) {
+          ::rocket::mutex::unique_lock lock(this->m_mutex);
+          this->m_failed = true;
+          this->m_done = true;
+          this->m_avail.notify_all();
+        }
+      }
   };
 
 }  // namespace
@@ -80,17 +343,432 @@ struct Variable_Wiper : Variable_Callback
 Collector::
 ~Collector()
   {
+    // Release all variables.
+    this->do_reset_collection();
+    while(auto var = this->m_tracked)
+      do_release(this->do_unlink(var));
+  }
+
+void
+Collector::
+do_link(Variable* var)
+noexcept
+  {
+    // Insert the variable before the first tracked one.
+    // The caller shall have transferred a reference to `*this`.
+    auto& links = var->open_gc_links();
+    ROCKET_ASSERT(!links.coll);
+    links.coll = this;
+    links.prev = nullptr;
+    links.next = ::std::exchange(this->m_tracked, var);
+    if(links.next)
+      links.next->open_gc_links().prev = var;
+    this->m_ntracked++;
+  }
+
+Variable*
+Collector::
+do_unlink(Variable* var)
+noexcept
+  {
+    // Remove the variable from the list.
+    // The reference is transferred to the caller.
+    auto& links = var->open_gc_links();
+    ROCKET_ASSERT(links.coll == this);
+    if(this->m_scan_tracked == var)
+      this->m_scan_tracked = links.next;
+    (links.prev ? links.prev->open_gc_links().next : this->m_tracked) = links.next;
+    if(links.next)
+      links.next->open_gc_links().prev = links.prev;
+    links.coll = nullptr;
+    this->m_ntracked--;
+    return var;
+  }
+
+void
+Collector::
+do_stage(Variable* var)
+noexcept
+  {
+    // If this variable has been staged, finish.
+    auto& links = var->open_gc_links();
+    if(links.mark & mark_staged)
+      return;
+
+    // Append it to `m_staging`, which owns a reference.
+    var->add_reference();
+    links.mark |= mark_staged;
+    links.stage = nullptr;
+    (this->m_staging_tail ? this->m_staging_tail->open_gc_links().stage : this->m_staging) = var;
+    this->m_staging_tail = var;
+    this->m_nstaged++;
+
+    // Its children will be staged later.
+    if(!this->m_scan_staged)
+      this->m_scan_staged = var;
+
+    // References from `m_tracked` and `m_staging` shall be excluded. The latter will be
+    // dropped in the next phase.
+    var->reset_gcref(links.coll == this);
+  }
+
+size_t
+Collector::
+do_drop_references(Variable* var, uint8_t scope)
+  {
+    // Drop the reference from the list that `var` is on.
+    var->increment_gcref(1);
+
+    // Skip variables that cannot have any children.
+    auto split = var->gcref_split();
+    if(split <= 0)
+      return 1;
+
+    // Drop references from `var` to its children. References to variables outside the
+    // scope are ignored.
+    size_t count = 1;
+    do_traverse(*var,
+      [&](const rcptr<Variable>& child) {
+        if(!(child->get_gc_links().mark & scope))
+          return false;
+
+        child->increment_gcref(split);
+        count++;
+        // This is not going to be recursive.
+        return false;
+      });
+    return count;
+  }
+
+void
+Collector::
+do_mark_reachable(Variable* var)
+noexcept
+  {
+    // Skip variables that are possibly unreachable, as well as those that have been marked.
+    auto gcref = var->get_gcref();
+    if((gcref < 0) || (gcref >= var->use_count()))
+      return;
+
+    // Mark this variable, and push it onto `m_marking`, so its children will be marked.
+    var->reset_gcref(-1);
+    var->open_gc_links().work = ::std::exchange(this->m_marking, var);
+  }
+
+bool
+Collector::
+do_drain_marking(size_t& work, uint8_t scope)
+  {
+    while(auto var = this->m_marking) {
+      if(work == 0)
+        return false;
+
+      // Pop a variable, then mark all its children that have not been marked.
+      // Variables outside the scope are not examined.
+      this->m_marking = var->get_gc_links().work;
+      do_consume(work, 1);
+      do_traverse(*var,
+        [&](const rcptr<Variable>& child) {
+          auto& links = child->open_gc_links();
+          if(!(links.mark & scope) || (child->get_gcref() < 0))
+            return false;
+
+          child->reset_gcref(-1);
+          links.work = ::std::exchange(this->m_marking, child.get());
+          // This is not going to be recursive.
+          return false;
+        });
+    }
+    return true;
+  }
+
+bool
+Collector::
+do_stage_tracked(size_t& work)
+  {
+    for(;;) {
+      // Stage children of staged variables in breadth-first order.
+      while(auto var = this->m_scan_staged) {
+        if(work == 0)
+          return false;
+
+        this->m_scan_staged = var->get_gc_links().stage;
+        do_consume(work, 1);
+
+        // If all references to this variable are from this collector, it can be marked for
+        // collection immediately.
+        if(var->use_count() <= 1 + (var->get_gc_links().coll == this)) {
+          this->m_stats.nbytes_freed += do_estimate_size(var->get_value());
+          var->uninitialize();
+          continue;
+        }
+
+        do_traverse(*var,
+          [&](const rcptr<Variable>& child) {
+            this->do_stage(child.get());
+            // This is not going to be recursive.
+            return false;
+          });
+      }
+
+      // Stage the next tracked variable.
+      auto var = this->m_scan_tracked;
+      if(!var)
+        return true;
+
+      this->m_scan_tracked = var->get_gc_links().next;
+      this->do_stage(var);
+    }
+  }
+
+bool
+Collector::
+do_drop_staged(size_t& work)
+  {
+    while(auto var = this->m_scan_staged) {
+      if(work == 0)
+        return false;
+
+      this->m_scan_staged = var->get_gc_links().stage;
+      do_consume(work, this->do_drop_references(var, mark_staged));
+    }
+    return true;
+  }
+
+bool
+Collector::
+do_mark_staged(size_t& work)
+  {
+    for(;;) {
+      // Mark variables that are reachable from marked ones.
+      if(!this->do_drain_marking(work, mark_staged))
+        return false;
+
+      // Check whether the next variable is reachable directly.
+      auto var = this->m_scan_staged;
+      if(!var)
+        return true;
+
+      if(work == 0)
+        return false;
+
+      this->m_scan_staged = var->get_gc_links().stage;
+      do_consume(work, 1);
+      this->do_mark_reachable(var);
+    }
+  }
+
+void
+Collector::
+do_drop_and_mark_parallel()
+  {
+    // Make the staging list random-accessible, so it can be partitioned.
+    cow_vector<Variable*> vars;
+    vars.reserve(this->m_nstaged);
+    for(auto var = this->m_staging;  var;  var = var->get_gc_links().stage)
+      vars.emplace_back(var);
+
+    // Drop references. Workers take chunks of variables until all have been processed.
+    // Counters are updated atomically, as a variable may be referenced by many others.
+    ::rocket::atomic_relaxed<size_t> next;
+    auto drop = [&](size_t /*index*/) {
+      for(;;) {
+        size_t bpos = next.fetch_add(s_parallel_chunk);
+        if(bpos >= vars.size())
+          return;
+
+        size_t epos = ::rocket::min(bpos + s_parallel_chunk, vars.size());
+        for(size_t k = bpos;  k != epos;  ++k) {
+          auto var = vars[k];
+          var->increment_gcref_atomic(1);
+
+          auto split = var->gcref_split();
+          if(split <= 0)
+            continue;
+
+          do_traverse(*var,
+            [&](const rcptr<Variable>& child) {
+              if(child->get_gc_links().mark & mark_staged)
+                child->increment_gcref_atomic(split);
+              // This is not going to be recursive.
+              return false;
+            });
+        }
+      }
+    };
+    auto& workers = *(this->m_workers_opt);
+    workers.run(drop);
+
+    // Mark reachable variables. Each worker has its own stack, and workers that have run out
+    // of work steal from others.
+    Parallel_Marker mark(vars, workers.get_parallelism());
+    workers.run(mark);
+    if(ROCKET_EXPECT(!mark.failed()))
+      return;
+
+    // Some marked variables may have unmarked children, so traverse all marked variables
+    // again, then look for the remaining ones that are reachable directly.
+    for(auto var : vars)
+      if(var->get_gcref() < 0)
+        var->open_gc_links().work = ::std::exchange(this->m_marking, var);
+
+    size_t work = SIZE_MAX;
+    this->m_scan_staged = this->m_staging;
+    this->do_mark_staged(work);
+  }
+
+bool
+Collector::
+do_sweep(Variable* var, uint8_t mark)
+noexcept
+  {
+    // Take the reference from the list that `var` was on.
+    auto& links = var->open_gc_links();
+    links.mark = static_cast<uint8_t>(links.mark & ~mark);
+    rcptr<Variable> hold(var);
+
+    // All reachable variables will have negative gcref counters.
+    if(var->get_gcref() >= 0) {
+      // Overwrite the value of this variable with a scalar value to break reference cycles.
+      this->m_stats.nbytes_freed += do_estimate_size(var->get_value());
+      var->uninitialize();
+      if(links.coll == this)
+        do_release(this->do_unlink(var));
+      // Cache this variable if a pool is specified.
+      if(this->m_output_opt)
+        this->m_output_opt->insert(hold);
+      return true;
+    }
+
+    // Transfer this variable to the next generational collector, if one has been tied.
+    // Variables that are tracked by other collectors are left intact.
+    auto tied = this->m_tied_opt;
+    if(tied && (!links.coll || (links.coll == this))) {
+      tied->do_link(links.coll ? this->do_unlink(var) : hold.release());
+      this->m_stats.npromoted++;
+      // Check whether the next generation needs to be checked as well.
+      if(tied->m_counter++ >= tied->m_threshold)
+        this->m_next = tied;
+    }
+    return false;
+  }
+
+void
+Collector::
+do_reset_collection()
+noexcept
+  {
+    // Release variables on lists.
+    while(auto var = this->m_staging) {
+      this->m_staging = var->get_gc_links().stage;
+      var->open_gc_links().mark &= static_cast<uint8_t>(~mark_staged);
+      do_release(var);
+    }
+    while(auto var = this->m_unreached) {
+      this->m_unreached = var->get_gc_links().stage;
+      var->open_gc_links().mark &= static_cast<uint8_t>(~mark_unreached);
+      do_release(var);
+    }
+
+    this->m_staging_tail = nullptr;
+    this->m_nstaged = 0;
+    this->m_marking = nullptr;
+    this->m_phase = phase_idle;
+    this->m_scan_tracked = nullptr;
+    this->m_scan_staged = nullptr;
+    this->m_next = nullptr;
+    this->m_cycle_examined = 0;
+    this->m_cycle_collected = 0;
+    this->m_cycle_pause = 0;
+  }
+
+void
+Collector::
+do_adapt_threshold(size_t nexamined, size_t ncollected, double pause)
+noexcept
+  {
+    // Update statistics. The survival ratio and the pause time are smoothed, so a single
+    // unusual collection has limited effect.
+    this->m_last_examined = nexamined;
+    this->m_last_collected = ncollected;
+    if(nexamined != 0) {
+      double ratio = static_cast<double>(nexamined - ncollected) / static_cast<double>(nexamined);
+      this->m_survival = (this->m_survival < 0) ? ratio : (this->m_survival + ratio) / 2;
+    }
+    this->m_pause = (this->m_pause + pause) / 2;
+
+    this->m_stats.ncollections++;
+    this->m_stats.nexamined += nexamined;
+    this->m_stats.ncollected += ncollected;
+    this->m_stats.pause_total += pause;
+    this->m_stats.pause_max = ::rocket::max(this->m_stats.pause_max, pause);
+    size_t bucket = 0;
+    while((bucket < pause_bucket_count - 1) && (pause >= s_pause_limits[bucket]))
+      bucket++;
+    this->m_stats.pause_hist[bucket]++;
+
+    if(!this->m_adaptive) {
+      this->m_adaptation = adaptation_none;
+      return;
+    }
+
+    // If pauses are too long, collect more often. If most variables survive, collecting
+    // them is mostly wasted, so collect less often.
+    auto adapt = adaptation_keep;
+    double thres = this->m_threshold;
+    if(this->m_pause > this->m_pause_target) {
+      adapt = adaptation_shrink_pause;
+      thres = thres * 0.75;
+    }
+    else if(this->m_survival > 0.75) {
+      adapt = adaptation_grow_survival;
+      thres = thres * 1.5 + 1;
+    }
+
+    // The cost of a collection is proportional to the number of variables being tracked.
+    // Wait for at least a quarter of that number of new variables, so the amortized cost of
+    // collection is linear.
+    double floor = static_cast<double>(this->m_ntracked) / 4;
+    if(thres < floor) {
+      adapt = adaptation_grow_heap;
+      thres = floor;
+    }
+
+    this->m_adaptation = adapt;
+    this->m_threshold = static_cast<uint32_t>(::rocket::clamp(thres, static_cast<double>(this->m_thres_min),
+                                                                      static_cast<double>(this->m_thres_max)));
+  }
+
+double
+Collector::
+get_pause_bucket_limit(size_t index)
+noexcept
+  {
+    return s_pause_limits[::rocket::min(index, pause_bucket_count - 1)];
+  }
+
+Collector&
+Collector::
+set_threshold_bounds(uint32_t thres_min, uint32_t thres_max)
+noexcept
+  {
+    this->m_thres_min = thres_min;
+    this->m_thres_max = ::rocket::max(thres_min, thres_max);
+    this->m_threshold = ::rocket::clamp(this->m_threshold, this->m_thres_min, this->m_thres_max);
+    return *this;
   }
 
 bool
 Collector::
 track_variable(const rcptr<Variable>& var)
   {
-    if(!this->m_tracked.insert(var))
+    if(var->get_gc_links().coll)
       return false;
+    var->add_reference();
+    this->do_link(var.get());
     this->m_counter++;
     // The variable has been inserted successfully.
-    if(ROCKET_UNEXPECT(this->m_counter > this->m_threshold))
+    if(ROCKET_UNEXPECT(this->m_counter > this->m_threshold) && !this->m_incr)
       this->auto_collect();
     return true;
   }
@@ -100,8 +778,9 @@ Collector::
 untrack_variable(const rcptr<Variable>& var)
 noexcept
   {
-    if(!this->m_tracked.erase(var))
+    if(var->get_gc_links().coll != this)
       return false;
+    do_release(this->do_unlink(var.get()));
     this->m_counter--;
     // The variable has been erased successfully.
     return true;
@@ -120,142 +799,184 @@ collect_single_opt()
     //   https://pythoninternal.wordpress.com/2014/08/04/the-garbage-collector/
     // We initialize `gcref` to zero then increment it, rather than initialize `gcref` to
     // the reference count then decrement it. This saves a phase below for us.
-    Collector* next = nullptr;
-    auto output = this->m_output_opt;
-    auto tied = this->m_tied_opt;
-    this->m_staging.clear();
+    // An incremental collection that is in progress is abandoned.
+    this->do_reset_collection();
+    double time_start = do_get_time_ms();
+    size_t work = SIZE_MAX;
+    size_t ncollected = 0;
 
     ///////////////////////////////////////////////////////////////////////////
     // Phase 1
     //   Add variables that are either tracked or reachable from tracked ones
     //   into the staging area.
     ///////////////////////////////////////////////////////////////////////////
-    do_traverse(this->m_tracked,
-      [&](const rcptr<Variable>& root) {
-        // Add a variable that is reachable directly.
-        // The reference from `m_tracked` should be excluded, so we initialize the gcref
-        // counter to 1.
-        root->reset_gcref(1);
-        // If this variable has been inserted indirectly, finish.
-        if(!this->m_staging.insert(root))
-          return false;
+    this->m_scan_tracked = this->m_tracked;
+    this->do_stage_tracked(work);
 
-        // If `root` is the last reference to this variable, it can be marked for collection
-        // immediately.
-        auto nref = root->use_count();
-        if(nref <= 1) {
-          root->uninitialize();
-          return false;
-        }
+    ///////////////////////////////////////////////////////////////////////////
+    // Phase 2
+    //   Drop references directly or indirectly from `m_staging`.
+    // Phase 3
+    //   Mark variables reachable indirectly from those reachable directly.
+    // These may be performed by multiple threads if there are many variables.
+    ///////////////////////////////////////////////////////////////////////////
+    if(this->m_workers_opt && (this->m_workers_opt->get_parallelism() > 1) &&
+       (this->m_nstaged >= s_parallel_min)) {
+      this->do_drop_and_mark_parallel();
+    }
+    else {
+      this->m_scan_staged = this->m_staging;
+      this->do_drop_staged(work);
+      this->m_scan_staged = this->m_staging;
+      this->do_mark_staged(work);
+    }
 
-        // Enumerate variables that are reachable from `root` indirectly.
-        do_traverse(*root,
-          [&](const rcptr<Variable>& child) {
-            // If this variable has been inserted indirectly, finish.
-            if(!this->m_staging.insert(child))
-              return false;
+    ///////////////////////////////////////////////////////////////////////////
+    // Phase 4
+    //   Wipe out variables whose `gcref` counters have excceeded their
+    //   reference counts.
+    ///////////////////////////////////////////////////////////////////////////
+    size_t nexamined = this->m_nstaged;
+    while(auto var = this->m_staging) {
+      this->m_staging = var->get_gc_links().stage;
+      ncollected += this->do_sweep(var, mark_staged);
+    }
 
-            // Initialize the gcref counter.
-            // N.B. If this variable is encountered later from `m_tracked`, the gcref counter
-            // will be overwritten with 1.
-            child->reset_gcref(0);
-            // Descend into grandchildren.
-            return true;
-          });
-        return false;
-      });
+    ///////////////////////////////////////////////////////////////////////////
+    // Finish
+    ///////////////////////////////////////////////////////////////////////////
+    auto next = this->m_next;
+    this->do_reset_collection();
+    this->m_counter = 0;
+    this->do_adapt_threshold(nexamined, ncollected, do_get_time_ms() - time_start);
+    return next;
+  }
+
+Collector*
+Collector::
+collect_step_opt(size_t& work)
+  {
+    // Ignore recursive requests.
+    const Sentry sentry(this->m_recur);
+    if(!sentry)
+      return nullptr;
+
+    // This is the same algorithm as `collect_single_opt()`, but each phase can be suspended
+    // when `work` is exhausted, and resumed later. As the mutator may run in between, results
+    // of the first four phases are only hints.
+    if(this->m_phase == phase_idle) {
+      this->do_reset_collection();
+      this->m_scan_tracked = this->m_tracked;
+      this->m_phase = phase_stage;
+    }
+
+    // The pause time of an incremental collection is that of its longest step.
+    double time_start = do_get_time_ms();
+    const auto record_pause = [&] {
+      this->m_cycle_pause = ::rocket::max(this->m_cycle_pause, do_get_time_ms() - time_start);
+      return this;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Phase 1
+    //   Add variables that are either tracked or reachable from tracked ones
+    //   into the staging area. Variables that are tracked after this phase
+    //   starts may be left out, and will be examined in the next collection.
+    ///////////////////////////////////////////////////////////////////////////
+    if(this->m_phase == phase_stage) {
+      if(!this->do_stage_tracked(work))
+        return record_pause();
+
+      this->m_cycle_examined = this->m_nstaged;
+      this->m_scan_staged = this->m_staging;
+      this->m_phase = phase_count;
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Phase 2
     //   Drop references directly or indirectly from `m_staging`.
     ///////////////////////////////////////////////////////////////////////////
-    do_traverse(this->m_staging,
-      [&](const rcptr<Variable>& root) {
-        // Drop a direct reference.
-        root->increment_gcref(1);
-        ROCKET_ASSERT(root->get_gcref() <= root->use_count());
-
-        // Skip variables that cannot have any children.
-        auto split = root->gcref_split();
-        if(split <= 0)
-          return false;
+    if(this->m_phase == phase_count) {
+      if(!this->do_drop_staged(work))
+        return record_pause();
 
-        // Enumerate variables that are reachable from `root` indirectly.
-        do_traverse(*root,
-          [&](const rcptr<Variable>& child) {
-            // Drop an indirect reference.
-            child->increment_gcref(split);
-            ROCKET_ASSERT(child->get_gcref() <= child->use_count());
-            // This is not going to be recursive.
-            return false;
-          });
-        return false;
-      });
+      this->m_scan_staged = this->m_staging;
+      this->m_phase = phase_mark;
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Phase 3
     //   Mark variables reachable indirectly from those reachable directly.
     ///////////////////////////////////////////////////////////////////////////
-    do_traverse(this->m_staging,
-      [&](const rcptr<Variable>& root) {
-        // Skip variables that are possibly unreachable.
-        if(root->get_gcref() >= root->use_count())
-          return false;
-
-        // Make this variable reachable, ...
-        root->reset_gcref(-1);
-        // ... as well as all children.
-        do_traverse(*root,
-          [&](const rcptr<Variable>& child) {
-            // Skip variables that have already been marked.
-            if(child->get_gcref() < 0)
-              return false;
+    if(this->m_phase == phase_mark) {
+      if(!this->do_mark_staged(work))
+        return record_pause();
 
-            // Mark it, ...
-            child->reset_gcref(-1);
-            // ... as well as all grandchildren.
-            return true;
-          });
-        return false;
-      });
+      this->m_phase = phase_gather;
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Phase 4
-    //   Wipe out variables whose `gcref` counters have excceeded their
-    //   reference counts.
+    //   Gather variables that are possibly unreachable, and transfer the
+    //   others to the next generational collector, if one has been tied.
     ///////////////////////////////////////////////////////////////////////////
-    do_traverse(this->m_staging,
-      [&](const rcptr<Variable>& root) {
-        // All reachable variables will have negative gcref counters.
-        if(root->get_gcref() >= 0) {
-          // Overwrite the value of this variable with a scalar value to break reference cycles.
-          root->uninitialize();
-          // Cache this variable if a pool is specified.
-          if(output)
-            output->insert(root);
-          this->m_tracked.erase(root);
-          return false;
+    if(this->m_phase == phase_gather) {
+      while(auto var = this->m_staging) {
+        if(work == 0)
+          return record_pause();
+
+        this->m_staging = var->get_gc_links().stage;
+        do_consume(work, 1);
+        if(var->get_gcref() < 0) {
+          this->do_sweep(var, mark_staged);
+          continue;
         }
 
-        if(tied) {
-          // Transfer this variable to the next generational collector, if one has been tied.
-          tied->m_tracked.insert(root);
-          // Check whether the next generation needs to be checked as well.
-          if(tied->m_counter++ >= tied->m_threshold)
-            next = tied;
-          this->m_tracked.erase(root);
-          return false;
-        }
+        // Move this variable from `m_staging` to `m_unreached`, together with the reference.
+        auto& links = var->open_gc_links();
+        links.mark = static_cast<uint8_t>((links.mark & ~mark_staged) | mark_unreached);
+        links.stage = ::std::exchange(this->m_unreached, var);
+      }
+      this->m_staging_tail = nullptr;
+    }
 
-        // Leave this variable intact.
-        return false;
-      });
+    ///////////////////////////////////////////////////////////////////////////
+    // Phase 5
+    //   Perform phases 2 to 4 again on unreachable variables, without any
+    //   interruption. A variable is unreachable only if all references to it
+    //   are from `m_tracked` or other unreachable variables.
+    ///////////////////////////////////////////////////////////////////////////
+    for(auto var = this->m_unreached;  var;  var = var->get_gc_links().stage) {
+      // Exclude references from `m_tracked`. The reference from `m_unreached` will be
+      // dropped below.
+      var->reset_gcref(var->get_gc_links().coll == this);
+      do_consume(work, 1);
+    }
+
+    for(auto var = this->m_unreached;  var;  var = var->get_gc_links().stage)
+      this->do_drop_references(var, mark_unreached);
+
+    size_t nmarked = SIZE_MAX;
+    for(auto var = this->m_unreached;  var;  var = var->get_gc_links().stage) {
+      this->do_mark_reachable(var);
+      this->do_drain_marking(nmarked, mark_unreached);
+    }
+
+    while(auto var = this->m_unreached) {
+      this->m_unreached = var->get_gc_links().stage;
+      this->m_cycle_collected += this->do_sweep(var, mark_unreached);
+    }
 
     ///////////////////////////////////////////////////////////////////////////
     // Finish
     ///////////////////////////////////////////////////////////////////////////
-    this->m_staging.clear();
+    auto next = this->m_next;
+    size_t nexamined = this->m_cycle_examined;
+    size_t ncollected = this->m_cycle_collected;
+    double pause = record_pause()->m_cycle_pause;
+    this->do_reset_collection();
     this->m_counter = 0;
+    this->do_adapt_threshold(nexamined, ncollected, pause);
     return next;
   }
 
@@ -280,8 +1001,10 @@ noexcept
       return *this;
 
     // Wipe all variables recursively.
+    this->do_reset_collection();
     Variable_Wiper wiper;
-    this->m_tracked.enumerate_variables(wiper);
+    for(auto var = this->m_tracked;  var;  var = var->get_gc_links().next)
+      wiper.wipe(*var);
     return *this;
   }
 
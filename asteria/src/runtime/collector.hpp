@@ -11,6 +11,33 @@ namespace asteria {
 
 class Collector
   {
+  public:
+    // These describe how the threshold was adjusted after the last collection.
+    enum Adaptation : uint8_t
+      {
+        adaptation_none           = 0,  // adaptive thresholds are disabled
+        adaptation_keep           = 1,  // the threshold was not changed
+        adaptation_grow_survival  = 2,  // most variables survived, so it was raised
+        adaptation_grow_heap      = 3,  // it was raised to a quarter of tracked variables
+        adaptation_shrink_pause   = 4,  // the pause time exceeded the target, so it was lowered
+      };
+
+    // These are accumulated over the lifetime of a collector. Pauses are counted in
+    // `pause_hist` by duration. See `get_pause_bucket_limit()`.
+    static constexpr size_t pause_bucket_count = 8;
+
+    struct Stats
+      {
+        uint64_t ncollections = 0;  // number of collections completed
+        uint64_t nexamined = 0;     // number of variables examined
+        uint64_t ncollected = 0;    // number of variables collected
+        uint64_t npromoted = 0;     // number of variables transferred to the tied collector
+        uint64_t nbytes_freed = 0;  // approximate number of bytes of values of collected variables
+        double pause_total = 0;     // sum of pause times, in milliseconds
+        double pause_max = 0;       // longest pause time, in milliseconds
+        uint64_t pause_hist[pause_bucket_count] = { };
+      };
+
   private:
     Variable_HashSet* m_output_opt;
     Collector* m_tied_opt;
@@ -18,8 +45,41 @@ class Collector
 
     uint32_t m_counter = 0;
     long m_recur = 0;
-    Variable_HashSet m_tracked;
-    Variable_HashSet m_staging;
+
+    // These are intrusive lists. See `Variable::GC_Links`.
+    Variable* m_tracked = nullptr;    // variables tracked by this collector
+    size_t m_ntracked = 0;
+    Variable* m_staging = nullptr;    // variables being examined, in the order of staging
+    Variable* m_staging_tail = nullptr;
+    size_t m_nstaged = 0;
+    Variable* m_marking = nullptr;    // variables whose children are to be marked
+    Variable* m_unreached = nullptr;  // variables that have been found unreachable
+
+    // These are states of collection, which are kept across incremental steps.
+    // See `collect_step_opt()`.
+    bool m_incr = false;
+    uint8_t m_phase = 0;
+    Variable* m_scan_tracked = nullptr;  // the next tracked variable to stage
+    Variable* m_scan_staged = nullptr;   // the next staged variable to examine
+    Collector* m_next = nullptr;
+    size_t m_cycle_examined = 0;
+    size_t m_cycle_collected = 0;
+    double m_cycle_pause = 0;
+
+    // These are used by adaptive thresholds. See `do_adapt_threshold()`.
+    bool m_adaptive = false;
+    Adaptation m_adaptation = adaptation_none;
+    uint32_t m_thres_min = 0;
+    uint32_t m_thres_max = UINT32_MAX;
+    double m_pause_target = 10;  // milliseconds
+    size_t m_last_examined = 0;
+    size_t m_last_collected = 0;
+    double m_survival = -1;  // smoothed survival ratio; negative if unknown
+    double m_pause = 0;  // smoothed pause time in milliseconds
+    Stats m_stats;
+
+    // This is used by parallel collection. See `do_drop_and_mark_parallel()`.
+    GC_Workers* m_workers_opt = nullptr;
 
   public:
     Collector(Variable_HashSet* output_opt, Collector* tied_opt, uint32_t threshold)
@@ -29,6 +89,63 @@ class Collector
 
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Collector);
 
+  private:
+    inline
+    void
+    do_link(Variable* var)
+    noexcept;
+
+    inline
+    Variable*
+    do_unlink(Variable* var)
+    noexcept;
+
+    inline
+    void
+    do_stage(Variable* var)
+    noexcept;
+
+    inline
+    size_t
+    do_drop_references(Variable* var, uint8_t scope);
+
+    inline
+    void
+    do_mark_reachable(Variable* var)
+    noexcept;
+
+    inline
+    bool
+    do_drain_marking(size_t& work, uint8_t scope);
+
+    // These perform the first three phases of a collection on `m_staging`. Each of them
+    // returns `true` if it has completed, and `false` if `work` has been exhausted.
+    bool
+    do_stage_tracked(size_t& work);
+
+    bool
+    do_drop_staged(size_t& work);
+
+    bool
+    do_mark_staged(size_t& work);
+
+    // This performs the second and the third phases of a full collection with multiple
+    // threads. It has the same effect as `do_drop_staged()` followed by `do_mark_staged()`.
+    void
+    do_drop_and_mark_parallel();
+
+    bool
+    do_sweep(Variable* var, uint8_t mark)
+    noexcept;
+
+    void
+    do_reset_collection()
+    noexcept;
+
+    void
+    do_adapt_threshold(size_t nexamined, size_t ncollected, double pause)
+    noexcept;
+
   public:
     Variable_HashSet*
     get_output_pool_opt()
@@ -60,11 +177,129 @@ class Collector
     noexcept
       { return this->m_threshold = threshold, *this;  }
 
+    // If a collector is adaptive, its threshold is adjusted after each collection according
+    // to the survival ratio, the pause time and the number of variables being tracked, within
+    // the bounds below.
+    bool
+    is_adaptive()
+    const noexcept
+      { return this->m_adaptive;  }
+
+    Collector&
+    set_adaptive(bool adaptive)
+    noexcept
+      { return this->m_adaptive = adaptive, *this;  }
+
+    uint32_t
+    get_threshold_min()
+    const noexcept
+      { return this->m_thres_min;  }
+
+    uint32_t
+    get_threshold_max()
+    const noexcept
+      { return this->m_thres_max;  }
+
+    Collector&
+    set_threshold_bounds(uint32_t thres_min, uint32_t thres_max)
+    noexcept;
+
+    double
+    get_pause_target()
+    const noexcept
+      { return this->m_pause_target;  }
+
+    Collector&
+    set_pause_target(double pause_target)
+    noexcept
+      { return this->m_pause_target = pause_target, *this;  }
+
+    Adaptation
+    get_last_adaptation()
+    const noexcept
+      { return this->m_adaptation;  }
+
+    size_t
+    get_last_examined()
+    const noexcept
+      { return this->m_last_examined;  }
+
+    size_t
+    get_last_collected()
+    const noexcept
+      { return this->m_last_collected;  }
+
+    double
+    get_survival_ratio()
+    const noexcept
+      { return this->m_survival;  }
+
+    double
+    get_pause_time()
+    const noexcept
+      { return this->m_pause;  }
+
+    const Stats&
+    get_stats()
+    const noexcept
+      { return this->m_stats;  }
+
+    Collector&
+    clear_stats()
+    noexcept
+      { return this->m_stats = Stats(), *this;  }
+
+    // Gets the upper bound of pause times in milliseconds that are counted in the bucket
+    // `index` of `Stats::pause_hist`. The last bucket has no upper bound, so infinity is
+    // returned for it.
+    static
+    double
+    get_pause_bucket_limit(size_t index)
+    noexcept;
+
+    // If a collector is incremental, it does not perform collection automatically when its
+    // threshold is exceeded. Its owner is responsible for calling `collect_step_opt()`.
+    bool
+    is_incremental()
+    const noexcept
+      { return this->m_incr;  }
+
+    Collector&
+    set_incremental(bool incr)
+    noexcept
+      { return this->m_incr = incr, *this;  }
+
+    // If worker threads have been set, `collect_single_opt()` counts references and marks
+    // reachable variables with all of them, including the calling one, provided that there
+    // are enough variables. Variables shall not be accessed by other threads in the meantime.
+    // Incremental collection is always performed by the calling thread.
+    GC_Workers*
+    get_workers_opt()
+    const noexcept
+      { return this->m_workers_opt;  }
+
+    Collector&
+    set_workers(GC_Workers* workers_opt)
+    noexcept
+      { return this->m_workers_opt = workers_opt, *this;  }
+
+    uint32_t
+    get_counter()
+    const noexcept
+      { return this->m_counter;  }
+
     size_t
     count_tracked_variables()
     const noexcept
-      { return this->m_tracked.size();  }
+      { return this->m_ntracked;  }
+
+    bool
+    is_collecting()
+    const noexcept
+      { return this->m_phase != 0;  }
 
+    // A variable may be tracked by at most one collector. If `var` has been tracked by another
+    // collector, this function fails.
     bool
     track_variable(const rcptr<Variable>& var);
 
@@ -75,6 +310,20 @@ class Collector
     Collector*
     collect_single_opt();
 
+    // Performs a part of a collection, which consumes at most `work` variables approximately.
+    // If the collection has not finished, `this` is returned. Otherwise, the tied collector
+    // is returned if it should be collected as well, or a null pointer otherwise.
+    // The mutator may run between steps, so the final sweep double-checks all variables that
+    // have been found unreachable before wiping them out. This is done in a single step, whose
+    // cost is proportional to the number of such variables.
+    Collector*
+    collect_step_opt(size_t& work);
+
+    Collector&
+    cancel_collection()
+    noexcept
+      { return this->do_reset_collection(), *this;  }
+
     void
     auto_collect();
 
@@ -45,6 +45,17 @@ class Evaluation_Stack
         return *this;
       }
 
+    Evaluation_Stack&
+    clear_cache()
+    noexcept
+      {
+        // Destroy references that have been popped but retained for reuse, as they may
+        // keep variables alive.
+        ROCKET_ASSERT(this->m_refs.empty() || this->m_refs.unique());
+        this->m_refs.pop_back(this->m_refs.size() - this->size());
+        return *this;
+      }
+
     Evaluation_Stack&
     reserve(cow_vector<Reference>&& refs)
       {
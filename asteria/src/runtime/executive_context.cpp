@@ -3,6 +3,9 @@
 
 #include "../precompiled.hpp"
 #include "executive_context.hpp"
+#include "global_context.hpp"
+#include "genius_collector.hpp"
+#include "variable.hpp"
 #include "runtime_error.hpp"
 #include "ptc_arguments.hpp"
 #include "../llds/avmc_queue.hpp"
@@ -14,9 +17,9 @@ namespace {
 template<typename XRefT>
 inline
 Reference*
-do_set_lazy_reference(Executive_Context& ctx, const phsh_string& name, XRefT&& xref)
+do_set_lazy_reference(Executive_Context& ctx, uint32_t slot, XRefT&& xref)
   {
-    auto& ref = ctx.open_named_reference(name);
+    auto& ref = ctx.open_local_reference(slot);
     ref = ::std::forward<XRefT>(xref);
     return ::std::addressof(ref);
   }
@@ -26,6 +29,26 @@ do_set_lazy_reference(Executive_Context& ctx, const phsh_string& name, XRefT&& x
 Executive_Context::
 ~Executive_Context()
   {
+    // Local variables that have not been tracked are supposed to die here. If one is
+    // still referenced elsewhere, it has escaped and has to be tracked from now on.
+    // Note that `get_variable_opt()` returns a new reference.
+    bool stack_cleared = false;
+    for(const auto& ref : this->m_local_refs) {
+      auto var = ref.get_variable_opt();
+      if(ROCKET_EXPECT(!var || !var->is_local() || (var->use_count() <= 2)))
+        continue;
+
+      // Stale references on the stack don't count.
+      if(!stack_cleared) {
+        this->m_stack->clear_cache();
+        stack_cleared = true;
+      }
+      if(var->use_count() > 2)
+        this->m_global->genius_collector()->adopt_local_variable(var);
+    }
+
+    // Return local references to the pool of the global context.
+    this->m_global->recycle_reference_buffer(::std::move(this->m_local_refs));
   }
 
 void
@@ -36,21 +59,15 @@ do_bind_parameters(const rcptr<Variadic_Arguer>& zvarg, const cow_vector<phsh_st
     // Set the zero-ary argument getter.
     this->m_zvarg = zvarg;
 
-    // Set the `this` reference.
-    // If the self reference is null, it is likely that `this` isn't ever referenced in this function,
-    // so perform lazy initialization.
-    if(!self.is_void() && !self.is_constant_null())
-      this->open_named_reference(::rocket::sref("__this")) = ::std::move(self);
-
     // This is the subscript of the special parameter placeholder `...`.
     size_t elps = SIZE_MAX;
 
     // Set parameters, which are local references.
+    // N.B. The `i`-th parameter always occupies the `i`-th slot. See 'analytic_context.cpp'.
+    this->m_local_refs = this->m_global->allocate_reference_buffer();
+    this->m_local_refs.reserve(params.size() + 3);
     for(size_t i = 0;  i < params.size();  ++i) {
       const auto& name = params.at(i);
-      if(name.empty())
-        continue;
-
       if(name.rdstr().starts_with("__"))
         ASTERIA_THROW("Reserved name not declarable as parameter (name `$1`)", name);
 
@@ -62,11 +79,20 @@ do_bind_parameters(const rcptr<Variadic_Arguer>& zvarg, const cow_vector<phsh_st
       }
       // Set the parameter.
       if(ROCKET_UNEXPECT(i >= args.size()))
-        this->open_named_reference(name) = Reference_root::S_constant();
+        this->m_local_refs.emplace_back(Reference_root::S_constant());
       else
-        this->open_named_reference(name) = ::std::move(args.mut(i));
+        this->m_local_refs.emplace_back(::std::move(args.mut(i)));
     }
 
+    // Pre-defined references follow parameters.
+    this->m_predef_slot = static_cast<uint32_t>(this->m_local_refs.size());
+
+    // Set the `this` reference.
+    // If the self reference is null, it is likely that `this` isn't ever referenced in this function,
+    // so perform lazy initialization.
+    if(!self.is_void() && !self.is_constant_null())
+      this->open_local_reference(this->m_predef_slot + 1) = ::std::move(self);
+
     // Disallow exceess arguments if the function is not variadic.
     if((elps == SIZE_MAX) && (args.size() > params.size())) {
       ASTERIA_THROW("Too many arguments (`$1` > `$2`)", args.size(), params.size());
@@ -79,6 +105,17 @@ do_bind_parameters(const rcptr<Variadic_Arguer>& zvarg, const cow_vector<phsh_st
       this->m_lazy_args = ::std::move(args);
   }
 
+void
+Executive_Context::
+do_extend_local_references(uint32_t slot)
+  {
+    // Take a buffer from the pool if none has been allocated.
+    if(this->m_local_refs.capacity() == 0)
+      this->m_local_refs = this->m_global->allocate_reference_buffer();
+
+    this->m_local_refs.append(slot + 1 - this->m_local_refs.size(), Reference_root::S_void());
+  }
+
 void
 Executive_Context::
 do_defer_expression(const Source_Location& sloc, AVMC_Queue&& queue)
@@ -161,23 +198,24 @@ do_on_scope_exit_exception(Runtime_Error& except)
 
 Reference*
 Executive_Context::
-do_lazy_lookup_opt(const phsh_string& name)
+do_lazy_lookup_opt(uint32_t slot)
   {
     // Create pre-defined references as needed.
     // N.B. If you have ever changed these, remember to update 'analytic_context.cpp' as well.
-    if(name == "__func") {
-      // Note: This can only happen inside a function context.
+    if(slot == this->m_predef_slot + 2) {
+      // `__func`
       Reference_root::S_constant xref = { this->m_zvarg->func() };
-      return do_set_lazy_reference(*this, name, ::std::move(xref));
+      return do_set_lazy_reference(*this, slot, ::std::move(xref));
     }
 
-    if(name == "__this") {
-      // Note: This can only happen inside a function context and the `this` argument is null.
-      return do_set_lazy_reference(*this, name, Reference_root::S_constant());
+    if(slot == this->m_predef_slot + 1) {
+      // `__this`
+      // Note: This can only happen if the `this` argument is null.
+      return do_set_lazy_reference(*this, slot, Reference_root::S_constant());
     }
 
-    if(name == "__varg") {
-      // Note: This can only happen inside a function context.
+    if(slot == this->m_predef_slot) {
+      // `__varg`
       cow_function varg;
       if(ROCKET_EXPECT(this->m_lazy_args.size()))
         varg = ::rocket::make_refcnt<Variadic_Arguer>(*(this->m_zvarg), ::std::move(this->m_lazy_args));
@@ -185,7 +223,7 @@ do_lazy_lookup_opt(const phsh_string& name)
         varg = this->m_zvarg;
 
       Reference_root::S_constant xref = { ::std::move(varg) };
-      return do_set_lazy_reference(*this, name, ::std::move(xref));
+      return do_set_lazy_reference(*this, slot, ::std::move(xref));
     }
 
     return nullptr;
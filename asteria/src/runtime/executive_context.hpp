@@ -23,9 +23,14 @@ class Executive_Context
     refp<Global_Context> m_global;
     refp<Evaluation_Stack> m_stack;
 
+    // This stores local references, indexed by slots allocated by the
+    // corresponding analytic context.
+    cow_vector<Reference> m_local_refs;
+
     // These members are used for lazy initialization.
     rcptr<Variadic_Arguer> m_zvarg;
     cow_vector<Reference> m_lazy_args;
+    uint32_t m_predef_slot = UINT32_MAX;
 
     // This stores deferred expressions.
     cow_bivector<Source_Location, AVMC_Queue> m_defer;
@@ -58,6 +63,12 @@ class Executive_Context
     do_bind_parameters(const rcptr<Variadic_Arguer>& zvarg, const cow_vector<phsh_string>& params,
                        Reference&& self, cow_vector<Reference>&& args);
 
+    Reference*
+    do_lazy_lookup_opt(uint32_t slot);
+
+    void
+    do_extend_local_references(uint32_t slot);
+
     void
     do_defer_expression(const Source_Location& sloc, AVMC_Queue&& queue);
 
@@ -81,10 +92,6 @@ class Executive_Context
     const noexcept override
       { return this->get_parent_opt();  }
 
-    Reference*
-    do_lazy_lookup_opt(const phsh_string& name)
-    override;
-
   public:
     bool
     is_analytic()
@@ -106,6 +113,27 @@ class Executive_Context
     const noexcept
       { return this->m_stack;  }
 
+    // Get a local reference by slot. A void reference is returned if it has
+    // not been initialized, or a null pointer if it is out of range.
+    const Reference*
+    get_local_reference_opt(uint32_t slot)
+    const
+      {
+        auto qref = this->m_local_refs.get_ptr(slot);
+        // Initialize builtins only when needed.
+        if(ROCKET_UNEXPECT(!qref || qref->is_void()) && this->m_zvarg && (slot - this->m_predef_slot < 3))
+          qref = const_cast<Executive_Context*>(this)->do_lazy_lookup_opt(slot);
+        return qref;
+      }
+
+    Reference&
+    open_local_reference(uint32_t slot)
+      {
+        if(ROCKET_UNEXPECT(slot >= this->m_local_refs.size()))
+          this->do_extend_local_references(slot);
+        return this->m_local_refs.mut(slot);
+      }
+
     // Defer an expression which will be evaluated at scope exit.
     // The result of such expressions are discarded.
     Executive_Context&
@@ -0,0 +1,120 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "gc_workers.hpp"
+#include "../utilities.hpp"
+#include <signal.h>  // ::sigfillset()
+
+namespace asteria {
+
+GC_Workers::
+~GC_Workers()
+  {
+    this->do_stop_threads();
+  }
+
+void*
+GC_Workers::
+do_thread_procedure(void* param)
+noexcept
+  {
+    auto& thr = *static_cast<Thread*>(param);
+    auto self = thr.self;
+    size_t index = thr.index;
+    uint64_t serial = thr.serial;
+
+    ::rocket::mutex::unique_lock lock(self->m_mutex);
+    for(;;) {
+      // Park until a new job is posted.
+      self->m_start.wait(lock, [&] { return self->m_exit || (self->m_serial != serial);  });
+      if(self->m_exit)
+        return nullptr;
+
+      serial = self->m_serial;
+      auto job = self->m_job;
+      auto jparam = self->m_param;
+      lock.unlock();
+
+      job(jparam, index);
+
+      // Notify the calling thread if this is the last one.
+      lock.lock(self->m_mutex);
+      if(--(self->m_npending) == 0)
+        self->m_finish.notify_one();
+    }
+  }
+
+void
+GC_Workers::
+do_stop_threads()
+noexcept
+  {
+    // Wake all threads up, and wait for them to exit.
+    ::rocket::mutex::unique_lock lock(this->m_mutex);
+    this->m_exit = true;
+    this->m_start.notify_all();
+    lock.unlock();
+
+    for(size_t k = 0;  k != this->m_nthreads;  ++k)
+      ::pthread_join(this->m_threads[k].handle, nullptr);
+
+    this->m_nthreads = 0;
+    this->m_exit = false;
+  }
+
+void
+GC_Workers::
+do_run(Job* job, void* param)
+noexcept
+  {
+    // Post the job.
+    ::rocket::mutex::unique_lock lock(this->m_mutex);
+    this->m_job = job;
+    this->m_param = param;
+    this->m_npending = this->m_nthreads;
+    this->m_serial++;
+    this->m_start.notify_all();
+    lock.unlock();
+
+    // The calling thread works, too.
+    job(param, 0);
+
+    lock.lock(this->m_mutex);
+    this->m_finish.wait(lock, [&] { return this->m_npending == 0;  });
+  }
+
+GC_Workers&
+GC_Workers::
+set_parallelism(size_t nthreads)
+noexcept
+  {
+    size_t nworkers = ::rocket::clamp(nthreads, size_t(1), size_t(parallelism_max)) - 1;
+    if(nworkers == this->m_nthreads)
+      return *this;
+
+    // Threads are not reused. It is unusual to change parallelism anyway.
+    this->do_stop_threads();
+    if(nworkers == 0)
+      return *this;
+
+    // Signals are meant for the interpreter, so workers shall not handle them.
+    ::sigset_t sigset, sigold;
+    ::sigfillset(&sigset);
+    ::pthread_sigmask(SIG_BLOCK, &sigset, &sigold);
+
+    while(this->m_nthreads != nworkers) {
+      auto& thr = this->m_threads[this->m_nthreads];
+      thr.self = this;
+      thr.index = this->m_nthreads + 1;
+      thr.serial = this->m_serial;
+      if(::pthread_create(&(thr.handle), nullptr, do_thread_procedure, &thr) != 0)
+        break;
+      this->m_nthreads++;
+    }
+
+    ::pthread_sigmask(SIG_SETMASK, &sigold, nullptr);
+    return *this;
+  }
+
+}  // namespace asteria
@@ -0,0 +1,97 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_RUNTIME_GC_WORKERS_HPP_
+#define ASTERIA_RUNTIME_GC_WORKERS_HPP_
+
+#include "../fwd.hpp"
+#include "../../rocket/mutex.hpp"
+#include "../../rocket/condition_variable.hpp"
+#include <pthread.h>
+
+namespace asteria {
+
+// These are threads for parallel collection. They are started in advance, and are
+// parked between collections.
+class GC_Workers
+  {
+  public:
+    // This is the maximum number of threads, including the calling one.
+    static constexpr size_t parallelism_max = 64;
+
+    // A job is called on every thread with a distinct index, which is zero for the
+    // calling thread.
+    using Job = void (void* param, size_t index);
+
+  private:
+    struct Thread
+      {
+        GC_Workers* self;
+        size_t index;
+        uint64_t serial;  // the serial number of the last job seen
+        ::pthread_t handle;
+      };
+
+    ::rocket::mutex m_mutex;
+    ::rocket::condition_variable m_start;   // signaled when a job is posted
+    ::rocket::condition_variable m_finish;  // signaled when all threads have finished it
+    Thread m_threads[parallelism_max - 1];
+    size_t m_nthreads = 0;
+
+    // These describe the current job.
+    uint64_t m_serial = 0;
+    Job* m_job = nullptr;
+    void* m_param = nullptr;
+    size_t m_npending = 0;
+    bool m_exit = false;
+
+  public:
+    GC_Workers()
+    noexcept
+      { }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(GC_Workers);
+
+  private:
+    static
+    void*
+    do_thread_procedure(void* param)
+    noexcept;
+
+    void
+    do_stop_threads()
+    noexcept;
+
+    void
+    do_run(Job* job, void* param)
+    noexcept;
+
+  public:
+    // This is the number of threads that take part in a job, including the calling one.
+    size_t
+    get_parallelism()
+    const noexcept
+      { return this->m_nthreads + 1;  }
+
+    // Starts or stops threads. Threads that fail to start are left out, so parallelism
+    // may end up lower than requested.
+    GC_Workers&
+    set_parallelism(size_t nthreads)
+    noexcept;
+
+    // Calls `func(index)` on all threads concurrently, and returns after all calls have
+    // returned. `func` shall not throw exceptions.
+    template<typename FuncT>
+    GC_Workers&
+    run(FuncT& func)
+    noexcept
+      {
+        this->do_run([](void* param, size_t index) { (*static_cast<FuncT*>(param))(index);  },
+                     ::std::addressof(func));
+        return *this;
+      }
+  };
+
+}  // namespace asteria
+
+#endif
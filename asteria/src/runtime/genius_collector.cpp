@@ -34,6 +34,73 @@ const
     }
   }
 
+bool
+Genius_Collector::
+do_collection_pending()
+const noexcept
+  {
+    if(this->m_active)
+      return true;
+
+    // Check whether any generation has exceeded its threshold.
+    return (this->m_newest.get_counter() > this->m_newest.get_threshold()) ||
+           (this->m_middle.get_counter() > this->m_middle.get_threshold()) ||
+           (this->m_oldest.get_counter() > this->m_oldest.get_threshold());
+  }
+
+rcptr<Variable>
+Genius_Collector::
+do_allocate_variable()
+  {
+    // Try allocating a variable from the pool.
+    auto var = this->m_pool.erase_random_opt();
+    if(ROCKET_EXPECT(var)) {
+      this->m_npool_hits++;
+      return var;
+    }
+    this->m_nfresh_allocs++;
+    return ::rocket::make_refcnt<Variable>();
+  }
+
+Genius_Collector::Stats
+Genius_Collector::
+get_stats()
+const noexcept
+  {
+    Stats stats;
+    stats.gens[gc_generation_newest] = this->m_newest.get_stats();
+    stats.gens[gc_generation_middle] = this->m_middle.get_stats();
+    stats.gens[gc_generation_oldest] = this->m_oldest.get_stats();
+    stats.npool_hits = this->m_npool_hits;
+    stats.nfresh_allocs = this->m_nfresh_allocs;
+    return stats;
+  }
+
+Genius_Collector&
+Genius_Collector::
+clear_stats()
+noexcept
+  {
+    this->m_newest.clear_stats();
+    this->m_middle.clear_stats();
+    this->m_oldest.clear_stats();
+    this->m_npool_hits = 0;
+    this->m_nfresh_allocs = 0;
+    return *this;
+  }
+
+Genius_Collector&
+Genius_Collector::
+set_step_budget(size_t budget)
+noexcept
+  {
+    this->m_step_budget = budget;
+    this->m_newest.set_incremental(budget != 0);
+    this->m_middle.set_incremental(budget != 0);
+    this->m_oldest.set_incremental(budget != 0);
+    return *this;
+  }
+
 rcptr<Variable>
 Genius_Collector::
 create_variable(GC_Generation gc_hint)
@@ -41,21 +108,51 @@ create_variable(GC_Generation gc_hint)
     // Locate the collector, which will be responsible for tracking the new variable.
     auto& coll = this->*(this->do_locate(gc_hint));
 
-    // Try allocating a variable from the pool.
-    auto var = this->m_pool.erase_random_opt();
-    if(ROCKET_UNEXPECT(!var))
-      var = ::rocket::make_refcnt<Variable>();
+    // Allocate a variable, which may be reused from the pool.
+    auto var = this->do_allocate_variable();
     coll.track_variable(var);
 
     // Mark it uninitialized.
     var->uninitialize();
+    var->set_local(false);
+
+    // Perform a step of incremental collection if necessary.
+    if(this->m_step_budget && this->do_collection_pending())
+      this->collect_step(this->m_step_budget);
+    return var;
+  }
+
+rcptr<Variable>
+Genius_Collector::
+create_local_variable()
+  {
+    // Allocate a variable, which may be reused from the pool.
+    auto var = this->do_allocate_variable();
+
+    // Mark it uninitialized. It is not tracked.
+    var->uninitialize();
+    var->set_local(true);
     return var;
   }
 
+Genius_Collector&
+Genius_Collector::
+adopt_local_variable(const rcptr<Variable>& var)
+  {
+    ROCKET_ASSERT(var->is_local());
+    var->set_local(false);
+    this->m_newest.track_variable(var);
+    return *this;
+  }
+
 size_t
 Genius_Collector::
 collect_variables(GC_Generation gc_limit)
   {
+    // Abandon the incremental collection in progress, if any.
+    if(auto qcoll = ::std::exchange(this->m_active, nullptr))
+      qcoll->cancel_collection();
+
     // Collect variables from the newest generation to the oldest.
     for(auto p = ::std::make_pair(&(this->m_newest), gc_limit + 1);
           p.first && p.second;  p.first = p.first->get_tied_collector_opt(), p.second--)
@@ -67,12 +164,45 @@ collect_variables(GC_Generation gc_limit)
     return nvars;
   }
 
+bool
+Genius_Collector::
+collect_step(size_t work)
+  {
+    if(work == 0)
+      return this->m_active == nullptr;
+
+    auto qcoll = this->m_active;
+    if(!qcoll) {
+      // Start a new collection.
+      qcoll = &(this->m_newest);
+      if(this->m_newest.get_counter() <= this->m_newest.get_threshold()) {
+        if(this->m_middle.get_counter() > this->m_middle.get_threshold())
+          qcoll = &(this->m_middle);
+        else if(this->m_oldest.get_counter() > this->m_oldest.get_threshold())
+          qcoll = &(this->m_oldest);
+      }
+    }
+
+    // Only one collector may be active at a time, as gcref counters are shared.
+    // If a collection completes and the next generation needs to be checked as well,
+    // continue with it.
+    while(qcoll && work) {
+      auto qnext = qcoll->collect_step_opt(work);
+      if(qnext == qcoll)
+        break;
+      qcoll = qnext;
+    }
+    this->m_active = qcoll;
+    return qcoll == nullptr;
+  }
+
 Genius_Collector&
 Genius_Collector::
 wipe_out_variables()
 noexcept
   {
     // Uninitialize all variables recursively.
+    this->m_active = nullptr;
     this->m_newest.wipe_out_variables();
     this->m_middle.wipe_out_variables();
     this->m_oldest.wipe_out_variables();
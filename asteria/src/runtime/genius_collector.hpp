@@ -6,6 +6,7 @@
 
 #include "../fwd.hpp"
 #include "collector.hpp"
+#include "gc_workers.hpp"
 #include "../llds/variable_hashset.hpp"
 
 namespace asteria {
@@ -14,20 +15,48 @@ class Genius_Collector
 final
   : public Rcfwd<Genius_Collector>
   {
+  public:
+    // These are accumulated over the lifetime of a collector.
+    struct Stats
+      {
+        Collector::Stats gens[3];    // indexed by `GC_Generation`
+        uint64_t npool_hits = 0;     // number of variables that have been reused from the pool
+        uint64_t nfresh_allocs = 0;  // number of variables that have been allocated anew
+      };
+
   private:
     // Mind the order of construction and destruction.
+    GC_Workers m_workers;
     Variable_HashSet m_pool;
     Collector m_oldest;
     Collector m_middle;
     Collector m_newest;
 
+    // These are used by incremental collection.
+    size_t m_step_budget = 0;
+    Collector* m_active = nullptr;
+
+    // These are statistics of allocation. Those of collection are kept by collectors.
+    uint64_t m_npool_hits = 0;
+    uint64_t m_nfresh_allocs = 0;
+
   public:
     Genius_Collector()
     noexcept
       : m_oldest(&(this->m_pool),           nullptr,  10),
         m_middle(&(this->m_pool), &(this->m_oldest),  60),
         m_newest(&(this->m_pool), &(this->m_middle), 800)
-      { }
+      {
+        // Thresholds are adjusted within these bounds automatically.
+        this->m_oldest.set_threshold_bounds(10, 1000000).set_adaptive(true);
+        this->m_middle.set_threshold_bounds(20, 5000).set_adaptive(true);
+        this->m_newest.set_threshold_bounds(200, 20000).set_adaptive(true);
+
+        // Worker threads are shared by all generations.
+        this->m_oldest.set_workers(&(this->m_workers));
+        this->m_middle.set_workers(&(this->m_workers));
+        this->m_newest.set_workers(&(this->m_workers));
+      }
 
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Genius_Collector);
 
@@ -36,6 +65,14 @@ final
     do_locate(GC_Generation gc_gen)
     const;
 
+    bool
+    do_collection_pending()
+    const noexcept;
+
+    inline
+    rcptr<Variable>
+    do_allocate_variable();
+
   public:
     size_t
     get_pool_size()
@@ -47,6 +84,16 @@ final
     noexcept
       { return this->m_pool.clear(), *this;  }
 
+    // Gets statistics of all generations and the pool. This is cheap, as counters are
+    // updated only when variables are allocated or collections complete.
+    Stats
+    get_stats()
+    const noexcept;
+
+    Genius_Collector&
+    clear_stats()
+    noexcept;
+
     const Collector&
     get_collector(GC_Generation gc_gen)
     const
@@ -56,12 +103,55 @@ final
     open_collector(GC_Generation gc_gen)
       { return this->*(this->do_locate(gc_gen));  }
 
+    // If the step budget is non-zero, collectors become incremental. Instead of a full
+    // collection when a threshold is exceeded, `create_variable()` performs a step of
+    // collection which processes about this number of variables.
+    size_t
+    get_step_budget()
+    const noexcept
+      { return this->m_step_budget;  }
+
+    Genius_Collector&
+    set_step_budget(size_t budget)
+    noexcept;
+
+    // This is the number of threads for full collections of all generations, including the
+    // calling one. It is one by default, so collection is serial and no thread is started.
+    // Otherwise, worker threads are started here and are parked between collections. See
+    // `Collector::set_workers()`.
+    size_t
+    get_parallelism()
+    const noexcept
+      { return this->m_workers.get_parallelism();  }
+
+    Genius_Collector&
+    set_parallelism(size_t nthreads)
+    noexcept
+      { return this->m_workers.set_parallelism(nthreads), *this;  }
+
     rcptr<Variable>
     create_variable(GC_Generation gc_hint = gc_generation_newest);
 
+    // Creates a variable that is not tracked by any collector. This is used for local
+    // variables that are known not to escape their scopes, which are destroyed when
+    // their reference counts drop to zero. Should one be referenced elsewhere after all,
+    // it shall be passed to `adopt_local_variable()` before its scope is left.
+    rcptr<Variable>
+    create_local_variable();
+
+    Genius_Collector&
+    adopt_local_variable(const rcptr<Variable>& var);
+
     size_t
     collect_variables(GC_Generation gc_limit = gc_generation_oldest);
 
+    // Performs a step of incremental collection, processing about `work` variables. If no
+    // collection is in progress, a new one is started from the newest generation whose
+    // threshold has been exceeded, or from the newest generation if there is none.
+    // Returns `true` if the collection has completed, and `false` otherwise.
+    bool
+    collect_step(size_t work);
+
     Genius_Collector&
     wipe_out_variables()
     noexcept;
@@ -6,6 +6,8 @@
 #include "genius_collector.hpp"
 #include "random_engine.hpp"
 #include "loader_lock.hpp"
+#include "module_cache.hpp"
+#include "regex_cache.hpp"
 #include "variable.hpp"
 #include "abstract_hooks.hpp"
 #include "../library/version.hpp"
@@ -127,6 +129,21 @@ initialize(API_Version version)
       ldrlk = ::rocket::make_refcnt<Loader_Lock>();
     this->m_ldrlk = ldrlk;
 
+    // Initialize the cache of compiled modules. Modules that were compiled before
+    // are discarded.
+    auto mcache = unerase_cast(this->m_mcache);
+    if(!mcache)
+      mcache = ::rocket::make_refcnt<Module_Cache>();
+    mcache->clear();
+    this->m_mcache = mcache;
+
+    // Initialize the cache of compiled regular expressions. As patterns do not depend
+    // on the library, they are retained.
+    auto rcache = unerase_cast(this->m_rcache);
+    if(!rcache)
+      rcache = ::rocket::make_refcnt<Regex_Cache>();
+    this->m_rcache = rcache;
+
     // Initialize standard library modules.
 #ifdef ROCKET_DEBUG
     ROCKET_ASSERT(::std::is_sorted(begin(s_modules), end(s_modules), Module_Comparator()));
@@ -6,6 +6,7 @@
 
 #include "../fwd.hpp"
 #include "abstract_context.hpp"
+#include "reference.hpp"
 #include "../recursion_sentry.hpp"
 
 namespace asteria {
@@ -20,8 +21,19 @@ class Global_Context
     rcfwdp<Genius_Collector> m_gcoll;
     rcfwdp<Random_Engine> m_prng;
     rcfwdp<Loader_Lock> m_ldrlk;
+    rcfwdp<Module_Cache> m_mcache;
+    rcfwdp<Regex_Cache> m_rcache;
     rcfwdp<Variable> m_vstd;
 
+    // This is a pool of buffers for arguments, evaluation stacks and local
+    // references, so function calls need not allocate memory.
+    array<cow_vector<Reference>, 30> m_rbufs;
+    size_t m_nrbufs = 0;
+
+    // These are statistics of inline caches for member access.
+    uint64_t m_ic_hits = 0;
+    uint64_t m_ic_misses = 0;
+
   public:
     explicit
     Global_Context(API_Version version = api_version_latest)
@@ -40,11 +52,6 @@ class Global_Context
     const noexcept final
       { return this->get_parent_opt();  }
 
-    Reference*
-    do_lazy_lookup_opt(const phsh_string& /*name*/)
-    override
-      { return nullptr;  }
-
   public:
     bool
     is_analytic()
@@ -104,12 +111,78 @@ class Global_Context
     const noexcept
       { return unerase_cast<Loader_Lock>(this->m_ldrlk);  }
 
+    ASTERIA_INCOMPLET(Module_Cache)
+    rcptr<Module_Cache>
+    module_cache()
+    const noexcept
+      { return unerase_cast<Module_Cache>(this->m_mcache);  }
+
+    ASTERIA_INCOMPLET(Regex_Cache)
+    rcptr<Regex_Cache>
+    regex_cache()
+    const noexcept
+      { return unerase_cast<Regex_Cache>(this->m_rcache);  }
+
     ASTERIA_INCOMPLET(Variable)
     rcptr<Variable>
     std_variable()
     const noexcept
       { return unerase_cast<Variable>(this->m_vstd);  }
 
+    // Get an empty buffer for references from the pool, which may have some
+    // capacity reserved.
+    cow_vector<Reference>
+    allocate_reference_buffer()
+    noexcept
+      {
+        if(this->m_nrbufs == 0)
+          return { };
+
+        this->m_nrbufs -= 1;
+        return ::std::move(this->m_rbufs[this->m_nrbufs]);
+      }
+
+    // Clear a buffer and return it to the pool. Empty and large buffers are not retained.
+    // If the buffer is not accepted, it is left intact.
+    Global_Context&
+    recycle_reference_buffer(cow_vector<Reference>&& refs)
+    noexcept
+      {
+        if((this->m_nrbufs == this->m_rbufs.size()) || !refs.unique())
+          return *this;
+
+        if((refs.capacity() == 0) || (refs.capacity() > 256))
+          return *this;
+
+        refs.clear();
+        this->m_rbufs[this->m_nrbufs] = ::std::move(refs);
+        this->m_nrbufs += 1;
+        return *this;
+      }
+
+    // These help profiling inline caches for member access. Lookups are only counted
+    // in debug builds.
+    uint64_t
+    get_inline_cache_hits()
+    const noexcept
+      { return this->m_ic_hits;  }
+
+    uint64_t
+    get_inline_cache_misses()
+    const noexcept
+      { return this->m_ic_misses;  }
+
+    Global_Context&
+    record_inline_cache_lookup(bool hit)
+    noexcept
+      {
+        if(hit)
+          this->m_ic_hits += 1;
+        else
+          this->m_ic_misses += 1;
+        return *this;
+      }
+
     // Get the maximum API version that is supported when this library is built.
     // N.B. This function must not be inlined for this reason.
     API_Version
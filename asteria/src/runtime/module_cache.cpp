@@ -0,0 +1,104 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "module_cache.hpp"
+#include "../utilities.hpp"
+#include <sys/stat.h>  // ::fstat()
+
+namespace asteria {
+
+Module_Cache::
+~Module_Cache()
+  {
+  }
+
+Module_Cache::File_Stamp
+Module_Cache::
+stamp_file(::std::FILE* fp, const cow_string& path)
+  {
+    struct ::stat info;
+    if(::fstat(::fileno(fp), &info))
+      ASTERIA_THROW("Could not get information about script file '$2'\n"
+                    "[`fstat()` failed: $1]",
+                    noadl::format_errno(errno), path);
+
+    File_Stamp stamp;
+    stamp.dev = static_cast<uint64_t>(info.st_dev);
+    stamp.ino = static_cast<uint64_t>(info.st_ino);
+    stamp.size = static_cast<int64_t>(info.st_size);
+    stamp.mtime_ns = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000 + info.st_mtim.tv_nsec;
+    return stamp;
+  }
+
+void
+Module_Cache::
+do_evict_until(size_t max_size)
+  {
+    // Evict the least recently used elements until the limit is satisfied.
+    while(this->m_elems.size() > max_size) {
+      auto qlru = this->m_elems.begin();
+      for(auto q = qlru;  q != this->m_elems.end();  ++q)
+        if(q->second.last_use < qlru->second.last_use)
+          qlru = q;
+      this->m_elems.erase(qlru);
+    }
+  }
+
+Module_Cache&
+Module_Cache::
+set_max_size(size_t max_size)
+  {
+    this->do_evict_until(max_size);
+    this->m_max_size = max_size;
+    return *this;
+  }
+
+opt<cow_function>
+Module_Cache::
+find_opt(const cow_string& path, const File_Stamp& stamp, const Compiler_Options& opts)
+  {
+    auto q = this->m_elems.find_mut(path);
+    if(q == this->m_elems.end())
+      return nullopt;
+
+    // Check whether the file has been modified or replaced since the module was compiled.
+    auto& elem = q->second;
+    static_assert(::std::is_trivially_copyable<Compiler_Options>::value);
+    if((elem.stamp.dev != stamp.dev) || (elem.stamp.ino != stamp.ino) || (elem.stamp.size != stamp.size) ||
+       (elem.stamp.mtime_ns != stamp.mtime_ns)) {
+      this->m_elems.erase(q);
+      return nullopt;
+    }
+    if(::std::memcmp(&(elem.opts), &opts, sizeof(opts)) != 0)
+      return nullopt;
+
+    elem.last_use = ++(this->m_clock);
+    return elem.target;
+  }
+
+Module_Cache&
+Module_Cache::
+insert(const cow_string& path, const File_Stamp& stamp, const Compiler_Options& opts,
+       const cow_function& target)
+  {
+    if(this->m_max_size == 0)
+      return *this;
+
+    // Make room for the new element.
+    if(!this->m_elems.count(path))
+      this->do_evict_until(this->m_max_size - 1);
+
+    Element elem = { stamp, opts, target, ++(this->m_clock) };
+    this->m_elems.insert_or_assign(path, ::std::move(elem));
+    return *this;
+  }
+
+bool
+Module_Cache::
+invalidate(const cow_string& path)
+  {
+    return this->m_elems.erase(path);
+  }
+
+}  // namespace asteria
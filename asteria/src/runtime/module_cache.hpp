@@ -0,0 +1,104 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_RUNTIME_MODULE_CACHE_HPP_
+#define ASTERIA_RUNTIME_MODULE_CACHE_HPP_
+
+#include "../fwd.hpp"
+
+namespace asteria {
+
+class Module_Cache
+final
+  : public Rcfwd<Module_Cache>
+  {
+  public:
+    // This identifies a particular version of a file.
+    struct File_Stamp
+      {
+        uint64_t dev;
+        uint64_t ino;
+        int64_t size;
+        int64_t mtime_ns;
+      };
+
+  private:
+    struct Element
+      {
+        File_Stamp stamp;
+        Compiler_Options opts;
+        cow_function target;
+        uint64_t last_use;
+      };
+
+    // Elements are keyed by real paths. Only one version of each file is retained.
+    cow_dictionary<Element> m_elems;
+    size_t m_max_size = 256;
+    uint64_t m_clock = 0;
+
+  public:
+    Module_Cache()
+    noexcept
+      = default;
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Module_Cache);
+
+  private:
+    void
+    do_evict_until(size_t max_size);
+
+  public:
+    // Get the stamp of a file that has been opened for reading. The stamp is taken
+    // from the stream rather than the path, so it always matches what is read.
+    // `path` is only used in error messages.
+    static
+    File_Stamp
+    stamp_file(::std::FILE* fp, const cow_string& path);
+
+    bool
+    empty()
+    const noexcept
+      { return this->m_elems.empty();  }
+
+    size_t
+    size()
+    const noexcept
+      { return this->m_elems.size();  }
+
+    // If the number of cached modules exceeds this limit, the least recently used
+    // ones are evicted. A limit of zero disables caching.
+    size_t
+    get_max_size()
+    const noexcept
+      { return this->m_max_size;  }
+
+    Module_Cache&
+    set_max_size(size_t max_size);
+
+    // Look for a module that was compiled from this version of the file with the
+    // same options. Stale elements are removed.
+    opt<cow_function>
+    find_opt(const cow_string& path, const File_Stamp& stamp, const Compiler_Options& opts);
+
+    // Add a module, replacing any existing one for the same file.
+    Module_Cache&
+    insert(const cow_string& path, const File_Stamp& stamp, const Compiler_Options& opts,
+           const cow_function& target);
+
+    // Remove the module for a file, so it will be compiled again upon the next `import`.
+    // The return value indicates whether a module has been removed.
+    bool
+    invalidate(const cow_string& path);
+
+    Module_Cache&
+    clear()
+    noexcept
+      {
+        this->m_elems.clear();
+        return *this;
+      }
+  };
+
+}  // namespace asteria
+
+#endif
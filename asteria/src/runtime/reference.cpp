@@ -56,6 +56,7 @@ do_unpack_tail_calls(Reference& self, Global_Context& global)
 
         // Perform a non-tail call.
         tca->get_target().invoke_ptc_aware(self, global, ::std::move(args));
+        global.recycle_reference_buffer(::std::move(args));
       }
 
       // Check for deferred expressions.
@@ -0,0 +1,70 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.hpp"
+#include "regex_cache.hpp"
+#include "../utilities.hpp"
+
+namespace asteria {
+
+Regex_Cache::
+~Regex_Cache()
+  {
+  }
+
+void
+Regex_Cache::
+do_evict_until(size_t max_size)
+  {
+    // Evict the least recently used elements until the limit is satisfied.
+    while(this->m_elems.size() > max_size) {
+      auto qlru = this->m_elems.begin();
+      for(auto q = qlru;  q != this->m_elems.end();  ++q)
+        if(q->second.last_use < qlru->second.last_use)
+          qlru = q;
+      this->m_elems.erase(qlru);
+    }
+  }
+
+Regex_Cache&
+Regex_Cache::
+set_max_size(size_t max_size)
+  {
+    this->do_evict_until(max_size);
+    this->m_max_size = max_size;
+    return *this;
+  }
+
+V_opaque
+Regex_Cache::
+find_opt(const cow_string& pattern)
+  {
+    auto q = this->m_elems.find_mut(pattern);
+    if(q == this->m_elems.end()) {
+      this->m_misses += 1;
+      return nullptr;
+    }
+
+    auto& elem = q->second;
+    elem.last_use = ++(this->m_clock);
+    this->m_hits += 1;
+    return elem.regex;
+  }
+
+Regex_Cache&
+Regex_Cache::
+insert(const cow_string& pattern, const V_opaque& regex)
+  {
+    if(this->m_max_size == 0)
+      return *this;
+
+    // Make room for the new element.
+    if(!this->m_elems.count(pattern))
+      this->do_evict_until(this->m_max_size - 1);
+
+    Element elem = { regex, ++(this->m_clock) };
+    this->m_elems.insert_or_assign(pattern, ::std::move(elem));
+    return *this;
+  }
+
+}  // namespace asteria
@@ -0,0 +1,94 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_RUNTIME_REGEX_CACHE_HPP_
+#define ASTERIA_RUNTIME_REGEX_CACHE_HPP_
+
+#include "../fwd.hpp"
+
+namespace asteria {
+
+class Regex_Cache
+final
+  : public Rcfwd<Regex_Cache>
+  {
+  private:
+    struct Element
+      {
+        V_opaque regex;
+        uint64_t last_use;
+      };
+
+    // Elements are keyed by pattern texts. The compiled form of a pattern is opaque
+    // to this class; it is created and interpreted by the string library.
+    cow_dictionary<Element> m_elems;
+    size_t m_max_size = 64;
+    uint64_t m_clock = 0;
+
+    // These are statistics of lookups.
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+
+  public:
+    Regex_Cache()
+    noexcept
+      = default;
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Regex_Cache);
+
+  private:
+    void
+    do_evict_until(size_t max_size);
+
+  public:
+    bool
+    empty()
+    const noexcept
+      { return this->m_elems.empty();  }
+
+    size_t
+    size()
+    const noexcept
+      { return this->m_elems.size();  }
+
+    // If the number of cached patterns exceeds this limit, the least recently used
+    // ones are evicted. A limit of zero disables caching.
+    size_t
+    get_max_size()
+    const noexcept
+      { return this->m_max_size;  }
+
+    Regex_Cache&
+    set_max_size(size_t max_size);
+
+    uint64_t
+    get_hits()
+    const noexcept
+      { return this->m_hits;  }
+
+    uint64_t
+    get_misses()
+    const noexcept
+      { return this->m_misses;  }
+
+    // Look for a pattern that has been compiled. If it is not found, a null pointer
+    // is returned. Either way the lookup is counted.
+    V_opaque
+    find_opt(const cow_string& pattern);
+
+    // Add a compiled pattern, replacing any existing one with the same text.
+    Regex_Cache&
+    insert(const cow_string& pattern, const V_opaque& regex);
+
+    Regex_Cache&
+    clear()
+    noexcept
+      {
+        this->m_elems.clear();
+        return *this;
+      }
+  };
+
+}  // namespace asteria
+
+#endif
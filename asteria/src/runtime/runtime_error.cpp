@@ -40,11 +40,9 @@ do_backtrace()
 void
 Runtime_Error::
 do_compose_message()
-  {
-    // Reuse the storage if any.
+const noexcept
+  try {
     ::rocket::tinyfmt_str fmt;
-    fmt.set_string(::std::move(this->m_what));
-    fmt.clear_string();
 
     // Write the value. Strings are written as is. ALl other values are prettified.
     fmt << "asteria runtime error: ";
@@ -64,5 +62,9 @@ do_compose_message()
     // Set the string.
     this->m_what = fmt.extract_string();
   }
+  catch(::std::exception& /*stdex*/) {
+    // This function is called by `what()` which must not throw exceptions.
+    this->m_what = ::rocket::sref("asteria runtime error: <message unavailable>");
+  }
 
 }  // namespace asteria
@@ -23,7 +23,9 @@ class Runtime_Error
     cow_vector<Backtrace_Frame> m_frames;
     size_t m_ipos = 0;  // where to insert new frames
 
-    cow_string m_what;  // a comprehensive string that is human-readable.
+    // This is a comprehensive string that is human-readable. It is composed on demand, because
+    // frames are pushed once for each level of the stack during unwinding.
+    mutable cow_string m_what;
 
   public:
     Runtime_Error(F_native, const exception& stdex)
@@ -50,7 +52,8 @@ class Runtime_Error
     do_backtrace();
 
     void
-    do_compose_message();
+    do_compose_message()
+    const noexcept;
 
     template<typename... ParamsT>
     void
@@ -61,15 +64,19 @@ class Runtime_Error
         this->m_frames.insert(ipos, Backtrace_Frame(::std::forward<ParamsT>(params)...));
         this->m_ipos = ipos + 1;
 
-        // Rebuild the message using new frames.
-        this->do_compose_message();
+        // Invalidate the message.
+        this->m_what.clear();
       }
 
   public:
     const char*
     what()
     const noexcept override
-      { return this->m_what.c_str();  }
+      {
+        if(this->m_what.empty())
+          this->do_compose_message();
+        return this->m_what.c_str();
+      }
 
     const Value&
     value()
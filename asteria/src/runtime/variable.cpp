@@ -6,10 +6,63 @@
 #include "../utilities.hpp"
 
 namespace asteria {
+namespace {
+
+// The slab allocator is never destroyed, as variables may be deallocated during
+// program termination, after static objects have been destroyed.
+union Slab_Storage
+  {
+    Variable_Slab slab;
+
+    constexpr
+    Slab_Storage()
+    noexcept
+      : slab()
+      { }
+
+    ~Slab_Storage()
+      { }
+  }
+s_slab_storage;
+
+thread_local Variable_Slab::Cache s_cache(s_slab_storage.slab);
+
+}  // namespace
 
 Variable::
 ~Variable()
   {
+    // Collectors own references to variables on their lists.
+    ROCKET_ASSERT(!this->m_gc.coll);
+    ROCKET_ASSERT(!this->m_gc.mark);
+  }
+
+void*
+Variable::
+operator new(size_t size)
+  {
+    ROCKET_ASSERT(size == sizeof(Variable));
+    return s_cache.allocate();
+  }
+
+void
+Variable::
+operator delete(void* ptr)
+noexcept
+  {
+    if(ptr)
+      s_cache.deallocate(ptr);
+  }
+
+Variable_Slab::Stats
+Variable::
+get_slab_stats()
+noexcept
+  {
+    // Return blocks that are cached by the calling thread, so the result is exact if there
+    // is only one thread.
+    s_cache.flush();
+    return s_slab_storage.slab.get_stats();
   }
 
 Variable_Callback&
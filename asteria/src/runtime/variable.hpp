@@ -6,6 +6,8 @@
 
 #include "../fwd.hpp"
 #include "../value.hpp"
+#include "../llds/variable_slab.hpp"
+#include "../../rocket/atomic.hpp"
 
 namespace asteria {
 
@@ -13,17 +15,36 @@ class Variable
 final
   : public Rcfwd<Variable>
   {
+  public:
+    // These are intrusive links that are maintained by collectors. A variable may be tracked
+    // by at most one collector, which owns a reference to it. While a collection is in
+    // progress, a variable may also be on a list of staged variables, which owns another
+    // reference, and on a stack of variables to mark. See 'collector.cpp'.
+    struct GC_Links
+      {
+        Collector* coll = nullptr;  // the collector that tracks this variable
+        Variable* next = nullptr;   // the next variable tracked by `coll`
+        Variable* prev = nullptr;   // the previous variable tracked by `coll`
+        Variable* stage = nullptr;  // the next variable on a staging list
+        Variable* work = nullptr;   // the next variable on a mark stack
+        uint8_t mark = 0;           // which of the lists above this variable is on
+      };
+
   private:
     Value m_value;
     bool m_immut = false;
     bool m_alive = false;
+    bool m_local = false;  // untracked; see `Genius_Collector::create_local_variable()`
 
-    // These are reference counters for garbage collection and are uninitialized by default.
+    // These are reference counters for garbage collection.
     // As values are reference-counting, reference counts can be fractional. For example,
     // if three variablesshare a single instance of a function, then each of them is supposed
     // to have 1/3 of the object.
-    long m_gcref_i;
-    double m_gcref_f;
+    // They are atomic because parallel collection may update them from multiple threads.
+    // Relaxed loads and stores compile to plain moves, so the serial path is unaffected.
+    ::rocket::atomic_relaxed<long> m_gcref_i;
+    ::rocket::atomic_relaxed<double> m_gcref_f;
+    GC_Links m_gc;
 
   public:
     Variable()
@@ -32,6 +53,21 @@ final
 
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Variable);
 
+    // Variables are allocated from a global slab allocator.
+    static
+    void*
+    operator new(size_t size);
+
+    static
+    void
+    operator delete(void* ptr)
+    noexcept;
+
+    static
+    Variable_Slab::Stats
+    get_slab_stats()
+    noexcept;
+
   public:
     const Value&
     get_value()
@@ -52,6 +88,16 @@ final
     noexcept
       { return this->m_immut = immutable, *this;  }
 
+    bool
+    is_local()
+    const noexcept
+      { return this->m_local;  }
+
+    Variable&
+    set_local(bool local)
+    noexcept
+      { return this->m_local = local, *this;  }
+
     bool
     is_initialized()
     const noexcept
@@ -85,14 +131,14 @@ final
     long
     get_gcref()
     const noexcept
-      { return this->m_gcref_i;  }
+      { return this->m_gcref_i.load();  }
 
     Variable&
     reset_gcref(long iref)
     noexcept
       {
-        this->m_gcref_i = iref;
-        this->m_gcref_f = 0x1p-26;
+        this->m_gcref_i.store(iref);
+        this->m_gcref_f.store(0x1p-26);
         return *this;
       }
 
@@ -103,17 +149,69 @@ final
         // Optimize for the non-split case.
         if(split > 1) {
           // Update the fractional part.
-          this->m_gcref_f += 1 / static_cast<double>(split);
-          if(static_cast<long>(this->m_gcref_f) == 0) {
+          double fnew = this->m_gcref_f.load() + 1 / static_cast<double>(split);
+          if(static_cast<long>(fnew) == 0) {
+            this->m_gcref_f.store(fnew);
             return *this;
           }
           // Accumulate the carry bit.
-          this->m_gcref_f -= 1;
+          this->m_gcref_f.store(fnew - 1);
+        }
+        this->m_gcref_i.store(this->m_gcref_i.load() + 1);
+        return *this;
+      }
+
+    // These are used by parallel collection, where a counter may be updated by multiple
+    // threads at the same time.
+    Variable&
+    increment_gcref_atomic(long split)
+    noexcept
+      {
+        if(split > 1) {
+          // Update the fractional part, and accumulate the carry bit if any.
+          double fcur = this->m_gcref_f.load();
+          double fnew;
+          do {
+            fnew = fcur + 1 / static_cast<double>(split);
+            if(static_cast<long>(fnew) != 0)
+              fnew -= 1;
+          }
+          while(!this->m_gcref_f.compare_exchange(fcur, fnew));
+          if(fnew >= fcur)
+            return *this;
         }
-        this->m_gcref_i += 1;
+        this->m_gcref_i.fetch_add(1);
         return *this;
       }
 
+    long
+    get_gcref_atomic()
+    const noexcept
+      { return this->m_gcref_i.load();  }
+
+    // Sets the counter to -1 if it equals `iref`. Returns whether it has been set.
+    bool
+    mark_gcref_atomic(long iref)
+    noexcept
+      {
+        // `compare_exchange()` may fail spuriously, so retry as long as `iref` is unchanged.
+        long cmp = iref;
+        while(!this->m_gcref_i.compare_exchange(cmp, -1))
+          if(cmp != iref)
+            return false;
+        return true;
+      }
+
+    const GC_Links&
+    get_gc_links()
+    const noexcept
+      { return this->m_gc;  }
+
+    GC_Links&
+    open_gc_links()
+    noexcept
+      { return this->m_gc;  }
+
     Variable_Callback&
     enumerate_variables(Variable_Callback& callback)
     const;
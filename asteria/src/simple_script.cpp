@@ -6,10 +6,26 @@
 #include "compiler/token_stream.hpp"
 #include "compiler/statement_sequence.hpp"
 #include "runtime/air_optimizer.hpp"
+#include "runtime/bytecode.hpp"
 #include "utilities.hpp"
+#include <sys/mman.h>  // ::mmap()
+#include <sys/stat.h>  // ::fstat()
+#include <fcntl.h>  // ::open()
+#include <unistd.h>  // ::pread()
 
 namespace asteria {
 
+void
+Simple_Script::
+do_retain_code(const cow_vector<AIR_Node>& code)
+  {
+    this->m_code_retained = this->m_retain_code;
+    if(this->m_retain_code)
+      this->m_code = code;
+    else
+      this->m_code.clear();
+  }
+
 Simple_Script&
 Simple_Script::
 reload(tinybuf& cbuf, const cow_string& name)
@@ -29,6 +45,8 @@ reload(tinybuf& cbuf, const cow_string& name)
     // Instantiate the function.
     AIR_Optimizer optmz(this->m_opts);
     optmz.reload(nullptr, this->m_params, stmtq);
+    this->m_name = name;
+    this->do_retain_code(optmz);
     this->m_func = optmz.create_function(Source_Location(name, 0, 0),
                                          ::rocket::sref("<file scope>"));
     return *this;
@@ -57,6 +75,23 @@ reload_file(const char* path)
     // Open the file denoted by this path.
     ::rocket::tinybuf_file cbuf;
     cbuf.open(abspath, tinybuf::open_read);
+
+    // Precompiled scripts are recognized by their signatures. As they are mapped into
+    // memory, only regular files are checked. `pread()` doesn't move the file offset,
+    // so other streams, such as pipes, are not affected.
+    int fd = ::fileno(cbuf.get_handle());
+    struct ::stat info;
+    if(::fstat(fd, &info))
+      ASTERIA_THROW("Could not get information about script file '$2'\n"
+                    "[`fstat()` failed: $1]",
+                    noadl::format_errno(errno), abspath);
+
+    if(S_ISREG(info.st_mode)) {
+      char sig[sizeof(bytecode_signature)];
+      auto nsig = ::pread(fd, sig, sizeof(sig), 0);
+      if((nsig > 0) && Bytecode_Reader::has_signature(sig, static_cast<size_t>(nsig)))
+        return this->do_reload_bytecode_fd(fd, abspath);
+    }
     return this->reload(cbuf, cow_string(abspath));
   }
 
@@ -70,6 +105,111 @@ reload_stdin()
     return this->reload(cbuf, ::rocket::sref("<stdin>"));
   }
 
+Simple_Script&
+Simple_Script::
+reload_bytecode(const void* data, size_t size)
+  {
+    if(ROCKET_UNEXPECT(this->m_params.empty()))
+      this->m_params.emplace_back(::rocket::sref("..."));
+
+    // Decode the header, followed by the function body.
+    Bytecode_Reader reader(data, size);
+    reader.get_header();
+    auto opts = reader.get_options();
+    auto name = reader.get_string().rdstr();
+    auto code = AIR_Node::deserialize_function_code(reader, nullptr, this->m_params);
+    if(!reader.at_end())
+      ASTERIA_THROW("Trailing garbage after bytecode");
+
+    // Instantiate the function. Code has been optimized before it was saved.
+    AIR_Optimizer optmz(opts);
+    optmz.rebind(nullptr, this->m_params, code);
+    this->m_opts = opts;
+    this->m_name = ::std::move(name);
+    this->do_retain_code(code);
+    this->m_func = optmz.create_function(Source_Location(this->m_name, 0, 0),
+                                         ::rocket::sref("<file scope>"));
+    return *this;
+  }
+
+Simple_Script&
+Simple_Script::
+do_reload_bytecode_fd(int fd, const char* path)
+  {
+    struct ::stat info;
+    if(::fstat(fd, &info))
+      ASTERIA_THROW("Could not get information about bytecode file '$2'\n"
+                    "[`fstat()` failed: $1]",
+                    noadl::format_errno(errno), path);
+
+    // Map the file into memory, which is unmapped when this function returns.
+    auto size = static_cast<size_t>(info.st_size);
+    if(size == 0)
+      return this->reload_bytecode(nullptr, 0);
+
+    void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(addr == MAP_FAILED)
+      ASTERIA_THROW("Could not map bytecode file '$2'\n"
+                    "[`mmap()` failed: $1]",
+                    noadl::format_errno(errno), path);
+
+    const auto unmap = [&] { ::munmap(addr, size);  };
+    try {
+      this->reload_bytecode(addr, size);
+    }
+    catch(...) {
+      unmap();
+      throw;
+    }
+    unmap();
+    return *this;
+  }
+
+Simple_Script&
+Simple_Script::
+reload_bytecode_file(const char* path)
+  {
+    ::rocket::unique_posix_fd fd(::open(path, O_RDONLY | O_CLOEXEC), ::close);
+    if(!fd)
+      ASTERIA_THROW("Could not open bytecode file '$2'\n"
+                    "[`open()` failed: $1]",
+                    noadl::format_errno(errno), path);
+
+    return this->do_reload_bytecode_fd(fd, path);
+  }
+
+const Simple_Script&
+Simple_Script::
+save_bytecode(tinybuf& obuf)
+const
+  {
+    if(!this->m_func)
+      ASTERIA_THROW("No script loaded");
+
+    if(!this->m_code_retained)
+      ASTERIA_THROW("Code of script '$1' was not retained for saving", this->m_name);
+
+    // Encode the header, followed by the function body.
+    Bytecode_Writer writer(obuf);
+    writer.put_header();
+    writer.put_options(this->m_opts);
+    writer.put_string(this->m_name);
+    AIR_Node::serialize_code(writer, this->m_code);
+    return *this;
+  }
+
+const Simple_Script&
+Simple_Script::
+save_bytecode_file(const char* path)
+const
+  {
+    ::rocket::tinybuf_file obuf;
+    obuf.open(path, tinybuf::open_write | tinybuf::open_create | tinybuf::open_truncate);
+    this->save_bytecode(obuf);
+    obuf.flush();
+    return *this;
+  }
+
 Reference
 Simple_Script::
 execute(Global_Context& global, cow_vector<Reference>&& args)
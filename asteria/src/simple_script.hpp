@@ -5,6 +5,7 @@
 #define ASTERIA_SIMPLE_SCRIPT_HPP_
 
 #include "fwd.hpp"
+#include "runtime/air_node.hpp"
 
 namespace asteria {
 
@@ -13,8 +14,14 @@ class Simple_Script
   private:
     Compiler_Options m_opts;  // static
     cow_vector<phsh_string> m_params;  // constant
+    cow_string m_name;
     cow_function m_func;  // note type erasure
 
+    // The AIR is only needed by `save_bytecode()`, so it is not kept by default.
+    bool m_retain_code = false;
+    bool m_code_retained = false;
+    cow_vector<AIR_Node> m_code;
+
   public:
     constexpr
     Simple_Script()
@@ -36,6 +43,13 @@ class Simple_Script
       : m_opts(opts)
       { this->reload(cbuf, name);  }
 
+  private:
+    void
+    do_retain_code(const cow_vector<AIR_Node>& code);
+
+    Simple_Script&
+    do_reload_bytecode_fd(int fd, const char* path);
+
   public:
     const Compiler_Options&
     get_options()
@@ -52,6 +66,17 @@ class Simple_Script
     noexcept
       { return this->m_opts = opts, *this;  }
 
+    // If this is set, scripts that are loaded later can be saved as bytecode.
+    bool
+    get_retain_code()
+    const noexcept
+      { return this->m_retain_code;  }
+
+    Simple_Script&
+    set_retain_code(bool retain)
+    noexcept
+      { return this->m_retain_code = retain, *this;  }
+
     explicit operator
     bool()
     const noexcept
@@ -60,7 +85,12 @@ class Simple_Script
     Simple_Script&
     clear()
     noexcept
-      { return this->m_func.reset(), *this;  }
+      {
+        this->m_func.reset();
+        this->m_code_retained = false;
+        this->m_code.clear();
+        return *this;
+      }
 
     operator
     const cow_function&()
@@ -80,6 +110,26 @@ class Simple_Script
     Simple_Script&
     reload_stdin();
 
+    // Load a script that has been precompiled by `save_bytecode()`. No lexing or
+    // parsing is performed. Options are replaced with those that the script was
+    // compiled with.
+    Simple_Script&
+    reload_bytecode(const void* data, size_t size);
+
+    // The file is mapped into memory and decoded in place.
+    Simple_Script&
+    reload_bytecode_file(const char* path);
+
+    // Save the script that has been loaded as bytecode. The script must have been
+    // loaded with `set_retain_code(true)`.
+    const Simple_Script&
+    save_bytecode(tinybuf& obuf)
+    const;
+
+    const Simple_Script&
+    save_bytecode_file(const char* path)
+    const;
+
     // Execute the script that has been loaded.
     Reference
     execute(Global_Context& global, cow_vector<Reference>&& args = { })
@@ -0,0 +1,86 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/runtime/argument_reader.hpp"
+
+using namespace asteria;
+
+namespace {
+
+V_string
+join(V_string text, optV_integer on)
+  {
+    text += on ? ":some" : ":none";
+    return text;
+  }
+
+}  // namespace
+
+int main()
+  {
+    cow_vector<Reference> args;
+    Reference_root::S_constant xref = { V_string(::rocket::sref("hello")) };
+    args.emplace_back(xref);
+    xref.val = V_integer(42);
+    args.emplace_back(xref);
+
+    Argument_Reader reader(::rocket::cref(args), ::rocket::sref("test"));
+    Argument_Reader::State state;
+    V_string text;
+    V_integer n;
+    V_real r;
+    optV_integer on;
+
+    // `(string, real)` matches, as integers are converted to reals.
+    ASTERIA_TEST_CHECK(reader.I().v(text).S(state).v(r).F());
+    ASTERIA_TEST_CHECK(text == "hello");
+    ASTERIA_TEST_CHECK(r == 42.0);
+
+    // Resume from `state`.
+    ASTERIA_TEST_CHECK(reader.L(state).o(on).F());
+    ASTERIA_TEST_CHECK(on.value_or(0) == 42);
+    ASTERIA_TEST_CHECK(!reader.L(state).v(n).v(n).F());
+    ASTERIA_TEST_CHECK(!reader.I().v(n).F());
+
+    // Unfinished overloads are not listed.
+    reader.I().v(text).v(n);
+    try {
+      reader.throw_no_matching_function_call();
+      ASTERIA_TEST_CHECK(false);
+    }
+    catch(exception& except) {
+      ::rocket::cow_string what(except.what());
+      ASTERIA_TEST_CHECK(what.find("`test(string, integer)`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("`test(string, real)`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("`test(string, [integer])`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("`test(string, integer, integer)`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("`test(integer)`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("<truncated>") == what.npos);
+    }
+
+    // Typed overloads are described by the signatures of functions.
+    Reference self = Reference_root::S_void();
+    ASTERIA_TEST_CHECK(reader.C(self, join));
+    ASTERIA_TEST_CHECK(self.read().as_string() == "hello:some");
+    xref.val = V_null();
+    args.mut(1) = xref;
+    ASTERIA_TEST_CHECK(reader.C(self, join));
+    ASTERIA_TEST_CHECK(self.read().as_string() == "hello:none");
+    xref.val = V_real(1.5);
+    args.mut(1) = xref;
+    ASTERIA_TEST_CHECK(!reader.C(self, join));
+
+    // Overloads that do not fit in the buffer are reported as omitted.
+    for(int k = 0;  k < 100;  ++k)
+      reader.I().v(n).v(n).F();
+    try {
+      reader.throw_no_matching_function_call();
+      ASTERIA_TEST_CHECK(false);
+    }
+    catch(exception& except) {
+      ::rocket::cow_string what(except.what());
+      ASTERIA_TEST_CHECK(what.find("`test(string, [integer])`") != what.npos);
+      ASTERIA_TEST_CHECK(what.find("(some overloads have been omitted)") != what.npos);
+    }
+  }
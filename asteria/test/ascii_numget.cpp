@@ -0,0 +1,112 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../rocket/ascii_numget.hpp"
+#include <random>
+
+using namespace asteria;
+
+namespace {
+
+double
+do_parse(::rocket::ascii_numget& numg, const char* str)
+  {
+    const char* bp = str;
+    double value = -1;
+    numg.get(value, bp, bp + ::std::strlen(str));
+    return value;
+  }
+
+void
+do_check_parse(const char* str)
+  {
+    // The result shall equal that of the C library, bit by bit.
+    for(bool single : { false, true }) {
+      ::rocket::ascii_numget numg;
+      const char* bp = str;
+      const char* ep = bp + ::std::strlen(str);
+      double value;
+      if(!numg.parse_F(bp, ep) || (bp != ep))
+        ASTERIA_TERMINATE("`$1` could not be parsed", str);
+      numg.cast_F(value, -HUGE_VAL, HUGE_VAL, single);
+
+      bool match;
+      if(single) {
+        float fvalue = static_cast<float>(value);
+        float fcheck = ::std::strtof(str, nullptr);
+        match = ::std::memcmp(&fvalue, &fcheck, sizeof(float)) == 0;
+      }
+      else {
+        double check = ::std::strtod(str, nullptr);
+        match = ::std::memcmp(&value, &check, sizeof(double)) == 0;
+      }
+      if(!match)
+        ASTERIA_TERMINATE("`$1` was not parsed correctly (single = $2)", str, single);
+    }
+  }
+
+}  // namespace
+
+int main()
+  {
+    ::rocket::ascii_numget numg;
+    ASTERIA_TEST_CHECK(do_parse(numg, "1.0e23") == 1.0e23);
+    ASTERIA_TEST_CHECK(do_parse(numg, "-0.1") == -0.1);
+    ASTERIA_TEST_CHECK(do_parse(numg, "0x1.8p1") == 3);
+    ASTERIA_TEST_CHECK(do_parse(numg, "12345678901234567890123") == 1.2345678901234568e22);
+    ASTERIA_TEST_CHECK(do_parse(numg, "1e-400") == 0);
+    ASTERIA_TEST_CHECK(numg.underflowed());
+    ASTERIA_TEST_CHECK(do_parse(numg, "1e+400") == HUGE_VAL);
+    ASTERIA_TEST_CHECK(numg.overflowed());
+
+    // Check numbers that are tricky to round.
+    do_check_parse("9007199254740993");
+    do_check_parse("9007199254740992.5000000000000000001");
+    do_check_parse("2.2250738585072011e-308");
+    do_check_parse("2.4703282292062327e-324");
+    do_check_parse("2.4703282292062328e-324");
+    do_check_parse("1.7976931348623158e308");
+    do_check_parse("1.7976931348623159e308");
+    do_check_parse("3.4028235677973366e38");
+    do_check_parse("7.006492321624085354618e-46");
+    do_check_parse("123456789012345678901234567890e-20");
+
+    // Check halfway points of adjacent values, and their neighbors, whose significant
+    // figures are truncated after 19 digits.
+    ::std::mt19937_64 prng(42);
+#ifdef __OPTIMIZE__
+    constexpr long nloop = 1000000;
+#else
+    constexpr long nloop = 100000;
+#endif
+    char str[1024];
+    for(long k = 0;  k < nloop;  ++k) {
+      uint64_t bits = prng();
+      double value;
+      ::std::memcpy(&value, &bits, sizeof(value));
+      if(!::std::isfinite(value))
+        continue;
+
+      ::std::snprintf(str, sizeof(str), "%.17g", value);
+      do_check_parse(str);
+      ::std::snprintf(str, sizeof(str), "%.*g", static_cast<int>(bits % 24 + 1), value);
+      do_check_parse(str);
+
+      double next = ::std::nextafter(value, HUGE_VAL);
+      if(::std::isfinite(next) && (k % 16 == 0)) {
+        long double half = (static_cast<long double>(value) + next) / 2;
+        ::std::snprintf(str, sizeof(str), "%.800Lg", half);
+        do_check_parse(str);
+        ::std::snprintf(str, sizeof(str), "%.25Lg", half);
+        do_check_parse(str);
+      }
+    }
+
+    // Check long strings of digits.
+    ::std::strcpy(str, "0.");
+    for(long k = 2;  k < 1000;  ++k)
+      str[k] = static_cast<char>('0' + prng() % 10);
+    str[1000] = 0;
+    do_check_parse(str);
+  }
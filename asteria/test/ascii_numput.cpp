@@ -0,0 +1,120 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../rocket/ascii_numput.hpp"
+#include <random>
+
+using namespace asteria;
+
+namespace {
+
+int
+do_count_digits(const char* str)
+  {
+    // Count significant digits before the exponent, if any.
+    int ndigits = 0;
+    int nzeroes = 0;
+    for(auto p = str;  *p && (*p != 'e');  ++p) {
+      if((*p < '0') || (*p > '9'))
+        continue;
+      if((*p == '0') && (ndigits == 0))
+        continue;
+      // Trailing zeroes of integers are not significant.
+      nzeroes = (*p == '0') ? (nzeroes + 1) : 0;
+      ndigits++;
+    }
+    return ndigits - nzeroes;
+  }
+
+void
+do_check_shortest(double value, bool single)
+  {
+    ::rocket::ascii_numput nump;
+    if(single)
+      nump.put_DF(value, true);
+    else
+      nump.put_DF(value);
+
+    // The result shall convert back to `value` exactly.
+    bool match = single ? (::std::strtof(nump.data(), nullptr) == static_cast<float>(value))
+                        : (::std::strtod(nump.data(), nullptr) == value);
+    if(!match)
+      ASTERIA_TERMINATE("`$1` does not round-trip (single = $2)", nump.data(), single);
+
+    // No number with fewer digits converts back to `value`.
+    int ndigits = do_count_digits(nump.data());
+    if(ndigits <= 1)
+      return;
+
+    char temp[64];
+    ::std::snprintf(temp, sizeof(temp), "%.*e", ndigits - 2, value);
+    match = single ? (::std::strtof(temp, nullptr) == static_cast<float>(value))
+                   : (::std::strtod(temp, nullptr) == value);
+    if(match)
+      ASTERIA_TERMINATE("`$1` is not the shortest, as `$2` also round-trips (single = $3)",
+                        nump.data(), temp, single);
+  }
+
+}  // namespace
+
+int main()
+  {
+    ::rocket::ascii_numput nump;
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(0.1).data(), "0.1") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(-123.75).data(), "-123.75") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(1.0 / 3).data(), "0.3333333333333333") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(0x1p-1074).data(), "5e-324") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(DBL_MAX).data(), "1.7976931348623157e+308") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(1.0e16).data(), "10000000000000000") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(1.0e17).data(), "1e+17") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(0.0001).data(), "0.0001") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(0.00001).data(), "1e-05") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DE(0.1).data(), "1e-01") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DE(-250.5).data(), "-2.505e+02") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(static_cast<double>(0.1f), true).data(), "0.1") == 0);
+    ASTERIA_TEST_CHECK(::std::strcmp(nump.put_DF(static_cast<double>(FLT_MAX), true).data(), "3.4028235e+38") == 0);
+
+    // Check boundaries, where the lower neighbor is closer than the upper one.
+    for(int e = -1074;  e <= 1023;  ++e) {
+      double value = ::std::ldexp(1.0, e);
+      do_check_shortest(value, false);
+      do_check_shortest(::std::nextafter(value, 0.0), false);
+      do_check_shortest(::std::nextafter(value, HUGE_VAL), false);
+    }
+    for(int e = -149;  e <= 127;  ++e) {
+      float value = ::std::ldexp(1.0f, e);
+      do_check_shortest(static_cast<double>(value), true);
+      do_check_shortest(static_cast<double>(::std::nextafter(value, 0.0f)), true);
+      do_check_shortest(static_cast<double>(::std::nextafter(value, HUGE_VALF)), true);
+    }
+
+    // Check powers of ten and their neighbors.
+    for(int e = -323;  e <= 308;  ++e) {
+      double value = ::std::pow(10.0, e);
+      do_check_shortest(value, false);
+      do_check_shortest(::std::nextafter(value, 0.0), false);
+      do_check_shortest(::std::nextafter(value, HUGE_VAL), false);
+    }
+
+    // Check random bit patterns.
+    ::std::mt19937_64 prng(42);
+#ifdef __OPTIMIZE__
+    constexpr long nloop = 2000000;
+#else
+    constexpr long nloop = 200000;
+#endif
+    for(long k = 0;  k < nloop;  ++k) {
+      uint64_t bits = prng();
+      double value;
+      ::std::memcpy(&value, &bits, sizeof(value));
+      if(::std::isfinite(value) && (value != 0))
+        do_check_shortest(value, false);
+
+      uint32_t fbits = static_cast<uint32_t>(bits >> 32);
+      float fvalue;
+      ::std::memcpy(&fvalue, &fbits, sizeof(fvalue));
+      if(::std::isfinite(fvalue) && (fvalue != 0))
+        do_check_shortest(static_cast<double>(fvalue), true);
+    }
+  }
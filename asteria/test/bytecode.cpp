@@ -0,0 +1,143 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/air_node.hpp"
+#include "../src/runtime/bytecode.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const table = [ 1, 2.5, "three", null, true, { four: 4 } ];
+        var [ a, b ] = table;
+        var { four } = table[5];
+
+        func fib(n) {
+          return n <= 1 ? n : fib(n - 1) + fib(n - 2);
+        }
+
+        func make_counter() {
+          var n = 0;
+          return func() { return ++n;  };
+        }
+        var counter = make_counter();
+        counter();
+
+        var sum = 0;
+        for(each k, v : table)
+          switch(typeof v) {
+            case "integer":
+              sum += v;
+              break;
+            case "real":
+              sum += 10;
+              continue;
+            default:
+              sum += 100;
+          }
+
+        var i = 0;
+        do
+          i += 1;
+        while(i < 5);
+
+        var caught;
+        try {
+          defer i++;
+          throw "oops";
+        }
+        catch(e)
+          caught = e;
+
+        assert table[2] == "three";
+        return [ a, b, four, fib(10), counter(), sum, i, caught, __file, table[7] ?? "x" ];
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"), tinybuf::open_read);
+
+    Global_Context global;
+    Simple_Script code;
+    code.set_retain_code(true);
+    code.reload(cbuf, ::rocket::sref("my_script"));
+    auto expected = code.execute(global).read();
+
+    // Save the script, then load it back.
+    ::rocket::tinybuf_str obuf;
+    code.save_bytecode(obuf);
+    auto bytes = obuf.get_string();
+    ASTERIA_TEST_CHECK(bytes.size() > 8);
+
+    // Code is not retained by default, so it cannot be saved again.
+    Simple_Script loaded;
+    loaded.reload_bytecode(bytes.data(), bytes.size());
+    ::rocket::tinybuf_str obuf2;
+    ASTERIA_TEST_CHECK_CATCH(loaded.save_bytecode(obuf2));
+
+    loaded.set_retain_code(true);
+    loaded.reload_bytecode(bytes.data(), bytes.size());
+    auto result = loaded.execute(global).read();
+    ASTERIA_TEST_CHECK(result.compare(expected) == compare_equal);
+    ASTERIA_TEST_CHECK(result.as_array().at(3).as_integer() == 55);
+    ASTERIA_TEST_CHECK(result.as_array().at(8).as_string() == "my_script");
+
+    // Saving the loaded script yields the same bytes.
+    loaded.save_bytecode(obuf2);
+    ASTERIA_TEST_CHECK(obuf2.get_string() == bytes);
+
+    // Corrupted bytecode is rejected.
+    ASTERIA_TEST_CHECK_CATCH(loaded.reload_bytecode(bytes.data(), bytes.size() - 1));
+    ASTERIA_TEST_CHECK_CATCH(loaded.reload_bytecode(bytes.data() + 1, bytes.size() - 1));
+
+    // Local references are checked against enclosing scopes. The outermost function has
+    // three slots for `__varg`, `__this` and `__func`.
+    auto make_reference = [&](uint32_t depth, uint32_t slot) {
+      ::rocket::tinybuf_str tbuf;
+      Bytecode_Writer writer(tbuf);
+      writer.put_header();
+      writer.put_options(Compiler_Options());
+      writer.put_string(::rocket::sref("crafted"));
+      AIR_Node::S_push_local_reference xnode = { Source_Location(::rocket::sref("crafted"), 1, 1),
+                                                 depth, slot, ::rocket::sref("x") };
+      AIR_Node::serialize_code(writer, cow_vector<AIR_Node>(1, ::std::move(xnode)));
+      return tbuf.get_string();
+    };
+    bytes = make_reference(0, 2);
+    loaded.reload_bytecode(bytes.data(), bytes.size());
+    bytes = make_reference(0, 3);
+    ASTERIA_TEST_CHECK_CATCH(loaded.reload_bytecode(bytes.data(), bytes.size()));
+    bytes = make_reference(1, 0);
+    ASTERIA_TEST_CHECK_CATCH(loaded.reload_bytecode(bytes.data(), bytes.size()));
+
+    // Option flags are normalized, so any non-zero byte reads as `true`.
+    ::rocket::tinybuf_str tbuf;
+    Bytecode_Writer writer(tbuf);
+    writer.put_options(Compiler_Options());
+    bytes = tbuf.get_string();
+    bytes.mut(2) = '\x02';
+    Bytecode_Reader reader(bytes.data(), bytes.size());
+    auto opts = reader.get_options();
+    ASTERIA_TEST_CHECK(opts.escapable_single_quotes == true);
+    ASTERIA_TEST_CHECK(reader.at_end());
+
+    // Deeply nested values are rejected instead of overflowing the stack.
+    auto make_nested = [&](size_t depth) {
+      cow_string str;
+      str.reserve(depth * 2 + 1);
+      for(size_t k = 0;  k < depth;  ++k)
+        str.push_back(static_cast<char>(vtype_array)).push_back('\x01');
+      str.push_back(static_cast<char>(vtype_null));
+      return str;
+    };
+    bytes = make_nested(bytecode_max_value_depth);
+    Bytecode_Reader(bytes.data(), bytes.size()).get_value();
+    bytes = make_nested(100000);
+    ASTERIA_TEST_CHECK_CATCH(Bytecode_Reader(bytes.data(), bytes.size()).get_value());
+  }
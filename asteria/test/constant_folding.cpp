@@ -0,0 +1,131 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/air_optimizer.hpp"
+#include "../src/compiler/token_stream.hpp"
+#include "../src/compiler/statement_sequence.hpp"
+
+using namespace asteria;
+
+namespace {
+
+cow_vector<AIR_Node>
+do_generate(const char* source, int8_t level)
+  {
+    Compiler_Options opts;
+    opts.optimization_level = level;
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(source), tinybuf::open_read);
+    Token_Stream tstrm(opts);
+    tstrm.reload(cbuf, ::rocket::sref(__FILE__));
+    Statement_Sequence stmtq(opts);
+    stmtq.reload(tstrm);
+
+    AIR_Optimizer optmz(opts);
+    optmz.reload(nullptr, cow_vector<phsh_string>(), stmtq);
+    return optmz;
+  }
+
+bool
+do_match(const cow_vector<AIR_Node>& code, ::std::initializer_list<AIR_Node::Index> indices)
+  {
+    return ::std::equal(code.begin(), code.end(), indices.begin(), indices.end(),
+                        [](const AIR_Node& node, AIR_Node::Index index) { return node.index() == index;  });
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Check the code that is generated. Nodes are matched by type.
+    using N = AIR_Node;
+    auto nodes = do_generate("return 1 + 2 * 3;", 0);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_push_immediate,
+                                         N::index_push_immediate, N::index_push_immediate,
+                                         N::index_apply_operator, N::index_apply_operator,
+                                         N::index_glvalue_to_prvalue, N::index_return_statement }));
+    nodes = do_generate("return 1 + 2 * 3;", 1);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_push_immediate,
+                                         N::index_return_statement }));
+
+    // Constant arrays are folded.
+    nodes = do_generate("var a = [ 1, 2, -3 ];", 1);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_declare_variable,
+                                         N::index_push_immediate, N::index_initialize_variable }));
+
+    // Conversions of local references remain, to be fused when solidified.
+    nodes = do_generate("var x = 1; return x;", 1);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_declare_variable,
+                                         N::index_push_immediate, N::index_initialize_variable,
+                                         N::index_clear_stack, N::index_push_local_reference,
+                                         N::index_glvalue_to_prvalue, N::index_return_statement }));
+
+    // Branches with constant conditions are pruned at level 2 only.
+    nodes = do_generate("if(false) { var e = 1 / 0; } return 1;", 1);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_push_immediate,
+                                         N::index_if_statement, N::index_clear_stack,
+                                         N::index_push_immediate, N::index_return_statement }));
+    nodes = do_generate("if(false) { var e = 1 / 0; } return 1;", 2);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_clear_stack,
+                                         N::index_push_immediate, N::index_return_statement }));
+
+    // Nodes after `return` are removed.
+    nodes = do_generate("return 1; return 2;", 1);
+    ASTERIA_TEST_CHECK(do_match(nodes, { N::index_clear_stack, N::index_push_immediate,
+                                         N::index_return_statement }));
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        assert 1 + 2 * 3 == 7;
+        assert typeof (1 + 2.5) == "real";
+        assert countof ("abc" + "de") == 5;
+        assert __fma(2, 3, 4) == 10;
+        assert ("ab" * 3) == "ababab";
+
+        var a = [ 1, 2, -3 ];
+        a[0] = 10;  // `a` must be a copy, not the folded constant.
+        assert a[0] == 10;
+        assert a[2] == -3;
+
+        var o = { x: 1, y: "z" + "w" };
+        o.x += 1;
+        assert o.x == 2;
+        assert o.y == "zw";
+
+        // Errors in unreachable code must not be raised.
+        if(false)
+          var e = 1 / 0;
+        assert (true ? 42 : 1 / 0) == 42;
+        assert (false && 1 / 0) == false;
+        assert (null ?? 5) == 5;
+        assert (6 ?? 1 / 0) == 6;
+
+        // Errors in reachable code must be raised at runtime.
+        try {
+          var e = 1 / 0;
+          assert false;
+        }
+        catch(e)
+          assert std.string.find(e, "divided by zero") != null;
+
+        // Nodes after `return` are unreachable.
+        func f() {
+          return 1;
+          assert false;
+        }
+        assert f() == 1;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"), tinybuf::open_read);
+
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    Global_Context global;
+    code.execute(global);
+  }
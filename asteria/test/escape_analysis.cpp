@@ -0,0 +1,81 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/genius_collector.hpp"
+#include "../src/runtime/variable.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Global_Context global;
+    auto gcoll = global.genius_collector();
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+        // Local variables that do not escape are not tracked.
+        var before = std.system.gc_count_variables(0);
+        for(var i = 0;  i < 5000;  ++i) {
+          var x = i, y;
+          const z = [ x, y ];
+          assert z[0] == i;
+        }
+        assert std.system.gc_count_variables(0) == before;
+
+        // Variables that are captured by closures escape.
+        var fs = [];
+        for(var i = 0;  i < 10;  ++i) {
+          var x = i;
+          fs[$] = func() { return x;  };
+        }
+        for(var i = 0;  i < 10;  ++i)
+          assert fs[i]() == i;
+
+        // Variables that are passed by reference escape.
+        func inc(r) { ++r;  }
+        func id(r) { return& r;  }
+        var g;
+        {
+          var x = 1;
+          inc(&x);
+          assert x == 2;
+          g = func() { return& id(&x);  };
+        }
+        g() = 5;
+        assert g() == 5;
+
+        // `this` may refer to a local variable.
+        {
+          var o = { n: 0, inc: func() { ++this.n;  return& this;  } };
+          o.inc().inc();
+          assert o.n == 2;
+        }
+
+        // Reference cycles through captured variables are collected.
+        var keep = [];
+        for(var i = 0;  i < 5000;  ++i) {
+          var o = { n: i };
+          o.get = func() { return o.n;  };
+          if(i % 1000 == 0)
+            keep[$] = o;
+        }
+        for(var i = 0;  i < 5;  ++i)
+          assert keep[i].get() == i * 1000;
+
+        std.system.gc_collect();
+        return std.system.gc_count_variables(0) + std.system.gc_count_variables(1) +
+               std.system.gc_count_variables(2);
+      )__"), tinybuf::open_read);
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    auto nvars = code.execute(global).read().as_integer();
+    ASTERIA_TEST_CHECK(nvars < 500);
+
+    // Nothing shall have been leaked.
+    gcoll->collect_variables();
+    gcoll->clear_pool();
+    ASTERIA_TEST_CHECK(Variable::get_slab_stats().nlive < 500);
+  }
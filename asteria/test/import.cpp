@@ -4,6 +4,7 @@
 #include "utilities.hpp"
 #include "../src/simple_script.hpp"
 #include "../src/runtime/global_context.hpp"
+#include "../src/runtime/module_cache.hpp"
 
 using namespace asteria;
 
@@ -21,6 +22,16 @@ int main()
         try { import("import_recursive.txt");  assert false;  }
           catch(e) { assert std.string.find(e, "Recursive import") != null;  }
 
+        // Compiled modules are cached, but not after the file has been modified.
+        assert import("import_add.txt", 1, 2) == 3;
+        var path = std.string.format("/tmp/asteria_import_$1.txt", std.numeric.random());
+        std.filesystem.file_write(path, "return 1;");
+        assert import(path) == 1;
+        assert import(path) == 1;
+        std.filesystem.file_write(path, "return 42;");
+        assert import(path) == 42;
+        std.filesystem.file_remove(path);
+
       )__"), tinybuf::open_read);
 
     static const ::rocket::unique_ptr<char, void (&)(void*)> abspath(::realpath(__FILE__, nullptr), ::free);
@@ -28,4 +39,8 @@ int main()
     Simple_Script code(cbuf, ::rocket::sref(abspath.get()));
     Global_Context global;
     code.execute(global);
+    ASTERIA_TEST_CHECK(global.module_cache()->size() == 3);
+
+    global.module_cache()->set_max_size(0);
+    ASTERIA_TEST_CHECK(global.module_cache()->empty());
   }
@@ -0,0 +1,67 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/genius_collector.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Global_Context global;
+    auto gcoll = global.genius_collector();
+    gcoll->set_step_budget(50);
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+        // Move references around between steps. Variables that are still reachable
+        // must survive.
+        var holder;
+        for(var i = 0;  i < 2000;  ++i) {
+          var x = i;
+          var g = func() { return x;  };
+          std.system.gc_step(3);
+          holder = g;
+          std.system.gc_step(3);
+          assert holder() == i;
+        }
+
+        // Drop references that have been counted in a previous step. `x` must survive.
+        var x = 42;
+        for(var k = 1;  k < 200;  ++k) {
+          var ys = [];
+          for(var j = 0;  j < 100;  ++j)
+            ys[$] = func() { return x;  };
+          std.system.gc_step(k);
+          ys = null;
+          while(!std.system.gc_step(k));
+          assert x == 42;
+        }
+
+        // Create reference cycles, which are collected in small steps as variables are
+        // created.
+        var keep = [];
+        for(var i = 0;  i < 10000;  ++i) {
+          var f, n = i;
+          f = func() { return [ f, n ];  };
+          if(i % 100 == 0)
+            keep[$] = f;
+        }
+        while(!std.system.gc_step(100));
+
+        for(each k, f : keep) {
+          var r = f();
+          assert typeof r[0] == "function";
+          assert r[1] == k * 100;
+        }
+
+        return std.system.gc_count_variables(0) + std.system.gc_count_variables(1) +
+               std.system.gc_count_variables(2);
+      )__"), tinybuf::open_read);
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    auto nvars = code.execute(global).read().as_integer();
+    ASTERIA_TEST_CHECK(nvars < 1000);
+  }
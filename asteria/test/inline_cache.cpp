@@ -0,0 +1,70 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        func get_x(o) {
+          return o.x;
+        }
+
+        var o = { x: 1, y: 2, z: 3 };
+        var sum = 0;
+        for(var i = 0;  i < 100;  ++i)
+          sum += get_x(o);
+        assert sum == 100;
+
+        // Different objects may share the same call site.
+        assert get_x({ x: "a" }) == "a";
+        assert get_x({ w: 1, x: 2.5 }) == 2.5;
+        assert get_x({ }) == null;
+        assert get_x(null) == null;
+
+        // Erasing and inserting members may relocate them.
+        unset o.y;
+        assert get_x(o) == 1;
+        unset o.x;
+        assert get_x(o) == null;
+        for(var i = 0;  i < 50;  ++i)
+          o[std.string.format("k$1", i)] = i;
+        o.x = "moved";
+        assert get_x(o) == "moved";
+        assert -o.k7 == -7;
+        assert typeof o.z == "integer";
+
+        // Writes still go through references.
+        o.z += 1;
+        assert o.z == 4;
+        ++o.z;
+        assert o.z == 5;
+
+        try {
+          get_x(42);
+          assert false;
+        }
+        catch(e)
+          assert std.string.find(e, "non-object") != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"), tinybuf::open_read);
+
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    Global_Context global;
+    code.execute(global);
+
+#ifdef ROCKET_DEBUG
+    // The loop above should have hit the cache most of the time.
+    ASTERIA_TEST_CHECK(global.get_inline_cache_hits() >= 90);
+    ASTERIA_TEST_CHECK(global.get_inline_cache_misses() >= 1);
+#endif
+  }
@@ -0,0 +1,96 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/value.hpp"
+#include "../rocket/unique_posix_file.hpp"
+#include <unistd.h>  // ::dup2()
+
+using namespace asteria;
+
+int main()
+  {
+    // Redirect standard input and output to temporary files.
+    ::rocket::unique_posix_file fin(::tmpfile(), ::fclose);
+    ::rocket::unique_posix_file fout(::tmpfile(), ::fclose);
+    ASTERIA_TEST_CHECK(fin && fout);
+    ::fputs("hello\n"
+            "caf\xC3\xA9 au lait, s'il vous pla\xC3\xAEt\n"
+            "\n", fin);
+    for(size_t k = 0;  k < 100000;  ++k)
+      ::fputc('x', fin);
+    ::fputs("\n"
+            "bad\xFF\n"
+            "\xE4\xB8\xAD\xE6\x96\x87\xF0\x9F\x98\x80 no terminating LF", fin);
+    ::fflush(fin);
+    ASTERIA_TEST_CHECK(::dup2(::fileno(fin), STDIN_FILENO) == STDIN_FILENO);
+    ASTERIA_TEST_CHECK(::dup2(::fileno(fout), STDOUT_FILENO) == STDOUT_FILENO);
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        assert std.io.getc() == 0x68;  // h
+        assert std.io.getln() == "ello";
+        assert std.io.getln() == "café au lait, s'il vous plaît";
+        assert std.io.getln() == "";
+        assert countof std.io.getln() == 100000;
+        try {
+          std.io.getln();
+          assert false;
+        }
+        catch(e) {
+          assert std.string.find(e, "Error reading standard input") != null;
+        }
+        assert std.io.getc() == 0x4E2D;
+        assert std.io.getc() == 0x6587;
+        assert std.io.getc() == 0x1F600;
+        assert std.io.getln() == " no terminating LF";
+        assert std.io.getln() == null;
+        assert std.io.getc() == null;
+
+        assert std.io.putc(0x4E2D) == 1;
+        assert std.io.putc("文\n") == 2;
+        assert std.io.putln("café au lait, s'il vous plaît") == 30;
+        assert std.io.putf("$1 $2\n", "π", 42) == 5;
+        assert std.io.write("bytes\n") == 6;
+
+        try {
+          std.io.putln("valid\xFFinvalid");
+          assert false;
+        }
+        catch(e) {
+          assert std.string.find(e, "byte offset `5`") != null;
+        }
+
+        try {
+          std.io.putc(0xD800);
+          assert false;
+        }
+        catch(e) {
+          assert std.string.find(e, "Invalid UTF code point") != null;
+        }
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"), tinybuf::open_read);
+
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    Global_Context global;
+    code.execute(global);
+
+    // Check what has been written. Characters before the invalid sequence are written.
+    char temp[256];
+    ::rewind(fout);
+    size_t ntotal = ::fread(temp, 1, sizeof(temp), fout);
+    static constexpr char expected[] =
+        "\xE4\xB8\xAD\xE6\x96\x87\n"
+        "caf\xC3\xA9 au lait, s'il vous pla\xC3\xAEt\n"
+        "\xCF\x80 42\n"
+        "bytes\n"
+        "valid";
+    ASTERIA_TEST_CHECK(ntotal == sizeof(expected) - 1);
+    ASTERIA_TEST_CHECK(::std::memcmp(temp, expected, ntotal) == 0);
+  }
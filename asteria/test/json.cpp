@@ -105,6 +105,20 @@ int main()
         assert countof r[1].c == 0;
         assert r[1].d == 4;
 
+        assert std.json.parse("-Infinity") == -infinity;
+        assert std.json.parse("0x1p4") == 16;
+        assert std.json.parse("1`000") == 1000;
+        assert std.json.parse("[1, /* two\n */ 2, // three\n 3,]") == [1,2,3];
+        assert std.json.parse("'a\\tb\\x41'") == "a\tbA";
+        assert std.json.parse("\"0123456789abcdef0123456789abcdef喵\"") == "0123456789abcdef0123456789abcdef喵";
+        assert std.json.parse("{if:1}").if == 1;
+        try { std.json.parse("[1,\n 2 3]");  assert false;  }
+          catch(e) { assert std.string.find(e, "line 2, offset 3") != null;  }
+        try { std.json.parse("\"abc");  assert false;  }
+          catch(e) { assert std.string.find(e, "Assertion failure") == null;  }
+        try { std.json.parse("nulll");  assert false;  }
+          catch(e) { assert std.string.find(e, "Assertion failure") == null;  }
+
         const depth = 1000;
         var r = [];
         for(var i = 1; i < depth; ++i) {
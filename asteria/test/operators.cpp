@@ -270,6 +270,31 @@ int main()
         assert -10 >> 1 == -5;
         assert 'abc' >> 1 == 'ab';
 
+        var t = s;
+        t += 'bc';
+        assert t == 'abc';
+        assert s == 'a';
+        var u = t;
+        t += t;
+        assert t == 'abcabc';
+        assert u == 'abc';
+        t <<<= 2;
+        assert t == 'cabc  ';
+        t >>>= 1;
+        assert t == ' cabc ';
+        t <<= 2;
+        assert t == ' cabc   ';
+        t >>= 4;
+        assert t == ' cab';
+        t *= 3;
+        assert t == ' cab cab cab';
+        t *= 0;
+        assert t == '';
+        assert u == 'abc';
+        u = 2;
+        u *= 'xy';
+        assert u == 'xyxy';
+
         assert false < true;
         assert 1 < 2;
         assert 1.0 < 2.0;
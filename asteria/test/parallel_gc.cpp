@@ -0,0 +1,52 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+#include "../src/runtime/genius_collector.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Global_Context global;
+    auto gcoll = global.genius_collector();
+    gcoll->set_parallelism(4);
+    ASTERIA_TEST_CHECK(gcoll->get_parallelism() == 4);
+
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+        // Let garbage accumulate, so the collection is large enough to run in parallel.
+        std.system.gc_set_threshold(0, 10000000);
+        std.system.gc_set_threshold(1, 10000000);
+        std.system.gc_set_threshold(2, 10000000);
+
+        var keep = [];
+        for(var i = 0;  i < 100000;  ++i) {
+          var o = { n: i };
+          o.get = func() { return o.n;  };
+          if(i % 100 == 0)
+            keep[$] = o;
+        }
+        assert std.system.gc_count_variables(0) >= 100000;
+
+        std.system.gc_collect();
+        for(var i = 0;  i < 1000;  ++i)
+          assert keep[i].get() == i * 100;
+
+        return std.system.gc_count_variables(0) + std.system.gc_count_variables(1) +
+               std.system.gc_count_variables(2);
+      )__"), tinybuf::open_read);
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    auto nvars = code.execute(global).read().as_integer();
+    ASTERIA_TEST_CHECK(nvars < 5000);
+
+    // Workers are stopped and started again.
+    gcoll->set_parallelism(2);
+    ASTERIA_TEST_CHECK(gcoll->get_parallelism() == 2);
+    code.execute(global);
+    gcoll->set_parallelism(1);
+    ASTERIA_TEST_CHECK(gcoll->get_parallelism() == 1);
+  }
@@ -0,0 +1,181 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/llds/regex_automaton.hpp"
+#include <regex>
+#include <random>
+
+using namespace asteria;
+
+namespace {
+
+using Submatch = Regex_Automaton::Submatch;
+
+void
+do_compare(const cow_string& pattern, const char* what, const cow_string& subject, bool found,
+           const Submatch* subs, size_t nsubs, bool check, const ::std::cmatch& matches)
+  {
+    bool same = found == check;
+    for(size_t i = 0;  same && found && (i != nsubs);  ++i)
+      if(matches[i].matched)
+        same = (subs[i].first == matches[i].first) && (subs[i].second == matches[i].second);
+      else
+        same = !subs[i].first && !subs[i].second;
+
+    if(!same)
+      ASTERIA_TERMINATE("`$1` did not behave like `std::regex` for `$2` with subject `$3`",
+                        what, pattern, subject);
+  }
+
+void
+do_check(const cow_string& pattern, const cow_vector<cow_string>& subjects)
+  {
+    // The result shall equal that of `std::regex`. Invalid patterns shall be rejected.
+    ::std::regex regex;
+    bool valid = true;
+    try {
+      regex.assign(pattern.data(), pattern.size());
+    }
+    catch(::std::regex_error& /*stdex*/) {
+      valid = false;
+    }
+
+    Regex_Automaton dfa;
+    if(!dfa.compile(pattern.data(), pattern.size()))
+      return;
+    if(!valid)
+      ASTERIA_TERMINATE("`$1` was accepted but `std::regex` rejected it", pattern);
+
+    using namespace ::std::regex_constants;
+    size_t nsubs = dfa.count_groups() + 1;
+    ASTERIA_TEST_CHECK(nsubs == regex.mark_count() + 1);
+    Submatch subs[64];
+    ::std::cmatch matches;
+
+    for(const auto& subject : subjects) {
+      const char* bp = subject.data();
+      const char* ep = bp + subject.size();
+
+      bool found = dfa.search(subs, nsubs, bp, ep, false);
+      bool check = ::std::regex_search(bp, ep, matches, regex);
+      do_compare(pattern, "search", subject, found, subs, nsubs, check, matches);
+
+      found = dfa.search(subs, 1, bp, ep, false);
+      do_compare(pattern, "search", subject, found, subs, 1, check, matches);
+
+      found = dfa.match(subs, nsubs, bp, ep);
+      check = ::std::regex_match(bp, ep, matches, regex);
+      do_compare(pattern, "match", subject, found, subs, nsubs, check, matches);
+
+      found = dfa.match(subs, 1, bp, ep);
+      do_compare(pattern, "match", subject, found, subs, 1, check, matches);
+
+      if(bp == ep)
+        continue;
+
+      found = dfa.search(subs, nsubs, bp + 1, ep, true);
+      check = ::std::regex_search(bp + 1, ep, matches, regex, match_prev_avail);
+      do_compare(pattern, "search", subject, found, subs, nsubs, check, matches);
+
+      found = dfa.search(subs, 1, bp + 1, ep, true);
+      do_compare(pattern, "search", subject, found, subs, 1, check, matches);
+
+      found = dfa.match_prefix(subs, nsubs, bp + 1, ep, true, true);
+      check = ::std::regex_search(bp + 1, ep, matches, regex, match_prev_avail | match_continuous |
+                                                             match_not_null);
+      do_compare(pattern, "match_prefix", subject, found, subs, nsubs, check, matches);
+    }
+  }
+
+cow_string
+do_random_atom(::std::mt19937& prng, int depth);
+
+cow_string
+do_random_pattern(::std::mt19937& prng, int depth)
+  {
+    cow_string pattern;
+    auto nterms = static_cast<uint32_t>(prng() % 4);
+    for(uint32_t k = 0;  k != nterms;  ++k) {
+      pattern += do_random_atom(prng, depth);
+
+      static constexpr const char* s_quants[] =
+        { "", "", "", "*", "+", "?", "*?", "+?", "??", "{2}", "{1,}", "{0,2}", "{1,3}?", "{,",
+          "{3,1}", "**" };
+      pattern += s_quants[prng() % ::rocket::countof(s_quants)];
+    }
+    if(prng() % 4 == 0)
+      pattern += "|" + do_random_pattern(prng, depth);
+    return pattern;
+  }
+
+cow_string
+do_random_atom(::std::mt19937& prng, int depth)
+  {
+    static constexpr const char* s_atoms[] =
+      { "a", "b", "ab", "ba", "1", "_", " ", "-", "\n", ".", "^", "$", "\\b", "\\B", "\\d",
+        "\\w", "\\W", "\\s", "\\S", "\\x61", "\\-", "\\n", "\\.", "\\1", "]", "}", "[ab]",
+        "[^a]", "[a-c]", "[^\\w]", "[\\d-]", "[-b]", "[a-]", "[:a]", "[[:alpha:]_]",
+        "[[:DIGIT:]]", "[[:punct:][:space:]]", "[b-a]", "[\\s-a]", "[]", "[^]", "[a--]",
+        "[\\b]", "(?=a)", "(", ")" };
+
+    if((depth < 3) && (prng() % 4 == 0)) {
+      static constexpr const char* s_opens[] = { "(", "(", "(?:" };
+      return s_opens[prng() % ::rocket::countof(s_opens)] + do_random_pattern(prng, depth + 1) + ")";
+    }
+    return ::rocket::sref(s_atoms[prng() % ::rocket::countof(s_atoms)]);
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Check the grammar.
+    Regex_Automaton dfa;
+    ASTERIA_TEST_CHECK(dfa.compile("a(b)(?:c(d))*", 13));
+    ASTERIA_TEST_CHECK(dfa.count_groups() == 2);
+    ASTERIA_TEST_CHECK(!dfa.compile("(a)\\1", 5));
+    ASTERIA_TEST_CHECK(!dfa.compile("a(?!b)", 6));
+    ASTERIA_TEST_CHECK(!dfa.compile("a{1001}", 7));
+    ASTERIA_TEST_CHECK(!dfa.compile("(a", 2));
+    ASTERIA_TEST_CHECK(!dfa.compile("a)", 2));
+
+    // Check submatches.
+    static constexpr char s_text[] = "2020-02-29 13:14:15";
+    Submatch subs[4];
+    ASTERIA_TEST_CHECK(dfa.compile("(\\d+):(\\d+):(\\d+)", 17));
+    ASTERIA_TEST_CHECK(dfa.search(subs, 4, s_text, s_text + 19, false));
+    ASTERIA_TEST_CHECK(subs[0].first == s_text + 11);
+    ASTERIA_TEST_CHECK(subs[0].second == s_text + 19);
+    ASTERIA_TEST_CHECK(subs[2].first == s_text + 14);
+    ASTERIA_TEST_CHECK(subs[2].second == s_text + 16);
+    ASTERIA_TEST_CHECK(!dfa.match(subs, 4, s_text, s_text + 19));
+
+    // Check long subjects, where `std::regex` might overflow the stack.
+    cow_string text(1000000, 'a');
+    text += 'b';
+    ASTERIA_TEST_CHECK(dfa.compile("(a|aa)*b", 8));
+    ASTERIA_TEST_CHECK(dfa.match(subs, 2, text.data(), text.data() + text.size()));
+    ASTERIA_TEST_CHECK(subs[1].first == text.data() + 999999);
+    ASTERIA_TEST_CHECK(dfa.compile("a*c", 3));
+    ASTERIA_TEST_CHECK(!dfa.search(subs, 1, text.data(), text.data() + text.size(), false));
+
+    // Compare random patterns with `std::regex`.
+    cow_vector<cow_string> subjects;
+    ::std::mt19937 prng(42);
+    for(long k = 0;  k < 100;  ++k) {
+      cow_string subject;
+      auto length = static_cast<uint32_t>(prng() % 12);
+      for(uint32_t i = 0;  i != length;  ++i)
+        subject += "aab1_ -\n"[prng() % 8];
+      subjects.emplace_back(::std::move(subject));
+    }
+
+#ifdef __OPTIMIZE__
+    constexpr long nloop = 20000;
+#else
+    constexpr long nloop = 2000;
+#endif
+    for(long k = 0;  k < nloop;  ++k)
+      do_check(do_random_pattern(prng, 0), subjects);
+  }
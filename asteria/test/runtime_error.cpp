@@ -0,0 +1,29 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/runtime/runtime_error.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    Runtime_Error except(Runtime_Error::F_throw(), V_string("meow"), Source_Location(::rocket::sref("file"), 1, 2));
+    except.push_frame_func(Source_Location(::rocket::sref("file"), 3, 4), ::rocket::sref("func()"));
+
+    // The message is composed on demand.
+    cow_string what = ::rocket::sref(except.what());
+    ASTERIA_TEST_CHECK(what.find("meow") != cow_string::npos);
+    ASTERIA_TEST_CHECK(what.find("#1 ") != cow_string::npos);
+    ASTERIA_TEST_CHECK(what.find("#2 ") == cow_string::npos);
+
+    // It is rebuilt after a new frame is pushed.
+    except.push_frame_plain(Source_Location(::rocket::sref("file"), 5, 6), ::rocket::sref("plain"));
+    what = ::rocket::sref(except.what());
+    ASTERIA_TEST_CHECK(what.find("#2 ") != cow_string::npos);
+    ASTERIA_TEST_CHECK(what.find("file:5:6") != cow_string::npos);
+
+    // Copies share the message.
+    auto copy = except;
+    ASTERIA_TEST_CHECK(::std::strcmp(copy.what(), except.what()) == 0);
+  }
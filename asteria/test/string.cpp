@@ -4,6 +4,7 @@
 #include "utilities.hpp"
 #include "../src/simple_script.hpp"
 #include "../src/runtime/global_context.hpp"
+#include "../src/runtime/regex_cache.hpp"
 
 using namespace asteria;
 
@@ -354,9 +355,48 @@ int main()
         assert std.string.regex_replace("a11b2c333d4e555", '\d{34}\w', '#') == "a11b2c333d4e555";
         assert std.string.regex_replace("a11b2c333d4e555", '(\w\d+)*', '$&$&') == "a11b2c333d4e555a11b2c333d4e555";
 
+        var r = std.string.regex_compile('(\d{3})(\w)');
+        assert typeof r == "opaque";
+        assert std.string.regex_find("a11b2c333d4e555", r) == [6,4];
+        assert std.string.regex_find("a11b2c333d4e555", 7, r) == null;
+        assert std.string.regex_match("333d", r) == [ "333d", "333", "d" ];
+        assert std.string.regex_match("a11b2c333d4e555", 6, 4, r) == [ "333d", "333", "d" ];
+        assert std.string.regex_replace("a11b2c333d4e555", r, '$2$1') == "a11b2cd3334e555";
+        assert std.string.regex_replace("a11b2c333d4e555", 0, 6, r, '#') == "a11b2c333d4e555";
+
+        try {
+          std.string.regex_compile('(a');
+          assert false;
+        }
+        catch(e) {
+          assert std.string.find(e, "Invalid regular expression") != null;
+        }
+        try {
+          std.string.regex_find("abc", std.checksum.crc32_new()["$h"]);
+          assert false;
+        }
+        catch(e) {
+          assert std.string.find(e, "Invalid dynamic cast") != null;
+        }
+
       )__"), tinybuf::open_read);
 
     Simple_Script code(cbuf, ::rocket::sref(__FILE__));
     Global_Context global;
     code.execute(global);
+
+    // Patterns that are used again are found in the cache.
+    auto rcache = global.regex_cache();
+    ASTERIA_TEST_CHECK(rcache->size() == 6);
+    auto hits = rcache->get_hits();
+    auto misses = rcache->get_misses();
+    code.execute(global);
+    ASTERIA_TEST_CHECK(rcache->get_hits() == hits + 12);
+    ASTERIA_TEST_CHECK(rcache->get_misses() == misses + 1);
+
+    // The least recently used patterns are evicted.
+    rcache->set_max_size(3);
+    ASTERIA_TEST_CHECK(rcache->size() == 3);
+    code.execute(global);
+    ASTERIA_TEST_CHECK(rcache->size() == 3);
   }
@@ -0,0 +1,136 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2020, LH_Mouse. All wrongs reserved.
+
+#include "utilities.hpp"
+#include "../src/simple_script.hpp"
+#include "../src/runtime/global_context.hpp"
+
+using namespace asteria;
+
+int main()
+  {
+    ::rocket::tinybuf_str cbuf;
+    cbuf.set_string(::rocket::sref(
+      R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        var n = 0;
+        for(var i = 0;  i < 100;  i += 1) {
+          if(i % 2 == 0)
+            n += i;
+          else
+            n -= 1;
+        }
+        assert n == 2400;
+
+        // Operands of other types take the generic path.
+        var r = 1.5;
+        r += 1;
+        assert r == 2.5;
+        var s = "ab";
+        s += "cd";
+        assert s == "abcd";
+        assert (s == 5) == false;
+        var a = [ 1, 2, 3 ];
+        a[1] = 5;
+        assert a[1] + 1 == 6;
+
+        // Non-assigning operators must not modify the variable.
+        var k = 10;
+        assert k - 3 == 7;
+        assert k == 10;
+
+        // Outer contexts are reachable.
+        {
+          {
+            k += 1;
+            if(k == 11)
+              k = 42;
+          }
+        }
+        assert k == 42;
+
+        // Errors must be raised as before.
+        var m = 0x7FFFFFFFFFFFFFFF;
+        try {
+          m += 1;
+          assert false;
+        }
+        catch(e)
+          assert std.string.find(e, "overflow") != null;
+        assert m == 0x7FFFFFFFFFFFFFFF;
+
+        const c = 1;
+        try {
+          c += 1;
+          assert false;
+        }
+        catch(e)
+          assert c == 1;
+
+        func f(x) {
+          switch(x) {
+            case 1:
+              var y = 5;
+            case 2:
+              return y + 1;
+            case 3:
+              return y;
+          }
+        }
+        assert f(1) == 6;
+        try {
+          f(2);
+          assert false;
+        }
+        catch(e)
+          assert std.string.find(e, "bypassed") != null;
+        try {
+          f(3);
+          assert false;
+        }
+        catch(e)
+          assert std.string.find(e, "bypassed") != null;
+
+        // Errors are reported at the local reference, not the operator.
+        var line;
+        func h() {
+          switch(1) {
+            case 0:
+              var w = 5;
+            case 1:
+              line = __line;  return w  // keep these on the same line!
+                                     + 1;
+          }
+        }
+        try {
+          h();
+          assert false;
+        }
+        catch(e) {
+          var lines = [ ];
+          for(each k, v : __backtrace)
+            lines[$] = v.line;
+          assert std.array.find(lines, line) != null;
+          assert std.array.find(lines, line + 1) == null;
+        }
+
+        // Values of local variables are copied when read.
+        var p = [ 1, 2 ];
+        var q = p;
+        q[0] = 5;
+        assert p[0] == 1;
+        assert q[0] == 5;
+        func g() {
+          var z = p;
+          return z;
+        }
+        assert g()[1] == 2;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"), tinybuf::open_read);
+
+    Simple_Script code(cbuf, ::rocket::sref(__FILE__));
+    Global_Context global;
+    code.execute(global);
+  }
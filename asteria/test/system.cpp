@@ -33,6 +33,55 @@ int main()
         assert std.system.execute('bash',
           [ '-c', 'test $VAR == yes' ], [ 'VAR=no' ]) != 0;
 
+        var p = std.system.gc_get_policy(0);
+        assert p.adaptive == true;
+        assert p.threshold >= p.threshold_min;
+        assert p.threshold <= p.threshold_max;
+        assert std.system.gc_get_policy(3) == null;
+
+        p = std.system.gc_set_policy(2, true, 50, 100);
+        assert p.threshold_min == 10;
+        var keep = [];
+        for(var i = 0;  i < 2000;  ++i) {
+          var v = i;
+          keep[$] = func() { return v;  };
+        }
+        std.system.gc_collect();
+        p = std.system.gc_get_policy(2);
+        assert p.threshold >= 50;
+        assert p.threshold <= 100;
+        assert p.decision != "none";
+        assert p.examined >= 2000;
+
+        p = std.system.gc_set_policy(0, true, null, null, null, 2);
+        assert p.parallelism == 1;
+        assert std.system.gc_get_policy(1).parallelism == 2;
+        std.system.gc_collect();
+        p = std.system.gc_set_policy(0, true, null, null, null, 0);
+        assert p.parallelism == 2;
+        assert std.system.gc_get_policy(0).parallelism == 1;
+
+        std.system.gc_set_threshold(0, 1000);
+        p = std.system.gc_get_policy(0);
+        assert p.adaptive == false;
+        assert p.threshold == 1000;
+
+        var s = std.system.gc_stats();
+        assert countof s.generations == 3;
+        assert countof s.pause_buckets == countof s.generations[0].pause_histogram;
+        assert s.pause_buckets[countof s.pause_buckets - 1] == infinity;
+        assert s.generations[2].collections >= 1;
+        assert s.generations[2].examined >= 2000;
+        assert s.generations[0].promoted + s.generations[1].promoted >= 2000;
+        var n = 0;
+        for(each k, c : s.generations[2].pause_histogram)
+          n += c;
+        assert n == s.generations[2].collections;
+        assert s.generations[2].pause_max <= s.generations[2].pause_total;
+        assert s.pool_hits + s.fresh_allocs >= 2000;
+        assert s.live_variables > 0;
+        assert s.bytes_mapped > 0;
+
       )__"), tinybuf::open_read);
 
     Simple_Script code(cbuf, ::rocket::sref(__FILE__));
@@ -21,4 +21,42 @@ int main()
 
     var->uninitialize();
     ASTERIA_TEST_CHECK(!var->is_initialized());
+
+    // Variables are allocated from slabs. The most recently freed block is reused first.
+    auto stats = Variable::get_slab_stats();
+    ASTERIA_TEST_CHECK(stats.nlive == 1);
+    ASTERIA_TEST_CHECK(stats.nslabs == 1);
+    auto addr = var.get();
+    var = ::rocket::make_refcnt<Variable>();
+    ASTERIA_TEST_CHECK(var.get() != addr);
+    auto other = ::rocket::make_refcnt<Variable>();
+    addr = other.get();
+    other.reset();
+    other = ::rocket::make_refcnt<Variable>();
+    ASTERIA_TEST_CHECK(other.get() == addr);
+
+    // Empty slabs are kept for reuse, up to a limit. Others are unmapped.
+    cow_vector<rcptr<Variable>> vars;
+    for(size_t k = 0;  k < Variable_Slab::slab_size / sizeof(Variable) * (Variable_Slab::spare_max + 3);  ++k)
+      vars.emplace_back(::rocket::make_refcnt<Variable>());
+    stats = Variable::get_slab_stats();
+    ASTERIA_TEST_CHECK(stats.nslabs > Variable_Slab::spare_max);
+    ASTERIA_TEST_CHECK(stats.nlive == vars.size() + 2);
+
+    vars.clear();
+    var.reset();
+    other.reset();
+    stats = Variable::get_slab_stats();
+    ASTERIA_TEST_CHECK(stats.nlive == 0);
+    ASTERIA_TEST_CHECK(stats.nslabs == Variable_Slab::spare_max);
+    ASTERIA_TEST_CHECK(stats.nbytes == Variable_Slab::slab_size * Variable_Slab::spare_max);
+    ASTERIA_TEST_CHECK(stats.nallocs == stats.nfrees);
+    ASTERIA_TEST_CHECK(stats.nslab_allocs == stats.nslab_frees + Variable_Slab::spare_max);
+
+    // Kept slabs are reused before new ones are mapped.
+    auto nslab_allocs = stats.nslab_allocs;
+    for(size_t k = 0;  k < Variable_Slab::slab_size / sizeof(Variable) * 3;  ++k)
+      vars.emplace_back(::rocket::make_refcnt<Variable>());
+    stats = Variable::get_slab_stats();
+    ASTERIA_TEST_CHECK(stats.nslab_allocs == nslab_allocs);
   }